@@ -61,6 +61,15 @@ struct SVertex
 	vec4 TexCoord;
 };
 
+// Compact copy of SVertex that animated meshes are skinned from, must match PackedVertex in Mesh.h
+struct SPackedVertex
+{
+	uint PositionXY;
+	uint PositionZPaintBits;
+	uint NormalTangent;
+	uint TexCoord;
+};
+
 struct SMeshlet
 {
 	uint VertCount;
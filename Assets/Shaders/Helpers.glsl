@@ -242,6 +242,23 @@ vec3 OctToDir(vec2 e)
 	return normalize(v);
 }
 
+/*
+* The position is stored as unorms within the given bounds, normal and tangent as 8 bit octahedral vectors. Only the
+* paint bits are restored of the w components
+*/
+SVertex UnpackVertex(SPackedVertex packedVertex, vec3 positionMin, vec3 positionExtent)
+{
+	vec3 position		= vec3(unpackUnorm2x16(packedVertex.PositionXY), unpackUnorm2x16(packedVertex.PositionZPaintBits).x);
+	vec4 octahedral		= unpackSnorm4x8(packedVertex.NormalTangent);
+
+	SVertex vertex;
+	vertex.Position		= vec4(positionMin + position * positionExtent, uintBitsToFloat(packedVertex.PositionZPaintBits >> 16));
+	vertex.Normal		= vec4(OctToDir(octahedral.xy), 0.0f);
+	vertex.Tangent		= vec4(OctToDir(octahedral.zw), 0.0f);
+	vertex.TexCoord		= vec4(unpackHalf2x16(packedVertex.TexCoord), 0.0f, 0.0f);
+	return vertex;
+}
+
 float PowerHeuristic(float nf, float fPDF, float ng, float gPDF)
 {
 	float f = nf * fPDF;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <type_traits>
+#include <concepts>
 
 #include "ECS/Component.h"
 
@@ -11,7 +12,25 @@
 
 #include "Multiplayer/Packet/Packet.h"
 #include "Networking/API/NetworkSegment.h"
+#include "Networking/API/BinaryEncoder.h"
+#include "Networking/API/BinaryDecoder.h"
 
+// Snapshot packets are sent as keyframes at least this often, so that a client that missed a baseline recovers
+#define SNAPSHOT_KEYFRAME_INTERVAL		32
+// A delta references a baseline at most 2^bits - 1 simulation ticks back, a distance of 0 marks a keyframe
+#define SNAPSHOT_BASELINE_DISTANCE_BITS	4
+
+/*
+* Describes the last snapshot written by WriteSegment
+*/
+struct SnapshotWriteInfo
+{
+	int32 SimulationTick	= -1;
+	// Tick of the baseline the snapshot was delta encoded against, -1 for keyframes
+	int32 BaselineTick		= -1;
+	// The snapshot carries an event, such as a fired projectile, and may not be skipped by interest management
+	bool RequiresDelivery	= false;
+};
 
 struct IPacketComponent
 {
@@ -25,10 +44,36 @@ private:
 	virtual void AddPacketReceivedEnd() = 0;
 	virtual void ClearPacketsReceived() = 0;
 	virtual bool WriteSegment(LambdaEngine::NetworkSegment* pSegment, int32 networkUID) = 0;
+	virtual bool ReadSnapshot(LambdaEngine::NetworkSegment* pSegment, void* pPacket) = 0;
+	virtual bool WriteSnapshotKeyframe(LambdaEngine::NetworkSegment* pSegment) = 0;
+	virtual const SnapshotWriteInfo& GetLastSnapshotWritten() const = 0;
+	virtual bool IsSnapshot() const = 0;
 	virtual uint16 GetPacketsToSendCount() = 0;
 	virtual uint16 GetPacketType() = 0;
 };
 
+/*
+* Baselines of a snapshot packet. The sender and every receiver keep the quantized state of the last packet for the entity.
+* Reliable segments arrive in order, so a receiver that got the previous snapshot has the baseline of the next delta.
+* Receivers that were skipped by interest management are sent the same snapshot as a keyframe instead
+*/
+template<typename T>
+struct PacketSnapshotState
+{
+};
+
+template<SnapshotPacket T>
+struct PacketSnapshotState<T>
+{
+	typename T::Snapshot SendBaseline;
+	typename T::Snapshot ReceiveBaseline;
+	int32 SendBaselineTick			= -1;
+	int32 ReceiveBaselineTick		= -1;
+	uint32 SnapshotsSinceKeyframe	= 0;
+	T LastWrittenPacket;
+	SnapshotWriteInfo LastWritten;
+};
+
 template<class T>
 struct PacketComponent : public IPacketComponent
 {
@@ -98,11 +143,160 @@ private:
 	{
 		T& packet = m_PacketsToSend.front();
 		packet.NetworkUID = networkUID;
-		bool result = pSegment->Write<T>(&packet);
+
+		bool result = false;
+		if constexpr (SnapshotPacket<T>)
+		{
+			result = WriteSnapshot(pSegment, packet);
+		}
+		else
+		{
+			result = pSegment->Write<T>(&packet);
+		}
+
 		m_PacketsToSend.pop();
 		return result;
 	}
 
+	/*
+	* Decodes a snapshot packet against the receive baseline
+	*	return - false if the segment is malformed or refers to a baseline this receiver does not have
+	*/
+	virtual bool ReadSnapshot(LambdaEngine::NetworkSegment* pSegment, void* pPacket) override final
+	{
+		using namespace LambdaEngine;
+
+		if constexpr (SnapshotPacket<T>)
+		{
+			BinaryDecoder decoder(pSegment);
+
+			int32 simulationTick;
+			int32 networkUID;
+			uint32 baselineDistance;
+			if (!decoder.ReadInt32(simulationTick) ||
+				!decoder.ReadInt32(networkUID) ||
+				!decoder.ReadBits(baselineDistance, SNAPSHOT_BASELINE_DISTANCE_BITS))
+			{
+				return false;
+			}
+
+			// Deltas that arrive before the first keyframe, e.g. right after joining, cannot be decoded and are dropped
+			const bool isKeyframe = baselineDistance == 0;
+			if (!isKeyframe && (m_SnapshotState.ReceiveBaselineTick < 0 || simulationTick - int32(baselineDistance) != m_SnapshotState.ReceiveBaselineTick))
+			{
+				return false;
+			}
+
+			T& packet = *static_cast<T*>(pPacket);
+			typename T::Snapshot snapshot;
+			if (!T::DecodeSnapshot(decoder, packet, isKeyframe ? nullptr : &m_SnapshotState.ReceiveBaseline, snapshot))
+			{
+				return false;
+			}
+
+			packet.SimulationTick	= simulationTick;
+			packet.NetworkUID		= networkUID;
+
+			m_SnapshotState.ReceiveBaseline		= snapshot;
+			m_SnapshotState.ReceiveBaselineTick	= simulationTick;
+			return true;
+		}
+		else
+		{
+			UNREFERENCED_VARIABLE(pSegment);
+			UNREFERENCED_VARIABLE(pPacket);
+			return false;
+		}
+	}
+
+	/*
+	* Writes the packet last written by WriteSegment again, as a keyframe for receivers that do not have its baseline
+	*/
+	virtual bool WriteSnapshotKeyframe(LambdaEngine::NetworkSegment* pSegment) override final
+	{
+		if constexpr (SnapshotPacket<T>)
+		{
+			typename T::Snapshot snapshot;
+			return EncodeSnapshot<typename T::Snapshot>(pSegment, m_SnapshotState.LastWrittenPacket, nullptr, 0, snapshot);
+		}
+		else
+		{
+			UNREFERENCED_VARIABLE(pSegment);
+			return false;
+		}
+	}
+
+	virtual const SnapshotWriteInfo& GetLastSnapshotWritten() const override final
+	{
+		if constexpr (SnapshotPacket<T>)
+		{
+			return m_SnapshotState.LastWritten;
+		}
+		else
+		{
+			static const SnapshotWriteInfo EMPTY_INFO;
+			return EMPTY_INFO;
+		}
+	}
+
+	virtual bool IsSnapshot() const override final
+	{
+		return SnapshotPacket<T>;
+	}
+
+	bool WriteSnapshot(LambdaEngine::NetworkSegment* pSegment, const T& packet)
+	{
+		constexpr int32 MAX_BASELINE_DISTANCE = (1 << SNAPSHOT_BASELINE_DISTANCE_BITS) - 1;
+
+		const int32 baselineDistance = packet.SimulationTick - m_SnapshotState.SendBaselineTick;
+		const bool isKeyframe =
+			m_SnapshotState.SendBaselineTick < 0 ||
+			baselineDistance <= 0 ||
+			baselineDistance > MAX_BASELINE_DISTANCE ||
+			m_SnapshotState.SnapshotsSinceKeyframe >= SNAPSHOT_KEYFRAME_INTERVAL;
+
+		typename T::Snapshot snapshot;
+		const bool result = isKeyframe ?
+			EncodeSnapshot<typename T::Snapshot>(pSegment, packet, nullptr, 0, snapshot) :
+			EncodeSnapshot(pSegment, packet, &m_SnapshotState.SendBaseline, uint32(baselineDistance), snapshot);
+
+		if (result)
+		{
+			SnapshotWriteInfo& info = m_SnapshotState.LastWritten;
+			info.SimulationTick		= packet.SimulationTick;
+			info.BaselineTick		= isKeyframe ? -1 : m_SnapshotState.SendBaselineTick;
+			info.RequiresDelivery	= false;
+			if constexpr (requires { { T::RequiresDelivery(packet) } -> std::convertible_to<bool>; })
+			{
+				info.RequiresDelivery = T::RequiresDelivery(packet);
+			}
+
+			m_SnapshotState.LastWrittenPacket		= packet;
+			m_SnapshotState.SendBaseline			= snapshot;
+			m_SnapshotState.SendBaselineTick		= packet.SimulationTick;
+			m_SnapshotState.SnapshotsSinceKeyframe	= isKeyframe ? 1 : m_SnapshotState.SnapshotsSinceKeyframe + 1;
+		}
+		else
+		{
+			// The segment is not sent, start over with a keyframe
+			m_SnapshotState.SendBaselineTick = -1;
+		}
+
+		return result;
+	}
+
+	template<typename TSnapshot>
+	static bool EncodeSnapshot(LambdaEngine::NetworkSegment* pSegment, const T& packet, const TSnapshot* pBaseline, uint32 baselineDistance, TSnapshot& snapshot)
+	{
+		LambdaEngine::BinaryEncoder encoder(pSegment);
+		return
+			encoder.WriteInt32(packet.SimulationTick) &&
+			encoder.WriteInt32(packet.NetworkUID) &&
+			encoder.WriteBits(baselineDistance, SNAPSHOT_BASELINE_DISTANCE_BITS) &&
+			T::EncodeSnapshot(encoder, packet, pBaseline, snapshot) &&
+			encoder.FlushBits();
+	}
+
 	virtual uint16 GetPacketsToSendCount() override final
 	{
 		return (uint16)m_PacketsToSend.size();
@@ -117,5 +311,6 @@ private:
 	LambdaEngine::TArray<T> m_PacketsReceived;
 	LambdaEngine::TQueue<T> m_PacketsToSend;
 	T m_LastReceivedPacket;
+	PacketSnapshotState<T> m_SnapshotState;
 	inline static uint16 s_PacketType = 0;
 };
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 #include "ECS/Components/Multiplayer/PacketComponent.h"
 
+#include "Multiplayer/InterestManager.h"
+
 #include "Containers/THashTable.h"
 
 class PacketTranscoderSystem : public LambdaEngine::System
@@ -22,7 +24,12 @@ public:
 	void FixedTickMainThreadServer(LambdaEngine::Timestamp deltaTime);
 
 private:
+	/*
+	* Sends the queued snapshots of an entity to the clients the InterestManager finds it relevant to
+	*/
+	void SendSnapshots(LambdaEngine::ClientRemoteBase* pClient, IPacketComponent* pPacketComponent, LambdaEngine::Entity entity, int32 networkUID);
 	bool OnPacketReceived(const LambdaEngine::NetworkSegmentReceivedEvent& event);
+	void OnNetworkEntityRemoved(LambdaEngine::Entity entity);
 	virtual void Tick(LambdaEngine::Timestamp deltaTime) override final { UNREFERENCED_VARIABLE(deltaTime); };
 
 public:
@@ -30,6 +37,9 @@ public:
 
 private:
 	LambdaEngine::THashTable<const LambdaEngine::ComponentType*, LambdaEngine::IDVector> m_ComponentTypeToEntities;
+	LambdaEngine::IDVector m_NetworkEntities;
+	InterestManager m_InterestManager;
+	LambdaEngine::TArray<uint32> m_SnapshotRecipients;
 
 private:
 	static PacketTranscoderSystem s_Instance;
@@ -4,6 +4,8 @@
 #include "Networking/API/IClient.h"
 #include "ECS/ComponentType.h"
 
+#include "Multiplayer/Packet/Packet.h"
+
 struct IPacketReceivedEvent : public LambdaEngine::Event
 {
 public:
@@ -12,6 +14,7 @@ public:
 public:
 	virtual void* Populate(LambdaEngine::IClient* pClient) = 0;
 	virtual uint16 GetSize() = 0;
+	virtual bool IsSnapshot() = 0;
 	virtual const LambdaEngine::ComponentType* GetComponentType() = 0;
 };
 
@@ -48,6 +51,11 @@ private:
 		return sizeof(T);
 	}
 
+	virtual bool IsSnapshot() override
+	{
+		return SnapshotPacket<T>;
+	}
+
 	virtual const LambdaEngine::ComponentType* GetComponentType()
 	{
 		return m_pComponentType;
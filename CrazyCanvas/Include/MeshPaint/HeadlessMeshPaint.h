@@ -0,0 +1,70 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/IDVector.h"
+#include "Containers/TArray.h"
+#include "Containers/THashTable.h"
+
+#include "Math/Math.h"
+
+#include "MeshPaintTypes.h"
+
+#include "Threading/API/SpinLock.h"
+
+namespace LambdaEngine
+{
+	struct Mesh;
+}
+
+/*
+* HeadlessMeshPaint paints the players' server side paint masks on the CPU, for dedicated servers that have no GPU to
+* run MeshPaintUpdater and HealthCompute on. Hit points are applied to the players' vertices the same way as
+* MeshPaintUpdater.comp does, and painted vertices are counted the same way as ComputeHealth.comp does, so that a
+* dedicated server deals the same damage as a listen server
+*/
+class HeadlessMeshPaint
+{
+	struct HitPoint
+	{
+		glm::vec3	Position;
+		glm::vec3	Direction;
+		float32		Angle;
+		EPaintMode	PaintMode;
+		ETeam		Team;
+	};
+
+public:
+	DECL_STATIC_CLASS(HeadlessMeshPaint);
+
+	static bool Init();
+	static void Release();
+
+	/* Queues a server hit point, it is painted on the players during the next call to PaintPlayers
+	*	angle - Rotation of the brush mask in degrees
+	*/
+	static void AddHitPoint(const glm::vec3& position, const glm::vec3& direction, EPaintMode paintMode, ETeam team, uint32 angle);
+
+	/* Paints the queued hit points on the players' paint masks */
+	static void PaintPlayers(const LambdaEngine::IDVector& players);
+
+	/* Clears the player's paint mask (When players are killed etc.) */
+	static void ResetServer(LambdaEngine::Entity entity);
+
+	static uint32 GetPaintedVertexCount(LambdaEngine::Entity entity);
+	static uint32 GetVertexCount();
+
+private:
+	static float32 SampleBrushMask(const glm::vec2& uv);
+
+private:
+	static LambdaEngine::SpinLock s_Lock;
+	static LambdaEngine::TArray<HitPoint> s_HitPoints;
+
+	// Server team index per vertex, zero where the vertex is not painted
+	static LambdaEngine::THashTable<LambdaEngine::Entity, LambdaEngine::TArray<uint8>> s_PaintMasks;
+
+	static LambdaEngine::Mesh* s_pPlayerMesh;
+	static LambdaEngine::TArray<uint8> s_BrushMaskAlpha;
+	static uint32 s_BrushMaskWidth;
+	static uint32 s_BrushMaskHeight;
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "LambdaEngine.h"
+
+#include "Containers/TArray.h"
+#include "Containers/THashTable.h"
+
+#include "ECS/Entity.h"
+
+#include "Math/Math.h"
+
+#include "Networking/API/ServerBase.h"
+
+// Entities within this distance of a viewer are replicated to it every tick
+#define INTEREST_FULL_RATE_RADIUS		16.0f
+// Between the full rate radius and this radius the update rate falls off with distance
+#define INTEREST_RADIUS					48.0f
+// Viewers are sorted into cells as large as the interest radius, so an entity only has to look at the neighbouring cells
+#define INTEREST_GRID_CELL_SIZE			INTEREST_RADIUS
+// Entities outside the interest radius are sent to a viewer once every interval ticks, teammates more often. The cells
+// of the grid are spread over the interval, so every tick an entity is only sent to the far viewers of some of the cells
+#define INTEREST_FAR_INTERVAL			8
+#define INTEREST_FAR_TEAMMATE_INTERVAL	4
+
+/*
+* InterestManager decides which clients the server replicates an entity's snapshots to. Clients are sorted into a
+* uniform grid by the position of their player. An entity goes to its owner and to nearby viewers every tick, to viewers
+* further out as their priority accumulates, and to everyone else on a schedule staggered over the entities and cells
+*/
+class InterestManager
+{
+public:
+	InterestManager() = default;
+	~InterestManager() = default;
+
+	/*
+	* Rebuilds the viewers and the grid from the clients' players, called once per server tick
+	*/
+	void Update(const LambdaEngine::ClientMap& clients);
+
+	/*
+	* Fills recipients with the indices of the viewers the entity is replicated to this tick
+	*/
+	void GatherRecipients(LambdaEngine::Entity entity, LambdaEngine::TArray<uint32>& recipients);
+
+	/*
+	* Drops the priority and the last sent tick every viewer keeps for the entity, called when the entity is destroyed
+	*/
+	void RemoveEntity(LambdaEngine::Entity entity);
+
+	/*
+	* Tick of the last snapshot of the entity sent to the viewer, -1 if the viewer has none
+	*/
+	int32& GetLastSentTick(uint32 viewerIndex, LambdaEngine::Entity entity);
+
+	LambdaEngine::ClientRemoteBase* GetViewerClient(uint32 viewerIndex) const { return m_Viewers[viewerIndex].pClient; }
+	uint32 GetViewerCount() const { return m_Viewers.GetSize(); }
+
+private:
+	// Kept across ticks for every connected client
+	struct ViewerState
+	{
+		LambdaEngine::THashTable<LambdaEngine::Entity, float32>	PriorityAccumulators;
+		LambdaEngine::THashTable<LambdaEngine::Entity, int32>	LastSentTicks;
+	};
+
+	struct Viewer
+	{
+		LambdaEngine::ClientRemoteBase* pClient	= nullptr;
+		ViewerState* pState						= nullptr;
+		glm::vec3 Position						= glm::vec3(0.0f);
+		uint8 Team								= 0;
+		// Equal to the stamp of the current GatherRecipients call once the viewer has been considered for the entity
+		uint32 Stamp							= 0;
+	};
+
+	void Select(uint32 viewerIndex, LambdaEngine::TArray<uint32>& recipients);
+
+	static glm::ivec3 GetCell(const glm::vec3& position);
+	static uint64 HashCell(const glm::ivec3& cell);
+
+private:
+	LambdaEngine::TArray<Viewer> m_Viewers;
+	LambdaEngine::THashTable<uint64, LambdaEngine::TArray<uint32>> m_Grid;
+	// Cells with viewers in them, bucketed by the tick of the far interval the cell is sent far entities on
+	LambdaEngine::TArray<uint64> m_OccupiedCellsByPhase[INTEREST_FAR_INTERVAL];
+	LambdaEngine::THashTable<uint8, LambdaEngine::TArray<uint32>> m_ViewersByTeam;
+	LambdaEngine::THashTable<LambdaEngine::Entity, uint32> m_ViewerByEntity;
+	// Viewers without a player in the world, such as clients that are still loading, are sent everything
+	LambdaEngine::TArray<uint32> m_UnplacedViewers;
+	LambdaEngine::THashTable<uint64, ViewerState> m_ViewerStates;
+	uint32 m_Tick	= 0;
+	uint32 m_Stamp	= 0;
+};
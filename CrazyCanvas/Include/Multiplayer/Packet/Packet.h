@@ -22,4 +22,16 @@ struct Packet
 	int32 SimulationTick	= -1;
 	int32 NetworkUID		= -1;
 };
-#pragma pack(pop)
\ No newline at end of file
+#pragma pack(pop)
+
+/*
+* Packets that declare a Snapshot type are bit packed with BinaryEncoder and delta encoded against the previous packet
+* for the same entity instead of being copied as a struct. They must provide
+*	static bool EncodeSnapshot(LambdaEngine::BinaryEncoder&, const T& packet, const Snapshot* pBaseline, Snapshot& snapshot)
+*	static bool DecodeSnapshot(LambdaEngine::BinaryDecoder&, T& packet, const Snapshot* pBaseline, Snapshot& snapshot)
+* where pBaseline is nullptr for keyframes and snapshot receives the quantized state the next packet is encoded against.
+* Snapshots are state and may be skipped for distant receivers, packets that also carry events can opt out with
+*	static bool RequiresDelivery(const T& packet)
+*/
+template<typename T>
+concept SnapshotPacket = requires { typename T::Snapshot; };
\ No newline at end of file
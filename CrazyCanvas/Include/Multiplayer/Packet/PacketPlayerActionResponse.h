@@ -3,13 +3,50 @@
 
 #include "Math/Math.h"
 
+#include "Networking/API/BinaryEncoder.h"
+#include "Networking/API/BinaryDecoder.h"
+
 #include "ECS/Components/Player/ProjectileComponent.h"
 
+/*
+* Quantization of PacketPlayerActionResponse snapshots. The local player treats position and velocity errors above
+* 0.01 as mispredictions, so the steps are kept at 1/512
+*/
+#define PLAYER_SNAPSHOT_POSITION_BOUND		512.0f
+#define PLAYER_SNAPSHOT_POSITION_BITS		19
+#define PLAYER_SNAPSHOT_VELOCITY_BOUND		64.0f
+#define PLAYER_SNAPSHOT_VELOCITY_BITS		16
+#define PLAYER_SNAPSHOT_ROTATION_BITS		12
+#define PLAYER_SNAPSHOT_ANGLE_BITS			9
+// Changes of at most +-127 steps per axis are sent as a delta instead of the full value
+#define PLAYER_SNAPSHOT_DELTA_BITS			8
+
+/*
+* Quantized state of a PacketPlayerActionResponse, kept on both ends as the baseline of the next delta
+*/
+struct PlayerActionResponseSnapshot
+{
+	glm::uvec3					Position;
+	glm::uvec3					Velocity;
+	LambdaEngine::QuantizedQuat	Rotation;
+};
+
 #pragma pack(push, 1)
 struct PacketPlayerActionResponse : Packet
 {
 	DECL_PACKET(PacketPlayerActionResponse);
 
+	typedef PlayerActionResponseSnapshot Snapshot;
+
+	static bool EncodeSnapshot(LambdaEngine::BinaryEncoder& encoder, const PacketPlayerActionResponse& packet, const Snapshot* pBaseline, Snapshot& snapshot);
+	static bool DecodeSnapshot(LambdaEngine::BinaryDecoder& decoder, PacketPlayerActionResponse& packet, const Snapshot* pBaseline, Snapshot& snapshot);
+
+	// Remote clients spawn the fired projectiles from the response, so it has to reach every client
+	FORCEINLINE static bool RequiresDelivery(const PacketPlayerActionResponse& packet)
+	{
+		return packet.FiredAmmo != EAmmoType::AMMO_TYPE_NONE;
+	}
+
 	glm::vec3	Position;
 	glm::vec3	Velocity;
 	glm::quat	Rotation;
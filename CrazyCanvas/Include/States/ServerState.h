@@ -48,6 +48,8 @@ private:
 	void SetState(EServerState state);
 	void TryLoadMatch();
 
+	static LambdaEngine::String GetHostUserName();
+
 public:
 	static EServerState GetState();
 
@@ -5,7 +5,12 @@
 
 #include "ECS/Components/Multiplayer/PacketComponent.h"
 
+#include "Game/ECS/Components/Networking/NetworkPositionComponent.h"
+#include "Game/ECS/Components/Physics/Collision.h"
+#include "Game/ECS/Components/Physics/Transform.h"
+
 #include "Multiplayer/Packet/PacketPlayerAction.h"
+#include "Multiplayer/Packet/PacketPlayerActionResponse.h"
 
 class PlayerRemoteSystem : public LambdaEngine::System
 {
@@ -20,6 +25,18 @@ public:
 private:
 	virtual void Tick(LambdaEngine::Timestamp deltaTime) override final { UNREFERENCED_VARIABLE(deltaTime); };
 	
+	// Applies the player's received actions, or moves the player's character controller if no actions were received
+	void TickPlayer(
+		LambdaEngine::Entity entityPlayer,
+		float32 dt,
+		const PacketComponent<PacketPlayerAction>& playerActionComponent,
+		PacketComponent<PacketPlayerActionResponse>& playerActionResponseComponent,
+		const LambdaEngine::NetworkPositionComponent& netPosComponent,
+		const LambdaEngine::PositionComponent& constPositionComponent,
+		LambdaEngine::VelocityComponent& velocityComponent,
+		const LambdaEngine::RotationComponent& constRotationComponent,
+		LambdaEngine::CharacterColliderComponent& characterColliderComponent);
+
 	void OnEntityRemoved(LambdaEngine::Entity entity);
 
 private:
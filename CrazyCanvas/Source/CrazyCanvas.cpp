@@ -32,6 +32,7 @@
 #include "Teams/TeamHelper.h"
 
 #include "Engine/EngineConfig.h"
+#include "Engine/EngineLoop.h"
 
 #include "ECS/Systems/Multiplayer/PacketTranscoderSystem.h"
 #include "ECS/Components/Player/WeaponComponent.h"
@@ -108,6 +109,7 @@ CrazyCanvas::CrazyCanvas(const argh::parser& flagParser)
 		desc.PingTimeout			= Timestamp::Seconds(5);
 		desc.UsePingSystem			= EngineConfig::GetBoolProperty(CONFIG_OPTION_NETWORK_PING_SYSTEM);
 		desc.MaxClients				= 10;
+		desc.ReceiverThreadCount	= EngineConfig::GetUint32Property(CONFIG_OPTION_NETWORK_RECEIVER_THREADS);
 
 		ServerSystem::Init(desc);
 	}
@@ -117,7 +119,8 @@ CrazyCanvas::CrazyCanvas(const argh::parser& flagParser)
 		LOG_ERROR("Failed to Load Resource Catalog Resources");
 	}
 
-	if (!RegisterGUIComponents())
+	const bool headless = EngineLoop::IsHeadless();
+	if (!headless && !RegisterGUIComponents())
 	{
 		LOG_ERROR("Failed to Register GUI Components");
 	}
@@ -142,24 +145,40 @@ CrazyCanvas::CrazyCanvas(const argh::parser& flagParser)
 	PacketType::Init();
 	PacketTranscoderSystem::GetInstance().Init();
 
-	RenderSystem& renderSystem = RenderSystem::GetInstance();
-	renderSystem.AddCustomRenderer(DBG_NEW MeshPaintUpdater());
-
-	if (stateStr == "server")
+	if (headless)
 	{
-		renderSystem.AddCustomRenderer(DBG_NEW HealthCompute());
+		// There is no render graph to hook into, mesh painting still has to track hits for the game logic
+		m_MeshPaintHandler.Init();
 	}
 	else
 	{
-		renderSystem.AddCustomRenderer(DBG_NEW PlayerRenderer());
-		renderSystem.AddCustomRenderer(DBG_NEW FirstPersonWeaponRenderer());
-		renderSystem.AddCustomRenderer(DBG_NEW ProjectileRenderer(RenderAPI::GetDevice()));
+		RenderSystem& renderSystem = RenderSystem::GetInstance();
+		renderSystem.AddCustomRenderer(DBG_NEW MeshPaintUpdater());
+
+		if (stateStr == "server")
+		{
+			renderSystem.AddCustomRenderer(DBG_NEW HealthCompute());
+		}
+		else
+		{
+			renderSystem.AddCustomRenderer(DBG_NEW PlayerRenderer());
+			renderSystem.AddCustomRenderer(DBG_NEW FirstPersonWeaponRenderer());
+			renderSystem.AddCustomRenderer(DBG_NEW ProjectileRenderer(RenderAPI::GetDevice()));
+		}
+
+		renderSystem.InitRenderGraphs();
+
+		if (stateStr != "server")
+		{
+			// The scene is only drawn where it can be seen, from the camera or, for the shadow map, from the directional light
+			renderSystem.SetRenderStageCullingView("DEFERRED_GEOMETRY_PASS",				ECullingView::CULLING_VIEW_CAMERA);
+			renderSystem.SetRenderStageCullingView("DEFERRED_GEOMETRY_PASS_MESH_PAINT",	ECullingView::CULLING_VIEW_CAMERA);
+			renderSystem.SetRenderStageCullingView("DIRL_SHADOWMAP",						ECullingView::CULLING_VIEW_DIRECTIONAL_LIGHT);
+		}
+
+		InitRendererResources();
 	}
 
-	renderSystem.InitRenderGraphs();
-
-	InitRendererResources();
-
 	if (stateStr == "crazycanvas")
 	{
 		pStartingState = DBG_NEW MainMenuState();
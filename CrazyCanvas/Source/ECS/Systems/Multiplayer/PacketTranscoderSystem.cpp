@@ -24,7 +24,7 @@ void PacketTranscoderSystem::Init()
 	SystemRegistration systemReg;
 
 	const PacketTypeMap& packetTypeMap = PacketType::GetPacketTypeMap();
-	systemReg.SubscriberRegistration.EntitySubscriptionRegistrations.Reserve((uint32)packetTypeMap.size());
+	systemReg.SubscriberRegistration.EntitySubscriptionRegistrations.Reserve((uint32)packetTypeMap.size() + 1);
 
 	for (auto pair : packetTypeMap)
 	{
@@ -43,6 +43,17 @@ void PacketTranscoderSystem::Init()
 		}
 	}
 
+	// The interest state kept for an entity is dropped along with the entity, entity IDs are reused
+	systemReg.SubscriberRegistration.EntitySubscriptionRegistrations.PushBack(
+		{
+			.pSubscriber = &m_NetworkEntities,
+			.ComponentAccesses =
+			{
+				{ NDA, NetworkComponent::Type() }
+			},
+			.OnEntityRemoval = std::bind_front(&PacketTranscoderSystem::OnNetworkEntityRemoved, this)
+		});
+
 	systemReg.Phase = 0;
 
 	RegisterSystem(TYPE_NAME(PacketTranscoderSystem), systemReg);
@@ -110,7 +121,10 @@ void PacketTranscoderSystem::FixedTickMainThreadServer(LambdaEngine::Timestamp d
 	const ClientMap& clients = pServer->GetClients();
 	ClientRemoteBase* pClient = nullptr;
 	if (!clients.empty())
+	{
 		pClient = clients.begin()->second;
+		m_InterestManager.Update(clients);
+	}
 
 	for (auto& pair : m_ComponentTypeToEntities)
 	{
@@ -126,7 +140,11 @@ void PacketTranscoderSystem::FixedTickMainThreadServer(LambdaEngine::Timestamp d
 			const uint16 packetType = pPacketComponent->GetPacketType();
 			VALIDATE_MSG(packetType != 0, "Packet type not registered, have you forgotten to register your package?");
 
-			if (pClient)
+			if (pClient && pPacketComponent->IsSnapshot())
+			{
+				SendSnapshots(pClient, pPacketComponent, entity, networkComponent.NetworkUID);
+			}
+			else if (pClient)
 			{
 				while (pPacketComponent->GetPacketsToSendCount() > 0)
 				{
@@ -150,6 +168,83 @@ void PacketTranscoderSystem::FixedTickMainThreadServer(LambdaEngine::Timestamp d
 	}
 }
 
+void PacketTranscoderSystem::SendSnapshots(ClientRemoteBase* pClient, IPacketComponent* pPacketComponent, Entity entity, int32 networkUID)
+{
+	if (pPacketComponent->GetPacketsToSendCount() == 0)
+		return;
+
+	const uint16 packetType = pPacketComponent->GetPacketType();
+
+	// Decided once per tick, so that accumulated priority is spent once even if several snapshots are queued
+	m_InterestManager.GatherRecipients(entity, m_SnapshotRecipients);
+
+	while (pPacketComponent->GetPacketsToSendCount() > 0)
+	{
+		// The segment pool is exhausted, the remaining snapshots are sent next tick
+		NetworkSegment* pSegment = pClient->GetFreePacket(packetType);
+		if (!pSegment)
+			break;
+
+		if (!pPacketComponent->WriteSegment(pSegment, networkUID))
+		{
+			pClient->ReturnPacket(pSegment);
+			LOG_ERROR("Failed to write packet data!");
+			DEBUGBREAK();
+			continue;
+		}
+
+		const SnapshotWriteInfo& info = pPacketComponent->GetLastSnapshotWritten();
+		const uint32 recipientCount = info.RequiresDelivery ? m_InterestManager.GetViewerCount() : m_SnapshotRecipients.GetSize();
+
+		NetworkSegment* pKeyframeSegment = nullptr;
+		for (uint32 i = 0; i < recipientCount; i++)
+		{
+			const uint32 viewerIndex = info.RequiresDelivery ? i : m_SnapshotRecipients[i];
+			int32& lastSentTick = m_InterestManager.GetLastSentTick(viewerIndex, entity);
+
+			// Recipients that were skipped since the baseline of the delta are sent the snapshot as a keyframe instead
+			NetworkSegment* pSourceSegment = pSegment;
+			if (info.BaselineTick >= 0 && lastSentTick != info.BaselineTick)
+			{
+				if (!pKeyframeSegment)
+				{
+					pKeyframeSegment = pClient->GetFreePacket(packetType);
+					if (pKeyframeSegment && !pPacketComponent->WriteSnapshotKeyframe(pKeyframeSegment))
+					{
+						pClient->ReturnPacket(pKeyframeSegment);
+						pKeyframeSegment = nullptr;
+						LOG_ERROR("Failed to write packet data!");
+						DEBUGBREAK();
+					}
+				}
+
+				pSourceSegment = pKeyframeSegment;
+			}
+
+			ClientRemoteBase* pRecipient = m_InterestManager.GetViewerClient(viewerIndex);
+			NetworkSegment* pRecipientSegment = pSourceSegment ? pRecipient->GetFreePacket(packetType) : nullptr;
+			if (pRecipientSegment)
+			{
+				pSourceSegment->CopyTo(pRecipientSegment);
+				lastSentTick = pRecipient->SendReliable(pRecipientSegment) ? info.SimulationTick : -1;
+			}
+			else
+			{
+				lastSentTick = -1;
+			}
+		}
+
+		pClient->ReturnPacket(pSegment);
+		if (pKeyframeSegment)
+			pClient->ReturnPacket(pKeyframeSegment);
+	}
+}
+
+void PacketTranscoderSystem::OnNetworkEntityRemoved(Entity entity)
+{
+	m_InterestManager.RemoveEntity(entity);
+}
+
 bool PacketTranscoderSystem::OnPacketReceived(const LambdaEngine::NetworkSegmentReceivedEvent& event)
 {
 	ECSCore* pECS = ECSCore::GetInstance();
@@ -161,6 +256,46 @@ bool PacketTranscoderSystem::OnPacketReceived(const LambdaEngine::NetworkSegment
 		return false;
 
 	uint16 packetSize = pEvent->GetSize();
+
+	// Snapshot packets are decoded against the baseline stored in the entity's component, so the entity is looked up first
+	if (pEvent->IsSnapshot())
+	{
+		if (pSegment->GetBufferSize() < sizeof(Packet))
+			return true;
+
+		const ComponentType* pComponentType = pEvent->GetComponentType();
+		if (!pComponentType)
+			return true;
+
+		const Packet* pPacket = (const Packet*)pSegment->GetBuffer();
+		Entity entity = MultiplayerUtils::GetEntity(pPacket->NetworkUID);
+		if (entity == UINT32_MAX)
+			return true;
+
+		IComponentArray* pComponents = pECS->GetComponentArray(pComponentType);
+		if (!pComponents->HasComponent(entity))
+			return true;
+
+		IPacketComponent* pPacketComponent = static_cast<IPacketComponent*>(pComponents->GetRawData(entity));
+		void* pEventPacketData = pEvent->Populate(event.pClient);
+
+		pSegment->ResetReadHead();
+		if (!pPacketComponent->ReadSnapshot(pSegment, pEventPacketData))
+			return true;
+
+		EventQueue::SendEventImmediate(*pEvent);
+
+		if (!MultiplayerUtils::HasWriteAccessToEntity(entity))
+			return true;
+
+		void* packetData = pPacketComponent->AddPacketReceivedBegin();
+		memcpy(packetData, pEventPacketData, packetSize);
+
+		pPacketComponent->AddPacketReceivedEnd();
+
+		return true;
+	}
+
 	if (packetSize != pSegment->GetBufferSize())
 		return true;
 
@@ -462,61 +462,70 @@ void GrenadeSystem::RaycastToPlayers(const LambdaEngine::TArray<LambdaEngine::En
 		.IncludedGroup = FCrazyCanvasCollisionGroup::COLLISION_GROUP_PLAYER,
 	};
 
-	RaycastInfo raycastInfo =
-	{
-		.Origin = grenadePosition,
-		.MaxDistance = GRENADE_PLAYER_BLAST_RADIUS,
-		.pFilterData = &queryFilterData
-	};
+	// The rays to every player are cast as one batch. Each explosion has its own batch, ExecuteQueryBatch waits on
+	// the thread pool, which can run another grenade's explode job on this thread in the meantime
+	constexpr const uint32 maxOverlaps = 10;
+	SceneQueryBatch queryBatch;
+	queryBatch.MaxTouchesPerQuery = maxOverlaps;
 
-	PhysicsSystem* pPhysicsSystem = PhysicsSystem::GetInstance();
 	for (Entity player : players)
 	{
 		const glm::vec3& playerPos = pPositionComponents->GetConstData(player).Position;
 
 		for (float32 rayHeightOffset : rayHeightOffsets)
 		{
-			raycastInfo.Direction = glm::normalize(glm::vec3(playerPos.x, playerPos.y + rayHeightOffset, playerPos.z) - grenadePosition);
+			queryBatch.Raycasts.PushBack(
+				{
+					.Origin = grenadePosition,
+					.Direction = glm::normalize(glm::vec3(playerPos.x, playerPos.y + rayHeightOffset, playerPos.z) - grenadePosition),
+					.MaxDistance = GRENADE_PLAYER_BLAST_RADIUS,
+					.pFilterData = &queryFilterData
+				});
+		}
+	}
 
-			constexpr const uint32 maxOverlaps = 10;
-			std::array<PxRaycastHit, maxOverlaps> rayHitsUserBuffer;
-			PxRaycastBuffer rayHits(rayHitsUserBuffer.data(), (PxU32)rayHitsUserBuffer.size());
-			if (pPhysicsSystem->Raycast(raycastInfo, rayHits))
-			{
-				const uint32 hitCount = rayHits.getNbTouches();
-				const PxRaycastHit* pHits = rayHits.getTouches();
+	PhysicsSystem::GetInstance()->ExecuteQueryBatch(queryBatch);
+
+	for (uint32 playerIdx = 0; playerIdx < players.GetSize(); playerIdx++)
+	{
+		const Entity player = players[playerIdx];
+
+		for (uint32 rayIdx = 0; rayIdx < (uint32)rayHeightOffsets.size(); rayIdx++)
+		{
+			const uint32 queryIdx = playerIdx * (uint32)rayHeightOffsets.size() + rayIdx;
+			const RaycastInfo& raycastInfo = queryBatch.Raycasts[queryIdx];
+			const SceneQueryResult& rayHits = queryBatch.RaycastResults[queryIdx];
 
-				for (uint32 hitNr = 0; hitNr < hitCount; hitNr++)
+			for (uint32 hitNr = 0; hitNr < rayHits.HitCount; hitNr++)
+			{
+				const PxRaycastHit& hit = queryBatch.RaycastHits[rayHits.FirstHit + hitNr];
+				if (reinterpret_cast<const ActorUserData*>(hit.actor->userData)->Entity == player)
 				{
-					const PxRaycastHit& hit = pHits[hitNr];
-					if (reinterpret_cast<const ActorUserData*>(hit.actor->userData)->Entity == player)
+					// The player was hit by the ray, paint him in the hit position
+					const LambdaEngine::EntityCollisionInfo collisionInfo0 =
 					{
-						// The player was hit by the ray, paint him in the hit position
-						const LambdaEngine::EntityCollisionInfo collisionInfo0 =
-						{
-							.Entity		= grenadeEntity,
-							.Position	= glm::vec3(hit.position.x, hit.position.y, hit.position.z),
-							.Direction	= raycastInfo.Direction,
-							.Normal		= glm::vec3(hit.normal.x, hit.normal.y, hit.normal.z)
-						};
+						.Entity		= grenadeEntity,
+						.Position	= glm::vec3(hit.position.x, hit.position.y, hit.position.z),
+						.Direction	= raycastInfo.Direction,
+						.Normal		= glm::vec3(hit.normal.x, hit.normal.y, hit.normal.z)
+					};
 
-						const LambdaEngine::EntityCollisionInfo collisionInfo1 =
-						{
-							.Entity		= player,
-							.Position	= glm::vec3(hit.position.x, hit.position.y, hit.position.z),
-							.Direction	= raycastInfo.Direction,
-							.Normal		= glm::vec3(hit.normal.x, hit.normal.y, hit.normal.z)
-						};
+					const LambdaEngine::EntityCollisionInfo collisionInfo1 =
+					{
+						.Entity		= player,
+						.Position	= glm::vec3(hit.position.x, hit.position.y, hit.position.z),
+						.Direction	= raycastInfo.Direction,
+						.Normal		= glm::vec3(hit.normal.x, hit.normal.y, hit.normal.z)
+					};
 
-						const EAmmoType ammoType	= EAmmoType::AMMO_TYPE_PAINT;
-						const ETeam team			= (ETeam)grenadeTeam;
-						const uint32 angle			= 0;
+					const EAmmoType ammoType	= EAmmoType::AMMO_TYPE_PAINT;
+					const ETeam team			= (ETeam)grenadeTeam;
+					const uint32 angle			= 0;
 
-						ProjectileHitEvent hitEvent(collisionInfo0, collisionInfo1, ammoType, team, angle);
-						EventQueue::SendEventImmediate(hitEvent);
+					ProjectileHitEvent hitEvent(collisionInfo0, collisionInfo1, ammoType, team, angle);
+					EventQueue::SendEventImmediate(hitEvent);
 
-						goto nextPlayer;
-					}
+					goto nextPlayer;
 				}
 			}
 		}
@@ -533,22 +542,27 @@ void GrenadeSystem::RaycastToEnvironment(LambdaEngine::Entity grenadeEntity, con
 		.IncludedGroup = FCollisionGroup::COLLISION_GROUP_STATIC,
 	};
 
-	RaycastInfo raycastInfo =
+	SceneQueryBatch queryBatch;
+	for (uint32 i = 0; i < NUM_ENVIRONMENT_SPHERE_POINTS; i++)
 	{
-		.Origin = grenadePosition,
-		.MaxDistance = GRENADE_ENVIRONMENT_BLAST_RADIUS,
-		.pFilterData = &queryFilterData
-	};
+		queryBatch.Raycasts.PushBack(
+			{
+				.Origin = grenadePosition,
+				.Direction = m_FibonacciSphere[i],
+				.MaxDistance = GRENADE_ENVIRONMENT_BLAST_RADIUS,
+				.pFilterData = &queryFilterData
+			});
+	}
 
-	PhysicsSystem* pPhysicsSystem = PhysicsSystem::GetInstance();
+	PhysicsSystem::GetInstance()->ExecuteQueryBatch(queryBatch);
 
 	for (uint32 i = 0; i < NUM_ENVIRONMENT_SPHERE_POINTS; i++)
 	{
-		raycastInfo.Direction = m_FibonacciSphere[i];
-
-		PxRaycastHit hit;
-		if (pPhysicsSystem->Raycast(raycastInfo, hit))
+		const RaycastInfo& raycastInfo = queryBatch.Raycasts[i];
+		const SceneQueryResult& result = queryBatch.RaycastResults[i];
+		if (result.HitCount > 0)
 		{
+			const PxRaycastHit& hit = queryBatch.RaycastHits[result.FirstHit];
 			if (hit.actor->userData != nullptr)
 			{
 				const ActorUserData* pUserData = reinterpret_cast<const ActorUserData*>(hit.actor->userData);
@@ -3,8 +3,14 @@
 #include "ECS/Components/Player/HealthComponent.h"
 #include "ECS/Components/Player/Player.h"
 
+#include "Game/ECS/Components/Physics/Transform.h"
+#include "Game/ECS/Components/Rendering/AnimationComponent.h"
+#include "Game/ECS/Components/Team/TeamComponent.h"
+
 #include "Application/API/Events/EventQueue.h"
 
+#include "Engine/EngineLoop.h"
+
 #include "Events/GameplayEvents.h"
 
 #include "Multiplayer/Packet/PacketHealthChanged.h"
@@ -12,6 +18,7 @@
 #include "Match/MatchServer.h"
 
 #include "MeshPaint/MeshPaintHandler.h"
+#include "MeshPaint/HeadlessMeshPaint.h"
 
 #include "Lobby/PlayerManagerServer.h"
 
@@ -44,8 +51,17 @@ void HealthSystemServer::FixedTick(LambdaEngine::Timestamp deltaTime)
 	using namespace LambdaEngine;
 	UNREFERENCED_VARIABLE(deltaTime);
 
-	for (Entity entity : m_HealthEntities)
-		HealthCompute::QueueHealthCalculation(entity);
+	// Dedicated servers have no GPU, the paint is applied and counted on the CPU there instead
+	const bool headless = EngineLoop::IsHeadless();
+	if (headless)
+	{
+		HeadlessMeshPaint::PaintPlayers(m_HealthEntities);
+	}
+	else
+	{
+		for (Entity entity : m_HealthEntities)
+			HealthCompute::QueueHealthCalculation(entity);
+	}
 
 	// More threadsafe
 	{
@@ -88,8 +104,9 @@ void HealthSystemServer::FixedTick(LambdaEngine::Timestamp deltaTime)
 				constexpr float32 START_HEALTH_F	= float32(START_HEALTH);
 
 				// Update health
-				const uint32	paintedVerticies	= HealthCompute::GetEntityHealth(entity);
-				const float32	paintedHealth		= float32(paintedVerticies) / float32(HealthCompute::GetVertexCount() * (1.0f - BIASED_MAX_HEALTH));
+				const uint32	paintedVerticies	= headless ? HeadlessMeshPaint::GetPaintedVertexCount(entity) : HealthCompute::GetEntityHealth(entity);
+				const uint32	vertexCount			= headless ? HeadlessMeshPaint::GetVertexCount() : HealthCompute::GetVertexCount();
+				const float32	paintedHealth		= float32(paintedVerticies) / float32(vertexCount * (1.0f - BIASED_MAX_HEALTH));
 				const int32		oldHealth			= healthComponent.CurrentHealth;
 				healthComponent.CurrentHealth		= std::max<int32>(int32(START_HEALTH_F * (1.0f - paintedHealth)), 0);
 
@@ -100,7 +117,7 @@ void HealthSystemServer::FixedTick(LambdaEngine::Timestamp deltaTime)
 						healthComponent.CurrentHealth,
 						paintedHealth,
 						paintedVerticies,
-						HealthCompute::GetVertexCount());
+						vertexCount);
 
 					bool killed = false;
 					if (healthComponent.CurrentHealth <= 0)
@@ -171,6 +188,13 @@ bool HealthSystemServer::InitInternal()
 			{ R, ProjectileComponent::Type() }
 		);
 
+		// Read by HeadlessMeshPaint to place the players' vertices
+		systemReg.SubscriberRegistration.AdditionalAccesses.PushBack({ R, PositionComponent::Type() });
+		systemReg.SubscriberRegistration.AdditionalAccesses.PushBack({ R, RotationComponent::Type() });
+		systemReg.SubscriberRegistration.AdditionalAccesses.PushBack({ R, ScaleComponent::Type() });
+		systemReg.SubscriberRegistration.AdditionalAccesses.PushBack({ R, TeamComponent::Type() });
+		systemReg.SubscriberRegistration.AdditionalAccesses.PushBack({ R, AnimationComponent::Type() });
+
 		RegisterSystem(TYPE_NAME(HealthSystemServer), systemReg);
 	}
 
@@ -24,6 +24,8 @@
 
 #include "Application/API/Events/EventQueue.h"
 
+#include "Engine/EngineLoop.h"
+
 #include "Math/Random.h"
 
 #include "Networking/API/ClientRemoteBase.h"
@@ -95,6 +97,12 @@ void MatchServer::TickInternal(LambdaEngine::Timestamp deltaTime)
 
 	//Render Some Server Match Information
 #if defined(RENDER_MATCH_INFORMATION)
+	// There is no ImGui renderer on a headless server
+	if (EngineLoop::IsHeadless())
+	{
+		return;
+	}
+
 	ImGuiRenderer::Get().DrawUI([this]()
 	{
 		ECSCore* pECS = ECSCore::GetInstance();
@@ -0,0 +1,256 @@
+#include "MeshPaint/HeadlessMeshPaint.h"
+
+#include "ECS/ECSCore.h"
+
+#include "Game/ECS/Components/Rendering/AnimationComponent.h"
+#include "Game/ECS/Components/Team/TeamComponent.h"
+#include "Game/ECS/Systems/Rendering/RenderSystem.h"
+
+#include "Log/Log.h"
+
+#include "Resources/ResourceCatalog.h"
+#include "Resources/ResourceManager.h"
+#include "Resources/ResourcePaths.h"
+
+#include "stb/stb_image.h"
+
+#include <mutex>
+
+/*
+* HeadlessMeshPaint
+*/
+
+LambdaEngine::SpinLock HeadlessMeshPaint::s_Lock;
+LambdaEngine::TArray<HeadlessMeshPaint::HitPoint> HeadlessMeshPaint::s_HitPoints;
+LambdaEngine::THashTable<LambdaEngine::Entity, LambdaEngine::TArray<uint8>> HeadlessMeshPaint::s_PaintMasks;
+LambdaEngine::Mesh* HeadlessMeshPaint::s_pPlayerMesh = nullptr;
+LambdaEngine::TArray<uint8> HeadlessMeshPaint::s_BrushMaskAlpha;
+uint32 HeadlessMeshPaint::s_BrushMaskWidth	= 0;
+uint32 HeadlessMeshPaint::s_BrushMaskHeight	= 0;
+
+bool HeadlessMeshPaint::Init()
+{
+	using namespace LambdaEngine;
+
+	s_pPlayerMesh = ResourceManager::GetMesh(ResourceCatalog::PLAYER_MESH_GUID);
+	if (s_pPlayerMesh == nullptr)
+	{
+		LOG_ERROR("[HeadlessMeshPaint]: Player mesh is not loaded");
+		return false;
+	}
+
+	// Textures are not loaded when headless, only the alpha of the brush mask is needed to know what is painted
+	const String brushMaskPath = String(TEXTURE_DIR) + "MeshPainting/BrushMaskV3.png";
+
+	int32 width		= 0;
+	int32 height	= 0;
+	int32 channels	= 0;
+	stbi_uc* pPixels = stbi_load(brushMaskPath.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+	if (pPixels == nullptr)
+	{
+		LOG_ERROR("[HeadlessMeshPaint]: Failed to load brush mask \"%s\"", brushMaskPath.c_str());
+		return false;
+	}
+
+	s_BrushMaskWidth	= uint32(width);
+	s_BrushMaskHeight	= uint32(height);
+	s_BrushMaskAlpha.Resize(s_BrushMaskWidth * s_BrushMaskHeight);
+	for (uint32 texel = 0; texel < s_BrushMaskAlpha.GetSize(); texel++)
+	{
+		s_BrushMaskAlpha[texel] = pPixels[texel * 4 + 3];
+	}
+
+	stbi_image_free(pPixels);
+	return true;
+}
+
+void HeadlessMeshPaint::Release()
+{
+	std::scoped_lock<LambdaEngine::SpinLock> lock(s_Lock);
+	s_HitPoints.Clear();
+	s_PaintMasks.clear();
+	s_BrushMaskAlpha.Clear();
+	s_pPlayerMesh = nullptr;
+}
+
+void HeadlessMeshPaint::AddHitPoint(const glm::vec3& position, const glm::vec3& direction, EPaintMode paintMode, ETeam team, uint32 angle)
+{
+	std::scoped_lock<LambdaEngine::SpinLock> lock(s_Lock);
+	s_HitPoints.PushBack(
+		{
+			.Position	= position,
+			.Direction	= glm::normalize(direction),
+			.Angle		= glm::radians(float32(angle)),
+			.PaintMode	= paintMode,
+			.Team		= team
+		});
+}
+
+void HeadlessMeshPaint::PaintPlayers(const LambdaEngine::IDVector& players)
+{
+	using namespace LambdaEngine;
+
+	constexpr float32 BRUSH_SIZE	= 1.0f;
+	constexpr float32 PAINT_DEPTH	= BRUSH_SIZE * 2.0f;
+	constexpr float32 EPSILON		= 0.00001f;
+
+	std::scoped_lock<SpinLock> lock(s_Lock);
+	if (s_HitPoints.IsEmpty() || s_pPlayerMesh == nullptr)
+	{
+		return;
+	}
+
+	const TArray<Vertex>&			vertices	= s_pPlayerMesh->Vertices;
+	const TArray<VertexJointData>&	jointData	= s_pPlayerMesh->VertexJointData;
+
+	const ECSCore* pECS = ECSCore::GetInstance();
+	const ComponentArray<TeamComponent>*		pTeamComponents			= pECS->GetComponentArray<TeamComponent>();
+	const ComponentArray<AnimationComponent>*	pAnimationComponents	= pECS->GetComponentArray<AnimationComponent>();
+
+	for (Entity entity : players)
+	{
+		TeamComponent teamComponent = {};
+		if (!pTeamComponents->GetConstIf(entity, teamComponent))
+		{
+			continue;
+		}
+
+		// Players are drawn rotated around the up axis only, see RenderSystem::OnPlayerEntityAdded
+		const glm::mat4 transform	= RenderSystem::CreateEntityTransform(entity, glm::bvec3(false, true, false));
+		const uint32 instanceTeam	= teamComponent.TeamIndex;
+
+		// Skin the vertices the same way Skinning.comp does when the server has a pose for the player
+		const TArray<glm::mat4>* pJointTransforms = nullptr;
+		if (pAnimationComponents != nullptr && pAnimationComponents->HasComponent(entity) && jointData.GetSize() == vertices.GetSize())
+		{
+			const AnimationComponent& animationComponent = pAnimationComponents->GetConstData(entity);
+			if (animationComponent.Pose.pSkeleton != nullptr && animationComponent.Pose.GlobalTransforms.GetSize() == animationComponent.Pose.pSkeleton->Joints.GetSize())
+			{
+				pJointTransforms = &animationComponent.Pose.GlobalTransforms;
+			}
+		}
+
+		TArray<uint8>& paintMask = s_PaintMasks[entity];
+		if (paintMask.GetSize() != vertices.GetSize())
+		{
+			paintMask.Resize(vertices.GetSize());
+			memset(paintMask.GetData(), 0, paintMask.GetSize());
+		}
+
+		for (uint32 v = 0; v < vertices.GetSize(); v++)
+		{
+			glm::vec4 position	= glm::vec4(vertices[v].ExtractPosition(), 1.0f);
+			glm::vec4 normal	= glm::vec4(vertices[v].ExtractNormal(), 0.0f);
+			if (pJointTransforms != nullptr)
+			{
+				// Vertices influenced by fewer than four joints have the remaining joints set to INVALID_JOINT_ID
+				const VertexJointData& joints = jointData[v];
+				const JointIndexType jointIDs[]	= { joints.JointID0, joints.JointID1, joints.JointID2, joints.JointID3 };
+				const float32 weights[]			= { joints.Weight0, joints.Weight1, joints.Weight2, 1.0f - (joints.Weight0 + joints.Weight1 + joints.Weight2) };
+
+				glm::mat4 jointTransform(0.0f);
+				for (uint32 j = 0; j < 4; j++)
+				{
+					if (jointIDs[j] != INVALID_JOINT_ID)
+					{
+						jointTransform += (*pJointTransforms)[jointIDs[j]] * weights[j];
+					}
+				}
+
+				position	= jointTransform * position;
+				normal		= jointTransform * normal;
+			}
+
+			const glm::vec3 worldPosition	= glm::vec3(transform * position);
+			const glm::vec3 worldNormal		= glm::normalize(glm::vec3(transform * normal));
+
+			for (const HitPoint& hitPoint : s_HitPoints)
+			{
+				const glm::vec3& direction = hitPoint.Direction;
+				if (glm::dot(worldNormal, -direction) < 0.0f)
+				{
+					continue;
+				}
+
+				const glm::vec3 targetPosToWorldPos = worldPosition - hitPoint.Position;
+				if (glm::abs(glm::dot(targetPosToWorldPos, direction)) >= PAINT_DEPTH)
+				{
+					continue;
+				}
+
+				// Paint is only applied to other teams, paint can be removed from the own team
+				const uint32 team		= uint32(hitPoint.Team);
+				const uint32 paintMode	= uint32(hitPoint.PaintMode);
+				const bool isRemove		= hitPoint.PaintMode == EPaintMode::REMOVE;
+				const bool isSameTeam	= instanceTeam == team;
+				if (isRemove ? !(instanceTeam == 0 || isSameTeam) : isSameTeam)
+				{
+					continue;
+				}
+
+				// Calculate uv-coordinates for a square encapsulating the sphere
+				glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f);
+				if (glm::abs(glm::abs(glm::dot(direction, up)) - 1.0f) < EPSILON)
+				{
+					up = glm::vec3(0.0f, 0.0f, 1.0f);
+				}
+
+				const glm::vec3 right = glm::normalize(glm::cross(direction, up));
+				up = glm::normalize(glm::cross(right, direction));
+
+				const glm::vec2 uv = glm::vec2(
+					glm::dot(-targetPosToWorldPos, right) / BRUSH_SIZE * 1.5f,
+					glm::dot(-targetPosToWorldPos, up) / BRUSH_SIZE * 1.5f) * 0.5f;
+
+				const float32 c = glm::cos(hitPoint.Angle);
+				const float32 s = glm::sin(hitPoint.Angle);
+				const glm::vec2 maskUV = glm::vec2(c * uv.x - s * uv.y, s * uv.x + c * uv.y) + 0.5f;
+				if (maskUV.x <= 0.0f || maskUV.x >= 1.0f || maskUV.y <= 0.0f || maskUV.y >= 1.0f || SampleBrushMask(maskUV) <= 0.001f)
+				{
+					continue;
+				}
+
+				paintMask[v] = uint8((team * paintMode) & 0x0F);
+			}
+		}
+	}
+
+	s_HitPoints.Clear();
+}
+
+void HeadlessMeshPaint::ResetServer(LambdaEngine::Entity entity)
+{
+	std::scoped_lock<LambdaEngine::SpinLock> lock(s_Lock);
+	s_PaintMasks.erase(entity);
+}
+
+uint32 HeadlessMeshPaint::GetPaintedVertexCount(LambdaEngine::Entity entity)
+{
+	std::scoped_lock<LambdaEngine::SpinLock> lock(s_Lock);
+	auto paintMaskIt = s_PaintMasks.find(entity);
+	if (paintMaskIt == s_PaintMasks.end())
+	{
+		return 0;
+	}
+
+	uint32 paintedVertexCount = 0;
+	for (uint8 server : paintMaskIt->second)
+	{
+		paintedVertexCount += server > 0 ? 1 : 0;
+	}
+
+	return paintedVertexCount;
+}
+
+uint32 HeadlessMeshPaint::GetVertexCount()
+{
+	return s_pPlayerMesh != nullptr ? s_pPlayerMesh->Vertices.GetSize() : 0;
+}
+
+float32 HeadlessMeshPaint::SampleBrushMask(const glm::vec2& uv)
+{
+	// The brush mask is sampled with the nearest sampler on the GPU
+	const uint32 x = std::min(uint32(uv.x * float32(s_BrushMaskWidth)), s_BrushMaskWidth - 1);
+	const uint32 y = std::min(uint32(uv.y * float32(s_BrushMaskHeight)), s_BrushMaskHeight - 1);
+	return float32(s_BrushMaskAlpha[y * s_BrushMaskWidth + x]) / 255.0f;
+}
@@ -2,6 +2,8 @@
 
 #include "Application/API/Events/EventQueue.h"
 
+#include "Engine/EngineLoop.h"
+
 #include "Game/Multiplayer/MultiplayerUtils.h"
 #include "Game/ECS/Systems/Rendering/RenderSystem.h"
 #include "Game/ECS/Components/Player/PlayerComponent.h"
@@ -10,6 +12,7 @@
 #include "Multiplayer/ClientHelper.h"
 #include "Multiplayer/ServerHelper.h"
 #include "RenderStages/MeshPaintUpdater.h"
+#include "MeshPaint/HeadlessMeshPaint.h"
 
 #include "Utilities/StringUtilities.h"
 
@@ -37,6 +40,13 @@ void MeshPaintHandler::Init()
 	EventQueue::RegisterEventHandler<ProjectileHitEvent, MeshPaintHandler>(this, &MeshPaintHandler::OnProjectileHit);
 	EventQueue::RegisterEventHandler<PacketReceivedEvent<PacketProjectileHit>>(this, &MeshPaintHandler::OnPacketProjectileHitReceived);
 
+	// There is no render graph when headless, the server's paint is applied to the players on the CPU instead
+	if (EngineLoop::IsHeadless())
+	{
+		HeadlessMeshPaint::Init();
+		return;
+	}
+
 	m_pRenderGraph	= RenderSystem::GetInstance().GetRenderGraph();
 
 	// Create buffer
@@ -73,6 +83,11 @@ void MeshPaintHandler::Tick(LambdaEngine::Timestamp delta)
 
 	UNREFERENCED_VARIABLE(delta);
 
+	if (EngineLoop::IsHeadless())
+	{
+		return;
+	}
+
 	// To ensure the hit point is added in the main thread to the render graph
 	// it is done in the tick function.
 
@@ -122,6 +137,11 @@ void MeshPaintHandler::Tick(LambdaEngine::Timestamp delta)
 void MeshPaintHandler::Release()
 {
 	m_pPointsBuffer.Reset();
+
+	if (LambdaEngine::EngineLoop::IsHeadless())
+	{
+		HeadlessMeshPaint::Release();
+	}
 }
 
 void MeshPaintHandler::AddHitPoint(
@@ -132,6 +152,16 @@ void MeshPaintHandler::AddHitPoint(
 	ETeam team,
 	uint32 angle)
 {
+	if (LambdaEngine::EngineLoop::IsHeadless())
+	{
+		if (remoteMode == ERemoteMode::SERVER)
+		{
+			HeadlessMeshPaint::AddHitPoint(position, direction, paintMode, team, angle);
+		}
+
+		return;
+	}
+
 	std::scoped_lock<LambdaEngine::SpinLock> lock(s_SpinLock);
 
 	PaintData data = {};
@@ -153,7 +183,14 @@ void MeshPaintHandler::ResetServer(LambdaEngine::Entity entity)
 {
 	using namespace LambdaEngine;
 
-	MeshPaintUpdater::ClearServer(entity);
+	if (EngineLoop::IsHeadless())
+	{
+		HeadlessMeshPaint::ResetServer(entity);
+	}
+	else
+	{
+		MeshPaintUpdater::ClearServer(entity);
+	}
 }
 
 bool MeshPaintHandler::OnProjectileHit(const ProjectileHitEvent& projectileHitEvent)
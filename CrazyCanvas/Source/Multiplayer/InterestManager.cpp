@@ -0,0 +1,206 @@
+#include "Multiplayer/InterestManager.h"
+
+#include "ECS/ECSCore.h"
+
+#include "Game/ECS/Components/Physics/Transform.h"
+#include "Game/ECS/Components/Team/TeamComponent.h"
+
+#include "Lobby/PlayerManagerBase.h"
+
+#include "Networking/API/ClientRemoteBase.h"
+
+#include <algorithm>
+
+using namespace LambdaEngine;
+
+void InterestManager::Update(const ClientMap& clients)
+{
+	ECSCore* pECS = ECSCore::GetInstance();
+	const ComponentArray<PositionComponent>* pPositionComponents = pECS->GetComponentArray<PositionComponent>();
+
+	m_Tick++;
+
+	m_Viewers.Clear();
+	m_ViewerByEntity.clear();
+	m_UnplacedViewers.Clear();
+
+	// Cells and teams are emptied rather than erased to keep their allocations between ticks
+	for (auto& pair : m_Grid)
+		pair.second.Clear();
+
+	for (auto& pair : m_ViewersByTeam)
+		pair.second.Clear();
+
+	for (TArray<uint64>& occupiedCells : m_OccupiedCellsByPhase)
+		occupiedCells.Clear();
+
+	for (auto& pair : clients)
+	{
+		ClientRemoteBase* pClient = pair.second;
+
+		const uint32 viewerIndex = m_Viewers.GetSize();
+		Viewer& viewer = m_Viewers.PushBack({});
+		viewer.pClient	= pClient;
+		viewer.pState	= &m_ViewerStates[pClient->GetUID()];
+
+		const Player* pPlayer = PlayerManagerBase::GetPlayer(pClient);
+		if (!pPlayer || !pPositionComponents->HasComponent(pPlayer->GetEntity()))
+		{
+			m_UnplacedViewers.PushBack(viewerIndex);
+			continue;
+		}
+
+		viewer.Position	= pPositionComponents->GetConstData(pPlayer->GetEntity()).Position;
+		viewer.Team		= pPlayer->GetTeam();
+
+		const uint64 cellHash = HashCell(GetCell(viewer.Position));
+		TArray<uint32>& cell = m_Grid[cellHash];
+		if (cell.IsEmpty())
+			m_OccupiedCellsByPhase[cellHash % INTEREST_FAR_INTERVAL].PushBack(cellHash);
+
+		cell.PushBack(viewerIndex);
+		m_ViewersByTeam[viewer.Team].PushBack(viewerIndex);
+		m_ViewerByEntity[pPlayer->GetEntity()] = viewerIndex;
+	}
+
+	// Drop the state of clients that have left
+	if (m_ViewerStates.size() > m_Viewers.GetSize())
+	{
+		for (auto it = m_ViewerStates.begin(); it != m_ViewerStates.end();)
+		{
+			if (clients.end() == std::find_if(clients.begin(), clients.end(), [&](const auto& pair) { return pair.second->GetUID() == it->first; }))
+				it = m_ViewerStates.erase(it);
+			else
+				it++;
+		}
+	}
+}
+
+void InterestManager::GatherRecipients(Entity entity, TArray<uint32>& recipients)
+{
+	ECSCore* pECS = ECSCore::GetInstance();
+	const ComponentArray<PositionComponent>* pPositionComponents = pECS->GetComponentArray<PositionComponent>();
+	const ComponentArray<TeamComponent>* pTeamComponents = pECS->GetComponentArray<TeamComponent>();
+
+	recipients.Clear();
+	m_Stamp++;
+
+	// Entities that are not placed in the world cannot be filtered
+	if (!pPositionComponents->HasComponent(entity))
+	{
+		for (uint32 viewerIndex = 0; viewerIndex < m_Viewers.GetSize(); viewerIndex++)
+			Select(viewerIndex, recipients);
+
+		return;
+	}
+
+	const glm::vec3 position = pPositionComponents->GetConstData(entity).Position;
+
+	// The owner predicts the entity and reconciles against every snapshot
+	auto ownerIt = m_ViewerByEntity.find(entity);
+	if (ownerIt != m_ViewerByEntity.end())
+		Select(ownerIt->second, recipients);
+
+	for (uint32 viewerIndex : m_UnplacedViewers)
+		Select(viewerIndex, recipients);
+
+	// Viewers within the interest radius accumulate priority until it is their turn
+	const glm::ivec3 entityCell = GetCell(position);
+	for (int32 x = -1; x <= 1; x++)
+	{
+		for (int32 y = -1; y <= 1; y++)
+		{
+			for (int32 z = -1; z <= 1; z++)
+			{
+				auto cellIt = m_Grid.find(HashCell(entityCell + glm::ivec3(x, y, z)));
+				if (cellIt == m_Grid.end())
+					continue;
+
+				for (uint32 viewerIndex : cellIt->second)
+				{
+					Viewer& viewer = m_Viewers[viewerIndex];
+					if (viewer.Stamp == m_Stamp)
+						continue;
+
+					const float32 distance = glm::distance(viewer.Position, position);
+					if (distance > INTEREST_RADIUS)
+						continue;
+
+					viewer.Stamp = m_Stamp;
+
+					float32& accumulator = viewer.pState->PriorityAccumulators[entity];
+					accumulator += distance <= INTEREST_FULL_RATE_RADIUS ? 1.0f : INTEREST_FULL_RATE_RADIUS / distance;
+					if (accumulator >= 1.0f)
+					{
+						accumulator -= 1.0f;
+						Select(viewerIndex, recipients);
+					}
+				}
+			}
+		}
+	}
+
+	// Teammates get the entity on ticks staggered by entity
+	const uint32 scheduleTick = m_Tick + entity;
+	if (scheduleTick % INTEREST_FAR_TEAMMATE_INTERVAL == 0 && pTeamComponents->HasComponent(entity))
+	{
+		auto teamIt = m_ViewersByTeam.find(pTeamComponents->GetConstData(entity).TeamIndex);
+		if (teamIt != m_ViewersByTeam.end())
+		{
+			for (uint32 viewerIndex : teamIt->second)
+			{
+				if (m_Viewers[viewerIndex].Stamp != m_Stamp)
+					Select(viewerIndex, recipients);
+			}
+		}
+	}
+
+	// Everyone else gets the entity once per interval, staggered by entity and cell so that every tick only visits the
+	// cells whose turn it is instead of every viewer
+	const uint32 phase = (INTEREST_FAR_INTERVAL - scheduleTick % INTEREST_FAR_INTERVAL) % INTEREST_FAR_INTERVAL;
+	for (uint64 cellHash : m_OccupiedCellsByPhase[phase])
+	{
+		for (uint32 viewerIndex : m_Grid[cellHash])
+		{
+			if (m_Viewers[viewerIndex].Stamp != m_Stamp)
+				Select(viewerIndex, recipients);
+		}
+	}
+}
+
+void InterestManager::RemoveEntity(Entity entity)
+{
+	for (auto& pair : m_ViewerStates)
+	{
+		pair.second.PriorityAccumulators.erase(entity);
+		pair.second.LastSentTicks.erase(entity);
+	}
+}
+
+int32& InterestManager::GetLastSentTick(uint32 viewerIndex, Entity entity)
+{
+	ViewerState* pState = m_Viewers[viewerIndex].pState;
+	auto it = pState->LastSentTicks.find(entity);
+	if (it == pState->LastSentTicks.end())
+		it = pState->LastSentTicks.insert({ entity, -1 }).first;
+
+	return it->second;
+}
+
+void InterestManager::Select(uint32 viewerIndex, TArray<uint32>& recipients)
+{
+	m_Viewers[viewerIndex].Stamp = m_Stamp;
+	recipients.PushBack(viewerIndex);
+}
+
+glm::ivec3 InterestManager::GetCell(const glm::vec3& position)
+{
+	return glm::ivec3(glm::floor(position / INTEREST_GRID_CELL_SIZE));
+}
+
+uint64 InterestManager::HashCell(const glm::ivec3& cell)
+{
+	// 21 bits per axis covers far more cells than any level has
+	constexpr uint64 MASK = (uint64(1) << 21) - 1;
+	return (uint64(cell.x) & MASK) | ((uint64(cell.y) & MASK) << 21) | ((uint64(cell.z) & MASK) << 42);
+}
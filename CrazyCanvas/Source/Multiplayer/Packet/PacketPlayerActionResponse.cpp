@@ -0,0 +1,189 @@
+#include "Multiplayer/Packet/PacketPlayerActionResponse.h"
+
+using namespace LambdaEngine;
+
+static constexpr int32 DELTA_MAX = (1 << (PLAYER_SNAPSHOT_DELTA_BITS - 1)) - 1;
+
+/*
+* Writes one bit telling if the value changed since the baseline, then either a small delta per axis or the full value.
+* Keyframes have no baseline and always write the full value
+*/
+static bool WriteDeltaVec3(BinaryEncoder& encoder, const glm::uvec3& value, const glm::uvec3* pBaseline, uint8 bitCount)
+{
+	if (pBaseline)
+	{
+		if (value == *pBaseline)
+		{
+			return encoder.WriteBits(0, 1);
+		}
+
+		const glm::ivec3 delta = glm::ivec3(value) - glm::ivec3(*pBaseline);
+		const bool isSmall = glm::all(glm::lessThanEqual(glm::abs(delta), glm::ivec3(DELTA_MAX)));
+		if (!encoder.WriteBits(1, 1) || !encoder.WriteBits(isSmall ? 1 : 0, 1))
+		{
+			return false;
+		}
+
+		if (isSmall)
+		{
+			return
+				encoder.WriteBits(uint32(delta.x + DELTA_MAX), PLAYER_SNAPSHOT_DELTA_BITS) &&
+				encoder.WriteBits(uint32(delta.y + DELTA_MAX), PLAYER_SNAPSHOT_DELTA_BITS) &&
+				encoder.WriteBits(uint32(delta.z + DELTA_MAX), PLAYER_SNAPSHOT_DELTA_BITS);
+		}
+	}
+
+	return
+		encoder.WriteBits(value.x, bitCount) &&
+		encoder.WriteBits(value.y, bitCount) &&
+		encoder.WriteBits(value.z, bitCount);
+}
+
+static bool ReadDeltaVec3(BinaryDecoder& decoder, glm::uvec3& value, const glm::uvec3* pBaseline, uint8 bitCount)
+{
+	if (pBaseline)
+	{
+		uint32 changed;
+		if (!decoder.ReadBits(changed, 1))
+		{
+			return false;
+		}
+
+		if (!changed)
+		{
+			value = *pBaseline;
+			return true;
+		}
+
+		uint32 isSmall;
+		if (!decoder.ReadBits(isSmall, 1))
+		{
+			return false;
+		}
+
+		if (isSmall)
+		{
+			glm::uvec3 delta;
+			if (!decoder.ReadBits(delta.x, PLAYER_SNAPSHOT_DELTA_BITS) ||
+				!decoder.ReadBits(delta.y, PLAYER_SNAPSHOT_DELTA_BITS) ||
+				!decoder.ReadBits(delta.z, PLAYER_SNAPSHOT_DELTA_BITS))
+			{
+				return false;
+			}
+
+			value = glm::uvec3(glm::ivec3(*pBaseline) + glm::ivec3(delta) - glm::ivec3(DELTA_MAX));
+			return true;
+		}
+	}
+
+	return
+		decoder.ReadBits(value.x, bitCount) &&
+		decoder.ReadBits(value.y, bitCount) &&
+		decoder.ReadBits(value.z, bitCount);
+}
+
+bool PacketPlayerActionResponse::EncodeSnapshot(BinaryEncoder& encoder, const PacketPlayerActionResponse& packet, const Snapshot* pBaseline, Snapshot& snapshot)
+{
+	snapshot.Position	= QuantizeVec3(packet.Position, -PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BITS);
+	snapshot.Velocity	= QuantizeVec3(packet.Velocity, -PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BITS);
+	snapshot.Rotation	= QuantizeQuat(packet.Rotation, PLAYER_SNAPSHOT_ROTATION_BITS);
+
+	if (!WriteDeltaVec3(encoder, snapshot.Position, pBaseline ? &pBaseline->Position : nullptr, PLAYER_SNAPSHOT_POSITION_BITS) ||
+		!WriteDeltaVec3(encoder, snapshot.Velocity, pBaseline ? &pBaseline->Velocity : nullptr, PLAYER_SNAPSHOT_VELOCITY_BITS))
+	{
+		return false;
+	}
+
+	const bool rotationChanged = !pBaseline || pBaseline->Rotation != snapshot.Rotation;
+	if (pBaseline && !encoder.WriteBits(rotationChanged ? 1 : 0, 1))
+	{
+		return false;
+	}
+
+	if (rotationChanged && !encoder.WriteQuantizedQuat(snapshot.Rotation, PLAYER_SNAPSHOT_ROTATION_BITS))
+	{
+		return false;
+	}
+
+	if (!encoder.WriteBits(packet.Walking ? 1 : 0, 1) ||
+		!encoder.WriteBits(packet.InAir ? 1 : 0, 1) ||
+		!encoder.WriteBits(uint32(packet.FiredAmmo), 2))
+	{
+		return false;
+	}
+
+	// The weapon fields are only read when a projectile was fired
+	if (packet.FiredAmmo != EAmmoType::AMMO_TYPE_NONE)
+	{
+		return
+			encoder.WriteQuantizedVec3(packet.WeaponPosition, -PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BITS) &&
+			encoder.WriteQuantizedVec3(packet.WeaponVelocity, -PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BITS) &&
+			encoder.WriteBits(packet.Angle, PLAYER_SNAPSHOT_ANGLE_BITS);
+	}
+
+	return true;
+}
+
+bool PacketPlayerActionResponse::DecodeSnapshot(BinaryDecoder& decoder, PacketPlayerActionResponse& packet, const Snapshot* pBaseline, Snapshot& snapshot)
+{
+	if (!ReadDeltaVec3(decoder, snapshot.Position, pBaseline ? &pBaseline->Position : nullptr, PLAYER_SNAPSHOT_POSITION_BITS) ||
+		!ReadDeltaVec3(decoder, snapshot.Velocity, pBaseline ? &pBaseline->Velocity : nullptr, PLAYER_SNAPSHOT_VELOCITY_BITS))
+	{
+		return false;
+	}
+
+	uint32 rotationChanged = 1;
+	if (pBaseline && !decoder.ReadBits(rotationChanged, 1))
+	{
+		return false;
+	}
+
+	if (rotationChanged)
+	{
+		if (!decoder.ReadQuantizedQuat(snapshot.Rotation, PLAYER_SNAPSHOT_ROTATION_BITS))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		snapshot.Rotation = pBaseline->Rotation;
+	}
+
+	packet.Position	= DequantizeVec3(snapshot.Position, -PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BITS);
+	packet.Velocity	= DequantizeVec3(snapshot.Velocity, -PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BITS);
+	packet.Rotation	= DequantizeQuat(snapshot.Rotation, PLAYER_SNAPSHOT_ROTATION_BITS);
+
+	uint32 walking;
+	uint32 inAir;
+	uint32 firedAmmo;
+	if (!decoder.ReadBits(walking, 1) ||
+		!decoder.ReadBits(inAir, 1) ||
+		!decoder.ReadBits(firedAmmo, 2))
+	{
+		return false;
+	}
+
+	packet.Walking		= walking != 0;
+	packet.InAir		= inAir != 0;
+	packet.FiredAmmo	= EAmmoType(firedAmmo);
+
+	// The packet is packed, so the fields are read into locals instead of being passed by reference
+	glm::vec3	weaponPosition	= glm::vec3(0.0f);
+	glm::vec3	weaponVelocity	= glm::vec3(0.0f);
+	uint32		angle			= 0;
+	if (packet.FiredAmmo != EAmmoType::AMMO_TYPE_NONE)
+	{
+		if (!decoder.ReadQuantizedVec3(weaponPosition, -PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BOUND, PLAYER_SNAPSHOT_POSITION_BITS) ||
+			!decoder.ReadQuantizedVec3(weaponVelocity, -PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BOUND, PLAYER_SNAPSHOT_VELOCITY_BITS) ||
+			!decoder.ReadBits(angle, PLAYER_SNAPSHOT_ANGLE_BITS))
+		{
+			return false;
+		}
+	}
+
+	packet.WeaponPosition	= weaponPosition;
+	packet.WeaponVelocity	= weaponVelocity;
+	packet.Angle			= angle;
+	return true;
+}
@@ -2,12 +2,28 @@
 
 #include "Resources/ResourceManager.h"
 
+#include "Engine/EngineLoop.h"
+
 #include "Game/ECS/Components/Rendering/AnimationComponent.h"
 
 bool ResourceCatalog::Init()
 {
 	using namespace LambdaEngine;
 
+	// Start decoding the assets that are loaded through the plain file loaders below on the streaming workers, the
+	// loads below then only wait for and register them
+	{
+		ResourceManager::LoadTextureFromFileAsync("MeshPainting/BrushMaskV3.png", EFormat::FORMAT_R8G8B8A8_UNORM, false, false, EStreamingPriority::STREAMING_PRIORITY_HIGH);
+		ResourceManager::LoadMeshFromFileAsync("Player/Idle.glb", EStreamingPriority::STREAMING_PRIORITY_HIGH);
+		ResourceManager::LoadMeshFromFileAsync("sphere.obj");
+
+		if (!EngineLoop::IsHeadless())
+		{
+			ResourceManager::LoadMeshFromFileAsync("Gun/WeaponLiquidWater.glb");
+			ResourceManager::LoadMeshFromFileAsync("Gun/WeaponLiquidPaint.glb");
+		}
+	}
+
 	//Music
 	{
 		MAIN_MENU_MUSIC_GUID = ResourceManager::LoadMusicFromFile("MainMenuCC.mp3");
@@ -71,7 +87,8 @@ bool ResourceCatalog::Init()
 		WEAPON_SOUND_OUTOFAMMO_2D_GUID = ResourceManager::LoadSoundEffect2DFromFile("Weapon/WaterSound.mp3");
 	}
 
-	// First person weapon and hands
+	// First person weapon and hands, only the local player has them
+	if (!EngineLoop::IsHeadless())
 	{
 		ARMS_FIRST_PERSON_ANIMATION_GUIDs = ResourceManager::LoadAnimationsFromFile("Gun/ArmsAnimation.glb");
 
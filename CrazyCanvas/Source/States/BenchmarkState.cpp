@@ -4,6 +4,7 @@
 #include "Application/API/Events/EventQueue.h"
 
 #include "Debug/GPUProfiler.h"
+#include "Debug/MicroBenchmarks.h"
 
 #include "ECS/ECSCore.h"
 
@@ -408,6 +409,20 @@ void BenchmarkState::PrintBenchmarkResults()
 	writer.String("AverageVRAM");
 	writer.Double(pGPUProfiler->GetAverageDeviceMemory() / MB);
 
+	TArray<MicroBenchmarkResult> microBenchmarkResults;
+	MicroBenchmarks::RunAll(microBenchmarkResults);
+
+	writer.String("MicroBenchmarks");
+	writer.StartObject();
+
+	for (const MicroBenchmarkResult& result : microBenchmarkResults)
+	{
+		writer.String(result.Name.c_str());
+		writer.Double(result.Value);
+	}
+
+	writer.EndObject();
+
 	writer.EndObject();
 
 	FILE* pFile = fopen("benchmark_results.json", "w");
@@ -40,8 +40,12 @@
 
 #include "Chat/ChatManager.h"
 
-#include <windows.h>
-#include <Lmcons.h>
+#ifdef LAMBDA_PLATFORM_WINDOWS
+	#include <windows.h>
+	#include <Lmcons.h>
+#else
+	#include <unistd.h>
+#endif
 
 using namespace LambdaEngine;
 
@@ -57,11 +61,7 @@ ServerState::ServerState(const std::string& clientHostID) :
 	else
 		m_ClientHostID = Random::Int32(0);
 
-	DWORD length = UNLEN + 1;
-	char buffer[UNLEN + 1];
-	GetUserNameA(buffer, &length);
-
-	String name = buffer;
+	String name = GetHostUserName();
 	name += "'s server";
 	strcpy(m_GameSettings.ServerName, name.c_str());
 	m_MapName = LevelManager::GetLevelNames()[0];
@@ -142,6 +142,33 @@ EServerState ServerState::GetState()
 	return s_State;
 }
 
+String ServerState::GetHostUserName()
+{
+#ifdef LAMBDA_PLATFORM_WINDOWS
+	DWORD length = UNLEN + 1;
+	char buffer[UNLEN + 1];
+	if (GetUserNameA(buffer, &length))
+	{
+		return buffer;
+	}
+#else
+	// A dedicated server started by a service manager has no login session, fall back to the environment
+	char buffer[256];
+	if (getlogin_r(buffer, sizeof(buffer)) == 0)
+	{
+		return buffer;
+	}
+
+	const char* pUser = getenv("USER");
+	if (pUser != nullptr)
+	{
+		return pUser;
+	}
+#endif
+
+	return "Unknown";
+}
+
 bool ServerState::OnPacketGameSettingsReceived(const PacketReceivedEvent<PacketGameSettings>& event)
 {
 	const PacketGameSettings& packet = event.Packet;
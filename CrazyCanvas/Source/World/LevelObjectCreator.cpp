@@ -1292,8 +1292,10 @@ bool LevelObjectCreator::CreatePlayer(
 						.MaterialGUID = ResourceCatalog::ARMS_FIRST_PERSON_MATERIAL_GUID,
 					});
 				
+				// The arms stay at the origin and are drawn at the camera, so their position says nothing about their distance
 				AnimationComponent animationComponentWeapon = {};
 				animationComponentWeapon.Pose.pSkeleton = ResourceManager::GetMesh(ResourceCatalog::ARMS_FIRST_PERSON_MESH_GUID)->pSkeleton;
+				animationComponentWeapon.IgnoreLOD = true;
 
 				AnimationGraph* pAnimationGraphWeapon = DBG_NEW AnimationGraph();
 				pAnimationGraphWeapon->AddState(DBG_NEW AnimationState("Idle", ResourceCatalog::ARMS_FIRST_PERSON_ANIMATION_GUIDs[1]));
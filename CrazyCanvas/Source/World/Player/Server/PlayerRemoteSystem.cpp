@@ -54,77 +54,109 @@ void PlayerRemoteSystem::Init()
 void PlayerRemoteSystem::FixedTickMainThread(LambdaEngine::Timestamp deltaTime)
 {
 	ECSCore* pECS = ECSCore::GetInstance();
-	auto* pPlayerActionComponents			= pECS->GetComponentArray<PacketComponent<PacketPlayerAction>>();
-	auto* pPlayerActionResponseComponents	= pECS->GetComponentArray<PacketComponent<PacketPlayerActionResponse>>();
-	auto* pCharacterColliderComponents		= pECS->GetComponentArray<CharacterColliderComponent>();
-	auto* pPositionComponents	= pECS->GetComponentArray<PositionComponent>();
-	auto* pNetPosComponents		= pECS->GetComponentArray<NetworkPositionComponent>();
-	auto* pVelocityComponents	= pECS->GetComponentArray<VelocityComponent>();
-	auto* pRotationComponents	= pECS->GetComponentArray<RotationComponent>();
-
 	const float32 dt = (float32)deltaTime.AsSeconds();
-	for(Entity entityPlayer : m_Entities)
+
+	if (pECS->GetArchetypeStorage())
+	{
+		// The players' components are stored together in chunks, one array per component type
+		ForEachChunk<const PlayerBaseComponent, const PacketComponent<PacketPlayerAction>, PacketComponent<PacketPlayerActionResponse>, const NetworkPositionComponent, const PositionComponent, VelocityComponent, const RotationComponent, CharacterColliderComponent>(
+			[this, dt](uint32 entityCount, const Entity* pEntities, const PlayerBaseComponent*, const PacketComponent<PacketPlayerAction>* pPlayerActionComponents, PacketComponent<PacketPlayerActionResponse>* pPlayerActionResponseComponents,
+				const NetworkPositionComponent* pNetPosComponents, const PositionComponent* pPositionComponents, VelocityComponent* pVelocityComponents, const RotationComponent* pRotationComponents, CharacterColliderComponent* pCharacterColliderComponents)
+		{
+			for (uint32 playerIdx = 0; playerIdx < entityCount; playerIdx++)
+			{
+				TickPlayer(pEntities[playerIdx], dt, pPlayerActionComponents[playerIdx], pPlayerActionResponseComponents[playerIdx], pNetPosComponents[playerIdx], pPositionComponents[playerIdx], pVelocityComponents[playerIdx], pRotationComponents[playerIdx], pCharacterColliderComponents[playerIdx]);
+			}
+		});
+	}
+	else
 	{
-		const PacketComponent<PacketPlayerAction>& playerActionComponent = pPlayerActionComponents->GetConstData(entityPlayer);
-		PacketComponent<PacketPlayerActionResponse>& playerActionResponseComponent = pPlayerActionResponseComponents->GetData(entityPlayer);
-		const NetworkPositionComponent& netPosComponent = pNetPosComponents->GetConstData(entityPlayer);
-		const PositionComponent& constPositionComponent = pPositionComponents->GetConstData(entityPlayer);
-		VelocityComponent& velocityComponent = pVelocityComponents->GetData(entityPlayer);
-		const RotationComponent& constRotationComponent = pRotationComponents->GetConstData(entityPlayer);
-		CharacterColliderComponent& characterColliderComponent = pCharacterColliderComponents->GetData(entityPlayer);
+		auto* pPlayerActionComponents			= pECS->GetComponentArray<PacketComponent<PacketPlayerAction>>();
+		auto* pPlayerActionResponseComponents	= pECS->GetComponentArray<PacketComponent<PacketPlayerActionResponse>>();
+		auto* pCharacterColliderComponents		= pECS->GetComponentArray<CharacterColliderComponent>();
+		auto* pPositionComponents	= pECS->GetComponentArray<PositionComponent>();
+		auto* pNetPosComponents		= pECS->GetComponentArray<NetworkPositionComponent>();
+		auto* pVelocityComponents	= pECS->GetComponentArray<VelocityComponent>();
+		auto* pRotationComponents	= pECS->GetComponentArray<RotationComponent>();
+
+		for (Entity entityPlayer : m_Entities)
+		{
+			TickPlayer(
+				entityPlayer,
+				dt,
+				pPlayerActionComponents->GetConstData(entityPlayer),
+				pPlayerActionResponseComponents->GetData(entityPlayer),
+				pNetPosComponents->GetConstData(entityPlayer),
+				pPositionComponents->GetConstData(entityPlayer),
+				pVelocityComponents->GetData(entityPlayer),
+				pRotationComponents->GetConstData(entityPlayer),
+				pCharacterColliderComponents->GetData(entityPlayer));
+		}
+	}
+}
 
-		const TArray<PacketPlayerAction>& gameStates = playerActionComponent.GetPacketsReceived();
+void PlayerRemoteSystem::TickPlayer(
+	LambdaEngine::Entity entityPlayer,
+	float32 dt,
+	const PacketComponent<PacketPlayerAction>& playerActionComponent,
+	PacketComponent<PacketPlayerActionResponse>& playerActionResponseComponent,
+	const LambdaEngine::NetworkPositionComponent& netPosComponent,
+	const LambdaEngine::PositionComponent& constPositionComponent,
+	LambdaEngine::VelocityComponent& velocityComponent,
+	const LambdaEngine::RotationComponent& constRotationComponent,
+	LambdaEngine::CharacterColliderComponent& characterColliderComponent)
+{
+	const TArray<PacketPlayerAction>& gameStates = playerActionComponent.GetPacketsReceived();
 
-		if (!gameStates.IsEmpty())
+	if (!gameStates.IsEmpty())
+	{
+		for (const PacketPlayerAction& gameState : gameStates)
 		{
-			for (const PacketPlayerAction& gameState : gameStates)
-			{
-				PacketPlayerAction& currentGameState = m_CurrentGameStates[entityPlayer];
-				ASSERT(gameState.SimulationTick - 1 == currentGameState.SimulationTick);
-				currentGameState = gameState;
+			PacketPlayerAction& currentGameState = m_CurrentGameStates[entityPlayer];
+			ASSERT(gameState.SimulationTick - 1 == currentGameState.SimulationTick);
+			currentGameState = gameState;
 
-				if (constRotationComponent.Quaternion != gameState.Rotation)
-				{
-					RotationComponent& rotationComponent = const_cast<RotationComponent&>(constRotationComponent);
-					rotationComponent.Quaternion = gameState.Rotation;
-					rotationComponent.Dirty = true;
-				}
+			if (constRotationComponent.Quaternion != gameState.Rotation)
+			{
+				RotationComponent& rotationComponent = const_cast<RotationComponent&>(constRotationComponent);
+				rotationComponent.Quaternion = gameState.Rotation;
+				rotationComponent.Dirty = true;
+			}
 
-				physx::PxControllerState playerControllerState;
-				characterColliderComponent.pController->getState(playerControllerState);
-				bool inAir = playerControllerState.touchedShape == nullptr;
+			physx::PxControllerState playerControllerState;
+			characterColliderComponent.pController->getState(playerControllerState);
+			bool inAir = playerControllerState.touchedShape == nullptr;
 
-				glm::i8vec3 deltaAction(gameState.DeltaActionX, gameState.DeltaActionY, gameState.DeltaActionZ);
+			glm::i8vec3 deltaAction(gameState.DeltaActionX, gameState.DeltaActionY, gameState.DeltaActionZ);
 
-				PlayerActionSystem::ComputeVelocity(constRotationComponent.Quaternion, deltaAction, gameState.Walking, dt, velocityComponent.Velocity, gameState.HoldingFlag, inAir);
+			PlayerActionSystem::ComputeVelocity(constRotationComponent.Quaternion, deltaAction, gameState.Walking, dt, velocityComponent.Velocity, gameState.HoldingFlag, inAir);
 
-				CharacterControllerHelper::TickCharacterController(dt, characterColliderComponent, netPosComponent, velocityComponent);
+			CharacterControllerHelper::TickCharacterController(dt, characterColliderComponent, netPosComponent, velocityComponent);
 
-				PacketPlayerActionResponse packet;
-				packet.SimulationTick = gameState.SimulationTick;
+			PacketPlayerActionResponse packet;
+			packet.SimulationTick = gameState.SimulationTick;
 
-				packet.Position = netPosComponent.Position;
-				packet.Velocity = velocityComponent.Velocity;
-				packet.Rotation = constRotationComponent.Quaternion;
+			packet.Position = netPosComponent.Position;
+			packet.Velocity = velocityComponent.Velocity;
+			packet.Rotation = constRotationComponent.Quaternion;
 
-				packet.Walking = gameState.Walking;
-				packet.InAir = inAir;
+			packet.Walking = gameState.Walking;
+			packet.InAir = inAir;
 
-				packet.Angle = currentGameState.Angle;
-				playerActionResponseComponent.SendPacket(packet);
+			packet.Angle = currentGameState.Angle;
+			playerActionResponseComponent.SendPacket(packet);
 
-				if (constPositionComponent.Position != netPosComponent.Position)
-				{
-					PositionComponent& positionComponent = const_cast<PositionComponent&>(constPositionComponent);
-					positionComponent.Position = netPosComponent.Position;
-					positionComponent.Dirty = true;
-				}
+			if (constPositionComponent.Position != netPosComponent.Position)
+			{
+				PositionComponent& positionComponent = const_cast<PositionComponent&>(constPositionComponent);
+				positionComponent.Position = netPosComponent.Position;
+				positionComponent.Dirty = true;
 			}
 		}
-		else if(netPosComponent.Dirty)
-		{
-			CharacterControllerHelper::TickCharacterController(dt, characterColliderComponent, netPosComponent, velocityComponent);
-		}
+	}
+	else if(netPosComponent.Dirty)
+	{
+		CharacterControllerHelper::TickCharacterController(dt, characterColliderComponent, netPosComponent, velocityComponent);
 	}
 }
 
@@ -4,6 +4,8 @@
 	#include "Application/Win32/Win32Application.h"
 #elif defined(LAMBDA_PLATFORM_MACOS)
 	#include "Application/Mac/MacApplication.h"
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	#include "Application/Linux/LinuxApplication.h"
 #else
 	#error No platform defined
 #endif
@@ -4,6 +4,8 @@
 	#include "Application/Win32/Win32Console.h"
 #elif defined(LAMBDA_PLATFORM_MACOS)
 	#include "Application/Mac/MacConsole.h"
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	#include "Application/Linux/LinuxConsole.h"
 #else
 	#error No platform defined
 #endif
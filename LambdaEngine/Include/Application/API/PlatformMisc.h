@@ -4,6 +4,8 @@
 	#include "Application/Win32/Win32Misc.h"
 #elif defined(LAMBDA_PLATFORM_MACOS)
 	#include "Application/Mac/MacMisc.h"
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	#include "Application/Linux/LinuxMisc.h"
 #else
 	#error No platform defined
 #endif
@@ -0,0 +1,62 @@
+#pragma once
+#include "Application/API/Application.h"
+
+#include <atomic>
+
+namespace LambdaEngine
+{
+	/*
+	* HeadlessApplication - Application without an OS event loop, used when the engine runs headless.
+	* Windows created by it are HeadlessWindows and the application runs until Terminate is called,
+	* either by the game or when the process receives SIGINT or SIGTERM
+	*/
+	class LAMBDA_API HeadlessApplication : public Application
+	{
+	public:
+		HeadlessApplication() = default;
+		~HeadlessApplication();
+
+		// Application interface
+		virtual bool Create() override final;
+		virtual TSharedRef<Window> CreateWindow(const WindowDesc* pDesc) override final;
+
+		virtual bool Tick() override final;
+
+		virtual bool ProcessStoredEvents() override final;
+
+		/*
+		* Can be called from any thread
+		*/
+		virtual void Terminate() override final;
+
+		virtual bool SupportsRawInput() const override final;
+
+		virtual void SetMouseVisibility(bool visible) override final;
+		virtual void SetMousePosition(int32 x, int32 y) override final;
+		virtual void SetInputMode(TSharedRef<Window> window, EInputMode inputMode) override final;
+		virtual EInputMode GetInputMode(TSharedRef<Window> window) const override final;
+
+		virtual void QueryCPUStatistics(CPUStatistics* pCPUStat) const override final;
+
+		FORCEINLINE bool IsTerminating() const
+		{
+			return m_IsTerminating.load(std::memory_order_relaxed);
+		}
+
+	public:
+		static void PeekEvents()
+		{
+		}
+
+		static Application* CreateApplication();
+
+	private:
+		static void SignalHandler(int signal);
+
+	private:
+		std::atomic_bool m_IsTerminating = false;
+
+	private:
+		static HeadlessApplication* s_pApplication;
+	};
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Application/API/Window.h"
+
+namespace LambdaEngine
+{
+	/*
+	* HeadlessWindow - Window without any native window behind it, only remembers its description so that
+	* code querying the main window keeps working
+	*/
+	class HeadlessWindow : public Window
+	{
+	public:
+		HeadlessWindow() = default;
+		~HeadlessWindow() = default;
+
+		bool Init(const WindowDesc* pDesc);
+
+	public:
+		// Window interface
+		virtual void Show() override final;
+		virtual void Close() override final;
+
+		virtual void Minimize() override final;
+		virtual void Maximize() override final;
+
+		virtual bool IsActiveWindow() const override final;
+
+		virtual void Restore() override final;
+
+		virtual void ToggleFullscreen() override final;
+
+		virtual void SetTitle(const String& title) override final;
+
+		virtual void SetPosition(int32 x, int32 y) override final;
+		virtual void GetPosition(int32* pPosX, int32* pPosY) const override final;
+
+		virtual void SetSize(uint16 width, uint16 height) override final;
+
+		virtual uint16 GetWidth() const override final;
+		virtual uint16 GetHeight() const override final;
+
+		virtual bool IsValid() const override final;
+
+	private:
+		int32 m_PositionX = 0;
+		int32 m_PositionY = 0;
+	};
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Application/Headless/HeadlessApplication.h"
+
+namespace LambdaEngine
+{
+	// There is no windowing backend on Linux, it is only used to run headless dedicated servers
+	typedef HeadlessApplication PlatformApplication;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Application/API/Console.h"
+
+namespace LambdaEngine
+{
+	/*
+	* LinuxConsole writes to the terminal the process was started from, colors are set with ANSI escape codes
+	*/
+	class LAMBDA_API LinuxConsole : public Console
+	{
+	public:
+		static void Show();
+		static void Close();
+
+		static void Print(const char*, ...);
+		static void PrintLine(const char* pFormat, ...);
+		static void PrintV(const char* pFormat, va_list args);
+		static void PrintLineV(const char* pFormat, va_list args);
+
+		static void Clear();
+		static void ClearLastLine();
+
+		static void SetTitle(const char* pTitle);
+		static void SetColor(EConsoleColor);
+	};
+
+	typedef LinuxConsole PlatformConsole;
+}
+
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Application/API/Misc.h"
+
+namespace LambdaEngine
+{
+	class LAMBDA_API LinuxMisc : public Misc
+	{
+	public:
+		DECL_STATIC_CLASS(LinuxMisc);
+
+		/*
+		* There is no windowing system to show a message box with, the message is written to stderr
+		*/
+		static void MessageBox(const char* pCaption, const char* pText);
+
+		static void OutputDebugString(const char* pFormat, ...);
+		static void OutputDebugStringV(const char* pFormat, va_list args);
+	};
+
+	typedef LinuxMisc PlatformMisc;
+}
+
+#endif
@@ -23,6 +23,7 @@ namespace LambdaEngine
 
 	enum class EAudioAPI
 	{
+		NONE,
 		FMOD
 	};
 
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Audio/API/IAudioDevice.h"
+
+namespace LambdaEngine
+{
+	/*
+	* Audio device used by headless engines. Nothing is played and every Create-function returns nullptr, so
+	* callers have to be able to handle missing sound objects
+	*/
+	class AudioDeviceNull : public IAudioDevice
+	{
+	public:
+		AudioDeviceNull()	= default;
+		~AudioDeviceNull()	= default;
+
+		virtual bool Init(const AudioDeviceDesc* pDesc) override final;
+
+		virtual void Tick() override final;
+
+		virtual void UpdateAudioListener(uint32 index, const AudioListenerDesc* pDesc) override final;
+
+		virtual uint32				GetAudioListener(bool requestNew)						override final;
+		virtual IMusic*				CreateMusic(const MusicDesc* pDesc)						override final;
+		virtual ISoundEffect3D*		Create3DSoundEffect(const SoundEffect3DDesc* pDesc)		override final;
+		virtual ISoundEffect2D*		Create2DSoundEffect(const SoundEffect2DDesc* pDesc)		override final;
+		virtual ISoundInstance3D*	Create3DSoundInstance(const SoundInstance3DDesc* pDesc)	override final;
+		virtual ISoundInstance2D*	Create2DSoundInstance(const SoundInstance2DDesc* pDesc)	override final;
+		virtual IAudioGeometry*		CreateAudioGeometry(const AudioGeometryDesc* pDesc)		override final;
+		virtual IReverbSphere*		CreateReverbSphere(const ReverbSphereDesc* pDesc)		override final;
+
+		virtual void SetMasterVolume(float volume) override final;
+		virtual void SetMusicVolume(float volume) override final;
+
+		virtual float GetMasterVolume() const override final;
+		virtual float GetMusicVolume() const override final;
+
+	private:
+		float m_MasterVolume	= 1.0f;
+		float m_MusicVolume		= 1.0f;
+	};
+}
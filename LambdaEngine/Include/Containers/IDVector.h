@@ -1,8 +1,8 @@
 #pragma once
 
 #include "Containers/IDContainer.h"
+#include "Containers/SparseIndexMap.h"
 #include "Containers/TArray.h"
-#include "Containers/THashTable.h"
 
 #include <queue>
 
@@ -37,53 +37,53 @@ namespace LambdaEngine
 		// Index vector using ID, assumes ID is linked to an element
 		const T& IndexID(uint32 ID) const
 		{
-			auto indexItr = m_IDToIndex.find(ID);
-			VALIDATE_MSG(indexItr != m_IDToIndex.end(), "Attempted to index using an unregistered ID: %d", ID);
+			const uint32 index = m_IDToIndex.Find(ID);
+			VALIDATE_MSG(index != SparseIndexMap::INVALID_INDEX, "Attempted to index using an unregistered ID: %d", ID);
 
-			return m_Data[indexItr->second];
+			return m_Data[index];
 		}
 
 		T& IndexID(uint32 ID)
 		{
-			auto indexItr = m_IDToIndex.find(ID);
-			VALIDATE_MSG(indexItr != m_IDToIndex.end(), "Attempted to index using an unregistered ID: %d", ID);
+			const uint32 index = m_IDToIndex.Find(ID);
+			VALIDATE_MSG(index != SparseIndexMap::INVALID_INDEX, "Attempted to index using an unregistered ID: %d", ID);
 
-			return m_Data[indexItr->second];
+			return m_Data[index];
 		}
 
 		void PushBack(const T& newElement, uint32 ID)
 		{
 			m_Data.PushBack(newElement);
 			m_IDs.PushBack(ID);
-			m_IDToIndex[ID] = m_Data.GetSize() - 1;
+			m_IDToIndex.Set(ID, m_Data.GetSize() - 1);
 		}
 
 		void Pop(uint32 ID) override final
 		{
-			auto popIndexItr = m_IDToIndex.find(ID);
-			VALIDATE_MSG(popIndexItr != m_IDToIndex.end(), "Attempted to pop a non-existing element, ID: %d", ID);
+			const uint32 popIndex = m_IDToIndex.Find(ID);
+			VALIDATE_MSG(popIndex != SparseIndexMap::INVALID_INDEX, "Attempted to pop a non-existing element, ID: %d", ID);
 
-			m_Data[popIndexItr->second] = m_Data.GetBack();
-			m_IDs[popIndexItr->second] = m_IDs.GetBack();
+			m_Data[popIndex] = m_Data.GetBack();
+			m_IDs[popIndex] = m_IDs.GetBack();
 
-			m_IDToIndex[m_IDs.GetBack()] = popIndexItr->second;
+			m_IDToIndex.Set(m_IDs.GetBack(), popIndex);
 
 			m_Data.PopBack();
 			m_IDs.PopBack();
 
-			m_IDToIndex.erase(popIndexItr);
+			m_IDToIndex.Erase(ID);
 		}
 
 		void Clear()
 		{
 			m_Data.Clear();
 			m_IDs.Clear();
-			m_IDToIndex.clear();
+			m_IDToIndex.Clear();
 		}
 
 		bool HasElement(uint32 ID) const override final
 		{
-			return m_IDToIndex.contains(ID);
+			return m_IDToIndex.Contains(ID);
 		}
 
 		uint32 Size() const override final
@@ -142,7 +142,7 @@ namespace LambdaEngine
 		TArray<uint32> m_IDs;
 
 		// Maps IDs to indices to the data array
-		THashTable<uint32, uint32> m_IDToIndex;
+		SparseIndexMap m_IDToIndex;
 	};
 
 	class IDVector : public IDContainer
@@ -159,30 +159,33 @@ namespace LambdaEngine
 		void PushBack(uint32 ID)
 		{
 			m_IDs.PushBack(ID);
-			m_IDToIndex.insert({ID, m_IDs.GetSize() - 1});
+			if (!m_IDToIndex.Contains(ID))
+			{
+				m_IDToIndex.Set(ID, m_IDs.GetSize() - 1);
+			}
 		}
 
 		void Pop(uint32 ID) override final
 		{
-			auto popIndexItr = m_IDToIndex.find(ID);
-			VALIDATE_MSG(popIndexItr != m_IDToIndex.end(), "Attempted to pop a non-existing element, ID: %d", ID);
+			const uint32 popIndex = m_IDToIndex.Find(ID);
+			VALIDATE_MSG(popIndex != SparseIndexMap::INVALID_INDEX, "Attempted to pop a non-existing element, ID: %d", ID);
 
-			m_IDs[popIndexItr->second] = m_IDs.GetBack();
-			m_IDToIndex[m_IDs.GetBack()] = popIndexItr->second;
+			m_IDs[popIndex] = m_IDs.GetBack();
+			m_IDToIndex.Set(m_IDs.GetBack(), popIndex);
 			m_IDs.PopBack();
 
-			m_IDToIndex.erase(popIndexItr);
+			m_IDToIndex.Erase(ID);
 		}
 
 		void Clear()
 		{
 			m_IDs.Clear();
-			m_IDToIndex.clear();
+			m_IDToIndex.Clear();
 		}
 
 		bool HasElement(uint32 ID) const override final
 		{
-			return m_IDToIndex.contains(ID);
+			return m_IDToIndex.Contains(ID);
 		}
 
 		uint32 Size() const override final
@@ -233,6 +236,6 @@ namespace LambdaEngine
 	private:
 		TArray<uint32> m_IDs;
 		// Maps IDs to indices to the ID array
-		THashTable<uint32, uint32> m_IDToIndex;
+		SparseIndexMap m_IDToIndex;
 	};
 }
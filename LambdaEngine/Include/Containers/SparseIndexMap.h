@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Containers/TArray.h"
+#include "Types.h"
+
+#include <algorithm>
+
+// Amount of IDs covered by each page, pages are only allocated once an ID within them is inserted
+#define SPARSE_INDEX_MAP_PAGE_SIZE 4096u
+
+namespace LambdaEngine
+{
+	/*
+		Maps IDs to indices using a paged sparse array. Meant for IDs generated by IDGenerator, which are dense, where
+		a lookup is a shift and two array accesses rather than a hash and a bucket walk. Inserting does not allocate
+		unless the ID lands on a page that has not been touched before.
+	*/
+	class SparseIndexMap
+	{
+	public:
+		static constexpr const uint32 INVALID_INDEX = UINT32_MAX;
+
+	public:
+		SparseIndexMap() = default;
+		~SparseIndexMap() = default;
+
+		// Returns INVALID_INDEX if the ID is not mapped
+		FORCEINLINE uint32 Find(uint32 ID) const
+		{
+			const uint32 pageIdx = ID / SPARSE_INDEX_MAP_PAGE_SIZE;
+			if (pageIdx >= m_Pages.GetSize() || m_Pages[pageIdx].IsEmpty())
+			{
+				return INVALID_INDEX;
+			}
+
+			return m_Pages[pageIdx][ID % SPARSE_INDEX_MAP_PAGE_SIZE];
+		}
+
+		FORCEINLINE bool Contains(uint32 ID) const
+		{
+			return Find(ID) != INVALID_INDEX;
+		}
+
+		FORCEINLINE void Set(uint32 ID, uint32 index)
+		{
+			const uint32 pageIdx = ID / SPARSE_INDEX_MAP_PAGE_SIZE;
+			if (pageIdx >= m_Pages.GetSize())
+			{
+				m_Pages.Resize(pageIdx + 1);
+			}
+
+			TArray<uint32>& page = m_Pages[pageIdx];
+			if (page.IsEmpty())
+			{
+				page.Resize(SPARSE_INDEX_MAP_PAGE_SIZE, INVALID_INDEX);
+			}
+
+			page[ID % SPARSE_INDEX_MAP_PAGE_SIZE] = index;
+		}
+
+		FORCEINLINE void Erase(uint32 ID)
+		{
+			const uint32 pageIdx = ID / SPARSE_INDEX_MAP_PAGE_SIZE;
+			if (pageIdx < m_Pages.GetSize() && !m_Pages[pageIdx].IsEmpty())
+			{
+				m_Pages[pageIdx][ID % SPARSE_INDEX_MAP_PAGE_SIZE] = INVALID_INDEX;
+			}
+		}
+
+		// Pages are kept, as the same IDs are likely to be reused
+		void Clear()
+		{
+			for (TArray<uint32>& page : m_Pages)
+			{
+				if (!page.IsEmpty())
+				{
+					std::fill_n(page.GetData(), page.GetSize(), INVALID_INDEX);
+				}
+			}
+		}
+
+	private:
+		TArray<TArray<uint32>> m_Pages;
+	};
+}
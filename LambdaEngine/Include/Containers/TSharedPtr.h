@@ -409,7 +409,7 @@ namespace LambdaEngine
 			: TBase()
 		{
 			static_assert(std::is_convertible<TOther*, T*>());
-			TBase::template InternalMove<TOther>(::Move(other));
+			TBase::template InternalMove<TOther>(std::move(other));
 		}
 		
 		template<typename TOther>
@@ -423,7 +423,7 @@ namespace LambdaEngine
 		FORCEINLINE TSharedPtr(TSharedPtr<TOther>&& other, T* pPtr) noexcept
 			: TBase()
 		{
-			TBase::template InternalConstructStrong<TOther>(::Move(other), pPtr);
+			TBase::template InternalConstructStrong<TOther>(std::move(other), pPtr);
 		}
 
 		template<typename TOther>
@@ -489,7 +489,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::InternalMove(::Move(other));
+				TBase::InternalMove(std::move(other));
 			}
 
 			return *this;
@@ -517,7 +517,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::template InternalMove<TOther>(::Move(other));
+				TBase::template InternalMove<TOther>(std::move(other));
 			}
 
 			return *this;
@@ -595,7 +595,7 @@ namespace LambdaEngine
 		FORCEINLINE TSharedPtr(TSharedPtr&& other) noexcept
 			: TBase()
 		{
-			TBase::InternalMove(::Move(other));
+			TBase::InternalMove(std::move(other));
 		}
 
 		template<typename TOther>
@@ -617,7 +617,7 @@ namespace LambdaEngine
 		FORCEINLINE TSharedPtr(TSharedPtr<TOther[]>&& other, T* pPtr) noexcept
 			: TBase()
 		{
-			TBase::template InternalConstructStrong<TOther>(::Move(other), pPtr);
+			TBase::template InternalConstructStrong<TOther>(std::move(other), pPtr);
 		}
 
 		template<typename TOther>
@@ -625,7 +625,7 @@ namespace LambdaEngine
 			: TBase()
 		{
 			static_assert(std::is_convertible<TOther*, T*>());
-			TBase::template InternalMove<TOther>(::Move(other));
+			TBase::template InternalMove<TOther>(std::move(other));
 		}
 
 		template<typename TOther>
@@ -686,7 +686,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::InternalMove(::Move(other));
+				TBase::InternalMove(std::move(other));
 			}
 
 			return *this;
@@ -714,7 +714,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::template InternalMove<TOther>(::Move(other));
+				TBase::template InternalMove<TOther>(std::move(other));
 			}
 
 			return *this;
@@ -795,7 +795,7 @@ namespace LambdaEngine
 		FORCEINLINE TWeakPtr(TWeakPtr&& other) noexcept
 			: TBase()
 		{
-			TBase::InternalMove(::Move(other));
+			TBase::InternalMove(std::move(other));
 		}
 
 		template<typename TOther>
@@ -811,7 +811,7 @@ namespace LambdaEngine
 			: TBase()
 		{
 			static_assert(std::is_convertible<TOther*, T*>(), "TWeakPtr: Trying to convert non-convertable types");
-			TBase::template InternalMove<TOther>(::Move(other));
+			TBase::template InternalMove<TOther>(std::move(other));
 		}
 
 		FORCEINLINE ~TWeakPtr()
@@ -837,7 +837,7 @@ namespace LambdaEngine
 		FORCEINLINE TSharedPtr<T> MakeShared() noexcept
 		{
 			const TWeakPtr& thisPtr = *this;
-			return ::Move(TSharedPtr<T>(thisPtr));
+			return TSharedPtr<T>(thisPtr);
 		}
 
 		FORCEINLINE T* operator->() const noexcept
@@ -867,7 +867,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::InternalMove(::Move(other));
+				TBase::InternalMove(std::move(other));
 			}
 
 			return *this;
@@ -895,7 +895,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::InternalMove(::Move(other));
+				TBase::InternalMove(std::move(other));
 			}
 
 			return *this;
@@ -976,7 +976,7 @@ namespace LambdaEngine
 		FORCEINLINE TWeakPtr(TWeakPtr&& other) noexcept
 			: TBase()
 		{
-			TBase::InternalMove(::Move(other));
+			TBase::InternalMove(std::move(other));
 		}
 
 		template<typename TOther>
@@ -992,7 +992,7 @@ namespace LambdaEngine
 			: TBase()
 		{
 			static_assert(std::is_convertible<TOther*, T*>(), "TWeakPtr: Trying to convert non-convertable types");
-			TBase::template InternalMove<TOther>(::Move(other));
+			TBase::template InternalMove<TOther>(std::move(other));
 		}
 
 		FORCEINLINE ~TWeakPtr()
@@ -1018,7 +1018,7 @@ namespace LambdaEngine
 		FORCEINLINE TSharedPtr<T[]> MakeShared() noexcept
 		{
 			const TWeakPtr& thisPtr = *this;
-			return ::Move(TSharedPtr<T[]>(thisPtr));
+			return TSharedPtr<T[]>(thisPtr);
 		}
 		
 		FORCEINLINE T& operator[](uint32 index) noexcept
@@ -1043,7 +1043,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::InternalMove(::Move(other));
+				TBase::InternalMove(std::move(other));
 			}
 
 			return *this;
@@ -1071,7 +1071,7 @@ namespace LambdaEngine
 			if (this != std::addressof(other))
 			{
 				Reset();
-				TBase::InternalMove(::Move(other));
+				TBase::InternalMove(std::move(other));
 			}
 
 			return *this;
@@ -1122,7 +1122,7 @@ namespace LambdaEngine
 	std::enable_if_t<!std::is_array_v<T>, TSharedPtr<T>> MakeShared(TArgs&&... Args) noexcept
 	{
 		T* pRefCountedPtr = DBG_NEW T(Forward<TArgs>(Args)...);
-		return ::Move(TSharedPtr<T>(pRefCountedPtr));
+		return TSharedPtr<T>(pRefCountedPtr);
 	}
 
 	template<typename T>
@@ -1131,7 +1131,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T>;
 
 		TType* pRefCountedPtr = DBG_NEW TType[size];
-		return ::Move(TSharedPtr<T>(pRefCountedPtr));
+		return TSharedPtr<T>(pRefCountedPtr);
 	}
 
 	/*
@@ -1145,7 +1145,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = static_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(pPointer, pRawPointer));
+		return TSharedPtr<T0>(pPointer, pRawPointer);
 	}
 
 	template<typename T0, typename T1>
@@ -1154,7 +1154,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = static_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(::Move(pPointer), pRawPointer));
+		return TSharedPtr<T0>(std::move(pPointer), pRawPointer);
 	}
 
 	// const_cast
@@ -1164,7 +1164,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = const_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(pPointer, pRawPointer));
+		return TSharedPtr<T0>(pPointer, pRawPointer);
 	}
 
 	template<typename T0, typename T1>
@@ -1173,7 +1173,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = const_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(::Move(pPointer), pRawPointer));
+		return TSharedPtr<T0>(std::move(pPointer), pRawPointer);
 	}
 
 	// reinterpret_cast
@@ -1183,7 +1183,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = reinterpret_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(pPointer, pRawPointer));
+		return TSharedPtr<T0>(pPointer, pRawPointer);
 	}
 
 	template<typename T0, typename T1>
@@ -1192,7 +1192,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = reinterpret_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(::Move(pPointer), pRawPointer));
+		return TSharedPtr<T0>(std::move(pPointer), pRawPointer);
 	}
 
 	// dynamic_cast
@@ -1202,7 +1202,7 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = dynamic_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(pPointer, pRawPointer));
+		return TSharedPtr<T0>(pPointer, pRawPointer);
 	}
 
 	template<typename T0, typename T1>
@@ -1211,6 +1211,6 @@ namespace LambdaEngine
 		using TType = TRemoveExtent<T0>;
 		
 		TType* pRawPointer = dynamic_cast<TType*>(pPointer.Get());
-		return ::Move(TSharedPtr<T0>(::Move(pPointer), pRawPointer));
+		return TSharedPtr<T0>(std::move(pPointer), pRawPointer);
 	}
 }
\ No newline at end of file
@@ -41,7 +41,7 @@ namespace LambdaEngine
 		FORCEINLINE TUniquePtr(TUniquePtr<TOther>&& other) noexcept
 			: m_pPtr(other.m_pPtr)
 		{
-			static_assert(std::is_convertible<TOther, T>);
+			static_assert(std::is_convertible<TOther*, T*>());
 			other.m_pPtr = nullptr;
 		}
 
@@ -121,7 +121,7 @@ namespace LambdaEngine
 		template<typename TOther>
 		FORCEINLINE TUniquePtr& operator=(TUniquePtr<TOther>&& other) noexcept
 		{
-			static_assert(std::is_convertible<TOther, T>);
+			static_assert(std::is_convertible<TOther*, T*>());
 
 			if (this != std::addressof(other))
 			{
@@ -206,7 +206,7 @@ namespace LambdaEngine
 		FORCEINLINE TUniquePtr(TUniquePtr<TOther>&& other) noexcept
 			: m_pPtr(other.m_pPtr)
 		{
-			static_assert(std::is_convertible<TOther, T>);
+			static_assert(std::is_convertible<TOther*, T*>());
 			other.m_pPtr = nullptr;
 		}
 
@@ -282,7 +282,7 @@ namespace LambdaEngine
 		template<typename TOther>
 		FORCEINLINE TUniquePtr& operator=(TUniquePtr<TOther>&& other) noexcept
 		{
-			static_assert(std::is_convertible<TOther, T>);
+			static_assert(std::is_convertible<TOther*, T*>());
 
 			if (this != std::addressof(other))
 			{
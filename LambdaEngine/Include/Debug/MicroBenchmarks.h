@@ -0,0 +1,84 @@
+#pragma once
+
+#include "LambdaEngine.h"
+
+#include "Containers/String.h"
+#include "Containers/TArray.h"
+
+namespace LambdaEngine
+{
+	struct MicroBenchmarkResult
+	{
+		String	Name;
+		float64	Value;
+	};
+
+	/*
+	* Isolated measurements of engine subsystems, written next to the frame statistics when running the benchmark state
+	*/
+	class LAMBDA_API MicroBenchmarks
+	{
+	public:
+		DECL_STATIC_CLASS(MicroBenchmarks);
+
+		/*
+		* Runs all micro benchmarks
+		*
+		* results - Array that the results are appended to
+		*/
+		static void RunAll(TArray<MicroBenchmarkResult>& results);
+
+		/*
+		* Schedules a fixed amount of small jobs with 1, 2, 4 ... ThreadPool::GetThreadCount() active workers and
+		* reports the throughput in jobs per second for each worker count. The jobs are scheduled from a worker, so the
+		* calling thread does not execute any of them
+		*
+		* results - Array that the results are appended to
+		*/
+		static void RunThreadPoolScaling(TArray<MicroBenchmarkResult>& results);
+
+		/*
+		* Compares the hash tables previously used for entity lookups against SparseIndexMap and ComponentMask, for
+		* 10k and 100k entities. Reports the average time in nanoseconds per operation.
+		*
+		* results - Array that the results are appended to
+		*/
+		static void RunECSContainers(TArray<MicroBenchmarkResult>& results);
+
+		/*
+		* Iterates 100k entities spread over several archetypes once through ForEachChunk and once entity by entity, in
+		* a component storage of its own with archetype storage enabled. Checks that chunk iteration visits the same
+		* entities and components as the per-entity lookups, reports the amount of mismatches and the average time in
+		* nanoseconds per entity for both ways of iterating
+		*
+		* results - Array that the results are appended to
+		*/
+		static void RunECSChunkIteration(TArray<MicroBenchmarkResult>& results);
+
+		/*
+		* Animates 9 and 200 instances of the BenchmarkState robot for 60 frames on the calling thread, each starting at
+		* another point of the walk clip, and skins the robot mesh on the CPU with every evaluated pose. The animation is
+		* evaluated without the pose cache, with the pose cache and at the farthest LOD. Reports the average evaluation
+		* time in nanoseconds per character and frame for each, and the skinning time in nanoseconds per vertex
+		*
+		* results - Array that the results are appended to
+		*/
+		static void RunAnimation(TArray<MicroBenchmarkResult>& results);
+
+		/*
+		* Simulates a 64 client UDP server at 60 Hz over an in-memory loopback and reports the server's average
+		* packet manager time per tick in milliseconds, covering enqueueing, flushing, receiving and resends
+		*
+		* results - Array that the results are appended to
+		*/
+		static void RunPacketManagerLoopback(TArray<MicroBenchmarkResult>& results);
+
+		/*
+		* Sends a tick worth of datagrams to 64 clients over 127.0.0.1, once with one SendTo per datagram and once
+		* with SendToBatch, and reports the average send time per datagram in microseconds for both
+		*
+		* results - Array that the results are appended to
+		*/
+		static void RunSocketLoopback(TArray<MicroBenchmarkResult>& results);
+	};
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "Containers/TArray.h"
+#include "Containers/THashTable.h"
+#include "Defines.h"
+#include "ECS/ComponentType.h"
+#include "ECS/Entity.h"
+
+#include <type_traits>
+#include <utility>
+
+// Size of a chunk's memory block, chunks holding components larger than this are grown to fit a single entity
+#define ARCHETYPE_CHUNK_SIZE (16u * 1024u)
+// The entity IDs and every component column in a chunk start on a cache line
+#define ARCHETYPE_COLUMN_ALIGNMENT 64u
+
+namespace LambdaEngine
+{
+	class IComponentArray;
+
+	// The components of a single type within each chunk of an archetype
+	struct ArchetypeColumn
+	{
+		const ComponentType* pComponentType;
+		IComponentArray* pComponentArray;
+		uint32 ComponentSize;
+		// Offset in bytes from the beginning of a chunk
+		uint32 Offset;
+	};
+
+	/*	A fixed-size block of memory storing entities and their components in SoA layout. The chunk begins with the
+		entity IDs, followed by one column per component type. */
+	struct ArchetypeChunk
+	{
+		byte* pAllocation;
+		// pAllocation aligned to ARCHETYPE_COLUMN_ALIGNMENT
+		byte* pData;
+		uint32 EntityCount;
+	};
+
+	// The entities that have exactly the same set of component types
+	struct Archetype
+	{
+		// Sorted by component type to allow comparing archetypes and walking two archetypes' columns side by side
+		TArray<ArchetypeColumn> Columns;
+		/*	Every chunk but the last one is full. Removing an entity moves the archetype's last entity into the hole,
+			meaning an archetype's entities are always tightly packed. */
+		TArray<ArchetypeChunk> Chunks;
+		uint32 ChunkCapacity = 0;
+		uint32 ChunkSize = 0;
+		uint32 EntityCount = 0;
+
+		// Archetypes reached by adding or removing a single component type, cached when first traversed
+		THashTable<const ComponentType*, uint32> AddEdges;
+		THashTable<const ComponentType*, uint32> RemoveEdges;
+	};
+
+	struct EntityLocation
+	{
+		uint32 ArchetypeIndex = UINT32_MAX;
+		uint32 ChunkIndex = 0;
+		uint32 Row = 0;
+	};
+
+	/*	ArchetypeStorage groups entities by their set of component types. Entities in the same archetype are stored
+		in chunks, where each component type is a contiguous array. Components are owned by the storage once they
+		have been committed, before that they are staged in their component array. */
+	class ArchetypeStorage
+	{
+	public:
+		DECL_UNIQUE_CLASS(ArchetypeStorage);
+		ArchetypeStorage() = default;
+		~ArchetypeStorage();
+
+		// Destroys every stored component. Has to be called while the component arrays are still alive.
+		void Release();
+
+		// Moves the entity's staged component out of the component array and into the entity's new archetype
+		void CommitComponent(Entity entity, IComponentArray* pComponentArray);
+		// Destroys the component and moves the entity into the archetype without the component type
+		void RemoveComponent(Entity entity, const ComponentType* pComponentType);
+
+		// Returns nullptr if the entity has no committed components
+		FORCEINLINE const EntityLocation* GetEntityLocation(Entity entity) const
+		{
+			return entity < m_EntityLocations.GetSize() && m_EntityLocations[entity].ArchetypeIndex != UINT32_MAX ? &m_EntityLocations[entity] : nullptr;
+		}
+
+		FORCEINLINE byte* GetComponent(const EntityLocation& location, uint32 columnIndex) const
+		{
+			const Archetype& archetype = m_Archetypes[location.ArchetypeIndex];
+			const ArchetypeColumn& column = archetype.Columns[columnIndex];
+			return archetype.Chunks[location.ChunkIndex].pData + column.Offset + location.Row * column.ComponentSize;
+		}
+
+		/*	Calls func once per chunk containing entities that have all of Comps and none of the excluded types.
+			func is called as func(uint32 entityCount, const Entity* pEntities, Comps* pComponents...), where each
+			component pointer is the start of a contiguous, cache line aligned array of entityCount components.
+			Dirty flags are set on every component requested as non-const. */
+		template<typename... Comps, typename Func>
+		void ForEachChunk(const TArray<const ComponentType*>& excludedTypes, Func&& func);
+
+		FORCEINLINE uint32 GetArchetypeCount() const { return m_Archetypes.GetSize(); }
+		FORCEINLINE const Archetype& GetArchetype(uint32 archetypeIndex) const { return m_Archetypes[archetypeIndex]; }
+
+	private:
+		uint32 FindArchetypeWithType(uint32 archetypeIndex, IComponentArray* pComponentArray);
+		// Returns UINT32_MAX if the component type is the archetype's only type
+		uint32 FindArchetypeWithoutType(uint32 archetypeIndex, const ComponentType* pComponentType);
+		uint32 FindOrCreateArchetype(TArray<ArchetypeColumn>& columns);
+
+		// Appends a row to the archetype's last chunk and stores the entity ID in it
+		EntityLocation AllocateRow(uint32 archetypeIndex, Entity entity);
+		/*	Fills the hole left by a removed row with the archetype's last row. Every component in the removed row
+			has to have been moved out or destroyed already. */
+		void FreeRow(const EntityLocation& location);
+
+		// Moves the components that both archetypes have from the source row to the destination row
+		void MoveRow(const EntityLocation& source, const EntityLocation& destination);
+
+		// Returns false if the archetype lacks any of the required types or has any of the excluded types
+		static bool FindColumns(const Archetype& archetype, const ComponentType* const* ppComponentTypes, uint32 componentTypeCount, const TArray<const ComponentType*>& excludedTypes, uint32* pColumnIndices);
+
+		template<typename... Comps, typename Func, size_t... Indices>
+		static void InvokeChunk(const Archetype& archetype, const ArchetypeChunk& chunk, const uint32* pColumnIndices, Func& func, std::index_sequence<Indices...>);
+
+		template<typename Comp>
+		static void SetDirtyFlags(Comp* pComponents, uint32 componentCount);
+
+	private:
+		TArray<Archetype> m_Archetypes;
+		// Indexed by entity
+		TArray<EntityLocation> m_EntityLocations;
+	};
+
+	template<typename... Comps, typename Func>
+	inline void ArchetypeStorage::ForEachChunk(const TArray<const ComponentType*>& excludedTypes, Func&& func)
+	{
+		static_assert(sizeof...(Comps) > 0, "ForEachChunk requires at least one component type");
+
+		constexpr const uint32 componentTypeCount = (uint32)sizeof...(Comps);
+		const ComponentType* const pComponentTypes[componentTypeCount] = { std::remove_const_t<Comps>::Type()... };
+		uint32 columnIndices[componentTypeCount];
+
+		for (const Archetype& archetype : m_Archetypes)
+		{
+			if (archetype.EntityCount == 0 || !FindColumns(archetype, pComponentTypes, componentTypeCount, excludedTypes, columnIndices))
+			{
+				continue;
+			}
+
+			for (const ArchetypeChunk& chunk : archetype.Chunks)
+			{
+				InvokeChunk<Comps...>(archetype, chunk, columnIndices, func, std::index_sequence_for<Comps...>());
+			}
+		}
+	}
+
+	template<typename... Comps, typename Func, size_t... Indices>
+	inline void ArchetypeStorage::InvokeChunk(const Archetype& archetype, const ArchetypeChunk& chunk, const uint32* pColumnIndices, Func& func, std::index_sequence<Indices...>)
+	{
+		(SetDirtyFlags<Comps>(reinterpret_cast<Comps*>(chunk.pData + archetype.Columns[pColumnIndices[Indices]].Offset), chunk.EntityCount), ...);
+		func(chunk.EntityCount, reinterpret_cast<const Entity*>(chunk.pData), reinterpret_cast<Comps*>(chunk.pData + archetype.Columns[pColumnIndices[Indices]].Offset)...);
+	}
+
+	template<typename Comp>
+	inline void ArchetypeStorage::SetDirtyFlags(Comp* pComponents, uint32 componentCount)
+	{
+		if constexpr (!std::is_const_v<Comp> && Comp::HasDirtyFlag())
+		{
+			for (uint32 componentIdx = 0; componentIdx < componentCount; componentIdx++)
+			{
+				pComponents[componentIdx].Dirty = true;
+			}
+		}
+	}
+}
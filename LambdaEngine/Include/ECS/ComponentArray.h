@@ -1,7 +1,9 @@
 #pragma once
 
+#include "Containers/SparseIndexMap.h"
 #include "Containers/THashTable.h"
 #include "Defines.h"
+#include "ECS/ArchetypeStorage.h"
 #include "ECS/Component.h"
 #include "ECS/Entity.h"
 
@@ -12,6 +14,7 @@
 
 namespace LambdaEngine
 {
+	class ArchetypeStorage;
 	class ComponentStorage;
 
 	#pragma pack(push, 1)
@@ -40,10 +43,24 @@ namespace LambdaEngine
 
 		virtual void* GetRawData(Entity entity) = 0;
 
+		virtual const ComponentType* GetComponentType() const = 0;
+
 	protected:
 		// Systems or other external users should not be able to perform immediate deletions
 		friend ComponentStorage;
 		virtual void Remove(Entity entity) = 0;
+
+		// Type-erased component operations used by the archetype storage to move components between chunks
+		friend ArchetypeStorage;
+		virtual uint32 GetComponentSize() const = 0;
+		virtual uint32 GetComponentAlignment() const = 0;
+		virtual void SetArchetypeColumn(uint32 archetypeIndex, uint32 columnIndex) = 0;
+		// Move constructs the entity's staged component at the destination and erases it from the staging area
+		virtual void MoveStagedComponent(Entity entity, void* pDestination) = 0;
+		// Move constructs the component at the destination and destroys the source component
+		virtual void MoveComponent(void* pDestination, void* pSource) = 0;
+		// Calls the component owner's destructor, if one is set, and destroys the component
+		virtual void DestroyComponent(void* pComponent, Entity entity) = 0;
 	};
 
 	template<typename Comp>
@@ -53,6 +70,10 @@ namespace LambdaEngine
 		ComponentArray() = default;
 		~ComponentArray() override final;
 
+		/*	Components are then staged in the component array when inserted, and moved into the archetype storage when
+			committed. Has to be set before any component is inserted. */
+		void SetArchetypeStorage(ArchetypeStorage* pArchetypeStorage) { m_pArchetypeStorage = pArchetypeStorage; }
+
 		void SetComponentOwner(const ComponentOwnership<Comp>& componentOwnership) { m_ComponentOwnership = componentOwnership; }
 		void UnsetComponentOwner() override final { m_ComponentOwnership = {}; }
 
@@ -73,43 +94,70 @@ namespace LambdaEngine
 		uint32 SerializeComponent(const Comp& component, uint8* pBuffer, uint32 bufferSize) const;
 		bool DeserializeComponent(Entity entity, const uint8* pBuffer, uint32 serializationSize, bool& entityHadComponent);
 
-		bool HasComponent(Entity entity) const override final { return m_EntityToIndex.find(entity) != m_EntityToIndex.end(); }
+		bool HasComponent(Entity entity) const override final { return m_EntityToIndex.Contains(entity); }
 		void ResetDirtyFlags() override final;
 
+		const ComponentType* GetComponentType() const override final { return Comp::Type(); }
+
 	protected:
 		void Remove(Entity entity) override final;
 
+		uint32 GetComponentSize() const override final { return sizeof(Comp); }
+		uint32 GetComponentAlignment() const override final { return alignof(Comp); }
+		void SetArchetypeColumn(uint32 archetypeIndex, uint32 columnIndex) override final;
+		void MoveStagedComponent(Entity entity, void* pDestination) override final;
+		void MoveComponent(void* pDestination, void* pSource) override final;
+		void DestroyComponent(void* pComponent, Entity entity) override final;
+
+	private:
+		// Returns nullptr if the entity does not have the component
+		Comp* FindComponent(Entity entity);
+		const Comp* FindComponent(Entity entity) const;
+
 	private:
 		TArray<Comp> m_Data;
 		TArray<uint32> m_IDs;
-		THashTable<Entity, uint32> m_EntityToIndex;
+		// Maps entities to their index in m_IDs, which is also the index in m_Data when archetype storage is not used
+		SparseIndexMap m_EntityToIndex;
 
 		ComponentOwnership<Comp> m_ComponentOwnership;
+
+		// Only used with archetype storage
+		ArchetypeStorage* m_pArchetypeStorage = nullptr;
+		// The column of the component type in each archetype, indexed by archetype. UINT32_MAX if the archetype lacks the type.
+		TArray<uint32> m_ArchetypeColumns;
+		// Components that have been inserted but not yet committed to the archetype storage
+		THashTable<Entity, Comp> m_StagedComponents;
 	};
 
 	template<typename Comp>
 	inline ComponentArray<Comp>::~ComponentArray()
 	{
+		// Committed components are destroyed by the archetype storage
 		if (m_ComponentOwnership.Destructor)
 		{
 			for (uint32 componentIdx = 0; componentIdx < m_Data.GetSize(); componentIdx++)
 			{
 				m_ComponentOwnership.Destructor(m_Data[componentIdx], m_IDs[componentIdx]);
 			}
+
+			for (auto& stagedComponent : m_StagedComponents)
+			{
+				m_ComponentOwnership.Destructor(stagedComponent.second, stagedComponent.first);
+			}
 		}
 	}
 
 	template<typename Comp>
 	inline Comp& ComponentArray<Comp>::Insert(Entity entity, const Comp& comp)
 	{
-		auto indexItr = m_EntityToIndex.find(entity);
-		VALIDATE_MSG(indexItr == m_EntityToIndex.end(), "Trying to add a component that already exists!");
+		VALIDATE_MSG(!m_EntityToIndex.Contains(entity), "Trying to add a component that already exists!");
 
 		// Get new index and add the component to that position.
-		uint32 newIndex = m_Data.GetSize();
-		m_EntityToIndex[entity] = newIndex;
+		uint32 newIndex = m_IDs.GetSize();
+		m_EntityToIndex.Set(entity, newIndex);
 		m_IDs.PushBack(entity);
-		Comp& storedComp = m_Data.PushBack(comp);
+		Comp& storedComp = m_pArchetypeStorage ? m_StagedComponents.insert({ entity, comp }).first->second : m_Data.PushBack(comp);
 
 		if (m_ComponentOwnership.Constructor)
 		{
@@ -122,13 +170,13 @@ namespace LambdaEngine
 	template<typename Comp>
 	bool ComponentArray<Comp>::GetIf(Entity entity, Comp& comp)
 	{
-		auto indexItr = m_EntityToIndex.find(entity);
-		if (indexItr == m_EntityToIndex.end())
+		Comp* pComponent = FindComponent(entity);
+		if (!pComponent)
 		{
 			return false;
 		}
 
-		comp = m_Data[indexItr->second];
+		comp = *pComponent;
 
 		if constexpr (Comp::HasDirtyFlag())
 		{
@@ -141,13 +189,13 @@ namespace LambdaEngine
 	template<typename Comp>
 	bool ComponentArray<Comp>::GetConstIf(Entity entity, Comp& comp) const
 	{
-		auto indexItr = m_EntityToIndex.find(entity);
-		if (indexItr == m_EntityToIndex.end())
+		const Comp* pComponent = FindComponent(entity);
+		if (!pComponent)
 		{
 			return false;
 		}
 
-		comp = m_Data[indexItr->second];
+		comp = *pComponent;
 
 		return true;
 	}
@@ -155,61 +203,149 @@ namespace LambdaEngine
 	template<typename Comp>
 	inline void* ComponentArray<Comp>::GetRawData(Entity entity)
 	{
-		auto indexItr = m_EntityToIndex.find(entity);
-		VALIDATE_MSG(indexItr != m_EntityToIndex.end(), "Trying to get a component that does not exist!");
-		return &m_Data[indexItr->second];
+		Comp* pComponent = FindComponent(entity);
+		VALIDATE_MSG(pComponent, "Trying to get a component that does not exist!");
+		return pComponent;
 	}
 
 	template<typename Comp>
 	inline Comp& ComponentArray<Comp>::GetData(Entity entity)
 	{
-		auto indexItr = m_EntityToIndex.find(entity);
-		VALIDATE_MSG(indexItr != m_EntityToIndex.end(), "Trying to get a component that does not exist!");
-
-		Comp& component = m_Data[indexItr->second];
+		Comp* pComponent = FindComponent(entity);
+		VALIDATE_MSG(pComponent, "Trying to get a component that does not exist!");
 
 		if constexpr (Comp::HasDirtyFlag())
 		{
-			component.Dirty = true;
+			pComponent->Dirty = true;
 		}
 
-		return component;
+		return *pComponent;
 	}
 
 	template<typename Comp>
 	inline const Comp& ComponentArray<Comp>::GetConstData(Entity entity) const
 	{
-		auto indexItr = m_EntityToIndex.find(entity);
-		VALIDATE_MSG(indexItr != m_EntityToIndex.end(), "Trying to get a component that does not exist!");
+		const Comp* pComponent = FindComponent(entity);
+		VALIDATE_MSG(pComponent, "Trying to get a component that does not exist!");
 
-		return m_Data[indexItr->second];
+		return *pComponent;
 	}
 
 	template<typename Comp>
 	inline void ComponentArray<Comp>::Remove(Entity entity)
 	{
-		auto indexItr = m_EntityToIndex.find(entity);
-		VALIDATE_MSG(indexItr != m_EntityToIndex.end(), "Trying to remove a component that does not exist!");
+		const uint32 currentIndex = m_EntityToIndex.Find(entity);
+		VALIDATE_MSG(currentIndex != SparseIndexMap::INVALID_INDEX, "Trying to remove a component that does not exist!");
 
-		uint32 currentIndex = indexItr->second;
+		if (m_pArchetypeStorage)
+		{
+			auto stagedItr = m_StagedComponents.find(entity);
+			if (stagedItr != m_StagedComponents.end())
+			{
+				if (m_ComponentOwnership.Destructor)
+				{
+					m_ComponentOwnership.Destructor(stagedItr->second, entity);
+				}
 
-		if (m_ComponentOwnership.Destructor)
+				m_StagedComponents.erase(stagedItr);
+			}
+			else
+			{
+				m_pArchetypeStorage->RemoveComponent(entity, Comp::Type());
+			}
+		}
+		else
 		{
-			m_ComponentOwnership.Destructor(m_Data[currentIndex], entity);
+			if (m_ComponentOwnership.Destructor)
+			{
+				m_ComponentOwnership.Destructor(m_Data[currentIndex], entity);
+			}
+
+			// Swap the removed component with the last component.
+			m_Data[currentIndex] = m_Data.GetBack();
+			m_Data.PopBack();
 		}
 
-		// Swap the removed component with the last component.
-		m_Data[currentIndex] = m_Data.GetBack();
 		m_IDs[currentIndex] = m_IDs.GetBack();
 
 		// Update entity-index maps.
-		m_EntityToIndex[m_IDs.GetBack()] = currentIndex;
+		m_EntityToIndex.Set(m_IDs.GetBack(), currentIndex);
 
-		m_Data.PopBack();
 		m_IDs.PopBack();
 
 		// Remove the deleted component's entry.
-		m_EntityToIndex.erase(indexItr);
+		m_EntityToIndex.Erase(entity);
+	}
+
+	template<typename Comp>
+	inline void ComponentArray<Comp>::SetArchetypeColumn(uint32 archetypeIndex, uint32 columnIndex)
+	{
+		if (archetypeIndex >= m_ArchetypeColumns.GetSize())
+		{
+			m_ArchetypeColumns.Resize(archetypeIndex + 1u, UINT32_MAX);
+		}
+
+		m_ArchetypeColumns[archetypeIndex] = columnIndex;
+	}
+
+	template<typename Comp>
+	inline void ComponentArray<Comp>::MoveStagedComponent(Entity entity, void* pDestination)
+	{
+		auto stagedItr = m_StagedComponents.find(entity);
+		VALIDATE_MSG(stagedItr != m_StagedComponents.end(), "Trying to commit a component that has not been inserted!");
+
+		new(pDestination) Comp(std::move(stagedItr->second));
+		m_StagedComponents.erase(stagedItr);
+	}
+
+	template<typename Comp>
+	inline void ComponentArray<Comp>::MoveComponent(void* pDestination, void* pSource)
+	{
+		Comp* pSourceComponent = reinterpret_cast<Comp*>(pSource);
+		new(pDestination) Comp(std::move(*pSourceComponent));
+		pSourceComponent->~Comp();
+	}
+
+	template<typename Comp>
+	inline void ComponentArray<Comp>::DestroyComponent(void* pComponent, Entity entity)
+	{
+		Comp* pTypedComponent = reinterpret_cast<Comp*>(pComponent);
+		if (m_ComponentOwnership.Destructor)
+		{
+			m_ComponentOwnership.Destructor(*pTypedComponent, entity);
+		}
+
+		pTypedComponent->~Comp();
+	}
+
+	template<typename Comp>
+	inline Comp* ComponentArray<Comp>::FindComponent(Entity entity)
+	{
+		if (m_pArchetypeStorage)
+		{
+			// Committed components are found without any hashing
+			const EntityLocation* pLocation = m_pArchetypeStorage->GetEntityLocation(entity);
+			if (pLocation && pLocation->ArchetypeIndex < m_ArchetypeColumns.GetSize())
+			{
+				const uint32 columnIndex = m_ArchetypeColumns[pLocation->ArchetypeIndex];
+				if (columnIndex != UINT32_MAX)
+				{
+					return reinterpret_cast<Comp*>(m_pArchetypeStorage->GetComponent(*pLocation, columnIndex));
+				}
+			}
+
+			auto stagedItr = m_StagedComponents.find(entity);
+			return stagedItr == m_StagedComponents.end() ? nullptr : &stagedItr->second;
+		}
+
+		const uint32 index = m_EntityToIndex.Find(entity);
+		return index == SparseIndexMap::INVALID_INDEX ? nullptr : &m_Data[index];
+	}
+
+	template<typename Comp>
+	inline const Comp* ComponentArray<Comp>::FindComponent(Entity entity) const
+	{
+		return const_cast<ComponentArray<Comp>*>(this)->FindComponent(entity);
 	}
 
 	template<typename Comp>
@@ -294,6 +430,34 @@ namespace LambdaEngine
 			{
 				component.Dirty = false;
 			}
+
+			if (m_pArchetypeStorage)
+			{
+				for (auto& stagedComponent : m_StagedComponents)
+				{
+					stagedComponent.second.Dirty = false;
+				}
+
+				for (uint32 archetypeIdx = 0; archetypeIdx < m_ArchetypeColumns.GetSize(); archetypeIdx++)
+				{
+					const uint32 columnIndex = m_ArchetypeColumns[archetypeIdx];
+					if (columnIndex == UINT32_MAX)
+					{
+						continue;
+					}
+
+					const Archetype& archetype = m_pArchetypeStorage->GetArchetype(archetypeIdx);
+					const uint32 columnOffset = archetype.Columns[columnIndex].Offset;
+					for (const ArchetypeChunk& chunk : archetype.Chunks)
+					{
+						Comp* pComponents = reinterpret_cast<Comp*>(chunk.pData + columnOffset);
+						for (uint32 componentIdx = 0; componentIdx < chunk.EntityCount; componentIdx++)
+						{
+							pComponents[componentIdx].Dirty = false;
+						}
+					}
+				}
+			}
 		}
 	}
 }
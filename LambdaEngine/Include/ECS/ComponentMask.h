@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Defines.h"
+#include "Types.h"
+
+#include <bit>
+
+// Maximum amount of component types that can be registered to entities
+#define MAX_COMPONENT_TYPES 256u
+
+namespace LambdaEngine
+{
+	// One bit per component type, where the bit index is assigned by the entity registry when a type is first seen
+	class ComponentMask
+	{
+	public:
+		FORCEINLINE void Set(uint32 componentTypeIndex)
+		{
+			m_Words[componentTypeIndex / 64u] |= (1ull << (componentTypeIndex % 64u));
+		}
+
+		FORCEINLINE void Reset(uint32 componentTypeIndex)
+		{
+			m_Words[componentTypeIndex / 64u] &= ~(1ull << (componentTypeIndex % 64u));
+		}
+
+		FORCEINLINE bool Test(uint32 componentTypeIndex) const
+		{
+			return (m_Words[componentTypeIndex / 64u] >> (componentTypeIndex % 64u)) & 1ull;
+		}
+
+		FORCEINLINE bool ContainsAll(const ComponentMask& other) const
+		{
+			uint64 missingBits = 0;
+			for (uint32 wordIdx = 0; wordIdx < WORD_COUNT; wordIdx++)
+			{
+				missingBits |= other.m_Words[wordIdx] & ~m_Words[wordIdx];
+			}
+
+			return missingBits == 0;
+		}
+
+		FORCEINLINE bool ContainsAny(const ComponentMask& other) const
+		{
+			uint64 sharedBits = 0;
+			for (uint32 wordIdx = 0; wordIdx < WORD_COUNT; wordIdx++)
+			{
+				sharedBits |= other.m_Words[wordIdx] & m_Words[wordIdx];
+			}
+
+			return sharedBits != 0;
+		}
+
+		FORCEINLINE bool IsEmpty() const
+		{
+			uint64 setBits = 0;
+			for (uint32 wordIdx = 0; wordIdx < WORD_COUNT; wordIdx++)
+			{
+				setBits |= m_Words[wordIdx];
+			}
+
+			return setBits == 0;
+		}
+
+		// Calls func with the index of every set bit, in ascending order
+		template<typename Func>
+		FORCEINLINE void ForEachSetBit(Func func) const
+		{
+			for (uint32 wordIdx = 0; wordIdx < WORD_COUNT; wordIdx++)
+			{
+				uint64 word = m_Words[wordIdx];
+				while (word)
+				{
+					func(wordIdx * 64u + (uint32)std::countr_zero(word));
+					word &= word - 1ull;
+				}
+			}
+		}
+
+	private:
+		static constexpr const uint32 WORD_COUNT = MAX_COMPONENT_TYPES / 64u;
+
+	private:
+		uint64 m_Words[WORD_COUNT] = {};
+	};
+}
@@ -13,6 +13,11 @@ namespace LambdaEngine
 		ComponentStorage() = default;
 		~ComponentStorage();
 
+		/*	Stores committed components in archetype chunks rather than in one array per component type.
+			Has to be called before any component type is registered. */
+		void EnableArchetypeStorage();
+		ArchetypeStorage* GetArchetypeStorage() { return m_pArchetypeStorage; }
+
 		template<typename Comp>
 		ComponentArray<Comp>* RegisterComponentType();
 
@@ -40,6 +45,9 @@ namespace LambdaEngine
 
 		bool DeleteComponent(Entity entity, const ComponentType* pComponentType);
 
+		// Moves an added component into the entity's archetype. Does nothing unless archetype storage is enabled.
+		void CommitComponent(Entity entity, const ComponentType* pComponentType);
+
 		uint32 SerializeComponent(Entity entity, const ComponentType* pComponentType, uint8* pBuffer, uint32 bufferSize) const;
 		bool DeserializeComponent(Entity entity, const ComponentType* pComponentType, uint32 componentDataSize, const uint8* pBuffer, bool& entityHadComponent);
 
@@ -68,6 +76,8 @@ namespace LambdaEngine
 		TArray<IComponentArray*> m_ComponentArrays;
 		// All component types with dirty flags. Used for resetting dirty flags at the end of each frame.
 		TArray<IComponentArray*> m_ComponentArraysWithDirtyFlags;
+
+		ArchetypeStorage* m_pArchetypeStorage = nullptr;
 	};
 
 	template<typename Comp>
@@ -78,6 +88,7 @@ namespace LambdaEngine
 
 		m_CompTypeToArrayMap[pComponentType] = m_ComponentArrays.GetSize();
 		ComponentArray<Comp>* pCompArray = DBG_NEW ComponentArray<Comp>();
+		pCompArray->SetArchetypeStorage(m_pArchetypeStorage);
 		m_ComponentArrays.PushBack(pCompArray);
 
 		m_TypeHashToCompTypeMap[pComponentType->GetHash()] = pComponentType;
@@ -37,6 +37,12 @@ namespace LambdaEngine
 
 		void Tick(Timestamp deltaTime);
 
+		/*	Enables archetype storage, where entities with the same set of component types are stored together in
+			chunks. The per-type component API keeps working, and systems can iterate contiguous chunks through
+			EntitySubscriber::ForEachChunk. Has to be called before any component is added. */
+		void EnableArchetypeStorage() { m_ComponentStorage.EnableArchetypeStorage(); }
+		ArchetypeStorage* GetArchetypeStorage() { return m_ComponentStorage.GetArchetypeStorage(); }
+
 		Entity CreateEntity() { return m_EntityRegistry.CreateEntity(); }
 
 		// Add a component to a specific entity.
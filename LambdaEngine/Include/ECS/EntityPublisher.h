@@ -23,6 +23,9 @@ namespace LambdaEngine
         IDVector* pSubscriber;
         TArray<const ComponentType*> ComponentTypes;
         TArray<const ComponentType*> ExcludedComponentTypes;
+        // The component types above as masks, for testing entities with a few bitwise operations
+        ComponentMask ComponentTypeMask;
+        ComponentMask ExcludedComponentTypeMask;
         // Optional: Called after an entity was added due to the subscription
         std::function<void(Entity)> OnEntityAdded;
         // Optional: Called before an entity was removed
@@ -40,7 +43,7 @@ namespace LambdaEngine
     class EntityPublisher
     {
     public:
-        EntityPublisher(const ComponentStorage* pComponentStorage, const EntityRegistry* pEntityRegistry);
+        EntityPublisher(const ComponentStorage* pComponentStorage, EntityRegistry* pEntityRegistry);
         ~EntityPublisher() = default;
 
         // Returns a subscription ID
@@ -66,6 +69,6 @@ namespace LambdaEngine
         THashTable<const ComponentType*, ComponentHandler*> m_ComponentHandlers;
 
         const ComponentStorage* m_pComponentStorage;
-        const EntityRegistry* m_pEntityRegistry;
+        EntityRegistry* m_pEntityRegistry;
     };
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Containers/IDVector.h"
+#include "ECS/ComponentMask.h"
+#include "ECS/ComponentType.h"
 #include "ECS/Entity.h"
 #include "Threading/API/SpinLock.h"
 #include "Utilities/IDGenerator.h"
@@ -11,10 +13,8 @@
 
 namespace LambdaEngine
 {
-    class ComponentType;
-
     // Map Entities to the set of component types they are registered to
-    typedef IDDVector<std::unordered_set<const ComponentType*>> EntityRegistryPage;
+    typedef IDDVector<ComponentMask> EntityRegistryPage;
 
     class EntityRegistry
     {
@@ -26,11 +26,16 @@ namespace LambdaEngine
         void DeregisterComponentType(Entity entity, const ComponentType* pComponentType);
 
         // EntityHasAllTypes returns true if the entity has all of the allowed types and none of the disallowed types
-        bool EntityHasAllowedTypes(Entity entity, const TArray<const ComponentType*>& allowedTypes, const TArray<const ComponentType*>& disallowedTypes) const;
+        bool EntityHasAllowedTypes(Entity entity, const ComponentMask& allowedTypes, const ComponentMask& disallowedTypes) const;
         // EntityHasAllTypes returns true if the entity has all of the specified types
-        bool EntityHasAllTypes(Entity entity, const TArray<const ComponentType*>& types) const;
+        bool EntityHasAllTypes(Entity entity, const ComponentMask& types) const;
         // EntityHasAnyOfTypes returns true if the entity has at least one of the specified types
-        bool EntityHasAnyOfTypes(Entity entity, const TArray<const ComponentType*>& types) const;
+        bool EntityHasAnyOfTypes(Entity entity, const ComponentMask& types) const;
+
+        // CreateComponentMask assigns bits to component types that have not been seen before
+        ComponentMask CreateComponentMask(const TArray<const ComponentType*>& componentTypes);
+        // GetComponentTypes fills componentTypes with the types in the mask
+        void GetComponentTypes(const ComponentMask& componentMask, TArray<const ComponentType*>& componentTypes) const;
 
         Entity CreateEntity();
         void DeregisterEntity(Entity entity);
@@ -39,9 +44,18 @@ namespace LambdaEngine
         void RemovePage();
         const EntityRegistryPage& GetTopRegistryPage() const { return m_EntityPages.top(); }
 
+    private:
+        // Requires m_Lock to be held
+        uint32 GetComponentTypeIndex(const ComponentType* pComponentType);
+
     private:
         std::stack<EntityRegistryPage> m_EntityPages;
         IDGenerator m_EntityIDGen;
+
+        // Component mask bit index for each component type, and the other way around
+        THashTable<const ComponentType*, uint32> m_ComponentTypeIndices;
+        TArray<const ComponentType*> m_ComponentTypes;
+
         mutable SpinLock m_Lock;
     };
 }
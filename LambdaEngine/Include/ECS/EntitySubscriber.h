@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ECS/ArchetypeStorage.h"
 #include "ECS/Component.h"
 #include "ECS/Entity.h"
 
@@ -40,7 +41,21 @@ namespace LambdaEngine
 		// SubscribeToEntities enqueues entity subscriptions. initFn is called when all dependencies have been initialized.
 		void SubscribeToEntities(EntitySubscriberRegistration& subscriberRegistration);
 
+		/*	ForEachChunk iterates every entity that has all of Comps and none of the excluded types, one chunk at a time.
+			func is called as func(uint32 entityCount, const Entity* pEntities, Comps* pComponents...), where each
+			component pointer is a contiguous array. Comps should be const for component types that are only read.
+			Requires archetype storage, see ECSCore::EnableArchetypeStorage. */
+		template<typename... Comps, typename Func>
+		void ForEachChunk(Func&& func, const TArray<const ComponentType*>& excludedTypes = {}) const
+		{
+			ArchetypeStorage* pArchetypeStorage = GetArchetypeStorage();
+			VALIDATE_MSG(pArchetypeStorage, "ForEachChunk requires archetype storage to be enabled!");
+			pArchetypeStorage->ForEachChunk<Comps...>(excludedTypes, std::forward<Func>(func));
+		}
+
 	private:
+		static ArchetypeStorage* GetArchetypeStorage();
+
 		// ProcessComponentGroups removes duplicate component access registrations
 		static void ProcessComponentGroups(EntitySubscriptionRegistration& subscriptionRegistration);
 		// ProcessExcludedTypes asserts that the same component type isn't both included and excluded in a subscription
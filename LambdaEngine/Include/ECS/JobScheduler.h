@@ -6,12 +6,46 @@
 #include "Utilities/IDGenerator.h"
 
 #include <array>
-#include <condition_variable>
+#include <atomic>
 #include <mutex>
 #include <unordered_set>
 
 namespace LambdaEngine
 {
+    struct JobCounter;
+
+    /*  A set of jobs compiled into a dependency graph. Job B depends on job A if A comes before B and both access
+        the same component type where at least one of them writes to it. Edges always point to a later node,
+        meaning the node order is a topological order. Successors are stored as one flat array indexed by offsets. */
+    struct JobGraph
+    {
+        TArray<Job*> Jobs;
+        TArray<uint32> PredecessorCounts;
+        TArray<uint32> SuccessorOffsets;
+        TArray<uint32> Successors;
+
+        /*  The component accesses the graph was built from, one range per node. Jobs with the same accesses in the same
+            order compile into the same graph, which is then reused instead of being rebuilt. */
+        TArray<ComponentAccess> NodeAccesses;
+        TArray<uint32> NodeAccessOffsets;
+
+        // Per-execution state
+        TArray<uint32> RemainingPredecessors;
+        TArray<uint8> ShouldExecute;
+        TArray<float32> ExecutionTimesMS;
+    };
+
+    // The longest chain of dependent jobs in a phase, measured using the execution times of the latest frame
+    struct JobCriticalPath
+    {
+        // Regular job IDs along the critical path, in execution order
+        TArray<uint32> RegularJobIDs;
+        TArray<float32> ExecutionTimesMS;
+        float32 CriticalPathTimeMS = 0.0f;
+        // Sum of the execution times of every job in the phase, i.e. the time it would take on a single thread
+        float32 SerialTimeMS = 0.0f;
+    };
+
     class JobScheduler
     {
     public:
@@ -25,62 +59,81 @@ namespace LambdaEngine
         void ScheduleJobs(const TArray<Job>& jobs, uint32_t phase);
 
         /*  ScheduleRegularJob schedules a job that is performed each frame, until it is explicitly deregistered using the job ID.
-            Returns the job ID. */
+            The phase's job graph is rebuilt before the phase is executed next time. Returns the job ID. */
         uint32 ScheduleRegularJob(const RegularJob& job, uint32_t phase);
         void DescheduleRegularJob(uint32 phase, uint32 jobID);
 
         const std::array<IDDVector<RegularJob>, PHASE_COUNT>& GetRegularJobs() const { return m_RegularJobs; }
+        const JobCriticalPath& GetCriticalPath(uint32 phase) const { return m_CriticalPaths[phase]; }
 
     private:
-        const Job* FindExecutableJob();
-        bool CanExecute(const Job& job) const;
-        bool CanExecuteRegularJob(const RegularJob& job) const;
-        void ExecuteJob(Job job);
+        // Applies pending regular job (de)registrations and rebuilds the phase's job graph if they changed it
+        void UpdatePhaseGraph(uint32 phase);
+
+        /*  Executes the phase's regular jobs that are due to tick in one graph with the jobs scheduled for the phase so far.
+            Returns true if any regular job ticked. */
+        bool ExecutePhase(uint32 phase, bool isFirstPass);
+        // Executes jobs scheduled while the phase was executing until none remain in the phase
+        void ExecuteScheduledJobs(uint32 phase);
+
+        // Dispatches the graph's root nodes and blocks until every node has completed
+        void ExecuteGraph(JobGraph& graph);
+        void ReleaseNode(JobGraph& graph, uint32 nodeIndex, JobCounter& counter);
+        void ExecuteNode(JobGraph& graph, uint32 nodeIndex, JobCounter& counter);
+        void CompleteNode(JobGraph& graph, uint32 nodeIndex, JobCounter& counter);
 
-        // Register the component accesses (reads and writes) to be performed by the job
-        void RegisterJobExecution(const Job& job);
-        void DeregisterJobExecution(const Job& job);
+        void UpdateCriticalPath(uint32 phase);
 
-        void SetPhase(uint32_t phase);
-        /*  Advances to the next phase. Performs component registrations and deletions and entity deletions. If it's the last phase already,
-            the next phase might be a previous one, to accumulate regular jobs. */
-        void NextPhase();
+        // Performs component registrations and deletions and entity deletions
+        void FinishPhase();
 
-        void AccumulateRegularJobs();
+        // Checks if any regular job with a tick period has accumulated enough time to tick again
+        bool RegularJobsNeedTicking() const;
 
-        // Checks if there are more jobs to execute in the current phase
-        bool PhaseJobsExist() const;
+        // Compiles the jobs' component accesses into the graph's edges
+        void BuildJobGraph(JobGraph& graph);
+        // Checks if the graph was built from the same component accesses as its current jobs, making a rebuild redundant
+        static bool HasSameAccesses(const JobGraph& graph);
+
+    private:
+        struct ComponentAccessState
+        {
+            uint32 LastWriter = UINT32_MAX;
+            // Readers since the last write
+            TArray<uint32> Readers;
+        };
 
     private:
         /*  One vector of jobs per phase. These jobs are anything but system ticks, i.e. they are irregularly scheduled.
             PHASE_COUNT + 1 is used to allow jobs to be scheduled as post-systems. */
         std::array<TArray<Job>, PHASE_COUNT + 1> m_Jobs;
 
-        // Indices to jobs yet to be executed within each phase
-        std::array<TArray<uint32>, PHASE_COUNT + 1> m_JobIndices;
+        // Irregularly scheduled jobs taken from m_Jobs that are currently being executed
+        TArray<Job> m_ExecutingJobs;
+        JobGraph m_ScheduledJobGraph;
 
         // Regular jobs are performed each frame, until they are explicitly deregistered
         std::array<IDDVector<RegularJob>, PHASE_COUNT> m_RegularJobs;
         IDGenerator m_RegularJobIDGenerator;
 
-        /*  IDs of the regular job to tick in the current phase.
-            Populated at the beginning of each phase. */
-        std::array<TArray<uint32>, PHASE_COUNT> m_RegularJobIDsToTick;
-        /*  IDs of regular jobs in each phase that, regardless of whether they have been ticked, should be ticked
-            at least one more time before the JobScheduler::Tick exits. */
-        std::array<std::unordered_set<uint32>, PHASE_COUNT> m_RegularJobsToAccumulate;
+        // Regular job (de)registrations are deferred until the phase is about to be executed
+        std::array<TArray<std::pair<uint32, RegularJob>>, PHASE_COUNT> m_RegularJobsToAdd;
+        std::array<TArray<uint32>, PHASE_COUNT> m_RegularJobsToRemove;
 
-        /*  Maps component TIDs to the amount of jobs are reading from them.
-            A zero read count means the component type is being written to. */
-        THashTable<const ComponentType*, uint32> m_ProcessingComponents;
+        // Regular jobs compiled into one graph per phase, rebuilt only when the phase's regular jobs change
+        std::array<JobGraph, PHASE_COUNT> m_PhaseGraphs;
+        std::array<bool, PHASE_COUNT> m_PhaseGraphIsDirty;
+        std::array<JobCriticalPath, PHASE_COUNT> m_CriticalPaths;
 
-        // Used to join threads executing jobs once the current phase's jobs have all been scheduled
-        TArray<uint32> m_ThreadHandles;
+        // Scratch data used when building graphs, kept to avoid reallocating it for every build
+        THashTable<const ComponentType*, ComponentAccessState> m_ComponentAccessStates;
+        TArray<TArray<uint32>> m_NodeSuccessors;
+        TArray<uint32> m_NodePredecessors;
 
+        // Protects m_Jobs and the pending regular job (de)registrations
         std::mutex m_Lock;
-        std::condition_variable m_ScheduleTimeoutCvar;
 
-        uint32_t m_CurrentPhase;
+        std::atomic_uint32_t m_CurrentPhase;
 
         // The latest delta time retrieved through JobScheduler::Tick
         float32 m_DeltaTime;
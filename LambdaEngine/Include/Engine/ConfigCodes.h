@@ -37,6 +37,10 @@ namespace LambdaEngine
 		CONFIG_OPTION_RAY_TRACED_SHADOWS		= 23,
 		CONFIG_OPTION_VOLUME_MUSIC				= 24,
 		CONFIG_OPTION_AA						= 25,
+		CONFIG_OPTION_ECS_ARCHETYPE_STORAGE		= 26,
+		CONFIG_OPTION_NETWORK_RECEIVER_THREADS	= 27,
+		CONFIG_OPTION_HEADLESS					= 28,
+		CONFIG_OPTION_PHYSICS_WORKER_THREADS	= 29,
 	};
 
 	/*
@@ -71,6 +75,10 @@ namespace LambdaEngine
 			case CONFIG_OPTION_RAY_TRACED_SHADOWS:			return "CONFIG_OPTION_RAY_TRACED_SHADOWS";
 			case CONFIG_OPTION_REFLECTIONS_SPP:				return "CONFIG_OPTION_REFLECTIONS_SPP";
 			case CONFIG_OPTION_VOLUME_MUSIC:				return "CONFIG_OPTION_VOLUME_MUSIC";
+			case CONFIG_OPTION_ECS_ARCHETYPE_STORAGE:		return "CONFIG_OPTION_ECS_ARCHETYPE_STORAGE";
+			case CONFIG_OPTION_NETWORK_RECEIVER_THREADS:	return "CONFIG_OPTION_NETWORK_RECEIVER_THREADS";
+			case CONFIG_OPTION_HEADLESS:					return "CONFIG_OPTION_HEADLESS";
+			case CONFIG_OPTION_PHYSICS_WORKER_THREADS:		return "CONFIG_OPTION_PHYSICS_WORKER_THREADS";
 			default:										return "CONFIG_OPTION_UNKNOWN";
 		}
 	}
@@ -103,6 +111,10 @@ namespace LambdaEngine
 			{"CONFIG_OPTION_RAY_TRACED_SHADOWS",		EConfigOption::CONFIG_OPTION_RAY_TRACED_SHADOWS},
 			{"CONFIG_OPTION_REFLECTIONS_SPP",			EConfigOption::CONFIG_OPTION_REFLECTIONS_SPP},
 			{"CONFIG_OPTION_VOLUME_MUSIC",				EConfigOption::CONFIG_OPTION_VOLUME_MUSIC},
+			{"CONFIG_OPTION_ECS_ARCHETYPE_STORAGE",		EConfigOption::CONFIG_OPTION_ECS_ARCHETYPE_STORAGE},
+			{"CONFIG_OPTION_NETWORK_RECEIVER_THREADS",	EConfigOption::CONFIG_OPTION_NETWORK_RECEIVER_THREADS},
+			{"CONFIG_OPTION_HEADLESS",					EConfigOption::CONFIG_OPTION_HEADLESS},
+			{"CONFIG_OPTION_PHYSICS_WORKER_THREADS",	EConfigOption::CONFIG_OPTION_PHYSICS_WORKER_THREADS},
 		};
 
 		auto itr = configMap.find(str);
@@ -59,6 +59,13 @@ namespace LambdaEngine
 		static Timestamp GetDeltaTime();
 		static Timestamp GetTimeSinceStart();
 
+		/*
+		* Headless engines run without a window, renderer, GUI or audio device, used by dedicated servers.
+		* Set from CONFIG_OPTION_HEADLESS during PreInit and always true on Linux
+		*	return - Returns true if the engine runs headless
+		*/
+		static bool IsHeadless();
+
 	private:
 		/*
 		* Initializes ECS systems. Separate from EngineLoop::Init to avoid cluttering.
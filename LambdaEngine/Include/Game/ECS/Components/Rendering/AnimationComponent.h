@@ -25,6 +25,8 @@ namespace LambdaEngine
 		bool			IsPaused = false;
 		AnimationGraph*	pGraph = nullptr;
 		SkeletonPose	Pose;
+		float64			PendingTime = 0.0; // Time not yet applied to the graph while the LOD skips updates
+		bool			IgnoreLOD = false; // Animated at full rate and depth wherever it is, e.g. first person arms that are drawn at the camera
 	};
 
 	/*
@@ -5,6 +5,8 @@
 #include "Game/ECS/Components/Physics/Collision.h"
 #include "Game/ECS/Components/Physics/Transform.h"
 #include "Math/Math.h"
+#include "Physics/PhysX/CollisionMeshCache.h"
+#include "Physics/PhysX/CpuDispatcher.h"
 #include "Physics/PhysX/ErrorCallback.h"
 #include "Physics/PhysX/PhysX.h"
 #include "Physics/PhysX/RaycastQueryFilterCallback.h"
@@ -72,6 +74,13 @@ namespace LambdaEngine
 	struct ActorUserData
 	{
 		Entity Entity;
+
+		// The transforms of dynamic collision entities are interpolated between the poses of the last two physics steps
+		PxTransform	PreviousPose	= PxTransform(PxIdentity);
+		PxTransform	CurrentPose		= PxTransform(PxIdentity);
+		bool		IsDynamic		= false;
+		bool		IsMoving		= false; // The actor was moved by the last step
+		bool		IsInterpolated	= false; // The actor is in the list of interpolated actors
 	};
 
 	// ShapeUserData is stored in each PxShape::userData. It is used eg. when colliding.
@@ -158,6 +167,7 @@ namespace LambdaEngine
 		GeometryParameters GeometryParams;
 		glm::vec3 Position;
 		glm::quat Rotation;
+		const QueryFilterData* pFilterData = nullptr;	// Used by batched queries, QueryOverlap takes its filter data as a parameter
 	};
 
 	struct RaycastInfo
@@ -168,6 +178,53 @@ namespace LambdaEngine
 		const QueryFilterData* pFilterData;
 	};
 
+	// Sweeps are limited to spheres, boxes and capsules
+	struct SweepQueryInfo
+	{
+		EGeometryType GeometryType;
+		GeometryParameters GeometryParams;
+		glm::vec3 Position;
+		glm::quat Rotation;
+		glm::vec3 Direction;
+		float32 MaxDistance;
+		const QueryFilterData* pFilterData = nullptr;
+	};
+
+	// The hits of a batched query are HitCount consecutive hits starting at FirstHit in the hit array of its kind
+	struct SceneQueryResult
+	{
+		uint32 FirstHit = 0;
+		uint32 HitCount = 0;
+	};
+
+	/*
+	* SceneQueryBatch holds queries that are executed together by PhysicsSystem::ExecuteQueryBatch. The results are
+	* stored in the same order as the queries, the arrays keep their memory when a batch is reused
+	*/
+	struct SceneQueryBatch
+	{
+		TArray<RaycastInfo>			Raycasts;
+		TArray<SweepQueryInfo>		Sweeps;
+		TArray<OverlapQueryInfo>	Overlaps;
+
+		// Zero reports one hit per query, the closest one for raycasts and sweeps. Otherwise up to this many hits are reported in no particular order
+		uint32 MaxTouchesPerQuery = 0;
+
+		TArray<SceneQueryResult>	RaycastResults;
+		TArray<PxRaycastHit>		RaycastHits;
+		TArray<SceneQueryResult>	SweepResults;
+		TArray<PxSweepHit>			SweepHits;
+		TArray<SceneQueryResult>	OverlapResults;
+		TArray<PxOverlapHit>		OverlapHits;
+
+		void Clear()
+		{
+			Raycasts.Clear();
+			Sweeps.Clear();
+			Overlaps.Clear();
+		}
+	};
+
 	class PhysicsSystem : public System, public ComponentOwner, public PxSimulationEventCallback
 	{
 	public:
@@ -178,6 +235,18 @@ namespace LambdaEngine
 
 		void Tick(Timestamp deltaTime) override final;
 
+		/*
+		* Starts the step of this fixed tick, it is simulated on the thread pool until FetchResults is called.
+		* Called by the engine loop after everything else in the fixed tick.
+		*/
+		void FixedTick(Timestamp delta);
+
+		/*
+		* Waits for the step started by the last fixed tick and writes back the actors it moved.
+		* Must be called before anything moves character controllers or actors
+		*/
+		void FetchResults();
+
 		PxMaterial* CreateMaterial(float32 staticFriction, float32 dynamicFriction, float32 restitution);
 
 		/* Static collision actors */
@@ -218,6 +287,12 @@ namespace LambdaEngine
 		*/
 		bool QueryOverlap(const OverlapQueryInfo& overlapInfo, PxOverlapBuffer& overlaps, const QueryFilterData* pFilterData = nullptr);
 
+		/**
+		 * Executes every query of the batch, split into jobs on the thread pool, and blocks until all of them are done.
+		 * Like the single queries, this must not be called while actors are added to or removed from the scene.
+		*/
+		void ExecuteQueryBatch(SceneQueryBatch& batch);
+
 		/* Implement PxSimulationEventCallback */
 		void onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pPairs, PxU32 nbPairs) override final;
 		void onTrigger(PxTriggerPair* pTriggerPairs, PxU32 nbPairs) override final;
@@ -247,6 +322,14 @@ namespace LambdaEngine
 
 		bool RaycastInternal(const RaycastInfo& raycastInfo, PxRaycastBuffer& raycastBuffer, PxQueryFlags queryFlags);
 
+		// CreateQueryGeometry creates a sphere if the geometry type is not supported
+		PxGeometryHolder CreateQueryGeometry(EGeometryType geometryType, const GeometryParameters& geometryParams) const;
+		static PxQueryFilterData CreateQueryFilterData(const QueryFilterData* pFilterData, PxQueryFlags queryFlags);
+
+		void ExecuteBatchedRaycast(SceneQueryBatch& batch, uint32 queryIdx);
+		void ExecuteBatchedSweep(SceneQueryBatch& batch, uint32 queryIdx);
+		void ExecuteBatchedOverlap(SceneQueryBatch& batch, uint32 queryIdx);
+
 		static void StaticCollisionDestructor(StaticCollisionComponent& collisionComponent, Entity entity);
 		static void DynamicCollisionDestructor(DynamicCollisionComponent& collisionComponent, Entity entity);
 		static void CharacterColliderDestructor(CharacterColliderComponent& characterColliderComponent, Entity entity);
@@ -272,6 +355,10 @@ namespace LambdaEngine
 
 		void FinalizeCollisionActor(const CollisionCreateInfo& collisionInfo, PxRigidActor* pActor);
 
+		// Stores the poses of the actors the last step moved, using the active actors reported by the scene
+		void UpdateMovedActors();
+		void InterpolateMovedActors(float32 alpha);
+
 		void TriggerCallbacks(
 			const std::array<PxRigidActor*, 2>& actors,
 			const std::array<PxShape*, 2>& shapes) const;
@@ -298,11 +385,17 @@ namespace LambdaEngine
 		PxControllerManager*	m_pControllerManager;
 		PxPvd*					m_pVisDbg; // Visual debugger
 
-		PxDefaultCpuDispatcher*	m_pDispatcher;
+		PhysXCpuDispatcher*		m_pDispatcher;
 		PxScene*				m_pScene;
 
 		PxMaterial* m_pDefaultMaterial;
 
+		mutable CollisionMeshCache m_CollisionMeshCache;
+
+		float64						m_TimeSinceStep		= 0.0;
+		bool						m_IsSimulating		= false;
+		TArray<PxRigidDynamic*>		m_MovedActors;
+
 		QueryFilterCallback m_QueryFilterCallback;
 		RaycastQueryFilterCallback m_RaycastQueryFilterCallback;
 	};
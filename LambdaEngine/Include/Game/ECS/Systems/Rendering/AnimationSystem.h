@@ -6,10 +6,18 @@
 
 #include "Resources/Mesh.h"
 
+#include "Rendering/Animation/PoseCache.h"
+
 #include "Time/API/Clock.h"
 
 #include "Application/API/Events/KeyEvents.h"
 
+// Beyond these distances from the active camera animations are updated every second and every fourth frame
+#define ANIMATION_LOD1_DISTANCE			20.0f
+#define ANIMATION_LOD2_DISTANCE			40.0f
+// Joints with more ancestors than this, such as fingers, keep their bind pose beyond the second distance
+#define ANIMATION_LOD2_MAX_JOINT_DEPTH	7
+
 namespace LambdaEngine
 {
 	struct MeshComponent;
@@ -37,13 +45,18 @@ namespace LambdaEngine
 			return m_HasInitClock ? m_Clock.GetDeltaTime().AsSeconds() : 0.0;
 		}
 
+	public:
+		/*
+		* Advances the animation's graph and evaluates its skinning transforms into the pose
+		*	maxJointDepth	- Joints deeper than this keep their bind pose
+		*	pPoseCache		- Shares the pose with other instances playing the same clip, may be nullptr
+		*/
+		static void Animate(AnimationComponent& animation, float64 deltaTimeInSeconds, uint32 maxJointDepth, PoseCache* pPoseCache);
+
 	private:
 		AnimationSystem();
 		~AnimationSystem();
 
-		void Animate(AnimationComponent& animation);
-		glm::mat4 ApplyParent(const Joint& joint, Skeleton& skeleton, TArray<glm::mat4>& matrices);
-
 		static void OnAnimationComponentDelete(AnimationComponent& animation, Entity entity);
 
 	public:
@@ -53,8 +66,11 @@ namespace LambdaEngine
 		bool m_HasInitClock	= false;
 		Clock m_Clock;
 
-		IDVector		m_AnimationEntities;
-		IDVector		m_AttachedAnimationEntities;
-		TArray<uint32>	m_JobIndices;
+		IDVector	m_AnimationEntities;
+		IDVector	m_AttachedAnimationEntities;
+		IDVector	m_CameraEntities;
+
+		uint32		m_FrameIndex = 0;
+		PoseCache	m_PoseCache;
 	};
 }
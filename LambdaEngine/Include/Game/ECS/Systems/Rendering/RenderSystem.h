@@ -27,6 +27,7 @@
 #include "Rendering/Core/API/AccelerationStructure.h"
 
 #include "Rendering/RenderGraphTypes.h"
+#include "Rendering/InstanceCuller.h"
 #include "Rendering/LightRenderer.h"
 
 #include "Rendering/ParticleManager.h"
@@ -164,6 +165,9 @@ namespace LambdaEngine
 			Buffer* pAnimatedVertexBuffer	= nullptr;
 			Buffer* pVertexBuffer			= nullptr;
 			uint32	VertexCount				= 0;
+			bool	IsVertexBufferPacked	= false; // Animated meshes keep PackedVertex in pVertexBuffer when the loader made them
+			glm::vec3 PackedPositionMin		= glm::vec3(0.0f);
+			glm::vec3 PackedPositionExtent	= glm::vec3(0.0f);
 			Buffer* pStagingMatrixBuffer	= nullptr;
 			Buffer* pBoneMatrixBuffer		= nullptr;
 			uint32	BoneMatrixCount			= 0;
@@ -187,6 +191,13 @@ namespace LambdaEngine
 
 			TArray<Entity> EntityIDs;
 
+			// Culling, animated meshes are not culled since their skinned bounds are not known on the CPU
+			bool		IsCullable			= false;
+			glm::vec3	LocalBoundsMin		= glm::vec3(0.0f);
+			glm::vec3	LocalBoundsMax		= glm::vec3(0.0f);
+			TArray<uint32> CullingProxies;	// One per raster instance
+			TArray<DrawArgInstanceRange> VisibleInstanceRanges[(uint32)ECullingView::CULLING_VIEW_COUNT];
+
 			DescriptorSet* pDrawArgDescriptorSet			= nullptr;
 			DescriptorSet* pDrawArgDescriptorExtensionsSet	= nullptr;
 		};
@@ -197,6 +208,17 @@ namespace LambdaEngine
 			uint32	InstanceIndex = 0;
 		};
 
+		// Must match the push constants in Skinning.comp
+		struct SkinningConstants
+		{
+			uint32		VertexCount				= 0;
+			uint32		IsVertexBufferPacked	= 0;
+			uint32		Padding0				= 0;
+			uint32		Padding1				= 0;
+			glm::vec4	PackedPositionMin		= glm::vec4(0.0f);
+			glm::vec4	PackedPositionExtent	= glm::vec4(0.0f);
+		};
+
 		struct PendingBufferUpdate
 		{
 			Buffer* pSrcBuffer	= nullptr;
@@ -315,6 +337,11 @@ namespace LambdaEngine
 		*/
 		void SetRenderStageSleeping(const String& renderStageName, bool sleeping);
 
+		/*
+		* Only the instances visible from the given view are drawn by the render stage, kept when the rendergraph is recreated
+		*/
+		void SetRenderStageCullingView(const String& renderStageName, ECullingView cullingView);
+
 		/**
 		 * @param forceUniqueResource Forces new vertex and index buffers to be created even if the meshGUID has been registered before
 		*/
@@ -442,6 +469,11 @@ namespace LambdaEngine
 
 		void UpdateRenderGraph();
 
+		/*
+		* Writes the ranges of visible instances for the view to every MeshEntry, all instances are visible if pFrustum is nullptr
+		*/
+		void CullInstances(ECullingView cullingView, const CullingFrustum* pFrustum);
+
 #if RENDER_SYSTEM_DEBUG
 		// Debug
 		void CheckWhereEntityAlreadyRegistered(Entity entity);
@@ -530,6 +562,11 @@ namespace LambdaEngine
 		// Draw Args
 		TSet<DrawArgMaskDesc> m_RequiredDrawArgs;
 
+		// Culling
+		InstanceCuller						m_InstanceCuller;
+		TArray<CulledInstance>				m_VisibleInstances[(uint32)ECullingView::CULLING_VIEW_COUNT];
+		THashTable<String, ECullingView>	m_RenderStageCullingViews;
+
 		// Animation
 		uint64						m_SkinningPipelineID;
 		TSharedRef<PipelineLayout>	m_SkinningPipelineLayout;
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "LambdaEngine.h"
+
+#include "Math/Math.h"
+
+namespace LambdaEngine
+{
+	/*
+	* Maps a float in [min, max] to an unsigned integer with bitCount bits, values outside the range are clamped
+	*/
+	FORCEINLINE uint32 QuantizeFloat(float32 value, float32 min, float32 max, uint8 bitCount)
+	{
+		const float32 maxQuantized	= float32((uint64(1) << bitCount) - 1);
+		const float32 normalized	= glm::clamp((value - min) / (max - min), 0.0f, 1.0f);
+		return uint32(normalized * maxQuantized + 0.5f);
+	}
+
+	FORCEINLINE float32 DequantizeFloat(uint32 value, float32 min, float32 max, uint8 bitCount)
+	{
+		const float32 maxQuantized = float32((uint64(1) << bitCount) - 1);
+		return min + (float32(value) / maxQuantized) * (max - min);
+	}
+
+	FORCEINLINE glm::uvec3 QuantizeVec3(const glm::vec3& value, float32 min, float32 max, uint8 bitCount)
+	{
+		return glm::uvec3(
+			QuantizeFloat(value.x, min, max, bitCount),
+			QuantizeFloat(value.y, min, max, bitCount),
+			QuantizeFloat(value.z, min, max, bitCount));
+	}
+
+	FORCEINLINE glm::vec3 DequantizeVec3(const glm::uvec3& value, float32 min, float32 max, uint8 bitCount)
+	{
+		return glm::vec3(
+			DequantizeFloat(value.x, min, max, bitCount),
+			DequantizeFloat(value.y, min, max, bitCount),
+			DequantizeFloat(value.z, min, max, bitCount));
+	}
+
+	/*
+	* Octahedral encoding of a unit vector, the result lies in [-1, 1] on both axes
+	*/
+	FORCEINLINE glm::vec2 EncodeOctahedral(const glm::vec3& value)
+	{
+		const float32 length = glm::abs(value.x) + glm::abs(value.y) + glm::abs(value.z);
+		if (length <= 0.0f)
+		{
+			return glm::vec2(0.0f);
+		}
+
+		const glm::vec3 projected = value / length;
+		if (projected.z >= 0.0f)
+		{
+			return glm::vec2(projected.x, projected.y);
+		}
+
+		// The lower half of the octahedron is folded over the diagonals
+		return glm::vec2(
+			(1.0f - glm::abs(projected.y)) * (projected.x >= 0.0f ? 1.0f : -1.0f),
+			(1.0f - glm::abs(projected.x)) * (projected.y >= 0.0f ? 1.0f : -1.0f));
+	}
+
+	FORCEINLINE glm::vec3 DecodeOctahedral(const glm::vec2& value)
+	{
+		glm::vec3 result(value.x, value.y, 1.0f - glm::abs(value.x) - glm::abs(value.y));
+		if (result.z < 0.0f)
+		{
+			result.x = (1.0f - glm::abs(value.y)) * (value.x >= 0.0f ? 1.0f : -1.0f);
+			result.y = (1.0f - glm::abs(value.x)) * (value.y >= 0.0f ? 1.0f : -1.0f);
+		}
+
+		return glm::normalize(result);
+	}
+
+	/*
+	* Packs a unit vector into 16 bits, two octahedral components as 8 bit snorms with x in the low byte. This is the
+	* layout unpackSnorm4x8 reads in the shaders. Rounding each component on its own is off by up to 0.93 degrees, so
+	* the four codes around the vector are tried and the closest one kept, which stays within 0.64 degrees
+	*/
+	FORCEINLINE uint32 PackOctahedral16(const glm::vec3& value)
+	{
+		const glm::vec2 encoded = glm::clamp(EncodeOctahedral(value), -1.0f, 1.0f) * 127.0f;
+		const glm::vec3 normalized = glm::normalize(value);
+
+		uint32	bestCode	= 0;
+		float32	bestDot		= -2.0f;
+		for (uint32 i = 0; i < 4; i++)
+		{
+			const int32 x = glm::clamp(int32((i & 1) ? glm::ceil(encoded.x) : glm::floor(encoded.x)), -127, 127);
+			const int32 y = glm::clamp(int32((i & 2) ? glm::ceil(encoded.y) : glm::floor(encoded.y)), -127, 127);
+
+			const float32 dot = glm::dot(DecodeOctahedral(glm::vec2(float32(x), float32(y)) / 127.0f), normalized);
+			if (dot > bestDot)
+			{
+				bestDot		= dot;
+				bestCode	= uint32(uint8(int8(x))) | (uint32(uint8(int8(y))) << 8);
+			}
+		}
+
+		return bestCode;
+	}
+
+	FORCEINLINE glm::vec3 UnpackOctahedral16(uint32 value)
+	{
+		const float32 x = float32(int8(uint8(value & 0xff))) / 127.0f;
+		const float32 y = float32(int8(uint8((value >> 8) & 0xff))) / 127.0f;
+		return DecodeOctahedral(glm::clamp(glm::vec2(x, y), -1.0f, 1.0f));
+	}
+
+	/*
+	* Smallest three encoding of a unit quaternion. The largest component is left out and rebuilt from the other three,
+	* which all lie in [-1/sqrt(2), 1/sqrt(2)] and are quantized to bitCount bits each
+	*/
+	struct QuantizedQuat
+	{
+		uint32 LargestIndex = 0;
+		uint32 Components[3] = { 0, 0, 0 };
+
+		FORCEINLINE bool operator==(const QuantizedQuat& other) const
+		{
+			return LargestIndex == other.LargestIndex &&
+				Components[0] == other.Components[0] &&
+				Components[1] == other.Components[1] &&
+				Components[2] == other.Components[2];
+		}
+
+		FORCEINLINE bool operator!=(const QuantizedQuat& other) const
+		{
+			return !(*this == other);
+		}
+	};
+
+	constexpr float32 QUAT_SMALLEST_THREE_BOUND = 0.70710678118f;
+
+	FORCEINLINE QuantizedQuat QuantizeQuat(const glm::quat& value, uint8 bitCount)
+	{
+		const glm::quat normalized = glm::normalize(value);
+
+		uint32 largestIndex = 0;
+		for (uint32 i = 1; i < 4; i++)
+		{
+			if (glm::abs(normalized[i]) > glm::abs(normalized[largestIndex]))
+			{
+				largestIndex = i;
+			}
+		}
+
+		// q and -q are the same rotation, flip it so the left out component is positive
+		const float32 sign = normalized[largestIndex] < 0.0f ? -1.0f : 1.0f;
+
+		QuantizedQuat result;
+		result.LargestIndex = largestIndex;
+
+		uint32 componentIndex = 0;
+		for (uint32 i = 0; i < 4; i++)
+		{
+			if (i != largestIndex)
+			{
+				result.Components[componentIndex++] = QuantizeFloat(sign * normalized[i], -QUAT_SMALLEST_THREE_BOUND, QUAT_SMALLEST_THREE_BOUND, bitCount);
+			}
+		}
+
+		return result;
+	}
+
+	FORCEINLINE glm::quat DequantizeQuat(const QuantizedQuat& value, uint8 bitCount)
+	{
+		glm::quat result;
+
+		float32 sumSquared = 0.0f;
+		uint32 componentIndex = 0;
+		for (uint32 i = 0; i < 4; i++)
+		{
+			if (i != value.LargestIndex)
+			{
+				const float32 component = DequantizeFloat(value.Components[componentIndex++], -QUAT_SMALLEST_THREE_BOUND, QUAT_SMALLEST_THREE_BOUND, bitCount);
+				result[i] = component;
+				sumSquared += component * component;
+			}
+		}
+
+		result[value.LargestIndex] = glm::sqrt(glm::max(1.0f - sumSquared, 0.0f));
+		return glm::normalize(result);
+	}
+
+	/*
+	* Packs a QuantizedQuat into 2 + 3 * bitCount bits, bitCount can be at most 20
+	*/
+	FORCEINLINE uint64 PackQuantizedQuat(const QuantizedQuat& value, uint8 bitCount)
+	{
+		return
+			uint64(value.LargestIndex) |
+			(uint64(value.Components[0]) << 2) |
+			(uint64(value.Components[1]) << (2 + bitCount)) |
+			(uint64(value.Components[2]) << (2 + 2 * bitCount));
+	}
+
+	FORCEINLINE QuantizedQuat UnpackQuantizedQuat(uint64 value, uint8 bitCount)
+	{
+		const uint64 mask = (uint64(1) << bitCount) - 1;
+
+		QuantizedQuat result;
+		result.LargestIndex		= uint32(value & 0x3);
+		result.Components[0]	= uint32((value >> 2) & mask);
+		result.Components[1]	= uint32((value >> (2 + bitCount)) & mask);
+		result.Components[2]	= uint32((value >> (2 + 2 * bitCount)) & mask);
+		return result;
+	}
+}
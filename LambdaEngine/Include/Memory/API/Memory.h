@@ -19,6 +19,13 @@ namespace LambdaEngine
 
 		static uint64 GetPageSize()					{ return 0; }
 		static uint64 GetAllocationGranularity()	{ return 0; }
+
+		/*
+		* Maps a whole file read only into memory, sizeInBytes is set to the size of the file. Returns nullptr if the
+		* file could not be opened or is empty
+		*/
+		static const void*	MapFile(const char* pFilepath, uint64& sizeInBytes)		{ return nullptr; }
+		static bool			UnmapFile(const void* pMemory, uint64 sizeInBytes)		{ return false; }
 	};
 }
 
@@ -4,6 +4,8 @@
 	#include "Memory/Win32/Win32Memory.h"
 #elif defined(LAMBDA_PLATFORM_MACOS)
 	#include "Memory/Mac/MacMemory.h"
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	#include "Memory/Linux/LinuxMemory.h"
 #else
 	#error No platform defined
 #endif
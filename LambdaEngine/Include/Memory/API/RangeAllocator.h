@@ -0,0 +1,107 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/TArray.h"
+
+namespace LambdaEngine
+{
+	struct RangeAllocation
+	{
+		uint32 Offset	= 0;
+		uint32 Size		= 0;
+		uint32 Handle	= UINT32_MAX;
+	};
+
+	struct RangeAllocatorStatistics
+	{
+		uint32	Capacity			= 0;
+		uint32	UsedSize			= 0;
+		uint32	FreeSize			= 0;
+		uint32	FreeRangeCount		= 0;
+		uint32	LargestFreeRange	= 0;
+		float32	Fragmentation		= 0.0f; // Share of the free size that is not part of the largest free range
+	};
+
+	/*
+	* RangeAllocator hands out ranges of a fixed capacity, such as elements of a buffer, using a two level segregated
+	* fit (TLSF). Free ranges are kept in lists bucketed by size with a bitmap of non-empty lists per level, so both
+	* allocating and freeing take constant time. Freed ranges are merged with free neighbours right away.
+	* Like any TLSF allocator, an allocation can fail while the list its size maps to still holds a large enough range,
+	* only the first few ranges of that list are checked
+	*/
+	class RangeAllocator
+	{
+		static constexpr uint32 SECOND_LEVEL_LOG2	= 4;
+		static constexpr uint32 SECOND_LEVEL_COUNT	= 1u << SECOND_LEVEL_LOG2;
+		static constexpr uint32 FIRST_LEVEL_COUNT	= 32 - SECOND_LEVEL_LOG2 + 1;
+		static constexpr uint32 INVALID_BLOCK		= UINT32_MAX;
+		// Amount of blocks checked in the list the size maps to when no larger list has a free block
+		static constexpr uint32 MAX_FALLBACK_CANDIDATES	= 8;
+
+		struct Block
+		{
+			uint32	Offset			= 0;
+			uint32	Size			= 0;
+			uint32	PrevPhysical	= INVALID_BLOCK;
+			uint32	NextPhysical	= INVALID_BLOCK;
+			uint32	PrevFree		= INVALID_BLOCK;
+			uint32	NextFree		= INVALID_BLOCK; // Next unused block when the block is not in use
+			bool	IsFree			= false;
+		};
+
+	public:
+		DECL_REMOVE_COPY(RangeAllocator);
+		DECL_REMOVE_MOVE(RangeAllocator);
+
+		RangeAllocator() = default;
+		~RangeAllocator() = default;
+
+		/*
+		* Frees every allocation and starts over with one free range spanning the capacity
+		*/
+		void Init(uint32 capacity);
+
+		/*
+		* Returns false if there is no free range of at least the size
+		*/
+		bool Allocate(uint32 size, RangeAllocation& allocation);
+		void Free(const RangeAllocation& allocation);
+
+		RangeAllocatorStatistics GetStatistics() const;
+
+		FORCEINLINE uint32 GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+		FORCEINLINE uint32 GetFreeSize() const
+		{
+			return m_FreeSize;
+		}
+
+	private:
+		uint32 AllocateBlock();
+		void ReleaseBlock(uint32 block);
+
+		void InsertFreeBlock(uint32 block);
+		void RemoveFreeBlock(uint32 block);
+
+		/*
+		* Finds a free block of at least the size, every block in the list that is found is large enough
+		*/
+		uint32 FindFreeBlock(uint32 size) const;
+
+		static void MapSize(uint32 size, uint32& firstLevel, uint32& secondLevel);
+
+	private:
+		TArray<Block>	m_Blocks;
+		uint32			m_UnusedBlocks		= INVALID_BLOCK;
+		uint32			m_Capacity			= 0;
+		uint32			m_FreeSize			= 0;
+		uint32			m_FreeRangeCount	= 0;
+
+		uint32			m_FirstLevelBitmap						= 0;
+		uint32			m_SecondLevelBitmaps[FIRST_LEVEL_COUNT]	= { };
+		uint32			m_FreeLists[FIRST_LEVEL_COUNT][SECOND_LEVEL_COUNT];
+	};
+}
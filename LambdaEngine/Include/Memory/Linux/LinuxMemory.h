@@ -0,0 +1,27 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Memory/API/Memory.h"
+
+namespace LambdaEngine
+{
+	class LinuxMemory : public Memory
+	{
+	public:
+		DECL_STATIC_CLASS(LinuxMemory);
+
+		static void*	VirtualAlloc(uint64 sizeInBytes);
+		static bool		VirtualProtect(void* pMemory, uint64 sizeInBytes);
+		static bool		VirtualFree(void* pMemory);
+
+		static uint64 GetPageSize();
+		static uint64 GetAllocationGranularity();
+
+		static const void*	MapFile(const char* pFilepath, uint64& sizeInBytes);
+		static bool			UnmapFile(const void* pMemory, uint64 sizeInBytes);
+	};
+
+	typedef LinuxMemory PlatformMemory;
+}
+
+#endif
@@ -16,6 +16,9 @@ namespace LambdaEngine
 
 		static uint64 GetPageSize();
 		static uint64 GetAllocationGranularity();
+
+		static const void*	MapFile(const char* pFilepath, uint64& sizeInBytes);
+		static bool			UnmapFile(const void* pMemory, uint64 sizeInBytes);
 	};
 
 	typedef MacMemory PlatformMemory;
@@ -6,6 +6,8 @@
 
 #include "Math/Math.h"
 
+#include "Math/Quantization.h"
+
 namespace LambdaEngine
 {
 	class NetworkSegment;
@@ -36,9 +38,23 @@ namespace LambdaEngine
 
 		bool ReadQuat(glm::quat& value);
 
+		/*
+		* Bit packed reads, mirrors BinaryEncoder. Byte aligned reads skip the bits left in the current byte
+		*	bitCount - [1, 32]
+		*/
+		bool ReadBits(uint32& value, uint8 bitCount);
+		void AlignBits();
+
+		bool ReadQuantizedFloat(float32& value, float32 min, float32 max, uint8 bitCount);
+		bool ReadQuantizedVec3(glm::vec3& value, float32 min, float32 max, uint8 bitCount);
+		bool ReadQuantizedQuat(glm::quat& value, uint8 bitCount);
+		bool ReadQuantizedQuat(QuantizedQuat& value, uint8 bitCount);
+
 		NetworkSegment* GetPacket();
 
 	private:
 		NetworkSegment* m_pNetworkPacket;
+		uint64 m_BitBuffer;
+		uint32 m_BitCount;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "Math/Math.h"
 
+#include "Math/Quantization.h"
+
 namespace LambdaEngine
 {
 	class NetworkSegment;
@@ -35,7 +37,26 @@ namespace LambdaEngine
 
 		bool WriteQuat(const glm::quat& value);
 
+		/*
+		* Bit packed writes. Bits are collected until a full byte is available, byte aligned writes and the destructor
+		* flush the remaining bits padded with zeros
+		*	bitCount - [1, 32]
+		*/
+		bool WriteBits(uint32 value, uint8 bitCount);
+		bool FlushBits();
+
+		bool WriteQuantizedFloat(float32 value, float32 min, float32 max, uint8 bitCount);
+		bool WriteQuantizedVec3(const glm::vec3& value, float32 min, float32 max, uint8 bitCount);
+
+		/*
+		* Writes the quaternion with smallest three encoding, 2 + 3 * bitCount bits
+		*/
+		bool WriteQuantizedQuat(const glm::quat& value, uint8 bitCount);
+		bool WriteQuantizedQuat(const QuantizedQuat& value, uint8 bitCount);
+
 	private:
 		NetworkSegment* m_pNetworkPacket;
+		uint64 m_BitBuffer;
+		uint32 m_BitCount;
 	};
 }
\ No newline at end of file
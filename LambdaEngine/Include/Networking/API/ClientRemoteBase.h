@@ -67,6 +67,12 @@ namespace LambdaEngine
 		void TransmitPackets();
 		void DecodeReceivedPackets();
 
+		/*
+		* Decodes the packet last received by pTransceiver, serialized per client since several receiver threads can
+		* receive packets from the same client
+		*/
+		void DecodeReceivedPackets(PacketTransceiverBase* pTransceiver);
+
 		virtual void OnPacketDelivered(NetworkSegment* pPacket) override;
 		virtual void OnPacketResent(NetworkSegment* pPacket, uint8 tries) override;
 		virtual void OnPacketMaxTriesReached(NetworkSegment* pPacket, uint8 tries) override;
@@ -110,6 +116,7 @@ namespace LambdaEngine
 		std::atomic_bool m_TerminationRequested;
 		std::atomic_bool m_TerminationApproved;
 		bool m_UsePingSystem;
+		SpinLock m_LockDecode;
 		SpinLock m_LockReceivedPackets;
 		std::atomic_int8_t m_BufferIndex;
 		TArray<NetworkSegment*> m_ReceivedPackets[2];
@@ -5,6 +5,7 @@
 #include "Threading/API/SpinLock.h"
 
 #include "Networking/API/NetworkSegment.h"
+#include "Networking/API/NetworkStatistics.h"
 
 #include "Containers/THashTable.h"
 
@@ -26,11 +27,17 @@ namespace LambdaEngine
 		virtual ~NetWorker();
 
 		void Flush();
+		uint32 GetReceiverThreadCount() const;
+
+		/*
+		* return - The counters of the receiver thread with the given index
+		*/
+		const NetworkWorkerStatistics* GetReceiverStatistics(uint32 workerIndex) const;
 
 	protected:
 		virtual bool OnThreadsStarted(std::string& reason) = 0;
 		virtual void RunTransmitter() = 0;
-		virtual void RunReceiver() = 0;
+		virtual void RunReceiver(uint32 workerIndex) = 0;
 		virtual void OnThreadsTerminated() = 0;
 		virtual void OnTerminationRequested(const std::string& reason) = 0;
 		virtual void OnReleaseRequested(const std::string& reason) = 0;
@@ -42,10 +49,17 @@ namespace LambdaEngine
 		bool ShouldTerminate() const;
 		void YieldTransmitter();
 		void TerminateAndRelease(const std::string& reason);
+		NetworkWorkerStatistics* GetMutableReceiverStatistics(uint32 workerIndex);
+
+		/*
+		* Sets the amount of threads running RunReceiver, can only be changed while the threads are stopped
+		*	count - Amount of receiver threads, at least one
+		*/
+		void SetReceiverThreadCount(uint32 count);
 
 	private:
 		void ThreadTransmitter();
-		void ThreadReceiver();
+		void ThreadReceiver(uint32 workerIndex);
 		void ThreadTransmitterDeleted();
 		void ThreadReceiverDeleted();
 		void ThreadsDeleted();
@@ -59,14 +73,16 @@ namespace LambdaEngine
 
 	private:
 		Thread* m_pThreadTransmitter;
-		Thread* m_pThreadReceiver;
+		uint32 m_ReceiverThreadCount;
+		NetworkWorkerStatistics* m_pReceiverStatistics;
 
 		SpinLock m_Lock;
 
 		std::atomic_bool m_Run;
 		std::atomic_bool m_ThreadsStarted;
 		std::atomic_bool m_Initiated;
-		std::atomic_bool m_ReceiverStopped;
+		std::atomic_uint32_t m_ReceiverThreadsAlive;
+		std::atomic_uint32_t m_ReceiversRunning;
 		std::atomic_bool m_ThreadsTerminated;
 		std::atomic_bool m_Release;
 
@@ -195,4 +195,49 @@ namespace LambdaEngine
 		SpinLock m_LockBytesSentHistory;
 		SpinLock m_LockBytesReceivedHistory;
 	};
+
+	/*
+	* Counters for a single receiver thread of a NetWorker. Only the owning thread writes to them, but they can be
+	* read from any thread
+	*/
+	class LAMBDA_API NetworkWorkerStatistics
+	{
+		friend class NetWorker;
+		friend class ServerUDP;
+
+	public:
+		NetworkWorkerStatistics();
+		~NetworkWorkerStatistics() = default;
+
+		/*
+		* return - The number of physical packets received by the worker
+		*/
+		uint32 GetPacketsReceived() const;
+
+		/*
+		* return - The total number of bytes received by the worker
+		*/
+		uint32 GetBytesReceived() const;
+
+		/*
+		* return - The number of connections the worker has created a remote client for
+		*/
+		uint32 GetNewConnections() const;
+
+		/*
+		* return - The total time the worker has spent looking up clients and decoding their packets
+		*/
+		Timestamp GetDecodeTime() const;
+
+	private:
+		void Reset();
+		void RegisterPacketReceived(uint32 bytes, Timestamp decodeTime);
+		void RegisterNewConnection();
+
+	private:
+		std::atomic_uint32_t m_PacketsReceived;
+		std::atomic_uint32_t m_BytesReceived;
+		std::atomic_uint32_t m_NewConnections;
+		std::atomic_uint64_t m_DecodeTimeNanoSeconds;
+	};
 }
\ No newline at end of file
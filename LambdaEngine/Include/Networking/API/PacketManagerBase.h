@@ -8,11 +8,17 @@
 
 #include "Networking/API/NetworkSegment.h"
 #include "Networking/API/NetworkStatistics.h"
+#include "Networking/API/ReliableSegmentBuffer.h"
 #include "Networking/API/SegmentPool.h"
 #include "Networking/API/IPEndPoint.h"
 
+#include "Threading/API/MPSCQueue.h"
 #include "Threading/API/SpinLock.h"
 
+/*	Amount of transmitted packets whose reliable segments are remembered until acked. Acks only reach 64 packets
+	back from the latest received sequence, so older bundles could never be acked anyway. */
+#define PACKET_BUNDLE_BUFFER_SIZE 256u
+
 namespace LambdaEngine
 {
 	class IPacketListener;
@@ -33,18 +39,18 @@ namespace LambdaEngine
 	public:
 		DECL_ABSTRACT_CLASS(PacketManagerBase);
 
-		struct SegmentInfo
+		struct Bundle
 		{
-			NetworkSegment* Segment = nullptr;
-			IPacketListener* Listener = nullptr;
-			Timestamp LastSent = 0;
-			uint8 Retries = 0;
+			TArray<uint32> ReliableUIDs;
+			Timestamp Timestamp = 0;
+			// 0 marks an unused bundle, packet sequence numbers start at 1
+			uint32 Sequence = 0;
 		};
 
-		struct Bundle
+		struct QueuedSegment
 		{
-			std::set<uint32> ReliableUIDs;
-			Timestamp Timestamp = 0;
+			NetworkSegment* pSegment = nullptr;
+			IPacketListener* pListener = nullptr;
 		};
 
 	public:
@@ -68,26 +74,41 @@ namespace LambdaEngine
 
 	protected:
 		virtual bool FindSegmentsToReturn(const TArray<NetworkSegment*>& segmentsReceived, TArray<NetworkSegment*>& segmentsReturned, bool& hasDiscardedResends) = 0;
-		void InsertSegment(NetworkSegment* pSegment);
+		// Queues a reliable segment that is waiting for an ack to be transmitted again, requires m_LockSegmentsWaitingForAck
+		void InsertResend(ReliableSegmentInfo& segmentInfo);
+		// Only looks at newly enqueued segments, resends are not visible without taking m_LockSegmentsWaitingForAck
+		bool HasSegmentsToSend() const;
 
 	private:
-		uint32 EnqueueSegment(NetworkSegment* pSegment, uint32 reliableUID);
+		uint32 EnqueueSegment(NetworkSegment* pSegment, IPacketListener* pListener, uint32 reliableUID);
 		void DeleteOldBundles();
 		void HandleAcks(const TSet<uint32>& acks);
 		void GetReliableUIDsFromAckedPackets(const TSet<uint32>& acks, TArray<uint32>& ackedReliableUIDs);
-		void GetReliableSegmentInfosFromUIDs(const TArray<uint32>& ackedReliableUIDs, TArray<SegmentInfo>& ackedReliableSegments);
 		void RegisterRTT(Timestamp rtt);
 
 	protected:
 		NetworkStatistics m_Statistics;
 		SegmentPool m_SegmentPool;
 		IPEndPoint m_IPEndPoint;
-		std::set<NetworkSegment*, NetworkSegmentUIDOrder> m_SegmentsToSend[2];
-		std::unordered_map<uint32, SegmentInfo> m_SegmentsWaitingForAck;
-		std::unordered_map<uint32, Bundle> m_Bundles;
-		std::atomic_int m_QueueIndex;
+		// Segments enqueued from any thread, drained by Flush
+		TMPSCQueue<QueuedSegment> m_SegmentsToSend;
+		ReliableSegmentBuffer m_SegmentsWaitingForAck;
+		// Reliable UIDs of segments in m_SegmentsWaitingForAck to transmit again during the next flush
+		TArray<uint32> m_ResendUIDs;
+		// Indexed by packet sequence number
+		Bundle m_Bundles[PACKET_BUNDLE_BUFFER_SIZE];
 		Timestamp m_Timer;
-		SpinLock m_LockSegmentsToSend;
+		SpinLock m_LockFlush;
+		SpinLock m_LockSegmentsWaitingForAck;
 		SpinLock m_LockBundles;
+		// Set by Flush while it transmits without m_LockSegmentsWaitingForAck, segments acked meanwhile are freed by Flush
+		bool m_IsTransmitting = false;
+		TArray<NetworkSegment*> m_SegmentsAckedWhileTransmitting;
+
+	private:
+		// Reused between flushes to avoid allocating when transmitting
+		TArray<NetworkSegment*> m_SegmentsToFlush;
+		TArray<NetworkSegment*> m_SegmentsToFree;
+		TArray<uint32> m_ReliableUIDsSent;
 	};
 }
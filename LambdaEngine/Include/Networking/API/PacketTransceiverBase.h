@@ -21,10 +21,29 @@ namespace LambdaEngine
 	public:
 		DECL_ABSTRACT_CLASS_NO_DEFAULT(PacketTransceiverBase);
 
-		uint32 Transmit(SegmentPool* pSegmentPool, std::set<NetworkSegment*, NetworkSegmentUIDOrder>& packets, std::set<uint32>& reliableUIDsSent, const IPEndPoint& endPoint, NetworkStatistics* pStatistics);
+		/*
+		* Transmits one packet containing as many segments as fits, starting at segmentIndex
+		*	return - The sequence number of the packet, UINT32_MAX if transmitting failed
+		*/
+		uint32 Transmit(const TArray<NetworkSegment*>& segments, uint32& segmentIndex, TArray<uint32>& reliableUIDsSent, const IPEndPoint& endPoint, NetworkStatistics* pStatistics);
 		bool ReceiveBegin(IPEndPoint& sender);
 		bool ReceiveEnd(SegmentPool* pSegmentPool, TArray<NetworkSegment*>& packets, TSet<uint32>& newAcks, NetworkStatistics* pStatistics);
 
+		/*
+		* return - The size of the packet received by the last call to ReceiveBegin
+		*/
+		uint32 GetBytesReceived() const;
+
+		/*
+		* return - The packet received by the last call to ReceiveBegin or SetReceivedData
+		*/
+		const uint8* GetReceivedData() const;
+
+		/*
+		* Hands the transceiver a packet another thread received, ReceiveEnd then decodes it like one from ReceiveBegin
+		*/
+		void SetReceivedData(const uint8* pBuffer, uint32 size);
+
 		virtual void SetSocket(ISocket* pSocket) = 0;
 
 		void SetIgnoreSaltMissmatch(bool ignore);
@@ -29,7 +29,11 @@ namespace LambdaEngine
 	public:
 		DECL_STATIC_CLASS(PacketTranscoder);
 
-		static void EncodeSegments(uint8* buffer, uint16 bufferSize, SegmentPool* pSegmentPool, std::set<NetworkSegment*, NetworkSegmentUIDOrder>& segmentsToEncode, std::set<uint32>& reliableUIDsSent, uint16& bytesWritten, Header* pHeader);
+		/*
+		* Writes segments starting at segmentIndex until the buffer is full or every segment has been written.
+		* segmentIndex is advanced past the written segments. Written segments are still owned by the caller.
+		*/
+		static void EncodeSegments(uint8* buffer, uint16 bufferSize, const TArray<NetworkSegment*>& segmentsToEncode, uint32& segmentIndex, TArray<uint32>& reliableUIDsSent, uint16& bytesWritten, Header* pHeader);
 		static bool DecodeSegments(const uint8* buffer, uint16 bufferSize, SegmentPool* pSegmentPool, TArray<NetworkSegment*>& segmentsDecoded, Header* pHeader);
 
 	private:
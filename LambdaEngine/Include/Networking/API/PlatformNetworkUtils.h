@@ -4,6 +4,8 @@
 	#include "Networking/Win32/Win32NetworkUtils.h"
 #elif defined(LAMBDA_PLATFORM_MACOS)
     #include "Networking/Mac/MacNetworkUtils.h"
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	#include "Networking/Linux/LinuxNetworkUtils.h"
 #else
 	#error No platform defined
 #endif
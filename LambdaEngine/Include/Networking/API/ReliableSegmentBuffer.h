@@ -0,0 +1,83 @@
+#pragma once
+
+#include "LambdaEngine.h"
+#include "Containers/TArray.h"
+
+#include "Time/API/Timestamp.h"
+
+// Amount of slots a ReliableSegmentBuffer starts with, it doubles whenever the in-flight UIDs span more than that
+#define RELIABLE_SEGMENT_BUFFER_INITIAL_CAPACITY 256u
+
+namespace LambdaEngine
+{
+	class NetworkSegment;
+	class IPacketListener;
+
+	struct ReliableSegmentInfo
+	{
+		NetworkSegment* Segment = nullptr;
+		IPacketListener* Listener = nullptr;
+		// UINT64_MAX while the segment is waiting to be (re)transmitted
+		Timestamp LastSent = 0;
+		// 0 marks an empty slot, reliable UIDs start at 1
+		uint32 ReliableUID = 0;
+		uint8 Retries = 0;
+	};
+
+	/*
+	* Ring buffer of reliable segments waiting for an ack, indexed by reliable UID. Reliable UIDs are handed out
+	* sequentially, so lookups are a mask and a compare and the buffer only allocates when it has to grow.
+	*/
+	class LAMBDA_API ReliableSegmentBuffer
+	{
+	public:
+		ReliableSegmentBuffer();
+		~ReliableSegmentBuffer() = default;
+
+		void Insert(const ReliableSegmentInfo& segmentInfo);
+		void Remove(uint32 reliableUID);
+		void Clear();
+
+		/*
+		* return - nullptr if no segment with the reliable UID is waiting for an ack
+		*/
+		FORCEINLINE ReliableSegmentInfo* Find(uint32 reliableUID)
+		{
+			ReliableSegmentInfo& segmentInfo = m_Slots[reliableUID & (m_Slots.GetSize() - 1)];
+			return segmentInfo.ReliableUID == reliableUID && reliableUID != 0 ? &segmentInfo : nullptr;
+		}
+
+		/*
+		* Calls func(ReliableSegmentInfo&) for every segment in reliable UID order
+		*/
+		template<typename Func>
+		void ForEach(Func func)
+		{
+			if (m_Count > 0)
+			{
+				const uint32 mask = m_Slots.GetSize() - 1;
+				for (uint32 reliableUID = m_OldestUID; reliableUID - m_OldestUID <= m_NewestUID - m_OldestUID; reliableUID++)
+				{
+					ReliableSegmentInfo& segmentInfo = m_Slots[reliableUID & mask];
+					if (segmentInfo.ReliableUID == reliableUID)
+					{
+						func(segmentInfo);
+					}
+				}
+			}
+		}
+
+		FORCEINLINE uint32 GetCount() const { return m_Count; }
+		FORCEINLINE bool IsEmpty() const { return m_Count == 0; }
+
+	private:
+		void Grow(uint32 requiredCapacity);
+
+	private:
+		// The size is always a power of two
+		TArray<ReliableSegmentInfo> m_Slots;
+		uint32 m_OldestUID;
+		uint32 m_NewestUID;
+		uint32 m_Count;
+	};
+}
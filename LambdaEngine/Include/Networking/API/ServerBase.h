@@ -12,6 +12,9 @@
 #include "Networking/API/IPEndPoint.h"
 #include "Networking/API/EProtocol.h"
 
+// Amount of shards the endpoint to client lookup is split into, receiver threads only contend when their senders share a shard
+#define SERVER_CLIENT_LOOKUP_SHARD_COUNT 16
+
 namespace LambdaEngine
 {
 	class ISocket;
@@ -32,6 +35,8 @@ namespace LambdaEngine
 		Timestamp PingInterval  = Timestamp::Seconds(1);
 		Timestamp PingTimeout   = Timestamp::Seconds(3);
 		bool UsePingSystem      = true;
+		// Only used by UDP servers, TCP servers receive on one thread per client. Each UDP client is decoded by one of them.
+		uint32 ReceiverThreadCount = 1;
 	};
 
 	class LAMBDA_API ServerBase : public NetWorker
@@ -88,6 +93,13 @@ namespace LambdaEngine
 			return result;
 		}
 
+	protected:
+		struct ClientLookupShard
+		{
+			SpinLock Lock;
+			ClientMap Clients;
+		};
+
 	protected:
 		ServerBase(const ServerDesc& desc);
 
@@ -99,7 +111,19 @@ namespace LambdaEngine
 
 		virtual void FixedTick(Timestamp delta);
 		ClientRemoteBase* GetClient(const IPEndPoint& endPoint);
-		void HandleNewConnection(ClientRemoteBase* pClient);
+		ClientLookupShard& GetClientLookupShard(const IPEndPoint& endPoint);
+
+		/*
+		* Flushes the packet managers of every client, called once per transmitter iteration
+		*/
+		void TransmitClientPackets();
+
+		/*
+		* Queues the client to be added unless the server is full or not accepting connections
+		*	return - True if the client was accepted, otherwise it is up to the caller to remove it from its lookup shard
+		*/
+		bool HandleNewConnection(ClientRemoteBase* pClient);
+		void RemoveFromClientLookup(ClientRemoteBase* pClient);
 
 		virtual ISocket* SetupSocket(std::string& reason) = 0;
 
@@ -126,6 +150,8 @@ namespace LambdaEngine
 		ClientUIDMap m_UIDToClient;
 		TArray<ClientRemoteBase*> m_ClientsToAdd;
 		TArray<ClientRemoteBase*> m_ClientsToRemove;
+		// Clients that are connecting or connected, looked up by receiver threads without taking m_LockClients
+		ClientLookupShard m_ClientLookupShards[SERVER_CLIENT_LOOKUP_SHARD_COUNT];
 
 	private:
 		static std::set<ServerBase*> s_Servers;
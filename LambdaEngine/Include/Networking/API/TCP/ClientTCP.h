@@ -21,7 +21,7 @@ namespace LambdaEngine
 		virtual const PacketManagerBase* GetPacketManager() const override;
 		virtual PacketTransceiverBase* GetTransceiver() override;
 		virtual ISocket* SetupSocket(std::string& reason) override;
-		virtual void RunReceiver() override;
+		virtual void RunReceiver(uint32 workerIndex) override;
 		virtual void OnPacketDelivered(NetworkSegment* pPacket) override;
 		virtual void OnPacketResent(NetworkSegment* pPacket, uint8 tries) override;
 		virtual void OnPacketMaxTriesReached(NetworkSegment* pPacket, uint8 tries) override;
@@ -21,7 +21,7 @@ namespace LambdaEngine
 		ServerTCP(const ServerDesc& desc);
 
 		virtual ISocket* SetupSocket(std::string& reason) override;
-		virtual void RunReceiver() override;
+		virtual void RunReceiver(uint32 workerIndex) override;
 
 	private:
 		ClientRemoteTCP* CreateClient(ISocketTCP* socket);
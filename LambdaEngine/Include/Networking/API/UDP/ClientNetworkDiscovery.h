@@ -39,7 +39,7 @@ namespace LambdaEngine
 	protected:
 		virtual bool OnThreadsStarted(std::string& reason) override;
 		virtual void RunTransmitter() override;
-		virtual void RunReceiver() override;
+		virtual void RunReceiver(uint32 workerIndex) override;
 		virtual void OnThreadsTerminated() override;
 		virtual void OnTerminationRequested(const std::string& reason) override;
 		virtual void OnReleaseRequested(const std::string& reason) override;
@@ -1,9 +1,20 @@
 #pragma once
 
 #include "Networking/API/ISocket.h"
+#include "Networking/API/IPEndPoint.h"
 
 namespace LambdaEngine
 {
+	struct UDPDatagram
+	{
+		uint8* pBuffer		= nullptr;
+		// The size of pBuffer when receiving, the number of bytes to send when sending
+		uint32 BufferSize	= 0;
+		// The number of bytes actually received or sent
+		int32 Bytes			= 0;
+		IPEndPoint EndPoint;
+	};
+
 	class ISocketUDP : public ISocket
 	{
 	public:
@@ -33,6 +44,52 @@ namespace LambdaEngine
 		*/
 		virtual bool ReceiveFrom(uint8* pBuffer, uint32 size, int32& bytesReceived, IPEndPoint& ipEndPoint) = 0;
 
+		/*
+		* Sends several datagrams. Platforms that support it send all of them with a single system call, the others
+		* fall back to one SendTo per datagram.
+		*
+		* pDatagrams - The datagrams to send, Bytes is set for every datagram that was sent
+		* count		 - The number of datagrams in pDatagrams
+		* sent		 - Will return the number of datagrams sent
+		*
+		* return	 - False if an error occured, otherwise true.
+		*/
+		virtual bool SendToBatch(UDPDatagram* pDatagrams, uint32 count, uint32& sent)
+		{
+			for (sent = 0; sent < count; sent++)
+			{
+				UDPDatagram& datagram = pDatagrams[sent];
+				if (!SendTo(datagram.pBuffer, datagram.BufferSize, datagram.Bytes, datagram.EndPoint))
+					return false;
+			}
+			return true;
+		}
+
+		/*
+		* Receives up to count datagrams, blocking until at least one has arrived unless the socket is non blocking.
+		* Platforms that support it receive all datagrams that are queued with a single system call, the others
+		* fall back to one ReceiveFrom.
+		*
+		* pDatagrams - The datagrams to receive into, pBuffer and BufferSize must be set
+		* count		 - The number of datagrams in pDatagrams
+		* received	 - Will return the number of datagrams received
+		*
+		* return	 - False if an error occured, otherwise true.
+		*/
+		virtual bool ReceiveFromBatch(UDPDatagram* pDatagrams, uint32 count, uint32& received)
+		{
+			received = 0;
+			if (count == 0)
+				return true;
+
+			UDPDatagram& datagram = pDatagrams[0];
+			if (!ReceiveFrom(datagram.pBuffer, datagram.BufferSize, datagram.Bytes, datagram.EndPoint))
+				return false;
+
+			received = datagram.Bytes > 0 ? 1 : 0;
+			return true;
+		}
+
 		/*
 		* Enables or disables the broadcast functionality
 		*
@@ -1,12 +1,18 @@
 #pragma once
 
 #include "Networking/API/PacketTransceiverBase.h"
+#include "Networking/API/UDP/ISocketUDP.h"
+
+#include <atomic>
+#include <thread>
+
+// Maximum number of datagrams a PacketTransceiverUDP queues or receives before going back to the socket
+#define PACKET_TRANSCEIVER_UDP_BATCH_SIZE 32
 
 namespace LambdaEngine
 {
 	class NetworkSegment;
 	class NetworkStatistics;
-	class ISocketUDP;
 
 	class LAMBDA_API PacketTransceiverUDP : public PacketTransceiverBase
 	{
@@ -19,6 +25,14 @@ namespace LambdaEngine
 		void SetSimulateReceivingPacketLoss(float32 lossRatio);
 		void SetSimulateTransmittingPacketLoss(float32 lossRatio);
 
+		/*
+		* Until EndTransmitBatch is called, packets transmitted by the calling thread are queued and sent with as few
+		* socket calls as possible. Packets transmitted by other threads in the meantime are sent right away.
+		* A packet that fails to send when the batch is flushed counts as lost, like any other UDP packet.
+		*/
+		void BeginTransmitBatch();
+		void EndTransmitBatch();
+
 	protected:
 		virtual bool TransmitData(const uint8* pBuffer, uint32 bytesToSend, int32& bytesSent, const IPEndPoint& ipEndPoint) override;
 		virtual bool ReceiveData(uint8* pBuffer, uint32 size, int32& bytesReceived, IPEndPoint& pIPEndPoint) override;
@@ -28,9 +42,23 @@ namespace LambdaEngine
 		static void ProcessSequence(uint32 sequence, NetworkStatistics* pStatistics);
 		void ProcessAcks(uint32 ack, uint64 ackBits, NetworkStatistics* pStatistics, TSet<uint32>& newAcks);
 
+		bool FlushTransmitBatch();
+
 	private:
 		ISocketUDP* m_pSocket;
 		float32 m_ReceivingLossRatio;
 		float32 m_TransmittingLossRatio;
+
+		// Only touched by the thread that called BeginTransmitBatch
+		std::atomic<std::thread::id> m_TransmitBatchThread;
+		UDPDatagram m_TransmitBatch[PACKET_TRANSCEIVER_UDP_BATCH_SIZE];
+		uint32 m_TransmitBatchCount;
+		uint8 m_pTransmitBatchBuffers[PACKET_TRANSCEIVER_UDP_BATCH_SIZE][MAXIMUM_SEGMENT_SIZE];
+
+		// Datagrams received by the last ReceiveFromBatch that ReceiveData has not handed out yet
+		UDPDatagram m_ReceiveBatch[PACKET_TRANSCEIVER_UDP_BATCH_SIZE];
+		uint32 m_ReceiveBatchCount;
+		uint32 m_ReceiveBatchIndex;
+		uint8 m_pReceiveBatchBuffers[PACKET_TRANSCEIVER_UDP_BATCH_SIZE][MAXIMUM_SEGMENT_SIZE];
 	};
 }
\ No newline at end of file
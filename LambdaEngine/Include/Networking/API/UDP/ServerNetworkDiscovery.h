@@ -38,7 +38,7 @@ namespace LambdaEngine
         virtual void OnTerminationRequested(const std::string& reason) override;
         virtual void OnReleaseRequested(const std::string& reason) override;
         virtual void RunTransmitter() override;
-        virtual void RunReceiver() override;
+        virtual void RunReceiver(uint32 workerIndex) override;
 
         void HandleReceivedPacket(const IPEndPoint& sender, NetworkSegment* pPacket);
 
@@ -7,6 +7,16 @@
 
 #include "Containers/THashTable.h"
 
+#include "Threading/API/MPSCQueue.h"
+
+#include <condition_variable>
+#include <mutex>
+
+// Maximum number of datagrams waiting for a receiver thread, datagrams forwarded to a full queue are dropped
+#define SERVER_UDP_RECEIVER_QUEUE_SIZE 256
+// Longest time a receiver thread sleeps before checking for forwarded datagrams or termination again
+#define SERVER_UDP_RECEIVER_WAIT_MS 5
+
 namespace LambdaEngine
 {
 	class ClientRemoteUDP;
@@ -26,12 +36,41 @@ namespace LambdaEngine
 		ServerUDP(const ServerDesc& desc);
 
 		virtual ISocket* SetupSocket(std::string& reason) override;
-		virtual void RunReceiver() override;
+		virtual void RunReceiver(uint32 workerIndex) override;
+		virtual void RunTransmitter() override;
+
+	private:
+		struct ForwardedDatagram
+		{
+			IPEndPoint Sender;
+			uint32 Bytes = 0;
+			uint8 pBuffer[MAXIMUM_SEGMENT_SIZE];
+		};
+
+		struct ReceiverQueue
+		{
+			ReceiverQueue() : Datagrams(SERVER_UDP_RECEIVER_QUEUE_SIZE), IsWaiting(false) {}
+
+			TMPSCQueue<ForwardedDatagram> Datagrams;
+			std::mutex Mutex;
+			std::condition_variable Condition;
+			std::atomic_bool IsWaiting;
+		};
 
 	private:
+		void RunSocketReceiver();
+		void RunQueueReceiver(uint32 workerIndex);
+		void ForwardReceived(uint32 workerIndex, const PacketTransceiverUDP* pTransceiver, const IPEndPoint& sender);
+		void DecodeReceived(uint32 workerIndex, PacketTransceiverUDP* pTransceiver, const IPEndPoint& sender);
+		uint32 GetReceiverIndex(const IPEndPoint& sender) const;
 		ClientRemoteUDP* GetOrCreateClient(const IPEndPoint& sender, bool& newConnection);
 
 	private:
+		// Used by the transmitter thread, and by receiver threads when rejecting a connection
 		PacketTransceiverUDP m_Transciver;
+		// One per receiver thread, only the first reads the socket and the others decode what it forwards to them
+		TArray<PacketTransceiverUDP*> m_ReceiveTransceivers;
+		// One per receiver thread except the first, holds the datagrams of the clients pinned to that thread
+		TArray<ReceiverQueue*> m_ReceiverQueues;
 	};
 }
\ No newline at end of file
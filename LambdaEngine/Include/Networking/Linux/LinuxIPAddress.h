@@ -0,0 +1,26 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Networking/API/IPAddress.h"
+
+#include <netinet/in.h>
+
+namespace LambdaEngine
+{
+	class LAMBDA_API LinuxIPAddress : public IPAddress
+	{
+		friend class LinuxNetworkUtils;
+
+	public:
+		virtual ~LinuxIPAddress();
+
+		struct in_addr* GetLinuxAddr();
+
+	private:
+		LinuxIPAddress(const std::string& address, uint64 hash);
+
+	private:
+		struct in_addr m_Addr;
+	};
+}
+#endif
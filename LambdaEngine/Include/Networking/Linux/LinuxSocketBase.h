@@ -0,0 +1,189 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Types.h"
+#include "Log/Log.h"
+
+#include "Networking/API/IPEndPoint.h"
+
+#include "Networking/Linux/LinuxIPAddress.h"
+
+#include <string>
+#include <cerrno>
+#include <cstring>
+
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <sys/socket.h>
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#define INVALID_SOCKET  -1
+#define SOCKET_ERROR    -1
+
+namespace LambdaEngine
+{
+	template <typename IBase>
+	class LinuxSocketBase : public IBase
+	{
+	public:
+		virtual bool Connect(const IPEndPoint& endPoint) override
+		{
+			struct sockaddr_in socketAddress;
+			IPEndPointToSocketAddress(&endPoint, &socketAddress);
+
+			if (connect(m_Socket, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress)) == SOCKET_ERROR)
+			{
+				int32 error = errno;
+				if (error == ECONNREFUSED)
+					return false;
+
+				LOG_ERROR_CRIT("Failed to connect to %s", endPoint.ToString().c_str());
+				PrintLastError(error);
+				return false;
+			}
+
+			ReadSocketData();
+
+			return true;
+		}
+
+		virtual bool Bind(const IPEndPoint& endPoint) override
+		{
+			struct sockaddr_in socketAddress;
+			IPEndPointToSocketAddress(&endPoint, &socketAddress);
+
+			if (bind(m_Socket, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress)) == SOCKET_ERROR)
+			{
+				int32 error = errno;
+				if (error == EADDRNOTAVAIL)
+					return false;
+
+				LOG_ERROR_CRIT("Failed to bind to %s", endPoint.ToString().c_str());
+				PrintLastError(error);
+				return false;
+			}
+
+			ReadSocketData();
+
+			return true;
+		}
+
+		virtual bool EnableBlocking(bool enable) override
+		{
+			int32 flags = fcntl(m_Socket, F_GETFL, 0);
+			flags = enable ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+			if (fcntl(m_Socket, F_SETFL, flags) == SOCKET_ERROR)
+			{
+				int32 error = errno;
+				LOG_ERROR_CRIT("Failed to change blocking mode to [%sBlocking] ", enable ? "" : "Non ");
+				PrintLastError(error);
+				return false;
+			}
+
+			m_NonBlocking = !enable;
+			return true;
+		}
+
+		virtual bool IsNonBlocking() const override
+		{
+			return m_NonBlocking;
+		}
+
+		virtual bool Close() override
+		{
+			if (m_Closed)
+			{
+				return true;
+			}
+
+			m_Closed = true;
+
+			// Unlike closesocket on Windows, close does not wake up threads blocked on the socket, shutdown does
+			shutdown(m_Socket, SHUT_RDWR);
+			if (close(m_Socket) == SOCKET_ERROR)
+			{
+				int32 error = errno;
+				LOG_ERROR_CRIT("Failed to close socket");
+				PrintLastError(error);
+				return false;
+			}
+
+			return true;
+		}
+
+		virtual bool IsClosed() const override
+		{
+			return m_Closed;
+		}
+
+		/*
+		* return - The IPEndPoint currently Bound or Connected to
+		*/
+		virtual const IPEndPoint& GetEndPoint() const override
+		{
+			return m_IPEndPoint;
+		}
+
+	protected:
+		LinuxSocketBase(int32 socket = INVALID_SOCKET)
+			: m_Socket(socket),
+			m_NonBlocking(false),
+			m_Closed(false),
+			m_IPEndPoint(IPAddress::ANY, 0)
+		{
+		}
+
+		~LinuxSocketBase()
+		{
+			Close();
+		}
+
+		void ReadSocketData()
+		{
+			sockaddr_in socketAddress;
+			socklen_t socketAddressSize = sizeof(socketAddress);
+			if (getsockname(m_Socket, reinterpret_cast<sockaddr*>(&socketAddress), &socketAddressSize) == SOCKET_ERROR)
+			{
+				LOG_ERROR_CRIT("Faild to ReadSocketData");
+				return;
+			}
+
+			SocketAddressToIPEndPoint(&socketAddress, m_IPEndPoint);
+		}
+
+	protected:
+		static void IPEndPointToSocketAddress(const IPEndPoint* pIPEndPoint, struct sockaddr_in* pSocketAddress)
+		{
+			memset(pSocketAddress, 0, sizeof(struct sockaddr_in));
+			pSocketAddress->sin_family	= AF_INET;
+			pSocketAddress->sin_port	= htons(pIPEndPoint->GetPort());
+			pSocketAddress->sin_addr	= *((LinuxIPAddress*)pIPEndPoint->GetAddress())->GetLinuxAddr();
+		}
+
+		static void SocketAddressToIPEndPoint(const struct sockaddr_in* pSocketAddress, IPEndPoint& ipEndPoint)
+		{
+			char pAddressBuffer[INET_ADDRSTRLEN];
+			inet_ntop(pSocketAddress->sin_family, &pSocketAddress->sin_addr, pAddressBuffer, INET_ADDRSTRLEN);
+			ipEndPoint.SetEndPoint(IPAddress::Get(pAddressBuffer), ntohs(pSocketAddress->sin_port));
+		}
+
+		static void PrintLastError(int32 errorCode)
+		{
+			LOG_ERROR("ERROR CODE: %d", errorCode);
+			LOG_ERROR("ERROR MESSAGE: %s", strerror(errorCode));
+		}
+
+	protected:
+		int32 m_Socket = INVALID_SOCKET;
+
+	private:
+		bool m_NonBlocking	= false;
+		bool m_Closed		= false;
+		IPEndPoint m_IPEndPoint;
+	};
+}
+
+#endif
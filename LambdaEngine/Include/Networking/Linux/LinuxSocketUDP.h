@@ -0,0 +1,74 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Networking/API/UDP/ISocketUDP.h"
+
+#include "LinuxSocketBase.h"
+
+// Maximum number of datagrams moved by a single sendmmsg or recvmmsg call
+#define LINUX_SOCKET_UDP_MAX_BATCH 64u
+
+namespace LambdaEngine
+{
+	/*
+	* Receiving waits on an epoll instance containing the socket and an eventfd that Close signals, so threads blocked
+	* in ReceiveFrom or ReceiveFromBatch return when the socket is closed. Batches are moved with sendmmsg and recvmmsg.
+	*/
+	class LinuxSocketUDP : public LinuxSocketBase<ISocketUDP>
+	{
+		friend class LinuxNetworkUtils;
+
+	public:
+		~LinuxSocketUDP();
+
+		/*
+		* Sends a buffer of data to the specified address and port
+		*
+		* pBuffer	  - The buffer to send.
+		* bytesToSend - The number of bytes to send.
+		* bytesSent	  - Will return the number of bytes actually sent.
+		* ipEndPoint  - The IPEndPoint to send the datagram packet to
+		*
+		* return	  - False if an error occured, otherwise true.
+		*/
+		virtual bool SendTo(const uint8* pBuffer, uint32 bytesToSend, int32& bytesSent, const IPEndPoint& ipEndPoint) override;
+
+		/*
+		* Receives a buffer of data.
+		*
+		* pBuffer	  - The buffer to read into.
+		* bytesToRead - The number of bytes to read.
+		* bytesRead	  - Will return the number of bytes actually read.
+		* ipEndPoint  - Will return the IPEndPoint the datagram packet came from
+		*
+		* return	  - False if an error occured, otherwise true.
+		*/
+		virtual bool ReceiveFrom(uint8* pBuffer, uint32 size, int32& bytesReceived, IPEndPoint& ipEndPoint) override;
+
+		virtual bool SendToBatch(UDPDatagram* pDatagrams, uint32 count, uint32& sent) override;
+		virtual bool ReceiveFromBatch(UDPDatagram* pDatagrams, uint32 count, uint32& received) override;
+
+		/*
+		* Enables or disables the broadcast functionality
+		*
+		* return	  - False if an error occured, otherwise true.
+		*/
+		virtual bool EnableBroadcast(bool enable) override;
+
+		virtual bool Close() override;
+
+	private:
+		LinuxSocketUDP();
+
+		/*
+		* Blocks until the socket has datagrams to read, returns immediately if the socket is non blocking
+		*	return - False if the socket was closed while waiting
+		*/
+		bool WaitForDatagrams();
+
+	private:
+		int32 m_EpollFD;
+		int32 m_WakeFD;
+	};
+}
+#endif
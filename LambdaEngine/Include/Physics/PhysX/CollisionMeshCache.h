@@ -0,0 +1,67 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/String.h"
+#include "Containers/THashTable.h"
+
+#include "Physics/PhysX/PhysX.h"
+
+#include "Threading/API/SpinLock.h"
+
+#include "Utilities/SHA256.h"
+
+// Bump when the key or the entry layout change, entries written before are then ignored
+#define COLLISION_MESH_CACHE_VERSION	1
+#define COLLISION_MESH_CACHE_MAGIC		0x4d4c4f43 // "COLM"
+
+namespace LambdaEngine
+{
+	/*
+	* CollisionMeshCache keeps cooked triangle meshes on disk, keyed by the SHA256 of the vertex positions, the indices,
+	* the mesh flags and the cooking parameters. Meshes that were cooked on an earlier run are created straight from the
+	* cooked data, and meshes that are requested again during a run share the PxTriangleMesh created the first time.
+	* Every function may be called from several threads at once
+	*/
+	class CollisionMeshCache
+	{
+		struct KeyHasher
+		{
+			FORCEINLINE size_t operator()(const SHA256Hash& key) const
+			{
+				return size_t(key.SHA256Chunk0);
+			}
+		};
+
+	public:
+		DECL_UNIQUE_CLASS(CollisionMeshCache);
+
+		CollisionMeshCache() = default;
+		~CollisionMeshCache();
+
+		void Init(physx::PxPhysics* pPhysics, physx::PxCooking* pCooking);
+
+		/*
+		* Releases the references the cache holds, meshes still used by shapes are released along with the shapes
+		*/
+		void Release();
+
+		/*
+		* Returns nullptr if the mesh could not be cooked. The returned mesh is owned by the cache
+		*/
+		physx::PxTriangleMesh* GetTriangleMesh(const physx::PxTriangleMeshDesc& meshDesc);
+
+	private:
+		void ComputeKey(const physx::PxTriangleMeshDesc& meshDesc, SHA256Hash& key) const;
+		physx::PxTriangleMesh* LoadTriangleMesh(const SHA256Hash& key) const;
+		void StoreTriangleMesh(const SHA256Hash& key, const physx::PxDefaultMemoryOutputStream& cookedData) const;
+
+		static String GetEntryPath(const SHA256Hash& key);
+
+	private:
+		physx::PxPhysics*	m_pPhysics	= nullptr;
+		physx::PxCooking*	m_pCooking	= nullptr;
+
+		SpinLock m_Lock;
+		THashTable<SHA256Hash, physx::PxTriangleMesh*, KeyHasher> m_TriangleMeshes;
+	};
+}
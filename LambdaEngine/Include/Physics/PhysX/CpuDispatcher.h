@@ -0,0 +1,28 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Physics/PhysX/PhysX.h"
+
+#include "Threading/API/ThreadPool.h"
+
+namespace LambdaEngine
+{
+	/*
+	* Runs the tasks of PhysX as jobs in the ThreadPool instead of on threads owned by PhysX. The worker count is the
+	* amount of threads PhysX splits its work for, zero uses every thread in the pool
+	*/
+	class PhysXCpuDispatcher : public physx::PxCpuDispatcher
+	{
+	public:
+		PhysXCpuDispatcher(uint32 workerCount);
+		~PhysXCpuDispatcher();
+
+		virtual void submitTask(physx::PxBaseTask& task) override final;
+
+		virtual uint32_t getWorkerCount() const override final;
+
+	private:
+		JobCounter	m_Tasks;
+		uint32		m_WorkerCount;
+	};
+}
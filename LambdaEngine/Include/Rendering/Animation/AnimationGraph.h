@@ -104,6 +104,19 @@ namespace LambdaEngine
 		FORCEINLINE void SetOutputNode(AnimationNode* pOutput)
 		{
 			m_pFinalNode->SetInputNode(pOutput);
+			m_pOutputClip = nullptr;
+		}
+
+		FORCEINLINE void SetOutputNode(ClipNode* pOutput)
+		{
+			m_pFinalNode->SetInputNode(pOutput);
+			m_pOutputClip = pOutput;
+		}
+
+		// The clip when the state outputs one clip without blending, otherwise nullptr
+		FORCEINLINE ClipNode* GetOutputClip() const
+		{
+			return m_pOutputClip;
 		}
 
 		FORCEINLINE float64 GetNormalizedTime() const
@@ -140,6 +153,7 @@ namespace LambdaEngine
 	private:
 		AnimationGraph*	m_pOwnerGraph;
 		OutputNode*		m_pFinalNode;
+		ClipNode*		m_pOutputClip;
 		StackAllocator	m_NodeAllocator;
 		TArray<AnimationNode*> m_Nodes;
 		String m_Name;
@@ -217,11 +231,23 @@ namespace LambdaEngine
 			return m_pCurrentTransition != nullptr;
 		}
 
+		// Clips leave out joints with more ancestors than this, set by the animation LOD
+		FORCEINLINE void SetMaxJointDepth(uint32 maxJointDepth)
+		{
+			m_MaxJointDepth = maxJointDepth;
+		}
+
+		FORCEINLINE uint32 GetMaxJointDepth() const
+		{
+			return m_MaxJointDepth;
+		}
+
 	private:
 		void FinishTransition();
 
 	private:
 		bool m_IsBlending;
+		uint32 m_MaxJointDepth;
 
 		Transition*		m_pCurrentTransition;
 		AnimationState* m_pCurrentState;
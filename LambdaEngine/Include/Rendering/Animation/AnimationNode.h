@@ -100,6 +100,9 @@ namespace LambdaEngine
 
 		virtual void Tick(const Skeleton& skeleton, float64 deltaTimeInSeconds) override;
 
+		// Samples the clip at a frame position into the result, called by Tick unless sampling is deferred
+		void Sample(const Skeleton& skeleton, float64 frame);
+
 		virtual void Reset() override
 		{
 			m_PlaybackSpeed			= m_OrignalPlaybackSpeed;
@@ -172,12 +175,26 @@ namespace LambdaEngine
 			return m_IsLooping;
 		}
 
+		// Frame position of the current time, between zero and the last frame of the clip
+		FORCEINLINE float64 GetFrame() const
+		{
+			return m_NormalizedTime * float64(m_pAnimation->FrameCount - 1);
+		}
+
+		// When set Tick only advances time, and the owner of the graph calls Sample so that instances can share samples
+		FORCEINLINE void SetDeferSampling(bool deferSampling)
+		{
+			m_DeferSampling = deferSampling;
+		}
+
 	private:
-		glm::vec3 SamplePosition(Animation::Channel& channel, float64 time);
-		glm::vec3 SampleScale(Animation::Channel& channel, float64 time);
-		glm::quat SampleRotation(Animation::Channel& channel, float64 time);
+		// Resolves the joint of every channel, done once per skeleton instead of once per tick
+		void BindSkeleton(const Skeleton& skeleton);
 
 		void OnLoopFinish();
+
+		// Fires the triggers between two points of the clip, as fractions of its duration in playback order
+		void HandleTriggers(float64 beginProgress, float64 endProgress);
 		
 		FORCEINLINE bool IsLoopFinished()
 		{
@@ -198,6 +215,7 @@ namespace LambdaEngine
 
 		bool m_IsLooping;
 		bool m_LoopFinished;
+		bool m_DeferSampling = false;
 
 		uint32	m_NumLoops;
 		float64	m_OrignalPlaybackSpeed;
@@ -209,6 +227,9 @@ namespace LambdaEngine
 
 		TArray<ClipTrigger> m_Triggers;
 		TArray<SQT> m_FrameData;
+
+		const Skeleton*			m_pBoundSkeleton = nullptr;
+		TArray<JointIndexType>	m_ChannelJoints;
 	};
 
 	/*
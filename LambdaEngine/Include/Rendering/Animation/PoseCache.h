@@ -0,0 +1,77 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/TArray.h"
+#include "Containers/THashTable.h"
+
+#include "Resources/Mesh.h"
+
+#include "Threading/API/SpinLock.h"
+
+#include "Utilities/HashUtilities.h"
+
+// Clip times are rounded to this fraction of a frame, so instances that are close in time share a pose
+#define ANIMATION_POSE_CACHE_SUBFRAMES 8
+
+namespace LambdaEngine
+{
+	/*
+	* PoseCacheKey - Everything the skinning transforms of an instance playing a single clip depend on
+	*/
+
+	struct PoseCacheKey
+	{
+		const Animation*	pAnimation		= nullptr;
+		const Skeleton*		pSkeleton		= nullptr;
+		uint32				Subframe		= 0;
+		uint32				MaxJointDepth	= 0;
+
+		bool operator==(const PoseCacheKey& other) const
+		{
+			return
+				pAnimation		== other.pAnimation &&
+				pSkeleton		== other.pSkeleton &&
+				Subframe		== other.Subframe &&
+				MaxJointDepth	== other.MaxJointDepth;
+		}
+	};
+
+	struct PoseCacheKeyHasher
+	{
+		size_t operator()(const PoseCacheKey& key) const
+		{
+			size_t hash = std::hash<const Animation*>()(key.pAnimation);
+			HashCombine<const Skeleton*>(hash, key.pSkeleton);
+			HashCombine<uint32>(hash, key.Subframe);
+			HashCombine<uint32>(hash, key.MaxJointDepth);
+			return hash;
+		}
+	};
+
+	/*
+	* PoseCache - Shares evaluated skinning transforms between instances that sample the same clip at the same time
+	* during a frame. Find and Insert may be called from several jobs at once, Reset may not
+	*/
+
+	class PoseCache
+	{
+	public:
+		PoseCache() = default;
+		~PoseCache() = default;
+
+		// Drops every pose and makes room for maxPoses, one per instance that can insert this frame
+		void Reset(uint32 maxPoses);
+
+		// Copies the pose into globalTransforms and returns true if another instance has already evaluated the key
+		bool Find(const PoseCacheKey& key, TArray<glm::mat4>& globalTransforms);
+
+		void Insert(const PoseCacheKey& key, const TArray<glm::mat4>& globalTransforms);
+
+	private:
+		SpinLock m_Lock;
+		THashTable<PoseCacheKey, uint32, PoseCacheKeyHasher> m_Entries;
+		// Kept between frames to reuse the allocations, an entry never moves once it has been inserted
+		TArray<TArray<glm::mat4>> m_Poses;
+		uint32 m_PoseCount = 0;
+	};
+}
@@ -3,6 +3,8 @@
 
 #include "Containers/String.h"
 
+#include <algorithm>
+
 namespace LambdaEngine
 {
 	FORCEINLINE ECommandQueueType ConvertPipelineStateTypeToQueue(EPipelineStateType pipelineStateType)
@@ -147,6 +149,36 @@ namespace LambdaEngine
 		}
 	}
 
+	// Bytes per 4x4 block of a block compressed format, zero for formats that are not block compressed
+	FORCEINLINE uint32 TextureFormatBlockSize(EFormat format)
+	{
+		switch (format)
+		{
+		case EFormat::FORMAT_BC1_RGBA_UNORM:	return 8;
+		case EFormat::FORMAT_BC3_UNORM:			return 16;
+		default:								return 0;
+		}
+	}
+
+	FORCEINLINE bool IsBlockCompressedFormat(EFormat format)
+	{
+		return TextureFormatBlockSize(format) > 0;
+	}
+
+	FORCEINLINE uint64 TextureMiplevelSize(EFormat format, uint32 width, uint32 height, uint32 miplevel)
+	{
+		const uint32 mipWidth	= std::max(width >> miplevel, 1u);
+		const uint32 mipHeight	= std::max(height >> miplevel, 1u);
+
+		const uint32 blockSize = TextureFormatBlockSize(format);
+		if (blockSize > 0)
+		{
+			return uint64((mipWidth + 3) / 4) * uint64((mipHeight + 3) / 4) * blockSize;
+		}
+
+		return uint64(mipWidth) * mipHeight * TextureFormatStride(format);
+	}
+
 	FORCEINLINE const char* TextureFormatToString(EFormat format)
 	{
 		switch (format)
@@ -176,6 +208,9 @@ namespace LambdaEngine
 		case EFormat::FORMAT_R32G32B32A32_UINT:		return "FORMAT_R32G32B32A32_UINT";
 		
 		case EFormat::FORMAT_D24_UNORM_S8_UINT:		return "FORMAT_D24_UNORM_S8_UINT";
+
+		case EFormat::FORMAT_BC1_RGBA_UNORM:		return "FORMAT_BC1_RGBA_UNORM";
+		case EFormat::FORMAT_BC3_UNORM:				return "FORMAT_BC3_UNORM";
 		default:                                    return "FORMAT_NONE";
 		}
 	}
@@ -208,6 +243,9 @@ namespace LambdaEngine
 		
 		else if	(string == "FORMAT_D24_UNORM_S8_UINT")		return EFormat::FORMAT_D24_UNORM_S8_UINT;
 
+		else if	(string == "FORMAT_BC1_RGBA_UNORM")			return EFormat::FORMAT_BC1_RGBA_UNORM;
+		else if	(string == "FORMAT_BC3_UNORM")				return EFormat::FORMAT_BC3_UNORM;
+
 		return EFormat::FORMAT_NONE;
 	}
 
@@ -76,6 +76,10 @@ namespace LambdaEngine
 		FORMAT_R8_UINT					= 19,
 		FORMAT_R8G8_UINT				= 20,
 		FORMAT_R32G32_UINT				= 21,
+
+		// Block compressed, every 4x4 block of texels is stored in 8 (BC1) or 16 (BC3) bytes
+		FORMAT_BC1_RGBA_UNORM			= 22,
+		FORMAT_BC3_UNORM				= 23,
 	};
 
 	enum class EIndexType
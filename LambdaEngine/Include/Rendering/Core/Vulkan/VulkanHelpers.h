@@ -60,6 +60,8 @@ namespace LambdaEngine
 		case EFormat::FORMAT_R8_UINT:				return VK_FORMAT_R8_UINT;
 		case EFormat::FORMAT_R8G8_UINT:				return VK_FORMAT_R8G8_UINT;
 		case EFormat::FORMAT_R32G32_UINT:			return VK_FORMAT_R32G32_UINT;
+		case EFormat::FORMAT_BC1_RGBA_UNORM:		return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+		case EFormat::FORMAT_BC3_UNORM:				return VK_FORMAT_BC3_UNORM_BLOCK;
 		default:									return VK_FORMAT_UNDEFINED;
 		}
 	}
@@ -0,0 +1,122 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/TArray.h"
+
+#include "Math/Math.h"
+
+// Margin added on every side of the bounds stored in the tree, instances that move within it are not reinserted
+#define INSTANCE_CULLER_AABB_MARGIN				0.25f
+// Instances whose bounding sphere radius is smaller than this fraction of their distance to the camera are culled
+#define INSTANCE_CULLER_MIN_RADIUS_PER_DISTANCE	0.002f
+
+namespace LambdaEngine
+{
+	/*
+	* The planes of a view projection with their normals pointing inwards. They are stored component by component so
+	* that a box is tested against four planes at once, the last two slots repeat the far plane
+	*/
+	struct alignas(16) CullingFrustum
+	{
+		float32		PlanesX[8];
+		float32		PlanesY[8];
+		float32		PlanesZ[8];
+		float32		PlanesW[8];
+		glm::vec3	ViewPosition			= glm::vec3(0.0f);
+		float32		MinRadiusPerDistance	= 0.0f; // Zero disables distance culling
+
+		static CullingFrustum FromViewProjection(const glm::mat4& viewProjection, const glm::vec3& viewPosition, float32 minRadiusPerDistance);
+	};
+
+	struct CulledInstance
+	{
+		void*	pUserData		= nullptr;
+		uint32	InstanceIndex	= 0;
+	};
+
+	/*
+	* InstanceCuller keeps the world space bounds of instances in a dynamic BVH, built by inserting one leaf at a time
+	* next to the sibling that grows the tree the least and kept balanced with tree rotations. Culling only reads the
+	* tree, so several views can be culled at the same time from different threads
+	*/
+	class InstanceCuller
+	{
+		static constexpr uint32 INVALID_NODE = UINT32_MAX;
+
+		struct Node
+		{
+			glm::vec3	Min;
+			uint32		Parent			= INVALID_NODE; // Next free node when the node is not in use
+			glm::vec3	Max;
+			uint32		Child0			= INVALID_NODE;
+			uint32		Child1			= INVALID_NODE;
+			int32		Height			= -1;
+			void*		pUserData		= nullptr;
+			uint32		InstanceIndex	= 0;
+
+			FORCEINLINE bool IsLeaf() const
+			{
+				return Child0 == INVALID_NODE;
+			}
+		};
+
+	public:
+		InstanceCuller() = default;
+		~InstanceCuller() = default;
+
+		/*
+		* Returns the proxy of the instance, which stays the same until the instance is removed
+		*/
+		uint32 AddInstance(const glm::vec3& min, const glm::vec3& max, void* pUserData, uint32 instanceIndex);
+		void RemoveInstance(uint32 proxy);
+
+		/*
+		* Only reinserts the instance if the new bounds are not within the bounds stored in the tree
+		*/
+		void MoveInstance(uint32 proxy, const glm::vec3& min, const glm::vec3& max);
+
+		void SetInstanceIndex(uint32 proxy, uint32 instanceIndex);
+
+		/*
+		* Appends the instances that intersect the frustum, and are large enough for their distance, to visible
+		*/
+		void Cull(const CullingFrustum& frustum, TArray<CulledInstance>& visible) const;
+
+		void Clear();
+
+		FORCEINLINE uint32 GetInstanceCount() const
+		{
+			return m_InstanceCount;
+		}
+
+	public:
+		/*
+		* Bounds of a box in local space after it has been transformed
+		*/
+		static void TransformBounds(const glm::vec3& min, const glm::vec3& max, const glm::mat4& transform, glm::vec3& transformedMin, glm::vec3& transformedMax);
+
+	private:
+		uint32 AllocateNode();
+		void FreeNode(uint32 node);
+
+		void InsertLeaf(uint32 leaf);
+		void RemoveLeaf(uint32 leaf);
+
+		/*
+		* Rotates the taller child of the node up if the heights of its children differ by more than one, returns the
+		* node that took its place
+		*/
+		uint32 Balance(uint32 node);
+
+		/*
+		* Refits the bounds and heights from the node to the root, balancing the tree on the way
+		*/
+		void Refit(uint32 node);
+
+	private:
+		TArray<Node>	m_Nodes;
+		uint32			m_Root			= INVALID_NODE;
+		uint32			m_FreeList		= INVALID_NODE;
+		uint32			m_InstanceCount	= 0;
+	};
+}
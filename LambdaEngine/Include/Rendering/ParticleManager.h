@@ -4,6 +4,8 @@
 
 #include "Game/ECS/Components/Rendering/ParticleEmitter.h"
 
+#include "Memory/API/RangeAllocator.h"
+
 #include "Rendering/Core/API/GraphicsTypes.h"
 
 #include "Rendering/RT/ASBuilder.h"
@@ -24,6 +26,7 @@ namespace LambdaEngine
 	{
 		uint32 Offset;
 		uint32 Size;
+		uint32 AllocationHandle = UINT32_MAX;
 	};
 
 	struct ParticleEmitterInstance
@@ -141,6 +144,7 @@ namespace LambdaEngine
 		uint32 GetParticleCount() const { return m_AliveIndices.GetSize();  }
 		uint32 GetActiveEmitterCount() const { return m_IndirectData.GetSize();  }
 		uint32 GetMaxParticleCount() const { return m_MaxParticleCount; }
+		RangeAllocatorStatistics GetParticleAllocatorStatistics() const { return m_ParticleAllocator.GetStatistics(); }
 
 		bool UpdateBuffers(CommandList* pCommandList);
 		bool UpdateResources(RenderGraph* pRendergraph);
@@ -164,8 +168,12 @@ namespace LambdaEngine
 		bool DeactivateEmitterInstance(EmitterID emitterID);
 
 		bool AllocateParticleChunk(ParticleChunk& chunk);
-		bool FreeParticleChunk(ParticleChunk chunk);
-		bool MergeParticleChunk(const ParticleChunk& chunk);
+		void FreeParticleChunk(ParticleChunk& chunk);
+
+		/*
+		* Sorts the dirty chunks and merges the ones that overlap or touch, so that each run of particles is copied once
+		*/
+		void CoalesceDirtyParticleChunks();
 
 		void CleanBuffers();
 
@@ -229,7 +237,7 @@ namespace LambdaEngine
 		TArray<glm::mat4>					m_EmitterTransformData;
 
 		TArray<ParticleChunk>				m_DirtyParticleChunks;
-		TArray<ParticleChunk>				m_FreeParticleChunks;
+		RangeAllocator						m_ParticleAllocator;
 		TArray<SAtlasInfo>					m_AtlasInfoData;
 
 		TSharedRef<Sampler>					m_Sampler = nullptr;
@@ -248,6 +248,11 @@ namespace LambdaEngine
 			*/
 			bool							Sleeping			= false;
 
+			/*
+				Only the visible instance ranges of the DrawArgs are drawn if set, see RenderSystem->SetRenderStageCullingView
+			*/
+			ECullingView					CullingView			= ECullingView::CULLING_VIEW_NONE;
+
 			//Triggering
 			ERenderStageExecutionTrigger	TriggerType					= ERenderStageExecutionTrigger::NONE;
 			uint32							FrameDelay					= 0;
@@ -373,6 +378,11 @@ namespace LambdaEngine
 		*/
 		void SetRenderStageSleeping(const String& renderStageName, bool sleeping);
 
+		/*
+		* Sets the view that the instances drawn by given render stage are culled against
+		*/
+		void SetRenderStageCullingView(const String& renderStageName, ECullingView cullingView);
+
 		/*
 		* Updates the RenderGraph, applying the updates made to resources with UpdateResource by writing them to the appropriate Descriptor Sets
 		*/
@@ -479,6 +489,12 @@ namespace LambdaEngine
 			CommandList** ppExecutionStage);
 
 		// Helpers
+		void DispatchMeshInstances(
+			CommandList* pCommandList,
+			uint32 meshletCount,
+			uint32 firstInstance,
+			uint32 instanceCount);
+
 		void PipelineTextureBarriers(
 			CommandList* pCommandList, 
 			const TArray<PipelineTextureBarrierDesc>& textureBarriers, 
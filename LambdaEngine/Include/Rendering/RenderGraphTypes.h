@@ -215,6 +215,17 @@ namespace LambdaEngine
 		TRIGGERED				= 3,
 	};
 
+	/*
+	* The view a SCENE_INSTANCES render stage is culled against, only the instances visible from it are drawn
+	*/
+	enum class ECullingView : uint8
+	{
+		CULLING_VIEW_CAMERA				= 0,
+		CULLING_VIEW_DIRECTIONAL_LIGHT	= 1,
+		CULLING_VIEW_COUNT				= 2,
+		CULLING_VIEW_NONE				= 0xff,
+	};
+
 	struct GraphicsShaderNames
 	{
 		String TaskShaderName		= "";
@@ -383,6 +394,12 @@ namespace LambdaEngine
 		}
 	};
 
+	struct DrawArgInstanceRange
+	{
+		uint32 FirstInstance	= 0;
+		uint32 InstanceCount	= 0;
+	};
+
 	struct DrawArg
 	{
 		TArray<Entity> EntityIDs;
@@ -397,6 +414,9 @@ namespace LambdaEngine
 		uint32	IndexCount				= 0;
 		uint32	MeshletCount			= 0;
 
+		// Visible instances per culling view, owned by the RenderSystem. A nullptr draws all instances
+		const TArray<DrawArgInstanceRange>* ppVisibleInstanceRanges[(uint32)ECullingView::CULLING_VIEW_COUNT] = { };
+
 		// Extensions
 		bool	HasExtensions			= false;	// Do not create a descriptor set if no data is used.
 
@@ -2,6 +2,7 @@
 #include "LambdaEngine.h"
 
 #include "Math/Math.h"
+#include "Math/Quantization.h"
 
 #include "Physics/BoundingBox.h"
 
@@ -16,8 +17,21 @@
 #define MAX_PRIMS 124
 #define MAX_VERTS 64
 
+// Triangles meshletized by each job, meshlets never cross the boundary between two jobs
+#define MESHLET_TRIANGLES_PER_JOB 8192
+
+// Size of the LRU cache that triangles are ordered for
+#define MESH_OPTIMIZER_CACHE_SIZE 32
+// Size of the FIFO cache that ACMR and ATVR are measured with, close to what GPUs have
+#define MESH_STATISTICS_CACHE_SIZE 16
+// Clusters are ordered for overdraw as long as the ACMR stays within this factor of the cache optimized order
+#define MESH_OVERDRAW_THRESHOLD 1.05f
+
 #define INVALID_JOINT_ID 0xff
 
+// Bits per component of the smallest three rotations in animations
+#define ANIMATION_ROTATION_BITS 20
+
 namespace LambdaEngine
 {
 	struct Vertex
@@ -66,6 +80,20 @@ namespace LambdaEngine
 		}
 	};
 
+	/*
+	* Compact copy of a Vertex that animated meshes are skinned from, 16 bytes instead of 64. The position is stored as
+	* 16 bit unorms within Mesh::PackedPositionMin and Mesh::PackedPositionExtent, the normal and tangent as 16 bit
+	* octahedral vectors and the texture coordinate as half floats. The low 16 paint bits are kept above the z
+	* component. Must match SPackedVertex in Defines.glsl
+	*/
+	struct PackedVertex
+	{
+		uint32 PositionXY			= 0;
+		uint32 PositionZPaintBits	= 0;
+		uint32 NormalTangent		= 0;
+		uint32 TexCoord				= 0;
+	};
+
 	// Meshlet data
 	struct Meshlet
 	{
@@ -75,6 +103,19 @@ namespace LambdaEngine
 		uint32 PrimOffset;
 	};
 
+	/*
+	* Culling data of a meshlet, kept apart from Meshlet since that is read by the mesh shaders. Every triangle of the
+	* meshlet faces away from the camera if dot(normalize(ConeApex - cameraPosition), ConeAxis) >= ConeCutoff
+	*/
+	struct MeshletCullingBounds
+	{
+		glm::vec3	Center;
+		float32		Radius;
+		glm::vec3	ConeApex;
+		float32		ConeCutoff; // One when the triangles face too many directions for the cone to be used
+		glm::vec3	ConeAxis;
+	};
+
 	struct PackedTriangle
 	{
 		uint8 i0;
@@ -142,6 +183,8 @@ namespace LambdaEngine
 		JointIndexType	RootJoint;	// The first node in the hiearchy, some meshes have multiple ones, we only take the first we find that has the assimp mRootNode as parent
 		TArray<Joint>	Joints;
 		TArray<glm::mat4> RelativeTransforms; // Relative transforms in seperate array since they are accessed vary rarely
+		TArray<JointIndexType> EvaluationOrder; // Joint indices ordered so that every parent comes before its children, baked at load time
+		TArray<uint8>	JointDepths; // Number of ancestors of each joint, used to skip the outermost joints at lower animation LODs
 		JointHashTable	JointMap;
 	};
 
@@ -166,26 +209,57 @@ namespace LambdaEngine
 		TArray<glm::mat4>	GlobalTransforms;
 	};
 
+	/*
+	* Animations are resampled at a fixed rate and quantized when they are loaded, so a frame is looked up directly from
+	* the time and sampling does not depend on the length of the clip
+	*/
 	struct Animation
 	{
-		struct Channel
+		// Translation and scale are stored relative to the range of their track
+		struct Vec3Track
 		{
-			struct KeyFrame
+			FORCEINLINE glm::vec3 GetFrame(uint32 frame) const
 			{
-				glm::vec3	Value;
-				float64		Time;
-			};
+				constexpr float32 MAX_VALUE = float32(UINT16_MAX);
+
+				// Tracks that do not change store a single frame
+				const uint32 index = Values.GetSize() > 3 ? frame * 3 : 0;
+				const glm::vec3 normalized(Values[index] / MAX_VALUE, Values[index + 1] / MAX_VALUE, Values[index + 2] / MAX_VALUE);
+				return Min + normalized * Extent;
+			}
 
-			struct RotationKeyFrame
+			FORCEINLINE glm::vec3 Sample(uint32 frame0, uint32 frame1, float32 factor) const
 			{
-				glm::quat	Value;
-				float64		Time;
-			};
-
-			PrehashedString				Name;
-			TArray<KeyFrame>			Positions;
-			TArray<KeyFrame>			Scales;
-			TArray<RotationKeyFrame>	Rotations;
+				return glm::mix(GetFrame(frame0), GetFrame(frame1), factor);
+			}
+
+			glm::vec3		Min		= glm::vec3(0.0f);
+			glm::vec3		Extent	= glm::vec3(0.0f);
+			TArray<uint16>	Values;	// Three values per frame
+		};
+
+		struct RotationTrack
+		{
+			FORCEINLINE glm::quat GetFrame(uint32 frame) const
+			{
+				const uint64 packed = Values[Values.GetSize() > 1 ? frame : 0];
+				return DequantizeQuat(UnpackQuantizedQuat(packed, ANIMATION_ROTATION_BITS), ANIMATION_ROTATION_BITS);
+			}
+
+			FORCEINLINE glm::quat Sample(uint32 frame0, uint32 frame1, float32 factor) const
+			{
+				return glm::normalize(glm::slerp(GetFrame(frame0), GetFrame(frame1), factor));
+			}
+
+			TArray<uint64> Values; // Smallest three quaternions packed with PackQuantizedQuat
+		};
+
+		struct Channel
+		{
+			PrehashedString	Name;
+			Vec3Track		Positions;
+			Vec3Track		Scales;
+			RotationTrack	Rotations;
 		};
 
 		inline float64 DurationInSeconds() const
@@ -196,6 +270,7 @@ namespace LambdaEngine
 		PrehashedString	Name;
 		float64			DurationInTicks;
 		float64			TicksPerSecond;
+		uint32			FrameCount = 0; // Frames are evenly spaced from the start to the end of the clip
 		TArray<Channel>	Channels;
 	};
 
@@ -207,23 +282,66 @@ namespace LambdaEngine
 		}
 
 		TArray<Vertex>			Vertices;
+		TArray<PackedVertex>	PackedVertices; // Only filled for animated meshes, see MeshFactory::PackVertices
 		TArray<VertexJointData>	VertexJointData;
 		TArray<MeshIndexType>	Indices;
 		TArray<MeshIndexType>	UniqueIndices;
 		TArray<PackedTriangle>	PrimitiveIndices;
 		TArray<Meshlet>			Meshlets;
+		TArray<MeshletCullingBounds>	MeshletBounds;
 		Skeleton*				pSkeleton = nullptr;
 		BoundingBox 			BoundingBox;
+		glm::vec3				PackedPositionMin		= glm::vec3(0.0f);
+		glm::vec3				PackedPositionExtent	= glm::vec3(0.0f);
 		glm::vec3				DefaultPosition;
 		glm::quat				DefaultRotation;
 		glm::vec3				DefaultScale;
 	};
 
+	// ACMR is vertex shader invocations per triangle and ATVR invocations per vertex, both for a FIFO cache
+	struct MeshOptimizationStats
+	{
+		uint32	VertexCountBefore	= 0;
+		uint32	VertexCountAfter	= 0;
+		float32	ACMRBefore			= 0.0f;
+		float32	ACMRAfter			= 0.0f;
+		float32	ATVRBefore			= 0.0f;
+		float32	ATVRAfter			= 0.0f;
+	};
+
 	class MeshFactory
 	{
 	public:
 		static Mesh* CreateQuad();
+
+		/*
+		* Builds the meshlets and their bounds, large meshes are split over the thread pool
+		*/
 		static void GenerateMeshlets(Mesh* pMesh, uint32 maxVerts = MAX_VERTS, uint32 maxPrims = MAX_PRIMS);
+
+		/*
+		* Removes duplicate vertices, orders the triangles for the vertex cache and then for overdraw and finally orders
+		* the vertices by first use. Call once the vertex joint data has been filled and before GenerateMeshlets
+		*/
+		static void OptimizeMesh(Mesh* pMesh, MeshOptimizationStats* pStats = nullptr);
+
+		/*
+		* Merges vertices that are bitwise equal, including their joint data, and returns the new vertex count
+		*/
+		static uint32 RemoveDuplicateVertices(Mesh* pMesh);
+
+		/*
+		* Fills PackedVertices from Vertices and the bounds the positions are quantized within. Vertices is left as is,
+		* it is still used by meshes that are not skinned and on the CPU
+		*/
+		static void PackVertices(Mesh* pMesh);
+
+		static void ComputeVertexCacheStats(const TArray<MeshIndexType>& indices, uint32 vertexCount, float32& acmr, float32& atvr);
+
+		/*
+		* Fills Skeleton::EvaluationOrder and Skeleton::JointDepths from the parent indices of the joints, call after the hierarchy has been built
+		*/
+		static void BakeSkeletonEvaluationOrder(Skeleton* pSkeleton);
 	};
 }
 
@@ -82,6 +82,17 @@ namespace LambdaEngine
 		bool						ShouldTessellate;
 	};
 
+	// Where a texture of a scene was loaded from, kept so that the scene can be cooked
+	struct LoadedTextureSource
+	{
+		LoadedTexture*	pTexture	= nullptr;
+		String			Name;
+		// Embedded textures are stored decoded as RGBA8, textures loaded from files have no size
+		uint32			Width		= 0;
+		uint32			Height		= 0;
+		TArray<byte>	EmbeddedPixels;
+	};
+
 	// SceneLoadingContext is internally created from a SceneLoadRequest.
 	struct SceneLoadingContext
 	{
@@ -99,6 +110,15 @@ namespace LambdaEngine
 		THashTable<String, LoadedTexture*>		LoadedTextures;
 		THashTable<uint32, uint32>				MaterialIndices;
 		bool									ShouldTessellate;
+		TArray<LoadedTextureSource>				TextureSources; // In the same order as pTextures
+		// The tessellator's buffers are released once the scene has been loaded if any mesh was tessellated
+		uint32									TessellatedMeshCount	= 0;
+		// Vertex cache totals of the meshes optimized while loading, reported once the scene has been loaded
+		uint32									OptimizedTriangleCount	= 0;
+		uint32									VertexCountBefore		= 0;
+		uint32									VertexCountAfter		= 0;
+		float32									CacheMissesBefore		= 0.0f;
+		float32									CacheMissesAfter		= 0.0f;
 	};
 
 	class LAMBDA_API ResourceLoader
@@ -245,6 +265,24 @@ namespace LambdaEngine
 			bool generateMips,
 			bool linearFilteringMips);
 
+		/**
+		* Load a texture whose complete mip chain is already in memory, such as a cooked texture
+		* @param name			Name of the texture
+		* @param pData			Every miplevel of the texture, largest first and tightly packed
+		* @param width			The pixel width of the largest miplevel
+		* @param height			The pixel height of the largest miplevel
+		* @param miplevels		Number of miplevels in pData
+		* @param format			The format of the data, may be block compressed
+		* @return A Texture* if the texture was loaded, otherwise nullptr will be returned
+		*/
+		static Texture* LoadTextureMiplevelsFromMemory(
+			const String& name,
+			const void* pData,
+			uint32 width,
+			uint32 height,
+			uint32 miplevels,
+			EFormat format);
+
 		/**
 		* Load sound from file
 		* @param filepath	Path to the shader file
@@ -259,6 +297,32 @@ namespace LambdaEngine
 			EShaderLang lang,
 			const String& entryPoint = "main");
 
+		/**
+		* Compiles a shader file to SPIR-V without creating the shader, so that several shaders can be compiled on
+		* different threads at once. GLSL is compiled through the shader cache
+		* @param filepath		Path to the shader file
+		* @param stage			Which stage the shader belongs to
+		* @param lang			The language of the shader file
+		* @param sourceSPIRV	Receives the SPIR-V of the shader
+		* @return True if the shader was compiled
+		*/
+		static bool CompileShaderFromFile(
+			const String& filepath,
+			FShaderStageFlag stage,
+			EShaderLang lang,
+			TArray<uint32>& sourceSPIRV);
+
+		/**
+		* Creates a shader from SPIR-V returned by CompileShaderFromFile, must be called from the thread that owns the device
+		* @return A Shader* if the shader was created, otherwise nullptr will be returned
+		*/
+		static Shader* CreateShaderFromSPIRV(
+			const String& name,
+			const TArray<uint32>& sourceSPIRV,
+			FShaderStageFlag stage,
+			EShaderLang lang,
+			const String& entryPoint = "main");
+
 		static bool CreateShaderReflection(
 			const String& filepath,
 			FShaderStageFlag stage,
@@ -309,6 +373,13 @@ namespace LambdaEngine
 
 		static bool ReadDataFromFile(const String& filepath, const char* pMode, byte** ppData, uint32* pDataSize);
 
+		/**
+		* Decodes an image file to R8G8B8A8 pixels without touching the GPU, safe to call from any thread
+		* @return The pixels, which must be freed with FreePixels, or nullptr if the file could not be decoded
+		*/
+		static void* LoadPixelsFromFile(const String& filepath, uint32& width, uint32& height);
+		static void FreePixels(void* pPixels);
+
 	private:
 		static bool InitCubemapGen();
 		static void ReleaseCubemapGen();
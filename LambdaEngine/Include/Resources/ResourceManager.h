@@ -1,6 +1,7 @@
 #pragma once
 #include "ResourceLoader.h"
 #include "ResourcePaths.h"
+#include "ResourceStreamer.h"
 
 #include "Containers/TSet.h"
 #include "Containers/THashTable.h"
@@ -267,6 +268,43 @@ namespace LambdaEngine
 			bool generateMips,
 			bool linearFilteringMips);
 
+		/**
+		* Start loading a texture from file on the streaming workers, the texture is uploaded by TickStreaming once it has
+		* been decoded. Loads of a file that is already loaded or streaming return the same GUID. Formats other than
+		* FORMAT_R8G8B8A8_UNORM are loaded at once
+		* @param filename		Name of the texture file
+		* @param format			The format of the pixeldata
+		* @param generateMips	If mipmaps should be generated on load
+		* @param priority		Requests of higher priority are decoded and uploaded first
+		* @return A GUID whose state can be polled with GetResourceState, GUID_NONE if the engine is headless
+		*/
+		static GUID_Lambda LoadTextureFromFileAsync(
+			const String& filename,
+			EFormat format,
+			bool generateMips,
+			bool linearFilteringMips,
+			EStreamingPriority priority = EStreamingPriority::STREAMING_PRIORITY_NORMAL);
+
+		/**
+		* Start loading a mesh and its animations from file on the streaming workers
+		* @param filename			The name of the file
+		* @param priority			Requests of higher priority are decoded and uploaded first
+		* @param shouldTessellate	If the mesh should be tessellated, which is done on the main thread once it has been decoded
+		* @return A GUID whose state can be polled with GetResourceState
+		*/
+		static GUID_Lambda LoadMeshFromFileAsync(
+			const String& filename,
+			EStreamingPriority priority = EStreamingPriority::STREAMING_PRIORITY_NORMAL,
+			bool shouldTessellate = false);
+
+		/*
+		* Registers the resources that the streaming workers have finished, highest priority first, until
+		* RESOURCE_STREAMING_UPLOAD_BUDGET bytes have been uploaded. Called once per frame by the engine loop
+		*/
+		static void TickStreaming();
+
+		static EResourceState GetResourceState(GUID_Lambda guid);
+
 		/**
 		* Load a texture from file
 		* @param filename		Name of the texture file, this should be a equirectangular map. This can be both HDR and LDR format
@@ -425,6 +463,14 @@ namespace LambdaEngine
 
 		static GUID_Lambda GetGUID(const std::unordered_map<String, GUID_Lambda>& namesToGUIDs, const String& name);
 
+		/*
+		* Synchronous loads of a file that is streaming wait for the request and register it at once. A mesh is tessellated
+		* if either the request or the synchronous load asked for it
+		*/
+		static void FinishStreaming(const String& filepath, bool shouldTessellate = false);
+		static void CompleteStreamingRequest(StreamingRequest* pRequest);
+		static bool CancelStreaming(GUID_Lambda guid);
+
 		static void InitMaterialCreation();
 		static void InitDefaultResources();
 
@@ -488,5 +534,11 @@ namespace LambdaEngine
 		static GUID_Lambda s_AOSeperateMetRoughCombinedMaterialShaderGUID;
 
 		static TSet<GUID_Lambda> s_UnloadedGUIDs;
+
+		// Streaming requests are keyed by their full path, so that textures and meshes of the same name never collide
+		static std::unordered_map<String, StreamingRequest*>		s_StreamingRequests;
+		static std::unordered_map<GUID_Lambda, StreamingRequest*>	s_StreamingGUIDs;
+		static TArray<StreamingRequest*>							s_PendingUploads;
+		static TSet<GUID_Lambda>									s_FailedStreamingGUIDs;
 	};
 }
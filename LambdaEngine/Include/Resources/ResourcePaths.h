@@ -5,8 +5,12 @@ namespace LambdaEngine
 	constexpr const char* SCENE_DIR			= "../Assets/Scenes/";
 	constexpr const char* MESH_DIR			= "../Assets/Meshes/";
 	constexpr const char* MESHLET_CACHE_DIR	= "../Assets/Meshes/MeshletCache/";
+	constexpr const char* COOKED_SCENE_DIR	= "../Assets/Cooked/Scenes/";
 	constexpr const char* ANIMATIONS_DIR	= MESH_DIR; // Equal to mesh dir for now
 	constexpr const char* TEXTURE_DIR		= "../Assets/Textures/";
+	constexpr const char* COOKED_TEXTURE_DIR	= "../Assets/Cooked/Textures/";
 	constexpr const char* SHADER_DIR		= "../Assets/Shaders/";
+	constexpr const char* SHADER_CACHE_DIR	= "../Assets/Cooked/Shaders/";
+	constexpr const char* COLLISION_CACHE_DIR	= "../Assets/Cooked/Collision/";
 	constexpr const char* SOUND_DIR			= "../Assets/Sounds/";
 }
\ No newline at end of file
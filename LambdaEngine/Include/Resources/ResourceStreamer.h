@@ -0,0 +1,120 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/String.h"
+#include "Containers/TArray.h"
+
+#include "Rendering/Core/API/GraphicsTypes.h"
+
+#include <condition_variable>
+#include <mutex>
+
+// Threads that read and decode files, uploads happen on the main thread
+#define RESOURCE_STREAMING_WORKER_COUNT		2
+// Bytes handed to the GPU per frame by ResourceManager::TickStreaming, at least one resource is always uploaded
+#define RESOURCE_STREAMING_UPLOAD_BUDGET	(16 * 1024 * 1024)
+
+namespace LambdaEngine
+{
+	struct Mesh;
+	struct Animation;
+
+	enum class EStreamingPriority : uint8
+	{
+		STREAMING_PRIORITY_LOW		= 0,
+		STREAMING_PRIORITY_NORMAL	= 1,
+		STREAMING_PRIORITY_HIGH		= 2,
+	};
+
+	enum class EResourceState : uint8
+	{
+		RESOURCE_STATE_UNKNOWN	= 0,
+		RESOURCE_STATE_LOADING	= 1,
+		RESOURCE_STATE_READY	= 2,
+		RESOURCE_STATE_FAILED	= 3,
+	};
+
+	enum class EStreamingRequestType : uint8
+	{
+		STREAMING_REQUEST_TYPE_TEXTURE	= 0,
+		STREAMING_REQUEST_TYPE_MESH		= 1,
+	};
+
+	/*
+	* A request is written by the thread that submits it, then only by the worker that decodes it and after completion
+	* only by the main thread again
+	*/
+	struct StreamingRequest
+	{
+		EStreamingRequestType	Type				= EStreamingRequestType::STREAMING_REQUEST_TYPE_TEXTURE;
+		EStreamingPriority		Priority			= EStreamingPriority::STREAMING_PRIORITY_NORMAL;
+		GUID_Lambda				GUID				= GUID_NONE;
+		String					Name				= "";
+		String					Filepath			= "";
+		bool					IsCancelled			= false;
+
+		// Texture
+		EFormat					Format				= EFormat::FORMAT_NONE;
+		bool					GenerateMips		= false;
+		bool					LinearFilteringMips	= false;
+		void*					pPixels				= nullptr;
+		uint32					Width				= 0;
+		uint32					Height				= 0;
+
+		// Mesh
+		int32					AssimpFlags			= 0;
+		Mesh*					pMesh				= nullptr;
+		TArray<Animation*>		Animations;
+		// Only used by the main thread, tessellation records GPU work and is done once the mesh has been decoded
+		bool					ShouldTessellate	= false;
+
+		// Set by the worker once decoding has finished, whether it succeeded or not
+		bool					Succeeded			= false;
+		uint64					UploadSizeInBytes	= 0;
+
+	private:
+		friend class ResourceStreamer;
+		uint64					Sequence			= 0;
+	};
+
+	/*
+	* ResourceStreamer reads and decodes files for ResourceManager on a small pool of worker threads. Requests are
+	* served highest priority first and in submission order within a priority, and completed requests are collected
+	* by ResourceManager which creates the GPU resources within its upload budget
+	*/
+	class ResourceStreamer
+	{
+	public:
+		DECL_STATIC_CLASS(ResourceStreamer);
+
+		static bool Init();
+		static bool Release();
+
+		static void Submit(StreamingRequest* pRequest);
+
+		/*
+		* Moves the requests that have finished decoding into completed
+		*/
+		static void PopCompleted(TArray<StreamingRequest*>& completed);
+
+		/*
+		* Blocks until the request has been decoded, a request that is still queued is decoded on the calling thread.
+		* The request is not returned by PopCompleted afterwards
+		*/
+		static void Wait(StreamingRequest* pRequest);
+
+	private:
+		static void RunWorker();
+		static void Decode(StreamingRequest* pRequest);
+
+	private:
+		static TArray<StreamingRequest*>	s_Queue;
+		static TArray<StreamingRequest*>	s_Completed;
+		static std::mutex					s_Mutex;
+		static std::condition_variable		s_QueueCondition;
+		static std::condition_variable		s_CompletedCondition;
+		static uint64						s_NextSequence;
+		static uint32						s_RunningWorkerCount;
+		static bool							s_IsRunning;
+	};
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/String.h"
+
+// Bump when the layout or the cooking of scenes changes, older files are then cooked again
+#define COOKED_SCENE_VERSION	5
+#define COOKED_SCENE_MAGIC		0x4e43534c // "LSCN"
+
+namespace LambdaEngine
+{
+	struct SceneLoadRequest;
+	struct SceneLoadingContext;
+
+	/*
+	* SceneCache stores everything a scene load produces in a versioned binary file next to the assets. The file is
+	* memory mapped when it is loaded, arrays are copied straight out of the mapping and Assimp does not run at all.
+	* A cooked scene is used as long as the hash of its source file is unchanged, and there is one per request since
+	* the Assimp flags, tessellation and level object prefixes all change the result. Textures are cooked by
+	* TextureCooker into files of their own that the cooked scene refers to
+	*/
+	class SceneCache
+	{
+	public:
+		DECL_STATIC_CLASS(SceneCache);
+
+		/*
+		* Fills the outputs of the context from the cooked scene, returns false if there is no up to date cooked scene
+		* for the request, in which case the outputs are left untouched
+		*/
+		static bool Load(const SceneLoadRequest& request, SceneLoadingContext& context);
+
+		/*
+		* Writes the outputs of a scene that was just loaded with Assimp
+		*/
+		static void Store(const SceneLoadRequest& request, const SceneLoadingContext& context);
+
+	private:
+		static bool CanCache(const SceneLoadingContext& context);
+		static String GetCookedScenePath(const SceneLoadRequest& request, const SceneLoadingContext& context);
+	};
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/String.h"
+#include "Containers/TArray.h"
+
+#include "Rendering/Core/API/GraphicsTypes.h"
+
+#include "Utilities/SHA256.h"
+
+// Bump when the compiler settings or the entry layout change, entries written before are then ignored
+#define SHADER_CACHE_VERSION	1
+#define SHADER_CACHE_MAGIC		0x43525053 // "SPRC"
+
+namespace LambdaEngine
+{
+	struct ShaderReflection;
+
+	/*
+	* ShaderCache keeps compiled SPIR-V and reflection data on disk. Entries are keyed by the SHA256 of the shader
+	* source with every include expanded, the stage and the defines, so any change to a shader or to a file it
+	* includes misses the cache. Entries with and without reflection data are stored in separate files, so storing
+	* one never replaces the other. Every function may be called from several threads at once
+	*/
+	class ShaderCache
+	{
+	public:
+		DECL_STATIC_CLASS(ShaderCache);
+
+		/*
+		* Returns false if an include could not be read, the shader should then be compiled without the cache so that
+		* the compiler reports the error
+		*/
+		static bool ComputeKey(const String& source, const String& directory, FShaderStageFlags stage, const String& defines, SHA256Hash& key);
+
+		/*
+		* Fills the requested outputs from the entry of the key, returns false if there is no entry or it lacks reflection
+		* data that was asked for
+		*/
+		static bool Load(const SHA256Hash& key, TArray<uint32>* pSourceSPIRV, ShaderReflection* pReflection);
+
+		/*
+		* pReflection may be nullptr when the compiler did not produce reflection data
+		*/
+		static void Store(const SHA256Hash& key, const TArray<uint32>& sourceSPIRV, const ShaderReflection* pReflection);
+
+	private:
+		static bool LoadEntry(const String& entryPath, TArray<uint32>* pSourceSPIRV, ShaderReflection* pReflection);
+		static bool ExpandIncludes(const String& source, const String& directory, const String& rootDirectory, uint32 depth, String& expanded);
+		static String GetEntryPath(const SHA256Hash& key, bool hasReflection);
+	};
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/String.h"
+#include "Containers/TArray.h"
+
+#include "Rendering/Core/API/GraphicsTypes.h"
+
+// Bump when the encoders or the mip filter change, textures cooked before are then cooked again
+#define COOKED_TEXTURE_VERSION	1
+#define COOKED_TEXTURE_MAGIC	0x44424d4c // "LMBD"
+
+namespace LambdaEngine
+{
+	class Texture;
+
+	struct CookedTextureDesc
+	{
+		EFormat	Format			= EFormat::FORMAT_NONE;
+		uint32	Width			= 0;
+		uint32	Height			= 0;
+		uint32	Miplevels		= 0;
+		// Size and write time of the file the texture was cooked from, zero for textures without a file of their own
+		uint64	SourceSize		= 0;
+		int64	SourceWriteTime	= 0;
+	};
+
+	/*
+	* TextureCooker turns RGBA8 pixels into a texture that is ready to be uploaded as is, with the full mip chain
+	* generated on the CPU and stored in a DDS file. Color textures are block compressed, BC1 when they are opaque and
+	* BC3 otherwise. Normal maps are kept as RGBA8 since the shaders read all three components, but their mips are
+	* renormalized instead of just averaged
+	*/
+	class TextureCooker
+	{
+	public:
+		DECL_STATIC_CLASS(TextureCooker);
+
+		/*
+		* Fills the format, size and miplevels of desc and writes every miplevel, largest first, to data
+		*/
+		static void Cook(const byte* pPixels, uint32 width, uint32 height, bool isNormalMap, CookedTextureDesc& desc, TArray<byte>& data);
+
+		/*
+		* Writes to a temporary file next to filepath which then replaces it, so a cooked texture is never seen half written
+		*/
+		static bool Write(const String& filepath, const CookedTextureDesc& desc, const TArray<byte>& data);
+
+		/*
+		* Returns true if the file was cooked by this version from a source of the given size and write time, and was
+		* written no earlier than writeTime, cooking it again would then give the same result
+		*/
+		static bool IsUpToDate(const String& filepath, uint64 sourceSize, int64 sourceWriteTime, int64 writeTime);
+
+		/*
+		* Maps a cooked texture and uploads it, returns nullptr if the file is missing, was written by another version
+		* or does not match the size and write time of its source
+		*/
+		static Texture* Load(const String& filepath, const String& name, uint64 sourceSize, int64 sourceWriteTime);
+
+	private:
+		static void GenerateMiplevel(const byte* pSrc, uint32 srcWidth, uint32 srcHeight, bool isNormalMap, byte* pDst);
+		static void CompressMiplevel(const byte* pPixels, uint32 width, uint32 height, EFormat format, byte* pDst);
+		static void CompressColorBlock(const byte* pBlock, byte* pDst);
+		static void CompressAlphaBlock(const byte* pBlock, byte* pDst);
+	};
+}
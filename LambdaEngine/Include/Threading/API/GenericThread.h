@@ -1,6 +1,8 @@
 #pragma once
 #include "LambdaEngine.h"
 
+#include <thread>
+
 namespace LambdaEngine
 {
 	/*
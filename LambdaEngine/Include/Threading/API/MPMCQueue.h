@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Defines.h"
+#include "Types.h"
+
+#include <atomic>
+
+namespace LambdaEngine
+{
+	/*
+	* Bounded lock-free multi-producer multi-consumer queue. Each cell carries a sequence number that tells producers
+	* and consumers whether the cell is ready for them, so neither side ever takes a lock.
+	*/
+	template<typename T, uint32 Capacity>
+	class TMPMCQueue
+	{
+		static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "TMPMCQueue capacity must be a power of two");
+
+		struct Cell
+		{
+			std::atomic<uint64> Sequence;
+			T Data;
+		};
+
+	public:
+		TMPMCQueue()
+			: m_EnqueuePos(0)
+			, m_DequeuePos(0)
+		{
+			for (uint64 cellIndex = 0; cellIndex < Capacity; cellIndex++)
+			{
+				m_Cells[cellIndex].Sequence.store(cellIndex, std::memory_order_relaxed);
+			}
+		}
+
+		~TMPMCQueue() = default;
+
+		/*
+		* Enqueues an item, can be called from any thread
+		*	return - false if the queue is full
+		*/
+		bool Enqueue(const T& data)
+		{
+			Cell* pCell = nullptr;
+			uint64 pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				pCell = &m_Cells[pos & MASK];
+				const uint64 sequence	= pCell->Sequence.load(std::memory_order_acquire);
+				const int64 diff		= int64(sequence) - int64(pos);
+				if (diff == 0)
+				{
+					if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			pCell->Data = data;
+			pCell->Sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* Dequeues the oldest item, can be called from any thread
+		*	return - false if the queue is empty
+		*/
+		bool Dequeue(T& data)
+		{
+			Cell* pCell = nullptr;
+			uint64 pos = m_DequeuePos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				pCell = &m_Cells[pos & MASK];
+				const uint64 sequence	= pCell->Sequence.load(std::memory_order_acquire);
+				const int64 diff		= int64(sequence) - int64(pos + 1);
+				if (diff == 0)
+				{
+					if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_DequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			data = pCell->Data;
+			pCell->Sequence.store(pos + MASK + 1, std::memory_order_release);
+			return true;
+		}
+
+		FORCEINLINE bool IsEmpty() const
+		{
+			return m_EnqueuePos.load(std::memory_order_relaxed) == m_DequeuePos.load(std::memory_order_relaxed);
+		}
+
+	private:
+		static constexpr uint64 MASK = uint64(Capacity) - 1;
+
+	private:
+		alignas(64) Cell m_Cells[Capacity];
+		alignas(64) std::atomic<uint64> m_EnqueuePos;
+		alignas(64) std::atomic<uint64> m_DequeuePos;
+	};
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Defines.h"
+#include "Types.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+namespace LambdaEngine
+{
+	/*
+	* Bounded lock-free multi-producer single-consumer queue with a capacity chosen at runtime. Producers use the same
+	* per-cell sequence numbers as TMPMCQueue, while the single consumer never has to compete for a cell.
+	*/
+	template<typename T>
+	class TMPSCQueue
+	{
+		struct Cell
+		{
+			std::atomic<uint64> Sequence;
+			T Data;
+		};
+
+	public:
+		DECL_UNIQUE_CLASS(TMPSCQueue);
+
+		/*
+		* capacity - Maximum amount of items in the queue, rounded up to a power of two
+		*/
+		TMPSCQueue(uint32 capacity)
+			: m_Mask(uint64(std::bit_ceil(std::max(capacity, 2u))) - 1)
+			, m_EnqueuePos(0)
+			, m_DequeuePos(0)
+		{
+			m_pCells = DBG_NEW Cell[m_Mask + 1];
+			for (uint64 cellIndex = 0; cellIndex <= m_Mask; cellIndex++)
+			{
+				m_pCells[cellIndex].Sequence.store(cellIndex, std::memory_order_relaxed);
+			}
+		}
+
+		~TMPSCQueue()
+		{
+			SAFEDELETE_ARRAY(m_pCells);
+		}
+
+		/*
+		* Enqueues an item, can be called from any thread
+		*	return - false if the queue is full
+		*/
+		bool Enqueue(const T& data)
+		{
+			Cell* pCell = nullptr;
+			uint64 pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				pCell = &m_pCells[pos & m_Mask];
+				const uint64 sequence	= pCell->Sequence.load(std::memory_order_acquire);
+				const int64 diff		= int64(sequence) - int64(pos);
+				if (diff == 0)
+				{
+					if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			pCell->Data = data;
+			pCell->Sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* Dequeues the oldest item, may only be called by one thread at a time
+		*	return - false if the queue is empty or the oldest item is still being written
+		*/
+		bool Dequeue(T& data)
+		{
+			const uint64 pos = m_DequeuePos.load(std::memory_order_relaxed);
+			Cell& cell = m_pCells[pos & m_Mask];
+			if (cell.Sequence.load(std::memory_order_acquire) != pos + 1)
+			{
+				return false;
+			}
+
+			data = cell.Data;
+			cell.Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+			m_DequeuePos.store(pos + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		FORCEINLINE bool IsEmpty() const
+		{
+			return m_EnqueuePos.load(std::memory_order_relaxed) == m_DequeuePos.load(std::memory_order_relaxed);
+		}
+
+		FORCEINLINE uint32 GetCapacity() const
+		{
+			return uint32(m_Mask + 1);
+		}
+
+	private:
+		const uint64 m_Mask;
+		Cell* m_pCells;
+		alignas(64) std::atomic<uint64> m_EnqueuePos;
+		alignas(64) std::atomic<uint64> m_DequeuePos;
+	};
+}
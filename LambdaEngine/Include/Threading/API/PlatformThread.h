@@ -1,6 +1,8 @@
 #pragma once
 #ifdef LAMBDA_PLATFORM_WINDOWS
 	#include "Threading/Win32/Win32Thread.h"
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	#include "Threading/Linux/LinuxThread.h"
 #else
 	#error "Not defined for platform"
 #endif
\ No newline at end of file
@@ -3,25 +3,47 @@
 #include "Defines.h"
 
 #include "Containers/TArray.h"
+#include "Threading/API/SpinLock.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
-#include <queue>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// Size of the inline storage for a job's callable. Callables that do not fit are rejected at compile time.
+#define THREAD_JOB_STORAGE_SIZE 96u
 
 namespace LambdaEngine
 {
-	// Used to block threads calling join(), and used by working threads to notify when the job is finished
-	struct JoinResources {
-		std::mutex Mutex;
-		std::condition_variable CondVar;
-		bool FinishSignal;
+	template<typename T, uint32 Capacity>
+	class TWorkStealingQueue;
+
+	template<typename T, uint32 Capacity>
+	class TMPMCQueue;
+
+	// Incremented when a job is scheduled and decremented when the job has finished. Wait on it using ThreadPool::Wait.
+	struct JobCounter
+	{
+		std::atomic_uint32_t Value = 0;
 	};
 
-	struct ThreadJob {
-		std::function<void()> Function;
-		uint32 JoinResourcesIndex; // uint32_MAX is specified when join resources should not be used
+	// A job stores its callable inline, scheduling a job never allocates
+	struct alignas(64) ThreadJob
+	{
+		byte Storage[THREAD_JOB_STORAGE_SIZE];
+		void(*pInvoke)(void* pStorage);
+		void(*pDestroy)(void* pStorage);
+		JobCounter* pCounter;
+		std::atomic_uint32_t IsInFlight;
 	};
 
+	// Ring of jobs owned by a single scheduling thread
+	struct ThreadJobPool;
+
 	class LAMBDA_API ThreadPool
 	{
 	public:
@@ -31,32 +53,125 @@ namespace LambdaEngine
 
 		static bool Release();
 
-		// Returns index to thread join resources. Calling join() on the returned index is required.
-		static uint32 Execute(std::function<void()> job);
-
-		// Schedules a job without any join resources attached. Calling joinAll() before the program exits is required.
-		static void ExecuteDetached(std::function<void()> job);
-
-		static void Join(uint32 joinResourcesIndex);
+		// Returns index to a join counter. Calling Join() on the returned index is required.
+		template<typename TFunction>
+		static uint32 Execute(TFunction&& function)
+		{
+			const uint32 joinCounterIdx = AllocateJoinCounter();
+			Execute(s_pJoinCounters[joinCounterIdx], std::forward<TFunction>(function));
+			return joinCounterIdx;
+		}
+
+		// Schedules a job that decrements the counter when finished. Wait() blocks until the counter reaches zero.
+		template<typename TFunction>
+		static void Execute(JobCounter& counter, TFunction&& function)
+		{
+			counter.Value.fetch_add(1, std::memory_order_relaxed);
+			Submit(CreateJob(&counter, std::forward<TFunction>(function)));
+		}
+
+		// Schedules a job without any counter attached. Calling JoinAll() before the program exits is required.
+		template<typename TFunction>
+		static void ExecuteDetached(TFunction&& function)
+		{
+			Submit(CreateJob(nullptr, std::forward<TFunction>(function)));
+		}
+
+		/*
+		* Blocks until all jobs attached to the counter have finished. The calling thread executes pending jobs while
+		* waiting instead of sleeping.
+		*/
+		static void Wait(const JobCounter& counter);
+
+		/*
+		* Blocks until the condition returns true, executing pending jobs in the meantime. Used to wait for work that is
+		* running on the pool without a counter, such as the tasks of a PhysX step.
+		*/
+		template<typename TCondition>
+		static void WaitUntil(TCondition&& condition)
+		{
+			while (!condition())
+			{
+				if (!ExecuteNextJob())
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		static void Join(uint32 joinCounterIndex);
 		static void JoinAll();
 
+		/*
+		* Limits how many of the worker threads are allowed to execute jobs. Used to measure scaling, the remaining
+		* workers are parked until the limit is raised again.
+		*	threadCount - Amount of workers to use, clamped to [1, GetThreadCount()]
+		*/
+		static void SetActiveThreadCount(uint32 threadCount);
+
 		static uint32 GetThreadCount() { return s_Threads.GetSize(); }
+		static uint32 GetActiveThreadCount() { return s_ActiveThreadCount.load(std::memory_order_relaxed); }
 
 	private:
+		template<typename TFunction>
+		static ThreadJob* CreateJob(JobCounter* pCounter, TFunction&& function)
+		{
+			using TCallable = std::decay_t<TFunction>;
+			static_assert(sizeof(TCallable) <= THREAD_JOB_STORAGE_SIZE, "Job callable is too large, capture less or capture by reference");
+			static_assert(alignof(TCallable) <= alignof(ThreadJob), "Job callable has a too strict alignment");
+
+			ThreadJob* pJob = AllocateJob();
+			new(pJob->Storage) TCallable(std::forward<TFunction>(function));
+			pJob->pInvoke	= [](void* pStorage) { (*reinterpret_cast<TCallable*>(pStorage))(); };
+			pJob->pDestroy	= [](void* pStorage) { reinterpret_cast<TCallable*>(pStorage)->~TCallable(); };
+			pJob->pCounter	= pCounter;
+			return pJob;
+		}
+
+		static ThreadJob* AllocateJob();
+		static uint32 AllocateJoinCounter();
+
+		// Pushes the job to the calling worker's deque, or to the shared queue if called from a non-worker thread
+		static void Submit(ThreadJob* pJob);
+
+		// Finds a job in the local deque, the shared queue or another worker's deque and executes it
+		static bool ExecuteNextJob();
+		static ThreadJob* FindJob();
+		static void ExecuteJob(ThreadJob* pJob);
+
 		// Infinite loop where threads wait for jobs
-		static void WaitForJob();
+		static void WorkerLoop(uint32 workerIndex);
 
 	private:
 		static TArray<std::thread> s_Threads;
-		static std::queue<ThreadJob> s_Jobs;
-		static std::condition_variable s_JobsExist;
-
-		// Pool of join resources to each thread job. Expanded upon need.
-		static TArray<JoinResources*> s_JoinResources;
-		static TArray<uint32> s_FreeJoinResourcesIndices;
-		static std::mutex s_ScheduleLock;
+		static TArray<TWorkStealingQueue<ThreadJob, 4096>*> s_WorkerQueues;
+		static TMPMCQueue<ThreadJob*, 4096>* s_pSharedQueue;
+
+		// Job pools are created per scheduling thread on first use and released together with the thread pool
+		// A thread's pool is only used if it was created in the current generation, other threads can not reset it
+		static TArray<ThreadJobPool*> s_JobPools;
+		static SpinLock s_JobPoolLock;
+		static std::atomic_uint32_t s_JobPoolGeneration;
+		static thread_local ThreadJobPool* s_pThreadJobPool;
+		static thread_local uint32 s_ThreadJobPoolGeneration;
+		static thread_local uint32 s_WorkerIndex;
+
+		// Counters handed out by Execute(function) to support Join(uint32)
+		static JobCounter* s_pJoinCounters;
+		static TArray<uint32> s_FreeJoinCounterIndices;
+		static SpinLock s_JoinCounterLock;
+
+		// Jobs scheduled but not yet picked up, and jobs scheduled but not yet finished
+		static std::atomic_uint32_t s_QueuedJobCount;
+		static std::atomic_uint32_t s_PendingJobCount;
+		static std::atomic_uint32_t s_ActiveThreadCount;
+
+		// Idle workers sleep here, the lock is only taken when a worker goes to sleep or has to be woken up
+		static std::atomic_uint32_t s_SleepingThreadCount;
+		static std::mutex s_SleepLock;
+		static std::condition_variable s_WakeCondition;
 
 		// Signals when threads should stop looking for jobs in order to delete the thread pool
-		static bool s_TimeToTerminate;
+		static std::atomic_bool s_TimeToTerminate;
 	};
 }
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Defines.h"
+#include "Types.h"
+
+#include <atomic>
+
+namespace LambdaEngine
+{
+	/*
+	* Bounded Chase-Lev deque. The owning thread pushes and pops at the bottom without any locking, while any other
+	* thread may steal from the top. Stores pointers only, the queue does not own the items.
+	*/
+	template<typename T, uint32 Capacity>
+	class TWorkStealingQueue
+	{
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "TWorkStealingQueue capacity must be a power of two");
+
+	public:
+		TWorkStealingQueue()
+			: m_Top(0)
+			, m_Bottom(0)
+		{
+			for (std::atomic<T*>& item : m_Items)
+			{
+				item.store(nullptr, std::memory_order_relaxed);
+			}
+		}
+
+		~TWorkStealingQueue() = default;
+
+		/*
+		* Pushes an item to the bottom of the queue. May only be called by the owning thread.
+		*	pItem	- Item to push
+		*	return	- false if the queue is full
+		*/
+		bool Push(T* pItem)
+		{
+			const int64 bottom	= m_Bottom.load(std::memory_order_relaxed);
+			const int64 top		= m_Top.load(std::memory_order_acquire);
+			if (bottom - top >= int64(Capacity))
+			{
+				return false;
+			}
+
+			m_Items[bottom & MASK].store(pItem, std::memory_order_relaxed);
+			m_Bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* Pops the most recently pushed item. May only be called by the owning thread.
+		*	return - nullptr if the queue is empty or the last item was stolen
+		*/
+		T* Pop()
+		{
+			const int64 bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64 top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				// Queue was empty
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T* pItem = m_Items[bottom & MASK].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last item, race against stealers
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					pItem = nullptr;
+				}
+
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return pItem;
+		}
+
+		/*
+		* Steals the oldest item. Can be called from any thread.
+		*	return - nullptr if the queue is empty or another thread won the race
+		*/
+		T* Steal()
+		{
+			int64 top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64 bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+			{
+				return nullptr;
+			}
+
+			T* pItem = m_Items[top & MASK].load(std::memory_order_relaxed);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return nullptr;
+			}
+
+			return pItem;
+		}
+
+		/*
+		* Approximate amount of items in the queue, only exact when called by the owning thread without concurrent steals
+		*/
+		FORCEINLINE uint32 GetSize() const
+		{
+			const int64 bottom	= m_Bottom.load(std::memory_order_relaxed);
+			const int64 top		= m_Top.load(std::memory_order_relaxed);
+			return bottom > top ? uint32(bottom - top) : 0;
+		}
+
+	private:
+		static constexpr int64 MASK = int64(Capacity) - 1;
+
+	private:
+		// Top and bottom are written by different threads, keep them on separate cache lines
+		alignas(64) std::atomic<int64> m_Top;
+		alignas(64) std::atomic<int64> m_Bottom;
+		alignas(64) std::atomic<T*> m_Items[Capacity];
+	};
+}
@@ -0,0 +1,27 @@
+#pragma once
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Threading/API/GenericThread.h"
+
+namespace LambdaEngine
+{
+	/*
+	* LinuxThread
+	*/
+
+	class LinuxThread : public GenericThread
+	{
+	public:
+		static ThreadHandle GetCurrentThreadHandle();
+		static ThreadHandle GetThreadHandle(std::thread& thread);
+
+		/*
+		* Linux limits thread names to 15 characters, longer names are truncated
+		*/
+		static bool SetThreadName(ThreadHandle threadID, const String& name);
+		static bool SetThreadAffinity(ThreadHandle threadID, uint64 affinityMask);
+	};
+
+	typedef LinuxThread PlatformThread;
+}
+
+#endif
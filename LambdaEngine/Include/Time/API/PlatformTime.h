@@ -4,6 +4,8 @@
 	#include "Time/Win32/Win32Time.h"
 #elif defined(LAMBDA_PLATFORM_MACOS)
 	#include "Time/Mac/MacTime.h"
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	#include "Time/Linux/LinuxTime.h"
 #else
 	#error No platform defined
 #endif
@@ -0,0 +1,34 @@
+#pragma once
+
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Time/API/Time.h"
+
+#include <time.h>
+
+namespace LambdaEngine
+{
+	class LinuxTime : public Time
+	{
+	public:
+		DECL_STATIC_CLASS(LinuxTime);
+
+		static FORCEINLINE uint64 GetPerformanceCounter()
+		{
+			struct timespec now = {};
+			clock_gettime(CLOCK_MONOTONIC, &now);
+
+			constexpr uint64 NANOSECONDS = 1000 * 1000 * 1000;
+			return (uint64(now.tv_sec) * NANOSECONDS) + uint64(now.tv_nsec);
+		}
+
+		// The counter is in nanoseconds
+		static FORCEINLINE uint64 GetPerformanceFrequency()
+		{
+			return 1000 * 1000 * 1000;
+		}
+	};
+
+	typedef LinuxTime PlatformTime;
+}
+
+#endif
@@ -0,0 +1,40 @@
+#pragma once
+#include "LambdaEngine.h"
+
+#include "Containers/String.h"
+
+#include <fstream>
+
+namespace LambdaEngine
+{
+	/*
+	* AtomicFileWriter writes to a temporary file next to the destination that Commit renames into place, so a reader
+	* never sees half a file and a failed write leaves the previous file intact. Every writer gets a temporary file with
+	* a random name, so several threads and processes can write the same file at once
+	*/
+	class AtomicFileWriter
+	{
+	public:
+		AtomicFileWriter(const String& filepath);
+		~AtomicFileWriter();
+
+		void Write(const void* pData, uint64 sizeInBytes);
+
+		/*
+		* Returns false if anything failed to be written or the destination could not be replaced, the temporary file
+		* is then removed
+		*/
+		bool Commit();
+
+	private:
+		String			m_Filepath;
+		String			m_TempFilepath;
+		std::ofstream	m_File;
+		bool			m_IsCommitted = false;
+	};
+
+	/*
+	* Lower case hex digits of the bytes in order, used to name cache files after their keys
+	*/
+	String ToHexString(const void* pData, uint64 sizeInBytes);
+}
@@ -1,8 +1,10 @@
 #include "Application/API/CommonApplication.h"
 #include "Application/API/PlatformApplication.h"
 #include "Application/API/Window.h"
+#include "Application/Headless/HeadlessApplication.h"
 
 #include "Engine/EngineConfig.h"
+#include "Engine/EngineLoop.h"
 
 #include "Application/API/Events/EventQueue.h"
 #include "Application/API/Events/MouseEvents.h"
@@ -215,8 +217,8 @@ namespace LambdaEngine
 
 	bool CommonApplication::PreInit()
 	{
-		// Create platform application
-		Application* pPlatformApplication = PlatformApplication::CreateApplication();
+		// Create platform application, a headless process never opens a window even if the platform could
+		Application* pPlatformApplication = EngineLoop::IsHeadless() ? HeadlessApplication::CreateApplication() : PlatformApplication::CreateApplication();
 		if (!pPlatformApplication->Create())
 		{
 			return false;
@@ -234,7 +236,10 @@ namespace LambdaEngine
 
 	bool CommonApplication::Tick()
 	{
-		PlatformApplication::PeekEvents();
+		if (!EngineLoop::IsHeadless())
+		{
+			PlatformApplication::PeekEvents();
+		}
 
 		bool shouldExit = m_pPlatformApplication->Tick();
 		if (shouldExit)
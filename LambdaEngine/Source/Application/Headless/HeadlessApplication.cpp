@@ -0,0 +1,110 @@
+#include "Application/Headless/HeadlessApplication.h"
+#include "Application/Headless/HeadlessWindow.h"
+
+#include <csignal>
+
+namespace LambdaEngine
+{
+	HeadlessApplication* HeadlessApplication::s_pApplication = nullptr;
+
+	/*
+	* HeadlessApplication
+	*/
+	HeadlessApplication::~HeadlessApplication()
+	{
+		if (s_pApplication == this)
+		{
+			std::signal(SIGINT, SIG_DFL);
+			std::signal(SIGTERM, SIG_DFL);
+			s_pApplication = nullptr;
+		}
+	}
+
+	bool HeadlessApplication::Create()
+	{
+		// Without a window to close, stopping the process is how a headless engine is asked to quit
+		s_pApplication = this;
+		std::signal(SIGINT, &HeadlessApplication::SignalHandler);
+		std::signal(SIGTERM, &HeadlessApplication::SignalHandler);
+		return true;
+	}
+
+	TSharedRef<Window> HeadlessApplication::CreateWindow(const WindowDesc* pDesc)
+	{
+		TSharedRef<HeadlessWindow> window = DBG_NEW HeadlessWindow();
+		if (window->Init(pDesc))
+		{
+			return window;
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	bool HeadlessApplication::Tick()
+	{
+		return ProcessStoredEvents();
+	}
+
+	bool HeadlessApplication::ProcessStoredEvents()
+	{
+		// There are no OS events, the only thing left to process is a request to quit
+		return !IsTerminating();
+	}
+
+	void HeadlessApplication::Terminate()
+	{
+		m_IsTerminating.store(true, std::memory_order_relaxed);
+	}
+
+	bool HeadlessApplication::SupportsRawInput() const
+	{
+		return false;
+	}
+
+	void HeadlessApplication::SetMouseVisibility(bool visible)
+	{
+		UNREFERENCED_VARIABLE(visible);
+	}
+
+	void HeadlessApplication::SetMousePosition(int32 x, int32 y)
+	{
+		UNREFERENCED_VARIABLE(x);
+		UNREFERENCED_VARIABLE(y);
+	}
+
+	void HeadlessApplication::SetInputMode(TSharedRef<Window> window, EInputMode inputMode)
+	{
+		UNREFERENCED_VARIABLE(window);
+		UNREFERENCED_VARIABLE(inputMode);
+	}
+
+	EInputMode HeadlessApplication::GetInputMode(TSharedRef<Window> window) const
+	{
+		UNREFERENCED_VARIABLE(window);
+		return EInputMode::INPUT_MODE_NONE;
+	}
+
+	void HeadlessApplication::QueryCPUStatistics(CPUStatistics* pCPUStat) const
+	{
+		VALIDATE(pCPUStat != nullptr);
+		(*pCPUStat) = { };
+	}
+
+	Application* HeadlessApplication::CreateApplication()
+	{
+		return DBG_NEW HeadlessApplication();
+	}
+
+	void HeadlessApplication::SignalHandler(int signal)
+	{
+		UNREFERENCED_VARIABLE(signal);
+
+		// Only touches a lock-free atomic, which is safe inside a signal handler
+		if (s_pApplication != nullptr)
+		{
+			s_pApplication->Terminate();
+		}
+	}
+}
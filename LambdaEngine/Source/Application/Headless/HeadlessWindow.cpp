@@ -0,0 +1,85 @@
+#include "Application/Headless/HeadlessWindow.h"
+
+namespace LambdaEngine
+{
+	/*
+	* HeadlessWindow
+	*/
+	bool HeadlessWindow::Init(const WindowDesc* pDesc)
+	{
+		VALIDATE(pDesc != nullptr);
+
+		m_Desc = *pDesc;
+		return true;
+	}
+
+	void HeadlessWindow::Show()
+	{
+	}
+
+	void HeadlessWindow::Close()
+	{
+	}
+
+	void HeadlessWindow::Minimize()
+	{
+	}
+
+	void HeadlessWindow::Maximize()
+	{
+	}
+
+	bool HeadlessWindow::IsActiveWindow() const
+	{
+		return false;
+	}
+
+	void HeadlessWindow::Restore()
+	{
+	}
+
+	void HeadlessWindow::ToggleFullscreen()
+	{
+	}
+
+	void HeadlessWindow::SetTitle(const String& title)
+	{
+		m_Desc.Title = title;
+	}
+
+	void HeadlessWindow::SetPosition(int32 x, int32 y)
+	{
+		m_PositionX = x;
+		m_PositionY = y;
+	}
+
+	void HeadlessWindow::GetPosition(int32* pPosX, int32* pPosY) const
+	{
+		VALIDATE(pPosX != nullptr);
+		VALIDATE(pPosY != nullptr);
+
+		(*pPosX) = m_PositionX;
+		(*pPosY) = m_PositionY;
+	}
+
+	void HeadlessWindow::SetSize(uint16 width, uint16 height)
+	{
+		m_Desc.Width	= width;
+		m_Desc.Height	= height;
+	}
+
+	uint16 HeadlessWindow::GetWidth() const
+	{
+		return m_Desc.Width;
+	}
+
+	uint16 HeadlessWindow::GetHeight() const
+	{
+		return m_Desc.Height;
+	}
+
+	bool HeadlessWindow::IsValid() const
+	{
+		return true;
+	}
+}
@@ -0,0 +1,111 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include <stdio.h>
+#include <stdarg.h>
+#include <mutex>
+
+#include "Threading/API/SpinLock.h"
+
+#include "Application/Linux/LinuxConsole.h"
+
+namespace LambdaEngine
+{
+	//Locks stdout so that lines from different threads do not interleave
+	SpinLock g_ConsoleLock;
+
+	/*
+	* LinuxConsole
+	*/
+	void LinuxConsole::Show()
+	{
+		// The terminal the server was started from is already attached
+	}
+
+	void LinuxConsole::Close()
+	{
+		std::scoped_lock<SpinLock> lock(g_ConsoleLock);
+		fflush(stdout);
+	}
+
+	void LinuxConsole::Print(const char* pMessage, ...)
+	{
+		va_list args;
+		va_start(args, pMessage);
+
+		PrintV(pMessage, args);
+
+		va_end(args);
+	}
+
+	void LinuxConsole::PrintLine(const char* pMessage, ...)
+	{
+		va_list args;
+		va_start(args, pMessage);
+
+		PrintLineV(pMessage, args);
+
+		va_end(args);
+	}
+
+	void LinuxConsole::PrintV(const char* pMessage, va_list args)
+	{
+		std::scoped_lock<SpinLock> lock(g_ConsoleLock);
+		vfprintf(stdout, pMessage, args);
+	}
+
+	void LinuxConsole::PrintLineV(const char* pMessage, va_list args)
+	{
+		std::scoped_lock<SpinLock> lock(g_ConsoleLock);
+		vfprintf(stdout, pMessage, args);
+		fputc('\n', stdout);
+		fflush(stdout);
+	}
+
+	void LinuxConsole::Clear()
+	{
+		std::scoped_lock<SpinLock> lock(g_ConsoleLock);
+		fputs("\033[2J\033[H", stdout);
+		fflush(stdout);
+	}
+
+	void LinuxConsole::ClearLastLine()
+	{
+		std::scoped_lock<SpinLock> lock(g_ConsoleLock);
+		fputs("\033[1A\033[2K\r", stdout);
+		fflush(stdout);
+	}
+
+	void LinuxConsole::SetTitle(const char* pTitle)
+	{
+		std::scoped_lock<SpinLock> lock(g_ConsoleLock);
+		fprintf(stdout, "\033]0;%s\007", pTitle);
+		fflush(stdout);
+	}
+
+	void LinuxConsole::SetColor(EConsoleColor color)
+	{
+		std::scoped_lock<SpinLock> lock(g_ConsoleLock);
+
+		const char* pColor = "\033[0m";
+		switch (color)
+		{
+		case EConsoleColor::COLOR_RED:
+			pColor = "\033[1;31m";
+			break;
+
+		case EConsoleColor::COLOR_GREEN:
+			pColor = "\033[1;32m";
+			break;
+
+		case EConsoleColor::COLOR_YELLOW:
+			pColor = "\033[1;33m";
+			break;
+
+		case EConsoleColor::COLOR_WHITE:
+			break;
+		}
+
+		fputs(pColor, stdout);
+	}
+}
+
+#endif
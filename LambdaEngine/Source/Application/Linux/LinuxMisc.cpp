@@ -0,0 +1,41 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include <stdio.h>
+#include <stdarg.h>
+#include <mutex>
+
+#include "Threading/API/SpinLock.h"
+
+#include "Application/Linux/LinuxMisc.h"
+
+namespace LambdaEngine
+{
+	/*
+	* LinuxMisc
+	*/
+	void LinuxMisc::MessageBox(const char* pCaption, const char* pText)
+	{
+		fprintf(stderr, "[%s] %s\n", pCaption, pText);
+		fflush(stderr);
+	}
+
+	void LinuxMisc::OutputDebugString(const char* pFormat, ...)
+	{
+		va_list args;
+		va_start(args, pFormat);
+
+		OutputDebugStringV(pFormat, args);
+
+		va_end(args);
+	}
+
+	void LinuxMisc::OutputDebugStringV(const char* pFormat, va_list args)
+	{
+		static SpinLock bufferlock;
+		std::scoped_lock<SpinLock> lock(bufferlock);
+
+		vfprintf(stderr, pFormat, args);
+		fputc('\n', stderr);
+	}
+}
+
+#endif
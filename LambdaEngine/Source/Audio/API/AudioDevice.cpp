@@ -1,6 +1,7 @@
 #include "Audio/API/IAudioDevice.h"
 
 #include "Audio/FMOD/AudioDeviceFMOD.h"
+#include "Audio/Null/AudioDeviceNull.h"
 
 namespace LambdaEngine
 {
@@ -12,6 +13,10 @@ namespace LambdaEngine
 		{
 			pDevice = DBG_NEW AudioDeviceFMOD();
 		}
+		else if (api == EAudioAPI::NONE)
+		{
+			pDevice = DBG_NEW AudioDeviceNull();
+		}
 		else
 		{
 			return nullptr;
@@ -2,20 +2,23 @@
 
 #include "Log/Log.h"
 
+#include "Engine/EngineLoop.h"
+
 namespace LambdaEngine
 {
 	IAudioDevice* AudioAPI::s_pAudioDevice = nullptr;
 
 	bool AudioAPI::Init()
 	{
+		const bool headless = EngineLoop::IsHeadless();
 
 		AudioDeviceDesc audioDeviceDesc = {};
-		audioDeviceDesc.pName					= "Main AudioDeviceFMOD";
+		audioDeviceDesc.pName					= headless ? "Main AudioDeviceNull" : "Main AudioDeviceFMOD";
 		audioDeviceDesc.Debug					= true;
 		audioDeviceDesc.MaxNumAudioListeners	= 1;
 		audioDeviceDesc.MaxWorldSize			= 200;
 
-		s_pAudioDevice = CreateAudioDevice(EAudioAPI::FMOD, audioDeviceDesc);
+		s_pAudioDevice = CreateAudioDevice(headless ? EAudioAPI::NONE : EAudioAPI::FMOD, audioDeviceDesc);
 
 		return true;
 	}
@@ -0,0 +1,91 @@
+#include "Audio/Null/AudioDeviceNull.h"
+
+namespace LambdaEngine
+{
+	bool AudioDeviceNull::Init(const AudioDeviceDesc* pDesc)
+	{
+		VALIDATE(pDesc != nullptr);
+
+		m_MasterVolume	= pDesc->MasterVolume;
+		m_MusicVolume	= pDesc->MusicVolume;
+		return true;
+	}
+
+	void AudioDeviceNull::Tick()
+	{
+	}
+
+	void AudioDeviceNull::UpdateAudioListener(uint32 index, const AudioListenerDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(index);
+		UNREFERENCED_VARIABLE(pDesc);
+	}
+
+	uint32 AudioDeviceNull::GetAudioListener(bool requestNew)
+	{
+		UNREFERENCED_VARIABLE(requestNew);
+		return 0;
+	}
+
+	IMusic* AudioDeviceNull::CreateMusic(const MusicDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(pDesc);
+		return nullptr;
+	}
+
+	ISoundEffect3D* AudioDeviceNull::Create3DSoundEffect(const SoundEffect3DDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(pDesc);
+		return nullptr;
+	}
+
+	ISoundEffect2D* AudioDeviceNull::Create2DSoundEffect(const SoundEffect2DDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(pDesc);
+		return nullptr;
+	}
+
+	ISoundInstance3D* AudioDeviceNull::Create3DSoundInstance(const SoundInstance3DDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(pDesc);
+		return nullptr;
+	}
+
+	ISoundInstance2D* AudioDeviceNull::Create2DSoundInstance(const SoundInstance2DDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(pDesc);
+		return nullptr;
+	}
+
+	IAudioGeometry* AudioDeviceNull::CreateAudioGeometry(const AudioGeometryDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(pDesc);
+		return nullptr;
+	}
+
+	IReverbSphere* AudioDeviceNull::CreateReverbSphere(const ReverbSphereDesc* pDesc)
+	{
+		UNREFERENCED_VARIABLE(pDesc);
+		return nullptr;
+	}
+
+	void AudioDeviceNull::SetMasterVolume(float volume)
+	{
+		m_MasterVolume = volume;
+	}
+
+	void AudioDeviceNull::SetMusicVolume(float volume)
+	{
+		m_MusicVolume = volume;
+	}
+
+	float AudioDeviceNull::GetMasterVolume() const
+	{
+		return m_MasterVolume;
+	}
+
+	float AudioDeviceNull::GetMusicVolume() const
+	{
+		return m_MusicVolume;
+	}
+}
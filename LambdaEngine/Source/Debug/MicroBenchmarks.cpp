@@ -0,0 +1,792 @@
+#include "Debug/MicroBenchmarks.h"
+
+#include "Containers/SparseIndexMap.h"
+#include "Containers/THashTable.h"
+
+#include "ECS/ComponentMask.h"
+#include "ECS/ComponentStorage.h"
+
+#include "Game/ECS/Components/Rendering/AnimationComponent.h"
+#include "Game/ECS/Systems/Rendering/AnimationSystem.h"
+
+#include "Networking/API/IPEndPoint.h"
+#include "Networking/API/PlatformNetworkUtils.h"
+#include "Networking/API/UDP/ISocketUDP.h"
+#include "Networking/API/UDP/PacketManagerUDP.h"
+#include "Networking/API/UDP/PacketTransceiverUDP.h"
+
+#include "Rendering/Animation/AnimationGraph.h"
+
+#include "Resources/ResourceManager.h"
+
+#include "Threading/API/ThreadPool.h"
+
+#include "Time/API/Clock.h"
+
+#include <unordered_set>
+
+namespace LambdaEngine
+{
+	/*
+	* Transceiver that hands packets directly to another transceiver's inbox instead of a socket, so that the
+	* loopback benchmark only measures the packet managers
+	*/
+	class LoopbackTransceiver : public PacketTransceiverUDP
+	{
+	public:
+		static constexpr const uint32 INBOX_SIZE = 64;
+
+	public:
+		LoopbackTransceiver() = default;
+		~LoopbackTransceiver() = default;
+
+		void SetPeer(LoopbackTransceiver* pPeer)
+		{
+			m_pPeer = pPeer;
+		}
+
+		uint32 GetDroppedPackets() const
+		{
+			return m_DroppedPackets;
+		}
+
+	protected:
+		virtual bool TransmitData(const uint8* pBuffer, uint32 bytesToSend, int32& bytesSent, const IPEndPoint& ipEndPoint) override
+		{
+			UNREFERENCED_VARIABLE(ipEndPoint);
+
+			// A full inbox behaves like a lost packet
+			if (m_pPeer->m_PacketCount == INBOX_SIZE)
+			{
+				m_pPeer->m_DroppedPackets++;
+			}
+			else
+			{
+				const uint32 packetIndex = (m_pPeer->m_ReadIndex + m_pPeer->m_PacketCount) % INBOX_SIZE;
+				memcpy(m_pPeer->m_Packets[packetIndex], pBuffer, bytesToSend);
+				m_pPeer->m_PacketSizes[packetIndex] = bytesToSend;
+				m_pPeer->m_PacketCount++;
+			}
+
+			bytesSent = (int32)bytesToSend;
+			return true;
+		}
+
+		virtual bool ReceiveData(uint8* pBuffer, uint32 size, int32& bytesReceived, IPEndPoint& ipEndPoint) override
+		{
+			UNREFERENCED_VARIABLE(size);
+			UNREFERENCED_VARIABLE(ipEndPoint);
+
+			if (m_PacketCount == 0)
+			{
+				bytesReceived = 0;
+				return false;
+			}
+
+			memcpy(pBuffer, m_Packets[m_ReadIndex], m_PacketSizes[m_ReadIndex]);
+			bytesReceived = (int32)m_PacketSizes[m_ReadIndex];
+			m_ReadIndex = (m_ReadIndex + 1) % INBOX_SIZE;
+			m_PacketCount--;
+			return true;
+		}
+
+	private:
+		LoopbackTransceiver* m_pPeer = nullptr;
+		uint8 m_Packets[INBOX_SIZE][MAXIMUM_SEGMENT_SIZE];
+		uint32 m_PacketSizes[INBOX_SIZE];
+		uint32 m_ReadIndex = 0;
+		uint32 m_PacketCount = 0;
+		uint32 m_DroppedPackets = 0;
+	};
+
+	// One end of a loopback connection, the server owns one of these per client and each client owns one
+	struct LoopbackEndPoint
+	{
+		PacketManagerUDP PacketManager;
+		LoopbackTransceiver Transceiver;
+		TArray<NetworkSegment*> SegmentsReceived;
+
+		LoopbackEndPoint(const PacketManagerDesc& desc) :
+			PacketManager(desc)
+		{
+		}
+
+		void Send(uint16 type, uint32 segmentCount, uint16 segmentSize, bool reliable)
+		{
+			static const uint8 payload[MAXIMUM_SEGMENT_SIZE] = {};
+
+			for (uint32 segmentNr = 0; segmentNr < segmentCount; segmentNr++)
+			{
+				NetworkSegment* pSegment = PacketManager.GetSegmentPool()->RequestFreeSegment();
+				if (pSegment == nullptr)
+				{
+					return;
+				}
+
+				pSegment->SetType(type);
+				pSegment->Write(payload, segmentSize);
+
+				if (reliable)
+					PacketManager.EnqueueSegmentReliable(pSegment);
+				else
+					PacketManager.EnqueueSegmentUnreliable(pSegment);
+			}
+		}
+
+		uint32 Receive()
+		{
+			uint32 segmentCount = 0;
+			IPEndPoint sender;
+			bool hasDiscardedResends = false;
+
+			while (Transceiver.ReceiveBegin(sender))
+			{
+				if (PacketManager.QueryBegin(&Transceiver, SegmentsReceived, hasDiscardedResends))
+				{
+					segmentCount += SegmentsReceived.GetSize();
+					PacketManager.QueryEnd(SegmentsReceived);
+				}
+			}
+
+			return segmentCount;
+		}
+	};
+
+	// Components only used by the chunk iteration benchmark, registered in a component storage of its own
+	struct ChunkTestPositionComponent
+	{
+		DECL_COMPONENT_WITH_DIRTY_FLAG(ChunkTestPositionComponent);
+		float32 Value;
+	};
+
+	struct ChunkTestVelocityComponent
+	{
+		DECL_COMPONENT(ChunkTestVelocityComponent);
+		float32 Value;
+	};
+
+	struct ChunkTestExcludedComponent
+	{
+		DECL_COMPONENT(ChunkTestExcludedComponent);
+		uint32 Value;
+	};
+
+	void MicroBenchmarks::RunAll(TArray<MicroBenchmarkResult>& results)
+	{
+		RunThreadPoolScaling(results);
+		RunECSContainers(results);
+		RunECSChunkIteration(results);
+		RunAnimation(results);
+		RunPacketManagerLoopback(results);
+		RunSocketLoopback(results);
+	}
+
+	void MicroBenchmarks::RunThreadPoolScaling(TArray<MicroBenchmarkResult>& results)
+	{
+		constexpr const uint32 JOB_COUNT		= 100000;
+		constexpr const uint32 WORK_PER_JOB		= 256;
+
+		// Make sure nothing else is running on the workers while measuring
+		ThreadPool::JoinAll();
+
+		const uint32 threadCount = ThreadPool::GetThreadCount();
+		std::atomic_uint32_t checksum = 0;
+
+		uint32 activeThreadCount = 1;
+		while (true)
+		{
+			ThreadPool::SetActiveThreadCount(activeThreadCount);
+
+			Clock clock;
+			clock.Reset();
+
+			// The jobs are scheduled from a worker and the calling thread does not help out while waiting, otherwise
+			// it would execute jobs as well and every measurement would use one thread more than reported
+			JobCounter jobCounter;
+			ThreadPool::Execute(jobCounter, [&jobCounter, &checksum]
+			{
+				for (uint32 jobNr = 0; jobNr < JOB_COUNT; jobNr++)
+				{
+					ThreadPool::Execute(jobCounter, [&checksum, jobNr]
+					{
+						// A small amount of work to resemble short ECS jobs
+						uint32 hash = jobNr;
+						for (uint32 iteration = 0; iteration < WORK_PER_JOB; iteration++)
+						{
+							hash = hash * 2654435761u + iteration;
+						}
+
+						checksum.fetch_add(hash & 1u, std::memory_order_relaxed);
+					});
+				}
+			});
+
+			while (jobCounter.Value.load(std::memory_order_acquire) > 0)
+			{
+				std::this_thread::yield();
+			}
+
+			clock.Tick();
+
+			const float64 jobsPerSecond = float64(JOB_COUNT) / clock.GetDeltaTime().AsSeconds();
+			results.PushBack({ "ThreadPoolJobsPerSecond_" + std::to_string(activeThreadCount) + "Threads", jobsPerSecond });
+			LOG_INFO("[MicroBenchmarks]: %u worker(s): %.0f jobs/s", activeThreadCount, jobsPerSecond);
+
+			if (activeThreadCount == threadCount)
+			{
+				break;
+			}
+
+			activeThreadCount = std::min(activeThreadCount * 2u, threadCount);
+		}
+
+		ThreadPool::SetActiveThreadCount(threadCount);
+	}
+
+	void MicroBenchmarks::RunECSContainers(TArray<MicroBenchmarkResult>& results)
+	{
+		constexpr const uint32 ENTITY_COUNTS[]			= { 10000, 100000 };
+		constexpr const uint32 COMPONENT_TYPE_COUNT		= 32;
+		constexpr const uint32 SUBSCRIPTION_TYPE_COUNT	= 4;
+
+		// Prevents the compiler from removing the measured lookups
+		uint64 checksum = 0;
+
+		auto report = [&results](const String& name, uint32 entityCount, const Clock& clock)
+		{
+			const float64 nsPerOp = clock.GetDeltaTime().AsSeconds() * 1e9 / float64(entityCount);
+			results.PushBack({ name + "_" + std::to_string(entityCount), nsPerOp });
+			LOG_INFO("[MicroBenchmarks]: %s, %u entities: %.2f ns/op", name.c_str(), entityCount, nsPerOp);
+		};
+
+		for (uint32 entityCount : ENTITY_COUNTS)
+		{
+			Clock clock;
+
+			// Entity to index lookups, as done by IDVector and ComponentArray
+			{
+				THashTable<uint32, uint32> hashTable;
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					hashTable[entity] = entity;
+				}
+				clock.Tick();
+				report("ECSEntityInsertNs_HashTable", entityCount, clock);
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					checksum += hashTable.find(entity)->second;
+				}
+				clock.Tick();
+				report("ECSEntityLookupNs_HashTable", entityCount, clock);
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					hashTable.erase(entity);
+				}
+				clock.Tick();
+				report("ECSEntityEraseNs_HashTable", entityCount, clock);
+			}
+
+			{
+				SparseIndexMap sparseMap;
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					sparseMap.Set(entity, entity);
+				}
+				clock.Tick();
+				report("ECSEntityInsertNs_SparseIndexMap", entityCount, clock);
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					checksum += sparseMap.Find(entity);
+				}
+				clock.Tick();
+				report("ECSEntityLookupNs_SparseIndexMap", entityCount, clock);
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					sparseMap.Erase(entity);
+				}
+				clock.Tick();
+				report("ECSEntityEraseNs_SparseIndexMap", entityCount, clock);
+			}
+
+			// Subscription checks, as done by the entity publisher whenever a component is added
+			{
+				const uint32 subscriptionTypes[SUBSCRIPTION_TYPE_COUNT] = { 1, 5, 9, 13 };
+
+				TArray<std::unordered_set<const void*>> typeSets(entityCount);
+				TArray<ComponentMask> typeMasks(entityCount);
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					for (uint32 typeIdx = 0; typeIdx < COMPONENT_TYPE_COUNT; typeIdx++)
+					{
+						if (((entity * 2654435761u) >> typeIdx) & 1u)
+						{
+							typeSets[entity].insert(reinterpret_cast<const void*>(uintptr_t(typeIdx + 1)));
+							typeMasks[entity].Set(typeIdx);
+						}
+					}
+				}
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					bool hasAllTypes = true;
+					for (uint32 typeIdx : subscriptionTypes)
+					{
+						hasAllTypes &= typeSets[entity].contains(reinterpret_cast<const void*>(uintptr_t(typeIdx + 1)));
+					}
+
+					checksum += hasAllTypes;
+				}
+				clock.Tick();
+				report("ECSSubscriptionCheckNs_TypeSet", entityCount, clock);
+
+				ComponentMask subscriptionMask;
+				for (uint32 typeIdx : subscriptionTypes)
+				{
+					subscriptionMask.Set(typeIdx);
+				}
+
+				clock.Reset();
+				for (uint32 entity = 0; entity < entityCount; entity++)
+				{
+					checksum += typeMasks[entity].ContainsAll(subscriptionMask);
+				}
+				clock.Tick();
+				report("ECSSubscriptionCheckNs_ComponentMask", entityCount, clock);
+			}
+		}
+
+		LOG_INFO("[MicroBenchmarks]: ECS container checksum: %llu", checksum);
+	}
+
+	void MicroBenchmarks::RunECSChunkIteration(TArray<MicroBenchmarkResult>& results)
+	{
+		constexpr const uint32 ENTITY_COUNT = 100000;
+
+		ComponentStorage componentStorage;
+		componentStorage.EnableArchetypeStorage();
+		ComponentArray<ChunkTestPositionComponent>* pPositionComponents	= componentStorage.RegisterComponentType<ChunkTestPositionComponent>();
+		ComponentArray<ChunkTestVelocityComponent>* pVelocityComponents	= componentStorage.RegisterComponentType<ChunkTestVelocityComponent>();
+		ComponentArray<ChunkTestExcludedComponent>* pExcludedComponents	= componentStorage.RegisterComponentType<ChunkTestExcludedComponent>();
+
+		// Spread the entities over several archetypes, and move some of them to another archetype afterwards
+		for (Entity entity = 0; entity < ENTITY_COUNT; entity++)
+		{
+			ChunkTestPositionComponent positionComponent;
+			positionComponent.Value = float32(entity);
+			componentStorage.AddComponent(entity, positionComponent);
+			componentStorage.CommitComponent(entity, ChunkTestPositionComponent::Type());
+
+			if (entity % 3 != 0)
+			{
+				componentStorage.AddComponent(entity, ChunkTestVelocityComponent{ float32(entity % 7 + 1) });
+				componentStorage.CommitComponent(entity, ChunkTestVelocityComponent::Type());
+			}
+
+			if (entity % 5 == 0)
+			{
+				componentStorage.AddComponent(entity, ChunkTestExcludedComponent{ entity });
+				componentStorage.CommitComponent(entity, ChunkTestExcludedComponent::Type());
+			}
+		}
+
+		for (Entity entity = 0; entity < ENTITY_COUNT; entity += 4)
+		{
+			if (pVelocityComponents->HasComponent(entity))
+			{
+				componentStorage.DeleteComponent(entity, ChunkTestVelocityComponent::Type());
+			}
+		}
+
+		// The entities a subscription to position and velocity excluding the excluded type would hold
+		TArray<Entity> subscribedEntities;
+		for (Entity entity = 0; entity < ENTITY_COUNT; entity++)
+		{
+			if (pVelocityComponents->HasComponent(entity) && !pExcludedComponents->HasComponent(entity))
+			{
+				subscribedEntities.PushBack(entity);
+			}
+		}
+
+		ArchetypeStorage* pArchetypeStorage = componentStorage.GetArchetypeStorage();
+		const TArray<const ComponentType*> excludedTypes = { ChunkTestExcludedComponent::Type() };
+
+		// Writes through the chunks, then checks every entity's components through per-entity lookups
+		componentStorage.ResetDirtyFlags();
+
+		uint32 visitedEntityCount = 0;
+		pArchetypeStorage->ForEachChunk<const ChunkTestVelocityComponent, ChunkTestPositionComponent>(excludedTypes,
+			[&visitedEntityCount](uint32 entityCount, const Entity* pEntities, const ChunkTestVelocityComponent* pVelocities, ChunkTestPositionComponent* pPositions)
+		{
+			for (uint32 entityIdx = 0; entityIdx < entityCount; entityIdx++)
+			{
+				pPositions[entityIdx].Value += pVelocities[entityIdx].Value * float32(pEntities[entityIdx] % 2 + 1);
+			}
+
+			visitedEntityCount += entityCount;
+		});
+
+		uint32 mismatchCount = visitedEntityCount > subscribedEntities.GetSize() ? visitedEntityCount - subscribedEntities.GetSize() : subscribedEntities.GetSize() - visitedEntityCount;
+		uint32 subscribedEntityIdx = 0;
+		for (Entity entity = 0; entity < ENTITY_COUNT; entity++)
+		{
+			const bool isSubscribed = subscribedEntityIdx < subscribedEntities.GetSize() && subscribedEntities[subscribedEntityIdx] == entity;
+			float32 expectedPosition = float32(entity);
+			if (isSubscribed)
+			{
+				expectedPosition += pVelocityComponents->GetConstData(entity).Value * float32(entity % 2 + 1);
+				subscribedEntityIdx++;
+			}
+
+			const ChunkTestPositionComponent& positionComponent = pPositionComponents->GetConstData(entity);
+			if (positionComponent.Value != expectedPosition || positionComponent.Dirty != isSubscribed)
+			{
+				mismatchCount++;
+			}
+		}
+
+		results.PushBack({ "ECSChunkIterationMismatches", float64(mismatchCount) });
+		if (mismatchCount > 0)
+		{
+			LOG_ERROR("[MicroBenchmarks]: Chunk iteration visited %u entities, %u mismatches against per-entity iteration", visitedEntityCount, mismatchCount);
+		}
+
+		ASSERT_MSG(mismatchCount == 0, "Chunk iteration does not match per-entity iteration");
+
+		// Read-only passes, as done by a system reading two component types
+		float64 checksum = 0.0;
+		Clock clock;
+
+		auto report = [&results](const String& name, const Clock& clock, uint32 entityCount)
+		{
+			const float64 nsPerEntity = clock.GetDeltaTime().AsSeconds() * 1e9 / float64(std::max(entityCount, 1u));
+			results.PushBack({ name, nsPerEntity });
+			LOG_INFO("[MicroBenchmarks]: %s, %u entities: %.2f ns/entity", name.c_str(), entityCount, nsPerEntity);
+		};
+
+		clock.Reset();
+		for (Entity entity : subscribedEntities)
+		{
+			checksum += pPositionComponents->GetConstData(entity).Value * pVelocityComponents->GetConstData(entity).Value;
+		}
+		clock.Tick();
+		report("ECSIterationNs_PerEntity", clock, subscribedEntities.GetSize());
+
+		clock.Reset();
+		pArchetypeStorage->ForEachChunk<const ChunkTestPositionComponent, const ChunkTestVelocityComponent>(excludedTypes,
+			[&checksum](uint32 entityCount, const Entity* pEntities, const ChunkTestPositionComponent* pPositions, const ChunkTestVelocityComponent* pVelocities)
+		{
+			UNREFERENCED_VARIABLE(pEntities);
+
+			for (uint32 entityIdx = 0; entityIdx < entityCount; entityIdx++)
+			{
+				checksum += pPositions[entityIdx].Value * pVelocities[entityIdx].Value;
+			}
+		});
+		clock.Tick();
+		report("ECSIterationNs_Chunks", clock, visitedEntityCount);
+
+		LOG_INFO("[MicroBenchmarks]: ECS iteration checksum: %.0f", checksum);
+	}
+
+	void MicroBenchmarks::RunAnimation(TArray<MicroBenchmarkResult>& results)
+	{
+		constexpr const uint32	FRAME_COUNT		= 60;
+		constexpr const float64	FRAME_TIME		= 1.0 / 60.0;
+		const uint32			characterCounts[] = { 9, 200 };
+
+		// The robot of BenchmarkState, which is loaded by the time the micro benchmarks run
+		GUID_Lambda meshGUID = GUID_NONE;
+		ResourceManager::LoadMeshFromFile("Robot/Standard Walk.fbx", meshGUID, false);
+		const TArray<GUID_Lambda> animationGUIDs = ResourceManager::LoadAnimationsFromFile("Robot/Standard Walk.fbx");
+
+		const Mesh* pMesh = ResourceManager::GetMesh(meshGUID);
+		if (pMesh == nullptr || pMesh->pSkeleton == nullptr || animationGUIDs.IsEmpty() || pMesh->VertexJointData.GetSize() != pMesh->Vertices.GetSize())
+		{
+			LOG_WARNING("[MicroBenchmarks]: Robot mesh or animation not found, skipping animation benchmark");
+			return;
+		}
+
+		const uint32 vertexCount = pMesh->Vertices.GetSize();
+		TArray<glm::vec4> skinnedPositions(vertexCount);
+		TArray<glm::vec4> skinnedNormals(vertexCount);
+
+		float64 checksum = 0.0;
+		Clock clock;
+
+		for (uint32 characterCount : characterCounts)
+		{
+			TArray<AnimationComponent> animations(characterCount);
+			for (uint32 characterIdx = 0; characterIdx < characterCount; characterIdx++)
+			{
+				AnimationComponent& animation = animations[characterIdx];
+				animation.Pose.pSkeleton	= pMesh->pSkeleton;
+				animation.pGraph			= DBG_NEW AnimationGraph(DBG_NEW AnimationState("Walk", animationGUIDs[0]));
+
+				// Characters start at different points of the clip, as they do in a match
+				AnimationSystem::Animate(animation, float64(characterIdx) * 0.37, UINT32_MAX, nullptr);
+			}
+
+			// Evaluation of the skeletons, as done by the animation jobs
+			clock.Reset();
+			for (uint32 frame = 0; frame < FRAME_COUNT; frame++)
+			{
+				for (AnimationComponent& animation : animations)
+				{
+					AnimationSystem::Animate(animation, FRAME_TIME, UINT32_MAX, nullptr);
+				}
+			}
+			clock.Tick();
+
+			const float64 animationNs = clock.GetDeltaTime().AsSeconds() * 1e9 / float64(FRAME_COUNT * characterCount);
+			results.PushBack({ "AnimationNs_PerCharacter_" + std::to_string(characterCount), animationNs });
+			LOG_INFO("[MicroBenchmarks]: Animation, %u characters: %.0f ns/character", characterCount, animationNs);
+
+			// Same evaluation with the pose cache shared by the characters, reset every frame as the system does
+			PoseCache poseCache;
+			clock.Reset();
+			for (uint32 frame = 0; frame < FRAME_COUNT; frame++)
+			{
+				poseCache.Reset(characterCount);
+				for (AnimationComponent& animation : animations)
+				{
+					AnimationSystem::Animate(animation, FRAME_TIME, UINT32_MAX, &poseCache);
+				}
+			}
+			clock.Tick();
+
+			const float64 poseCacheNs = clock.GetDeltaTime().AsSeconds() * 1e9 / float64(FRAME_COUNT * characterCount);
+			results.PushBack({ "AnimationNs_PerCharacter_" + std::to_string(characterCount) + "_PoseCache", poseCacheNs });
+			LOG_INFO("[MicroBenchmarks]: Animation with pose cache, %u characters: %.0f ns/character", characterCount, poseCacheNs);
+
+			// Every character at the farthest LOD, updated every fourth frame staggered by character without its deepest joints
+			clock.Reset();
+			for (uint32 frame = 0; frame < FRAME_COUNT; frame++)
+			{
+				for (uint32 characterIdx = 0; characterIdx < characterCount; characterIdx++)
+				{
+					if (((frame + characterIdx) & 3) == 0)
+					{
+						AnimationSystem::Animate(animations[characterIdx], FRAME_TIME * 4.0, ANIMATION_LOD2_MAX_JOINT_DEPTH, nullptr);
+					}
+				}
+			}
+			clock.Tick();
+
+			const float64 lodNs = clock.GetDeltaTime().AsSeconds() * 1e9 / float64(FRAME_COUNT * characterCount);
+			results.PushBack({ "AnimationNs_PerCharacter_" + std::to_string(characterCount) + "_LOD2", lodNs });
+			LOG_INFO("[MicroBenchmarks]: Animation at LOD 2, %u characters: %.0f ns/character", characterCount, lodNs);
+
+			// The poses are skinned at full detail below
+			for (AnimationComponent& animation : animations)
+			{
+				AnimationSystem::Animate(animation, FRAME_TIME, UINT32_MAX, nullptr);
+			}
+
+			// Skinning of every vertex with the evaluated poses, the same blend as Skinning.comp does on the GPU
+			clock.Reset();
+			for (const AnimationComponent& animation : animations)
+			{
+				const TArray<glm::mat4>& jointTransforms = animation.Pose.GlobalTransforms;
+				for (uint32 v = 0; v < vertexCount; v++)
+				{
+					// Vertices influenced by fewer than four joints have the remaining joints set to INVALID_JOINT_ID
+					const VertexJointData& jointData = pMesh->VertexJointData[v];
+					const JointIndexType jointIDs[]	= { jointData.JointID0, jointData.JointID1, jointData.JointID2, jointData.JointID3 };
+					const float32 weights[]			= { jointData.Weight0, jointData.Weight1, jointData.Weight2, 1.0f - (jointData.Weight0 + jointData.Weight1 + jointData.Weight2) };
+
+					glm::mat4 transform(0.0f);
+					for (uint32 j = 0; j < 4; j++)
+					{
+						if (jointIDs[j] != INVALID_JOINT_ID)
+						{
+							transform += jointTransforms[jointIDs[j]] * weights[j];
+						}
+					}
+
+					const Vertex& vertex = pMesh->Vertices[v];
+					skinnedPositions[v]	= transform * glm::vec4(vertex.ExtractPosition(), 1.0f);
+					skinnedNormals[v]	= transform * glm::vec4(vertex.ExtractNormal(), 0.0f);
+				}
+
+				checksum += skinnedPositions[vertexCount / 2].y + skinnedNormals[vertexCount / 2].y;
+			}
+			clock.Tick();
+
+			const float64 skinningNs = clock.GetDeltaTime().AsSeconds() * 1e9 / float64(characterCount * vertexCount);
+			results.PushBack({ "SkinningNs_PerVertex_" + std::to_string(characterCount), skinningNs });
+			LOG_INFO("[MicroBenchmarks]: CPU skinning, %u characters of %u vertices: %.2f ns/vertex", characterCount, vertexCount, skinningNs);
+
+			for (AnimationComponent& animation : animations)
+			{
+				SAFEDELETE(animation.pGraph);
+			}
+		}
+
+		LOG_INFO("[MicroBenchmarks]: Animation checksum: %.3f", checksum);
+	}
+
+	void MicroBenchmarks::RunPacketManagerLoopback(TArray<MicroBenchmarkResult>& results)
+	{
+		constexpr const uint32 CLIENT_COUNT					= 64;
+		constexpr const uint32 TICK_COUNT					= 600;
+		constexpr const uint32 SNAPSHOT_SEGMENTS_PER_TICK	= 8;
+		constexpr const uint16 SNAPSHOT_SEGMENT_SIZE		= 96;
+		constexpr const uint32 EVENT_SEGMENTS_PER_TICK		= 2;
+		constexpr const uint16 EVENT_SEGMENT_SIZE			= 32;
+		constexpr const uint16 INPUT_SEGMENT_SIZE			= 24;
+		constexpr const uint16 SEGMENT_TYPE					= 1;
+
+		PacketManagerDesc desc;
+		desc.PoolSize = 1024;
+
+		TArray<LoopbackEndPoint*> serverEndPoints;
+		TArray<LoopbackEndPoint*> clientEndPoints;
+		for (uint32 clientNr = 0; clientNr < CLIENT_COUNT; clientNr++)
+		{
+			LoopbackEndPoint* pServerEndPoint = DBG_NEW LoopbackEndPoint(desc);
+			LoopbackEndPoint* pClientEndPoint = DBG_NEW LoopbackEndPoint(desc);
+			pServerEndPoint->Transceiver.SetPeer(&pClientEndPoint->Transceiver);
+			pClientEndPoint->Transceiver.SetPeer(&pServerEndPoint->Transceiver);
+			serverEndPoints.PushBack(pServerEndPoint);
+			clientEndPoints.PushBack(pClientEndPoint);
+		}
+
+		const Timestamp tickDelta = Timestamp::MilliSeconds(1000.0 / 60.0);
+		Timestamp serverTime = 0;
+		uint64 segmentsReceived = 0;
+
+		for (uint32 tickNr = 0; tickNr < TICK_COUNT; tickNr++)
+		{
+			Clock clock;
+			clock.Reset();
+
+			// What the server does every tick: receive input, send snapshots and events, handle resends
+			for (LoopbackEndPoint* pServerEndPoint : serverEndPoints)
+			{
+				segmentsReceived += pServerEndPoint->Receive();
+				pServerEndPoint->Send(SEGMENT_TYPE, SNAPSHOT_SEGMENTS_PER_TICK, SNAPSHOT_SEGMENT_SIZE, false);
+				pServerEndPoint->Send(SEGMENT_TYPE, EVENT_SEGMENTS_PER_TICK, EVENT_SEGMENT_SIZE, true);
+				pServerEndPoint->PacketManager.Flush(&pServerEndPoint->Transceiver);
+				pServerEndPoint->PacketManager.Tick(tickDelta);
+			}
+
+			clock.Tick();
+			serverTime += clock.GetDeltaTime();
+
+			for (LoopbackEndPoint* pClientEndPoint : clientEndPoints)
+			{
+				segmentsReceived += pClientEndPoint->Receive();
+				pClientEndPoint->Send(SEGMENT_TYPE, 1, INPUT_SEGMENT_SIZE, false);
+				pClientEndPoint->PacketManager.Flush(&pClientEndPoint->Transceiver);
+				pClientEndPoint->PacketManager.Tick(tickDelta);
+			}
+		}
+
+		uint32 droppedPackets = 0;
+		for (uint32 clientNr = 0; clientNr < CLIENT_COUNT; clientNr++)
+		{
+			droppedPackets += serverEndPoints[clientNr]->Transceiver.GetDroppedPackets() + clientEndPoints[clientNr]->Transceiver.GetDroppedPackets();
+			SAFEDELETE(serverEndPoints[clientNr]);
+			SAFEDELETE(clientEndPoints[clientNr]);
+		}
+
+		const float64 serverMsPerTick = serverTime.AsMilliSeconds() / float64(TICK_COUNT);
+		results.PushBack({ "PacketManagerServerTickMs_" + std::to_string(CLIENT_COUNT) + "Clients", serverMsPerTick });
+		LOG_INFO("[MicroBenchmarks]: Packet manager loopback, %u clients: %.3f ms/tick on the server, %llu segments received, %u packets dropped",
+			CLIENT_COUNT, serverMsPerTick, segmentsReceived, droppedPackets);
+	}
+
+	void MicroBenchmarks::RunSocketLoopback(TArray<MicroBenchmarkResult>& results)
+	{
+		constexpr const uint32 CLIENT_COUNT		= 64;
+		constexpr const uint32 TICK_COUNT		= 600;
+		constexpr const uint32 DATAGRAM_SIZE	= 512;
+
+		ISocketUDP* pSender		= PlatformNetworkUtils::CreateSocketUDP();
+		ISocketUDP* pReceiver	= PlatformNetworkUtils::CreateSocketUDP();
+		if (!pSender->Bind(IPEndPoint(IPAddress::LOOPBACK, 0)) || !pReceiver->Bind(IPEndPoint(IPAddress::LOOPBACK, 0)) || !pReceiver->EnableBlocking(false))
+		{
+			LOG_WARNING("[MicroBenchmarks]: Socket loopback skipped, could not bind to the loopback address");
+			SAFEDELETE(pSender);
+			SAFEDELETE(pReceiver);
+			return;
+		}
+
+		static uint8 s_SendBuffer[DATAGRAM_SIZE]				= {};
+		static uint8 s_ReceiveBuffers[CLIENT_COUNT][DATAGRAM_SIZE]	= {};
+
+		// Every client is the same socket here, it is the number of datagrams per tick that matters
+		UDPDatagram sendDatagrams[CLIENT_COUNT];
+		UDPDatagram receiveDatagrams[CLIENT_COUNT];
+		for (uint32 clientNr = 0; clientNr < CLIENT_COUNT; clientNr++)
+		{
+			sendDatagrams[clientNr].pBuffer			= s_SendBuffer;
+			sendDatagrams[clientNr].BufferSize		= DATAGRAM_SIZE;
+			sendDatagrams[clientNr].EndPoint		= pReceiver->GetEndPoint();
+			receiveDatagrams[clientNr].pBuffer		= s_ReceiveBuffers[clientNr];
+			receiveDatagrams[clientNr].BufferSize	= DATAGRAM_SIZE;
+		}
+
+		// Empties the receiver between ticks so its socket buffer never fills up
+		uint64 datagramsReceived = 0;
+		auto drainReceiver = [&]()
+		{
+			uint32 received = 0;
+			do
+			{
+				pReceiver->ReceiveFromBatch(receiveDatagrams, CLIENT_COUNT, received);
+				datagramsReceived += received;
+			} while (received > 0);
+		};
+
+		Timestamp sendToTime		= 0;
+		Timestamp sendToBatchTime	= 0;
+		for (uint32 tickNr = 0; tickNr < TICK_COUNT; tickNr++)
+		{
+			Clock clock;
+			clock.Reset();
+
+			for (UDPDatagram& datagram : sendDatagrams)
+			{
+				pSender->SendTo(datagram.pBuffer, datagram.BufferSize, datagram.Bytes, datagram.EndPoint);
+			}
+
+			clock.Tick();
+			sendToTime += clock.GetDeltaTime();
+			drainReceiver();
+
+			clock.Reset();
+
+			uint32 sent = 0;
+			pSender->SendToBatch(sendDatagrams, CLIENT_COUNT, sent);
+
+			clock.Tick();
+			sendToBatchTime += clock.GetDeltaTime();
+			drainReceiver();
+		}
+
+		SAFEDELETE(pSender);
+		SAFEDELETE(pReceiver);
+
+		const float64 datagramCount		= float64(TICK_COUNT * CLIENT_COUNT);
+		const float64 sendToUs			= sendToTime.AsMicroSeconds() / datagramCount;
+		const float64 sendToBatchUs		= sendToBatchTime.AsMicroSeconds() / datagramCount;
+		results.PushBack({ "SocketSendToUs", sendToUs });
+		results.PushBack({ "SocketSendToBatchUs", sendToBatchUs });
+		LOG_INFO("[MicroBenchmarks]: Socket loopback, %u datagrams per tick: SendTo %.3f us/datagram, SendToBatch %.3f us/datagram, %llu of %.0f datagrams received",
+			CLIENT_COUNT, sendToUs, sendToBatchUs, datagramsReceived, datagramCount * 2.0);
+	}
+}
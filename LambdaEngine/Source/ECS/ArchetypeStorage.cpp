@@ -0,0 +1,328 @@
+#include "ECS/ArchetypeStorage.h"
+
+#include "ECS/ComponentArray.h"
+#include "Math/MathUtilities.h"
+
+#include <algorithm>
+
+namespace LambdaEngine
+{
+	ArchetypeStorage::~ArchetypeStorage()
+	{
+		VALIDATE_MSG(m_Archetypes.IsEmpty(), "ArchetypeStorage was not released before being deleted!");
+	}
+
+	void ArchetypeStorage::Release()
+	{
+		for (Archetype& archetype : m_Archetypes)
+		{
+			for (ArchetypeChunk& chunk : archetype.Chunks)
+			{
+				const Entity* pEntities = reinterpret_cast<const Entity*>(chunk.pData);
+				for (const ArchetypeColumn& column : archetype.Columns)
+				{
+					for (uint32 row = 0; row < chunk.EntityCount; row++)
+					{
+						column.pComponentArray->DestroyComponent(chunk.pData + column.Offset + row * column.ComponentSize, pEntities[row]);
+					}
+				}
+
+				SAFEDELETE_ARRAY(chunk.pAllocation);
+			}
+		}
+
+		m_Archetypes.Clear();
+		m_EntityLocations.Clear();
+	}
+
+	void ArchetypeStorage::CommitComponent(Entity entity, IComponentArray* pComponentArray)
+	{
+		if (entity >= m_EntityLocations.GetSize())
+		{
+			m_EntityLocations.Resize(entity + 1u);
+		}
+
+		const EntityLocation oldLocation = m_EntityLocations[entity];
+		const uint32 archetypeIndex = FindArchetypeWithType(oldLocation.ArchetypeIndex, pComponentArray);
+		const EntityLocation newLocation = AllocateRow(archetypeIndex, entity);
+
+		if (oldLocation.ArchetypeIndex != UINT32_MAX)
+		{
+			MoveRow(oldLocation, newLocation);
+			FreeRow(oldLocation);
+		}
+
+		const Archetype& archetype = m_Archetypes[archetypeIndex];
+		for (uint32 columnIdx = 0; columnIdx < archetype.Columns.GetSize(); columnIdx++)
+		{
+			if (archetype.Columns[columnIdx].pComponentArray == pComponentArray)
+			{
+				pComponentArray->MoveStagedComponent(entity, GetComponent(newLocation, columnIdx));
+				break;
+			}
+		}
+
+		m_EntityLocations[entity] = newLocation;
+	}
+
+	void ArchetypeStorage::RemoveComponent(Entity entity, const ComponentType* pComponentType)
+	{
+		const EntityLocation* pOldLocation = GetEntityLocation(entity);
+		VALIDATE_MSG(pOldLocation, "Trying to remove a component from an entity without committed components!");
+
+		const EntityLocation oldLocation = *pOldLocation;
+		const Archetype& oldArchetype = m_Archetypes[oldLocation.ArchetypeIndex];
+		for (uint32 columnIdx = 0; columnIdx < oldArchetype.Columns.GetSize(); columnIdx++)
+		{
+			const ArchetypeColumn& column = oldArchetype.Columns[columnIdx];
+			if (column.pComponentType == pComponentType)
+			{
+				column.pComponentArray->DestroyComponent(GetComponent(oldLocation, columnIdx), entity);
+				break;
+			}
+		}
+
+		EntityLocation newLocation;
+		const uint32 archetypeIndex = FindArchetypeWithoutType(oldLocation.ArchetypeIndex, pComponentType);
+		if (archetypeIndex != UINT32_MAX)
+		{
+			newLocation = AllocateRow(archetypeIndex, entity);
+			MoveRow(oldLocation, newLocation);
+		}
+
+		FreeRow(oldLocation);
+		m_EntityLocations[entity] = newLocation;
+	}
+
+	uint32 ArchetypeStorage::FindArchetypeWithType(uint32 archetypeIndex, IComponentArray* pComponentArray)
+	{
+		const ComponentType* pComponentType = pComponentArray->GetComponentType();
+		TArray<ArchetypeColumn> columns;
+
+		if (archetypeIndex != UINT32_MAX)
+		{
+			const Archetype& archetype = m_Archetypes[archetypeIndex];
+			auto edgeItr = archetype.AddEdges.find(pComponentType);
+			if (edgeItr != archetype.AddEdges.end())
+			{
+				return edgeItr->second;
+			}
+
+			columns = archetype.Columns;
+		}
+
+		columns.PushBack({ pComponentType, pComponentArray, pComponentArray->GetComponentSize(), 0u });
+		const uint32 newArchetypeIndex = FindOrCreateArchetype(columns);
+
+		if (archetypeIndex != UINT32_MAX)
+		{
+			m_Archetypes[archetypeIndex].AddEdges[pComponentType] = newArchetypeIndex;
+			m_Archetypes[newArchetypeIndex].RemoveEdges[pComponentType] = archetypeIndex;
+		}
+
+		return newArchetypeIndex;
+	}
+
+	uint32 ArchetypeStorage::FindArchetypeWithoutType(uint32 archetypeIndex, const ComponentType* pComponentType)
+	{
+		const Archetype& archetype = m_Archetypes[archetypeIndex];
+		if (archetype.Columns.GetSize() == 1u)
+		{
+			return UINT32_MAX;
+		}
+
+		auto edgeItr = archetype.RemoveEdges.find(pComponentType);
+		if (edgeItr != archetype.RemoveEdges.end())
+		{
+			return edgeItr->second;
+		}
+
+		TArray<ArchetypeColumn> columns;
+		columns.Reserve(archetype.Columns.GetSize() - 1u);
+		for (const ArchetypeColumn& column : archetype.Columns)
+		{
+			if (column.pComponentType != pComponentType)
+			{
+				columns.PushBack(column);
+			}
+		}
+
+		const uint32 newArchetypeIndex = FindOrCreateArchetype(columns);
+		m_Archetypes[archetypeIndex].RemoveEdges[pComponentType] = newArchetypeIndex;
+		m_Archetypes[newArchetypeIndex].AddEdges[pComponentType] = archetypeIndex;
+
+		return newArchetypeIndex;
+	}
+
+	uint32 ArchetypeStorage::FindOrCreateArchetype(TArray<ArchetypeColumn>& columns)
+	{
+		std::sort(columns.GetData(), columns.GetData() + columns.GetSize(), [](const ArchetypeColumn& columnA, const ArchetypeColumn& columnB)
+		{
+			return columnA.pComponentType < columnB.pComponentType;
+		});
+
+		// The edges of an archetype are only cached once they have been traversed, the archetype might still exist
+		for (uint32 archetypeIdx = 0; archetypeIdx < m_Archetypes.GetSize(); archetypeIdx++)
+		{
+			const TArray<ArchetypeColumn>& existingColumns = m_Archetypes[archetypeIdx].Columns;
+			const bool isSameSet = existingColumns.GetSize() == columns.GetSize() && std::equal(columns.GetData(), columns.GetData() + columns.GetSize(), existingColumns.GetData(),
+				[](const ArchetypeColumn& columnA, const ArchetypeColumn& columnB)
+				{
+					return columnA.pComponentType == columnB.pComponentType;
+				});
+
+			if (isSameSet)
+			{
+				return archetypeIdx;
+			}
+		}
+
+		// Fit as many rows as possible into a chunk, each column has to be padded to the column alignment
+		uint32 rowSize = sizeof(Entity);
+		for (const ArchetypeColumn& column : columns)
+		{
+			rowSize += column.ComponentSize;
+		}
+
+		const uint32 paddingSize = (columns.GetSize() + 1u) * ARCHETYPE_COLUMN_ALIGNMENT;
+		const uint32 chunkSize = std::max(ARCHETYPE_CHUNK_SIZE, rowSize + paddingSize);
+		const uint32 chunkCapacity = (chunkSize - paddingSize) / rowSize;
+
+		uint32 offset = (uint32)AlignUp(chunkCapacity * sizeof(Entity), ARCHETYPE_COLUMN_ALIGNMENT);
+		for (ArchetypeColumn& column : columns)
+		{
+			column.Offset = offset;
+			offset = (uint32)AlignUp(offset + chunkCapacity * column.ComponentSize, ARCHETYPE_COLUMN_ALIGNMENT);
+		}
+
+		const uint32 archetypeIndex = m_Archetypes.GetSize();
+		Archetype& archetype = m_Archetypes.PushBack({});
+		archetype.Columns		= columns;
+		archetype.ChunkCapacity	= chunkCapacity;
+		archetype.ChunkSize		= offset;
+
+		for (uint32 columnIdx = 0; columnIdx < columns.GetSize(); columnIdx++)
+		{
+			VALIDATE_MSG(columns[columnIdx].pComponentArray->GetComponentAlignment() <= ARCHETYPE_COLUMN_ALIGNMENT, "Component type has a too strict alignment for archetype storage!");
+			columns[columnIdx].pComponentArray->SetArchetypeColumn(archetypeIndex, columnIdx);
+		}
+
+		return archetypeIndex;
+	}
+
+	EntityLocation ArchetypeStorage::AllocateRow(uint32 archetypeIndex, Entity entity)
+	{
+		Archetype& archetype = m_Archetypes[archetypeIndex];
+		if (archetype.Chunks.IsEmpty() || archetype.Chunks.GetBack().EntityCount == archetype.ChunkCapacity)
+		{
+			ArchetypeChunk& chunk = archetype.Chunks.PushBack({});
+			chunk.pAllocation	= DBG_NEW byte[archetype.ChunkSize + ARCHETYPE_COLUMN_ALIGNMENT];
+			chunk.pData			= reinterpret_cast<byte*>(AlignUp(reinterpret_cast<uint64>(chunk.pAllocation), ARCHETYPE_COLUMN_ALIGNMENT));
+			chunk.EntityCount	= 0;
+		}
+
+		const uint32 chunkIndex = archetype.Chunks.GetSize() - 1u;
+		ArchetypeChunk& chunk = archetype.Chunks[chunkIndex];
+		const uint32 row = chunk.EntityCount;
+
+		reinterpret_cast<Entity*>(chunk.pData)[row] = entity;
+		chunk.EntityCount++;
+		archetype.EntityCount++;
+
+		return { archetypeIndex, chunkIndex, row };
+	}
+
+	void ArchetypeStorage::FreeRow(const EntityLocation& location)
+	{
+		Archetype& archetype = m_Archetypes[location.ArchetypeIndex];
+		const uint32 lastChunkIndex = archetype.Chunks.GetSize() - 1u;
+		ArchetypeChunk& lastChunk = archetype.Chunks[lastChunkIndex];
+		const uint32 lastRow = lastChunk.EntityCount - 1u;
+
+		if (location.ChunkIndex != lastChunkIndex || location.Row != lastRow)
+		{
+			const EntityLocation lastLocation = { location.ArchetypeIndex, lastChunkIndex, lastRow };
+			for (uint32 columnIdx = 0; columnIdx < archetype.Columns.GetSize(); columnIdx++)
+			{
+				archetype.Columns[columnIdx].pComponentArray->MoveComponent(GetComponent(location, columnIdx), GetComponent(lastLocation, columnIdx));
+			}
+
+			const Entity movedEntity = reinterpret_cast<const Entity*>(lastChunk.pData)[lastRow];
+			reinterpret_cast<Entity*>(archetype.Chunks[location.ChunkIndex].pData)[location.Row] = movedEntity;
+			m_EntityLocations[movedEntity] = location;
+		}
+
+		lastChunk.EntityCount--;
+		archetype.EntityCount--;
+
+		if (lastChunk.EntityCount == 0)
+		{
+			SAFEDELETE_ARRAY(lastChunk.pAllocation);
+			archetype.Chunks.PopBack();
+		}
+	}
+
+	void ArchetypeStorage::MoveRow(const EntityLocation& source, const EntityLocation& destination)
+	{
+		const TArray<ArchetypeColumn>& sourceColumns = m_Archetypes[source.ArchetypeIndex].Columns;
+		const TArray<ArchetypeColumn>& destinationColumns = m_Archetypes[destination.ArchetypeIndex].Columns;
+
+		// Both column arrays are sorted by component type
+		uint32 sourceColumnIdx = 0;
+		uint32 destinationColumnIdx = 0;
+		while (sourceColumnIdx < sourceColumns.GetSize() && destinationColumnIdx < destinationColumns.GetSize())
+		{
+			const ComponentType* pSourceType = sourceColumns[sourceColumnIdx].pComponentType;
+			const ComponentType* pDestinationType = destinationColumns[destinationColumnIdx].pComponentType;
+
+			if (pSourceType == pDestinationType)
+			{
+				sourceColumns[sourceColumnIdx].pComponentArray->MoveComponent(GetComponent(destination, destinationColumnIdx), GetComponent(source, sourceColumnIdx));
+				sourceColumnIdx++;
+				destinationColumnIdx++;
+			}
+			else if (pSourceType < pDestinationType)
+			{
+				sourceColumnIdx++;
+			}
+			else
+			{
+				destinationColumnIdx++;
+			}
+		}
+	}
+
+	bool ArchetypeStorage::FindColumns(const Archetype& archetype, const ComponentType* const* ppComponentTypes, uint32 componentTypeCount, const TArray<const ComponentType*>& excludedTypes, uint32* pColumnIndices)
+	{
+		const TArray<ArchetypeColumn>& columns = archetype.Columns;
+		for (uint32 typeIdx = 0; typeIdx < componentTypeCount; typeIdx++)
+		{
+			const ComponentType* pComponentType = ppComponentTypes[typeIdx];
+			const ArchetypeColumn* pColumnsEnd = columns.GetData() + columns.GetSize();
+			const ArchetypeColumn* pColumn = std::lower_bound(columns.GetData(), pColumnsEnd, pComponentType, [](const ArchetypeColumn& column, const ComponentType* pType)
+			{
+				return column.pComponentType < pType;
+			});
+
+			if (pColumn == pColumnsEnd || pColumn->pComponentType != pComponentType)
+			{
+				return false;
+			}
+
+			pColumnIndices[typeIdx] = uint32(pColumn - columns.GetData());
+		}
+
+		for (const ComponentType* pExcludedType : excludedTypes)
+		{
+			for (const ArchetypeColumn& column : columns)
+			{
+				if (column.pComponentType == pExcludedType)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
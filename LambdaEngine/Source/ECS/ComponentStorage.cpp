@@ -4,6 +4,13 @@ namespace LambdaEngine
 {
 	ComponentStorage::~ComponentStorage()
 	{
+		// Committed components are destroyed through their component arrays
+		if (m_pArchetypeStorage)
+		{
+			m_pArchetypeStorage->Release();
+			SAFEDELETE(m_pArchetypeStorage);
+		}
+
 		for (IComponentArray* pCompArr : m_ComponentArrays)
 			delete pCompArr;
 
@@ -11,6 +18,15 @@ namespace LambdaEngine
 		m_ComponentArraysWithDirtyFlags.Clear();
 	}
 
+	void ComponentStorage::EnableArchetypeStorage()
+	{
+		VALIDATE_MSG(m_ComponentArrays.IsEmpty(), "Archetype storage has to be enabled before any component type is registered!");
+		if (!m_pArchetypeStorage)
+		{
+			m_pArchetypeStorage = DBG_NEW ArchetypeStorage();
+		}
+	}
+
 	void ComponentStorage::UnsetComponentOwner(const ComponentType* pComponentType)
 	{
 		IComponentArray* pCompArray = GetComponentArray(pComponentType);
@@ -32,6 +48,14 @@ namespace LambdaEngine
 		}
 	}
 
+	void ComponentStorage::CommitComponent(Entity entity, const ComponentType* pComponentType)
+	{
+		if (m_pArchetypeStorage)
+		{
+			m_pArchetypeStorage->CommitComponent(entity, GetComponentArray(pComponentType));
+		}
+	}
+
 	uint32 ComponentStorage::SerializeComponent(Entity entity, const ComponentType* pComponentType, uint8* pBuffer, uint32 bufferSize) const
 	{
 		const IComponentArray* pComponentArray = GetComponentArray(pComponentType);
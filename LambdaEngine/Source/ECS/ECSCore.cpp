@@ -65,14 +65,15 @@ namespace LambdaEngine
 	{
 		const EntityRegistryPage& page = m_EntityRegistry.GetTopRegistryPage();
 
-		const auto& entityComponentSets = page.GetVec();
+		const auto& entityComponentMasks = page.GetVec();
 		const TArray<Entity>& entities = page.GetIDs();
+		TArray<const ComponentType*> componentTypes;
 
 		for (uint32 entityIdx = 0; entityIdx < entities.GetSize(); entityIdx++)
 		{
-			const std::unordered_set<const ComponentType*>& typeSet = entityComponentSets[entityIdx];
+			m_EntityRegistry.GetComponentTypes(entityComponentMasks[entityIdx], componentTypes);
 
-			for (const ComponentType* pComponentType : typeSet)
+			for (const ComponentType* pComponentType : componentTypes)
 			{
 				// Deregister entity's components from systems
 				m_EntityPublisher.UnpublishComponent(entities[entityIdx], pComponentType);
@@ -83,7 +84,7 @@ namespace LambdaEngine
 	void ECSCore::DeleteTopRegistryPage()
 	{
 		const EntityRegistryPage& page = m_EntityRegistry.GetTopRegistryPage();
-		const auto& entityComponentSets = page.GetVec();
+		const auto& entityComponentMasks = page.GetVec();
 		const TArray<Entity>& entities = page.GetIDs();
 		TArray<const ComponentType*> componentTypes;
 
@@ -91,8 +92,7 @@ namespace LambdaEngine
 		for (uint32 entityNr = 0; entityNr < entityCount; entityNr++)
 		{
 			Entity entity = entities[entityNr];
-			const std::unordered_set<const ComponentType*>& typeSet = entityComponentSets[entityNr];
-			componentTypes.Assign(typeSet.begin(), typeSet.end());
+			m_EntityRegistry.GetComponentTypes(entityComponentMasks[entityNr], componentTypes);
 
 			for (const ComponentType* pComponentType : componentTypes)
 				m_EntityRegistry.DeregisterComponentType(entity, pComponentType);
@@ -111,14 +111,15 @@ namespace LambdaEngine
 	{
 		const EntityRegistryPage& page = m_EntityRegistry.GetTopRegistryPage();
 
-		const auto& entityComponentSets = page.GetVec();
+		const auto& entityComponentMasks = page.GetVec();
 		const TArray<Entity>& entities = page.GetIDs();
+		TArray<const ComponentType*> componentTypes;
 
 		for (uint32 entityIdx = 0; entityIdx < entities.GetSize(); entityIdx++)
 		{
-			const std::unordered_set<const ComponentType*>& typeSet = entityComponentSets[entityIdx];
+			m_EntityRegistry.GetComponentTypes(entityComponentMasks[entityIdx], componentTypes);
 
-			for (const ComponentType* pComponentType : typeSet)
+			for (const ComponentType* pComponentType : componentTypes)
 				m_EntityPublisher.PublishComponent(entities[entityIdx], pComponentType);
 		}
 	}
@@ -231,6 +232,7 @@ namespace LambdaEngine
 		// Register all components first, then publish them
 		for (const std::pair<Entity, const ComponentType*>& component : m_ComponentsToRegister)
 		{
+			m_ComponentStorage.CommitComponent(component.first, component.second);
 			m_EntityRegistry.RegisterComponentType(component.first, component.second);
 		}
 
@@ -250,8 +252,8 @@ namespace LambdaEngine
 			if (DeleteComponent(component.first, component.second))
 			{
 				// If the entity has no more components, delete it
-				const std::unordered_set<const ComponentType*>& componentTypes = m_EntityRegistry.GetTopRegistryPage().IndexID(component.first);
-				if (componentTypes.empty())
+				const ComponentMask& componentTypes = m_EntityRegistry.GetTopRegistryPage().IndexID(component.first);
+				if (componentTypes.IsEmpty())
 					m_EntityRegistry.DeregisterEntity(component.first);
 			}
 		}
@@ -272,8 +274,7 @@ namespace LambdaEngine
 			if (registryPage.HasElement(entity))
 			{
 				// Delete every component belonging to the entity
-				const std::unordered_set<const ComponentType*>& componentTypesSet = registryPage.IndexID(entity);
-				componentTypes.Assign(componentTypesSet.begin(), componentTypesSet.end());
+				m_EntityRegistry.GetComponentTypes(registryPage.IndexID(entity), componentTypes);
 
 				for (const ComponentType* pComponentType : componentTypes)
 					m_EntityRegistry.DeregisterComponentType(entity, pComponentType);
@@ -52,6 +52,21 @@ namespace LambdaEngine
 						ImGui::TextUnformatted(pSystem->GetName().c_str());
 					}
 
+					// The critical path bounds how fast the phase can run regardless of the amount of threads
+					const JobCriticalPath& criticalPath = m_pJobScheduler->GetCriticalPath(phase);
+					ImGui::Separator();
+					ImGui::Text("Critical path: %.3f ms", criticalPath.CriticalPathTimeMS);
+					ImGui::Text("Serial: %.3f ms", criticalPath.SerialTimeMS);
+
+					for (uint32 pathIdx = 0; pathIdx < criticalPath.RegularJobIDs.GetSize(); pathIdx++)
+					{
+						const uint32 jobID = criticalPath.RegularJobIDs[pathIdx];
+						if (systems.HasElement(jobID))
+						{
+							ImGui::Text("%s: %.3f ms", systems.IndexID(jobID)->GetName().c_str(), criticalPath.ExecutionTimesMS[pathIdx]);
+						}
+					}
+
 					ImGui::EndChild();
 					ImGui::NextColumn();
 				}
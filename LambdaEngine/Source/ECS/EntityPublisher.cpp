@@ -6,7 +6,7 @@
 
 namespace LambdaEngine
 {
-    EntityPublisher::EntityPublisher(const ComponentStorage* pComponentStorage, const EntityRegistry* pEntityRegistry)
+    EntityPublisher::EntityPublisher(const ComponentStorage* pComponentStorage, EntityRegistry* pEntityRegistry)
         :m_pComponentStorage(pComponentStorage),
         m_pEntityRegistry(pEntityRegistry)
     {}
@@ -37,6 +37,9 @@ namespace LambdaEngine
 
             EliminateDuplicateTIDs(newSub.ComponentTypes);
             newSub.ComponentTypes.ShrinkToFit();
+
+            newSub.ComponentTypeMask = m_pEntityRegistry->CreateComponentMask(newSub.ComponentTypes);
+            newSub.ExcludedComponentTypeMask = m_pEntityRegistry->CreateComponentMask(newSub.ExcludedComponentTypes);
             subscriptions.EmplaceBack(newSub);
         }
 
@@ -73,7 +76,7 @@ namespace LambdaEngine
             // See which entities in the entity vector also have all the other component types. Register those entities in the system.
             for (Entity entity : entities)
             {
-                const bool registerEntity = m_pEntityRegistry->EntityHasAllowedTypes(entity, subscription.ComponentTypes, subscription.ExcludedComponentTypes);
+                const bool registerEntity = m_pEntityRegistry->EntityHasAllowedTypes(entity, subscription.ComponentTypeMask, subscription.ExcludedComponentTypeMask);
 
                 if (registerEntity)
                 {
@@ -146,7 +149,7 @@ namespace LambdaEngine
             // Use indices stored in the component type -> component storage mapping to get the component subscription
             EntitySubscription& sysSub = m_SubscriptionStorage.IndexID(subBucketItr->second.SystemID)[subBucketItr->second.SubIdx];
 
-            const bool entityHasExcludedTypes = m_pEntityRegistry->EntityHasAnyOfTypes(entity, sysSub.ExcludedComponentTypes);
+            const bool entityHasExcludedTypes = m_pEntityRegistry->EntityHasAnyOfTypes(entity, sysSub.ExcludedComponentTypeMask);
             const bool subscriberHasEntity = sysSub.pSubscriber->HasElement(entity);
 
             // Check if an excluded type was added. If so, remove the entity
@@ -160,7 +163,7 @@ namespace LambdaEngine
                 sysSub.pSubscriber->Pop(entity);
             }
             // Check if the entity should be added to the subscription
-            else if (!subscriberHasEntity && !entityHasExcludedTypes && m_pEntityRegistry->EntityHasAllTypes(entity, sysSub.ComponentTypes))
+            else if (!subscriberHasEntity && !entityHasExcludedTypes && m_pEntityRegistry->EntityHasAllTypes(entity, sysSub.ComponentTypeMask))
             {
                 sysSub.pSubscriber->PushBack(entity);
 
@@ -187,7 +190,7 @@ namespace LambdaEngine
             if (!sysSub.pSubscriber->HasElement(entity))
             {
                 // Check if this component was excluded, and therefore preventing an entity to being pushed to a subscriber
-                if (m_pEntityRegistry->EntityHasAllowedTypes(entity, sysSub.ComponentTypes, sysSub.ExcludedComponentTypes))
+                if (m_pEntityRegistry->EntityHasAllowedTypes(entity, sysSub.ComponentTypeMask, sysSub.ExcludedComponentTypeMask))
                 {
                     sysSub.pSubscriber->PushBack(entity);
 
@@ -16,16 +16,20 @@ namespace LambdaEngine
 	{
 		std::scoped_lock<SpinLock> lock(m_Lock);
 
+		const uint32 componentTypeIndex = GetComponentTypeIndex(pComponentType);
+
 		EntityRegistryPage& topPage = m_EntityPages.top();
 		if (!topPage.HasElement(entity))
 		{
-			// Initialize a new set
-			topPage.PushBack({ pComponentType }, entity);
+			// Initialize a new mask
+			ComponentMask componentMask;
+			componentMask.Set(componentTypeIndex);
+			topPage.PushBack(componentMask, entity);
 		}
 		else
 		{
-			// Add the component type to the set
-			topPage.IndexID(entity).insert(pComponentType);
+			// Add the component type to the mask
+			topPage.IndexID(entity).Set(componentTypeIndex);
 		}
 	}
 
@@ -40,53 +44,53 @@ namespace LambdaEngine
 		}
 		else
 		{
-			topPage.IndexID(entity).erase(pComponentType);
+			topPage.IndexID(entity).Reset(GetComponentTypeIndex(pComponentType));
 		}
 	}
 
-	bool EntityRegistry::EntityHasAllowedTypes(Entity entity, const TArray<const ComponentType*>& allowedTypes, const TArray<const ComponentType*>& disallowedTypes) const
+	bool EntityRegistry::EntityHasAllowedTypes(Entity entity, const ComponentMask& allowedTypes, const ComponentMask& disallowedTypes) const
 	{
 		std::scoped_lock<SpinLock> lock(m_Lock);
 
-		const EntityRegistryPage& topPage = m_EntityPages.top();
-		const std::unordered_set<const ComponentType*>& entityTypes = topPage.IndexID(entity);
+		const ComponentMask& entityTypes = m_EntityPages.top().IndexID(entity);
+		return entityTypes.ContainsAll(allowedTypes) && !entityTypes.ContainsAny(disallowedTypes);
+	}
 
-		const bool hasDisallowedType = std::any_of(disallowedTypes.Begin(), disallowedTypes.End(), [entityTypes](const ComponentType* pType) {
-			return entityTypes.contains(pType);
-		});
+	bool EntityRegistry::EntityHasAllTypes(Entity entity, const ComponentMask& types) const
+	{
+		std::scoped_lock<SpinLock> lock(m_Lock);
 
-		if (hasDisallowedType)
-		{
-			return false;
-		}
+		return m_EntityPages.top().IndexID(entity).ContainsAll(types);
+	}
 
-		return std::none_of(allowedTypes.Begin(), allowedTypes.End(), [entityTypes](const ComponentType* pType) {
-			return !entityTypes.contains(pType);
-		});
+	bool EntityRegistry::EntityHasAnyOfTypes(Entity entity, const ComponentMask& types) const
+	{
+		std::scoped_lock<SpinLock> lock(m_Lock);
+
+		return m_EntityPages.top().IndexID(entity).ContainsAny(types);
 	}
 
-	bool EntityRegistry::EntityHasAllTypes(Entity entity, const TArray<const ComponentType*>& types) const
+	ComponentMask EntityRegistry::CreateComponentMask(const TArray<const ComponentType*>& componentTypes)
 	{
 		std::scoped_lock<SpinLock> lock(m_Lock);
 
-		const EntityRegistryPage& topPage = m_EntityPages.top();
-		const std::unordered_set<const ComponentType*>& entityTypes = topPage.IndexID(entity);
+		ComponentMask componentMask;
+		for (const ComponentType* pComponentType : componentTypes)
+		{
+			componentMask.Set(GetComponentTypeIndex(pComponentType));
+		}
 
-		// Check that none of the entity types are missing
-		return std::none_of(types.Begin(), types.End(), [entityTypes](const ComponentType* pType) {
-			return !entityTypes.contains(pType);
-		});
+		return componentMask;
 	}
 
-	bool EntityRegistry::EntityHasAnyOfTypes(Entity entity, const TArray<const ComponentType*>& types) const
+	void EntityRegistry::GetComponentTypes(const ComponentMask& componentMask, TArray<const ComponentType*>& componentTypes) const
 	{
 		std::scoped_lock<SpinLock> lock(m_Lock);
 
-		const EntityRegistryPage& topPage = m_EntityPages.top();
-		const std::unordered_set<const ComponentType*>& entityTypes = topPage.IndexID(entity);
-
-		return std::any_of(types.Begin(), types.End(), [entityTypes](const ComponentType* pType) {
-			return entityTypes.contains(pType);
+		componentTypes.Clear();
+		componentMask.ForEachSetBit([&](uint32 componentTypeIndex)
+		{
+			componentTypes.PushBack(m_ComponentTypes[componentTypeIndex]);
 		});
 	}
 
@@ -130,4 +134,20 @@ namespace LambdaEngine
 
 		m_EntityPages.pop();
 	}
+
+	uint32 EntityRegistry::GetComponentTypeIndex(const ComponentType* pComponentType)
+	{
+		auto indexItr = m_ComponentTypeIndices.find(pComponentType);
+		if (indexItr != m_ComponentTypeIndices.end())
+		{
+			return indexItr->second;
+		}
+
+		const uint32 componentTypeIndex = m_ComponentTypes.GetSize();
+		VALIDATE_MSG(componentTypeIndex < MAX_COMPONENT_TYPES, "Too many component types, increase MAX_COMPONENT_TYPES");
+
+		m_ComponentTypeIndices[pComponentType] = componentTypeIndex;
+		m_ComponentTypes.PushBack(pComponentType);
+		return componentTypeIndex;
+	}
 }
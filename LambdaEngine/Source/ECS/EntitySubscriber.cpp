@@ -24,6 +24,11 @@ namespace LambdaEngine
         m_SubscriptionID = ECSCore::GetInstance()->SubscribeToEntities(subscriberRegistration);
     }
 
+    ArchetypeStorage* EntitySubscriber::GetArchetypeStorage()
+    {
+        return ECSCore::GetInstance()->GetArchetypeStorage();
+    }
+
     void EntitySubscriber::ProcessComponentGroups(EntitySubscriptionRegistration& subscriptionRegistration)
     {
         // Add the component accesses in the component groups to the component accesses vector
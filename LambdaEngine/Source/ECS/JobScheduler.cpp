@@ -1,99 +1,92 @@
 #include "ECS/JobScheduler.h"
 
+#include "Debug/CPUProfiler.h"
 #include "ECS/ECSCore.h"
 #include "ECS/EntitySubscriber.h"
 #include "Threading/API/ThreadPool.h"
+#include "Time/API/Clock.h"
 
-#include <numeric>
+#include <algorithm>
+#include <atomic>
 
 namespace LambdaEngine
 {
     JobScheduler::JobScheduler() :
             m_CurrentPhase(0u)
         ,   m_DeltaTime(0.0f)
-    {}
+    {
+        m_PhaseGraphIsDirty.fill(true);
+    }
 
     void JobScheduler::Tick(float32 dt)
     {
         m_DeltaTime = dt;
 
-        std::unique_lock<std::mutex> uLock(m_Lock);
-        SetPhase(0u);
-        AccumulateRegularJobs();
-
-        // m_CurrentPhase == PHASE_COUNT means all regular jobs are finished, and only post-systems jobs are executed
-        while (m_CurrentPhase <= PHASE_COUNT)
+        for (uint32 phase = 0; phase < PHASE_COUNT; phase++)
         {
-            const Job* pJob = nullptr;
-            do
-            {
-                pJob = FindExecutableJob();
-                if (pJob)
-                {
-                    RegisterJobExecution(*pJob);
-                    m_ThreadHandles.PushBack(ThreadPool::Execute(std::bind_front(&JobScheduler::ExecuteJob, this, *pJob)));
-                }
-            } while(pJob);
+            UpdatePhaseGraph(phase);
 
-            if (!PhaseJobsExist())
+            // Increase the accumulator only if the regular job has a non-zero tick period
+            for (RegularJob& regularJob : m_RegularJobs[phase])
             {
-                // No more jobs in the current phase, perhaps currently running jobs will schedule new ones
-                m_Lock.unlock();
-                for (uint32 threadHandle : m_ThreadHandles)
-                {
-                    ThreadPool::Join(threadHandle);
-                }
+                regularJob.Accumulator += m_DeltaTime * (regularJob.TickPeriod > 0.0f);
+            }
+        }
 
-                m_ThreadHandles.Clear();
-                m_Lock.lock();
+        /*  The first pass ticks every regular job that is due. Regular jobs with a tick period might need to tick
+            several times per frame to catch up, the phases are then replayed until every accumulator is drained. */
+        bool isFirstPass = true;
+        do
+        {
+            for (uint32 phase = 0; phase < PHASE_COUNT; phase++)
+            {
+                m_CurrentPhase = phase;
+                UpdatePhaseGraph(phase);
 
-                if (!PhaseJobsExist())
+                if (ExecutePhase(phase, isFirstPass) && isFirstPass)
                 {
-                    NextPhase();
+                    UpdateCriticalPath(phase);
                 }
+
+                ExecuteScheduledJobs(phase);
+                FinishPhase();
             }
-            else
-            {
-                m_ScheduleTimeoutCvar.wait(uLock);
-            }
-        }
+
+            // Post-systems jobs
+            m_CurrentPhase = PHASE_COUNT;
+            ExecuteScheduledJobs(PHASE_COUNT);
+            FinishPhase();
+
+            isFirstPass = false;
+        } while (RegularJobsNeedTicking());
+
+        m_CurrentPhase = 0u;
     }
 
     void JobScheduler::ScheduleJob(const Job& job, uint32_t phase)
     {
         std::scoped_lock<std::mutex> lock(m_Lock);
         m_Jobs[phase].EmplaceBack(job);
-        m_JobIndices[phase].PushBack(m_Jobs[phase].GetSize() - 1u);
-
-        m_ScheduleTimeoutCvar.notify_all();
     }
 
     void JobScheduler::ScheduleJobASAP(const Job& job)
     {
         std::scoped_lock<std::mutex> lock(m_Lock);
-        const uint32 phase = m_CurrentPhase >= m_Jobs.size() ? 0u : m_CurrentPhase;
+        const uint32 currentPhase = m_CurrentPhase.load();
+        const uint32 phase = currentPhase >= m_Jobs.size() ? 0u : currentPhase;
         m_Jobs[phase].EmplaceBack(job);
-        m_JobIndices[phase].PushBack(m_Jobs[phase].GetSize() - 1u);
-
-        m_ScheduleTimeoutCvar.notify_all();
     }
 
     void JobScheduler::ScheduleJobs(const TArray<Job>& jobs, uint32_t phase)
     {
         std::scoped_lock<std::mutex> lock(m_Lock);
 
-        // Push jobs
-        const uint32 oldJobsCount = m_Jobs[phase].GetSize();
-        m_Jobs[phase].Resize(oldJobsCount + jobs.GetSize());
-        std::copy_n(jobs.begin(), jobs.GetSize(), &m_Jobs[phase][oldJobsCount]);
-
-        // Push job indices
-        TArray<uint32>& jobIndices = m_JobIndices[phase];
-        const uint32 oldIndicesCount = m_JobIndices[phase].GetSize();
-        m_JobIndices[phase].Resize(oldIndicesCount + jobs.GetSize());
-        std::iota(&jobIndices[oldIndicesCount - 1u], &jobIndices.GetBack(), oldJobsCount);
-
-        m_ScheduleTimeoutCvar.notify_all();
+        TArray<Job>& phaseJobs = m_Jobs[phase];
+        phaseJobs.Reserve(phaseJobs.GetSize() + jobs.GetSize());
+        for (const Job& job : jobs)
+        {
+            phaseJobs.PushBack(job);
+        }
     }
 
     uint32 JobScheduler::ScheduleRegularJob(const RegularJob& job, uint32_t phase)
@@ -101,7 +94,7 @@ namespace LambdaEngine
         std::scoped_lock<std::mutex> lock(m_Lock);
 
         const uint32 jobID = m_RegularJobIDGenerator.GenID();
-        m_RegularJobs[phase].PushBack(job, jobID);
+        m_RegularJobsToAdd[phase].PushBack({ jobID, job });
 
         return jobID;
     }
@@ -109,186 +102,448 @@ namespace LambdaEngine
     void JobScheduler::DescheduleRegularJob(uint32 phase, uint32 jobID)
     {
         std::scoped_lock<std::mutex> lock(m_Lock);
-        m_RegularJobs[phase].Pop(jobID);
+
+        // The job might not have been added yet
+        TArray<std::pair<uint32, RegularJob>>& jobsToAdd = m_RegularJobsToAdd[phase];
+        for (uint32 jobIdx = 0; jobIdx < jobsToAdd.GetSize(); jobIdx++)
+        {
+            if (jobsToAdd[jobIdx].first == jobID)
+            {
+                jobsToAdd.Erase(jobsToAdd.Begin() + jobIdx);
+                return;
+            }
+        }
+
+        m_RegularJobsToRemove[phase].PushBack(jobID);
     }
 
-    const Job* JobScheduler::FindExecutableJob()
+    void JobScheduler::UpdatePhaseGraph(uint32 phase)
     {
-        const TArray<Job>& scheduledJobs = m_Jobs[m_CurrentPhase];
-        TArray<uint32>& jobIndices = m_JobIndices[m_CurrentPhase];
+        {
+            std::scoped_lock<std::mutex> lock(m_Lock);
+
+            IDDVector<RegularJob>& regularJobs = m_RegularJobs[phase];
+            TArray<uint32>& jobsToRemove = m_RegularJobsToRemove[phase];
+            TArray<std::pair<uint32, RegularJob>>& jobsToAdd = m_RegularJobsToAdd[phase];
+
+            if (!jobsToRemove.IsEmpty() || !jobsToAdd.IsEmpty())
+            {
+                for (uint32 jobID : jobsToRemove)
+                {
+                    regularJobs.Pop(jobID);
+                }
+
+                for (const std::pair<uint32, RegularJob>& jobToAdd : jobsToAdd)
+                {
+                    regularJobs.PushBack(jobToAdd.second, jobToAdd.first);
+                }
+
+                jobsToRemove.Clear();
+                jobsToAdd.Clear();
+                m_PhaseGraphIsDirty[phase] = true;
+            }
+        }
 
-        for (uint32& jobIndex : jobIndices)
+        if (m_PhaseGraphIsDirty[phase])
         {
-            const Job& job = scheduledJobs[jobIndex];
-            if (CanExecute(job))
+            JobGraph& graph = m_PhaseGraphs[phase];
+            IDDVector<RegularJob>& regularJobs = m_RegularJobs[phase];
+
+            graph.Jobs.Clear();
+            graph.Jobs.Reserve(regularJobs.Size());
+            for (RegularJob& regularJob : regularJobs)
             {
-                jobIndex = jobIndices.GetBack();
-                jobIndices.PopBack();
+                graph.Jobs.PushBack(&regularJob);
+            }
+
+            BuildJobGraph(graph);
+            m_PhaseGraphIsDirty[phase] = false;
+        }
+    }
 
-                return &job;
+    bool JobScheduler::ExecutePhase(uint32 phase, bool isFirstPass)
+    {
+        JobGraph& phaseGraph = m_PhaseGraphs[phase];
+        IDDVector<RegularJob>& regularJobs = m_RegularJobs[phase];
+
+        // Graph nodes are ordered the same way as the regular jobs
+        bool anyJobTicks = false;
+        for (uint32 jobIdx = 0; jobIdx < regularJobs.Size(); jobIdx++)
+        {
+            RegularJob& regularJob = regularJobs[jobIdx];
+
+            // Jobs without a tick period are ticked once per frame
+            const bool hasTickPeriod = regularJob.TickPeriod > 0.0f;
+            const bool shouldTick = (isFirstPass || hasTickPeriod) && regularJob.Accumulator >= regularJob.TickPeriod;
+            if (shouldTick)
+            {
+                regularJob.Accumulator -= regularJob.TickPeriod;
             }
+
+            phaseGraph.ShouldExecute[jobIdx] = shouldTick;
+            anyJobTicks |= shouldTick;
         }
 
-        if (m_CurrentPhase < PHASE_COUNT && !m_RegularJobsToAccumulate[m_CurrentPhase].empty())
         {
-            TArray<uint32>& regularJobIDsToTick = m_RegularJobIDsToTick[m_CurrentPhase];
-            for (uint32& jobID : regularJobIDsToTick)
+            std::scoped_lock<std::mutex> lock(m_Lock);
+            m_ExecutingJobs.Swap(m_Jobs[phase]);
+        }
+
+        if (m_ExecutingJobs.IsEmpty())
+        {
+            if (anyJobTicks)
             {
-                RegularJob& job = m_RegularJobs[m_CurrentPhase].IndexID(jobID);
+                ExecuteGraph(phaseGraph);
+            }
 
-                if (CanExecute(job))
-                {
-                    job.Accumulator -= job.TickPeriod;
-                    if (job.TickPeriod <= 0.0f || job.Accumulator < job.TickPeriod)
-                    {
-                        m_RegularJobsToAccumulate[m_CurrentPhase].erase(jobID);
-                    }
+            return anyJobTicks;
+        }
+
+        /*  Jobs scheduled before the phase started are executed concurrently with its regular jobs, like they were before
+            phases were compiled into graphs. They come first, so regular jobs accessing the same components wait for them. */
+        JobGraph& graph = m_ScheduledJobGraph;
+        graph.Jobs.Clear();
+        for (Job& job : m_ExecutingJobs)
+        {
+            graph.Jobs.PushBack(&job);
+        }
 
-                    jobID = regularJobIDsToTick.GetBack();
-                    regularJobIDsToTick.PopBack();
+        const uint32 scheduledJobCount = graph.Jobs.GetSize();
+        const uint32 regularJobCount = phaseGraph.Jobs.GetSize();
+        for (Job* pRegularJob : phaseGraph.Jobs)
+        {
+            graph.Jobs.PushBack(pRegularJob);
+        }
+
+        if (!HasSameAccesses(graph))
+        {
+            BuildJobGraph(graph);
+        }
+
+        std::fill_n(graph.ShouldExecute.GetData(), scheduledJobCount, uint8(1));
+        std::copy_n(phaseGraph.ShouldExecute.GetData(), regularJobCount, graph.ShouldExecute.GetData() + scheduledJobCount);
 
-                    return &job;
+        ExecuteGraph(graph);
+
+        // The critical path is measured on the phase graph
+        std::copy_n(graph.ExecutionTimesMS.GetData() + scheduledJobCount, regularJobCount, phaseGraph.ExecutionTimesMS.GetData());
+        m_ExecutingJobs.Clear();
+
+        return anyJobTicks;
+    }
+
+    void JobScheduler::ExecuteScheduledJobs(uint32 phase)
+    {
+        // Executing jobs might schedule new jobs in the same phase
+        while (true)
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_Lock);
+                if (m_Jobs[phase].IsEmpty())
+                {
+                    break;
                 }
+
+                m_ExecutingJobs.Swap(m_Jobs[phase]);
+            }
+
+            // Systems tend to schedule the same jobs every frame, the graph is then only rebuilt when the jobs differ
+            JobGraph& graph = m_ScheduledJobGraph;
+            graph.Jobs.Clear();
+            for (Job& job : m_ExecutingJobs)
+            {
+                graph.Jobs.PushBack(&job);
+            }
+
+            if (!HasSameAccesses(graph))
+            {
+                BuildJobGraph(graph);
             }
-        }
 
-        return nullptr;
+            std::fill_n(graph.ShouldExecute.GetData(), graph.ShouldExecute.GetSize(), uint8(1));
+
+            ExecuteGraph(graph);
+            m_ExecutingJobs.Clear();
+        }
     }
 
-    bool JobScheduler::CanExecute(const Job& job) const
+    void JobScheduler::ExecuteGraph(JobGraph& graph)
     {
-        // Prevent multiple jobs from accessing the same components where at least one of them has write permissions
-        // i.e. prevent data races
-        for (const ComponentAccess& componentReg : job.Components)
+        const uint32 nodeCount = graph.Jobs.GetSize();
+        std::copy_n(graph.PredecessorCounts.GetData(), nodeCount, graph.RemainingPredecessors.GetData());
+
+        JobCounter counter;
+        for (uint32 nodeIdx = 0; nodeIdx < nodeCount; nodeIdx++)
         {
-            auto processingComponentItr = m_ProcessingComponents.find(componentReg.pTID);
-            /*  processingComponentItr->second is the amount of jobs currently reading from the component type.
-                If the count is zero, a job is writing to the component type. */
-            if (processingComponentItr != m_ProcessingComponents.end() && (componentReg.Permissions == RW || processingComponentItr->second == 0))
+            if (graph.PredecessorCounts[nodeIdx] == 0)
             {
-                return false;
+                ReleaseNode(graph, nodeIdx, counter);
             }
         }
 
-        return true;
+        // Completing jobs dispatch their successors from the worker threads, this thread helps out meanwhile
+        ThreadPool::Wait(counter);
     }
 
-    bool JobScheduler::CanExecuteRegularJob(const RegularJob& job) const
+    void JobScheduler::ReleaseNode(JobGraph& graph, uint32 nodeIndex, JobCounter& counter)
     {
-        const Job& simpleJob = job;
-        return job.Accumulator >= job.TickPeriod && CanExecute(simpleJob);
+        if (graph.ShouldExecute[nodeIndex])
+        {
+            ThreadPool::Execute(counter, [this, &graph, nodeIndex, &counter]
+            {
+                ExecuteNode(graph, nodeIndex, counter);
+            });
+        }
+        else
+        {
+            // Jobs that are not due this pass still have to release their successors
+            graph.ExecutionTimesMS[nodeIndex] = 0.0f;
+            CompleteNode(graph, nodeIndex, counter);
+        }
     }
 
-    void JobScheduler::ExecuteJob(Job job)
+    void JobScheduler::ExecuteNode(JobGraph& graph, uint32 nodeIndex, JobCounter& counter)
     {
-        job.Function();
-        m_Lock.lock();
-        DeregisterJobExecution(job);
-        m_Lock.unlock();
+        Clock clock;
+        clock.Reset();
+
+        {
+            // PhysX tasks are recorded with the same profiler, so both show up per worker thread in the timeline
+            LAMBDA_PROFILER_SCOPE("ECS Job");
+            graph.Jobs[nodeIndex]->Function();
+        }
+
+        clock.Tick();
+        graph.ExecutionTimesMS[nodeIndex] = (float32)clock.GetDeltaTime().AsMilliSeconds();
+
+        CompleteNode(graph, nodeIndex, counter);
     }
 
-    void JobScheduler::RegisterJobExecution(const Job& job)
+    void JobScheduler::CompleteNode(JobGraph& graph, uint32 nodeIndex, JobCounter& counter)
     {
-        for (const ComponentAccess& componentReg : job.Components)
+        const uint32 successorsEnd = graph.SuccessorOffsets[nodeIndex + 1];
+        for (uint32 successorIdx = graph.SuccessorOffsets[nodeIndex]; successorIdx < successorsEnd; successorIdx++)
         {
-            const uint32 isReadOnly = componentReg.Permissions == R;
-
-            auto processingComponentItr = m_ProcessingComponents.find(componentReg.pTID);
-            if (processingComponentItr == m_ProcessingComponents.end())
-            {
-                m_ProcessingComponents.insert({componentReg.pTID, isReadOnly});
-            }
-            else
+            const uint32 successor = graph.Successors[successorIdx];
+            std::atomic_ref<uint32> remainingPredecessors(graph.RemainingPredecessors[successor]);
+            if (remainingPredecessors.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
             {
-                processingComponentItr->second += isReadOnly;
+                ReleaseNode(graph, successor, counter);
             }
         }
     }
 
-    void JobScheduler::DeregisterJobExecution(const Job& job)
+    void JobScheduler::UpdateCriticalPath(uint32 phase)
     {
-        for (const ComponentAccess& componentReg : job.Components)
+        const JobGraph& graph = m_PhaseGraphs[phase];
+        const TArray<uint32>& jobIDs = m_RegularJobs[phase].GetIDs();
+        const uint32 nodeCount = graph.Jobs.GetSize();
+
+        // Nodes are topologically ordered, so the longest path to each node can be found in a single pass
+        TArray<float32> pathTimes(nodeCount, 0.0f);
+        TArray<uint32> pathParents(nodeCount, UINT32_MAX);
+
+        JobCriticalPath& criticalPath = m_CriticalPaths[phase];
+        criticalPath.SerialTimeMS = 0.0f;
+
+        uint32 criticalPathEnd = UINT32_MAX;
+        float32 criticalPathTime = 0.0f;
+
+        for (uint32 nodeIdx = 0; nodeIdx < nodeCount; nodeIdx++)
         {
-            auto processingComponentItr = m_ProcessingComponents.find(componentReg.pTID);
-            if (processingComponentItr->second <= 1u)
+            const float32 executionTime = graph.ExecutionTimesMS[nodeIdx];
+            criticalPath.SerialTimeMS += executionTime;
+
+            // pathTimes holds the longest path leading up to the node until its own execution time is added
+            pathTimes[nodeIdx] += executionTime;
+            if (pathTimes[nodeIdx] >= criticalPathTime)
             {
-                // The job was the only one reading or writing to the component type
-                m_ProcessingComponents.erase(processingComponentItr);
+                criticalPathTime = pathTimes[nodeIdx];
+                criticalPathEnd = nodeIdx;
             }
-            else
+
+            for (uint32 successorIdx = graph.SuccessorOffsets[nodeIdx]; successorIdx < graph.SuccessorOffsets[nodeIdx + 1]; successorIdx++)
             {
-                processingComponentItr->second -= 1u;
+                const uint32 successor = graph.Successors[successorIdx];
+                if (pathTimes[nodeIdx] > pathTimes[successor] || pathParents[successor] == UINT32_MAX)
+                {
+                    pathTimes[successor] = pathTimes[nodeIdx];
+                    pathParents[successor] = nodeIdx;
+                }
             }
         }
 
-        m_ScheduleTimeoutCvar.notify_all();
+        criticalPath.CriticalPathTimeMS = criticalPathTime;
+        criticalPath.RegularJobIDs.Clear();
+        criticalPath.ExecutionTimesMS.Clear();
+
+        for (uint32 nodeIdx = criticalPathEnd; nodeIdx != UINT32_MAX; nodeIdx = pathParents[nodeIdx])
+        {
+            criticalPath.RegularJobIDs.PushBack(jobIDs[nodeIdx]);
+            criticalPath.ExecutionTimesMS.PushBack(graph.ExecutionTimesMS[nodeIdx]);
+        }
+
+        std::reverse(criticalPath.RegularJobIDs.GetData(), criticalPath.RegularJobIDs.GetData() + criticalPath.RegularJobIDs.GetSize());
+        std::reverse(criticalPath.ExecutionTimesMS.GetData(), criticalPath.ExecutionTimesMS.GetData() + criticalPath.ExecutionTimesMS.GetSize());
     }
 
-    void JobScheduler::SetPhase(uint32_t phase)
+    void JobScheduler::FinishPhase()
     {
-        if (m_CurrentPhase <= PHASE_COUNT)
+        ECSCore* pECS = ECSCore::GetInstance();
+        pECS->PerformComponentRegistrations();
+        pECS->PerformComponentDeletions();
+        pECS->PerformEntityDeletions();
+    }
+
+    bool JobScheduler::RegularJobsNeedTicking() const
+    {
+        for (const IDDVector<RegularJob>& regularJobs : m_RegularJobs)
         {
-            m_Jobs[m_CurrentPhase].Clear();
+            for (const RegularJob& regularJob : regularJobs)
+            {
+                if (regularJob.TickPeriod > 0.0f && regularJob.Accumulator >= regularJob.TickPeriod)
+                {
+                    return true;
+                }
+            }
         }
 
-        m_CurrentPhase = phase;
+        return false;
     }
 
-    void JobScheduler::NextPhase()
+    void JobScheduler::BuildJobGraph(JobGraph& graph)
     {
-        uint32 upcomingPhase = m_CurrentPhase + 1u;
-        // All phases have been processed. Some might need to be replayed to accumulate regular jobs
-        if (m_CurrentPhase == PHASE_COUNT)
+        const uint32 nodeCount = graph.Jobs.GetSize();
+
+        // The scratch data keeps its allocations between builds
+        for (auto& accessStatePair : m_ComponentAccessStates)
         {
-            for (uint32 phase = 0; phase < PHASE_COUNT; phase++)
+            accessStatePair.second.LastWriter = UINT32_MAX;
+            accessStatePair.second.Readers.Clear();
+        }
+
+        if (m_NodeSuccessors.GetSize() < nodeCount)
+        {
+            m_NodeSuccessors.Resize(nodeCount);
+        }
+
+        for (uint32 nodeIdx = 0; nodeIdx < nodeCount; nodeIdx++)
+        {
+            m_NodeSuccessors[nodeIdx].Clear();
+        }
+
+        TArray<TArray<uint32>>& successors = m_NodeSuccessors;
+        TArray<uint32>& predecessors = m_NodePredecessors;
+
+        graph.NodeAccesses.Clear();
+        graph.NodeAccessOffsets.Resize(nodeCount + 1);
+        graph.PredecessorCounts.Resize(nodeCount);
+        for (uint32 nodeIdx = 0; nodeIdx < nodeCount; nodeIdx++)
+        {
+            predecessors.Clear();
+            graph.NodeAccessOffsets[nodeIdx] = graph.NodeAccesses.GetSize();
+
+            for (const ComponentAccess& componentAccess : graph.Jobs[nodeIdx]->Components)
             {
-                const std::unordered_set<uint32>& regularJobsToAccumulate = m_RegularJobsToAccumulate[phase];
-                if (!regularJobsToAccumulate.empty())
+                graph.NodeAccesses.PushBack(componentAccess);
+                if (componentAccess.Permissions == NDA)
+                {
+                    continue;
+                }
+
+                ComponentAccessState& accessState = m_ComponentAccessStates[componentAccess.pTID];
+                if (accessState.LastWriter != UINT32_MAX)
                 {
-                    // Find which regular jobs need accumulating
-                    TArray<uint32>& regularJobIDsToTick = m_RegularJobIDsToTick[phase];
-                    for (uint32 jobID : regularJobsToAccumulate)
+                    predecessors.PushBack(accessState.LastWriter);
+                }
+
+                if (componentAccess.Permissions == RW)
+                {
+                    // Writers wait for every reader since the last write, and become the new last writer
+                    for (uint32 reader : accessState.Readers)
                     {
-                        regularJobIDsToTick.PushBack(jobID);
+                        if (reader != nodeIdx)
+                        {
+                            predecessors.PushBack(reader);
+                        }
                     }
 
-                    upcomingPhase = phase;
-                    break;
+                    accessState.Readers.Clear();
+                    accessState.LastWriter = nodeIdx;
+                }
+                else
+                {
+                    accessState.Readers.PushBack(nodeIdx);
                 }
             }
+
+            // The same predecessor might be found through several component types
+            uint32* pPredecessorsBegin = predecessors.GetData();
+            std::sort(pPredecessorsBegin, pPredecessorsBegin + predecessors.GetSize());
+            const uint32* pPredecessorsEnd = std::unique(pPredecessorsBegin, pPredecessorsBegin + predecessors.GetSize());
+
+            uint32 predecessorCount = 0;
+            for (const uint32* pPredecessor = pPredecessorsBegin; pPredecessor != pPredecessorsEnd; pPredecessor++)
+            {
+                if (*pPredecessor != nodeIdx)
+                {
+                    successors[*pPredecessor].PushBack(nodeIdx);
+                    predecessorCount++;
+                }
+            }
+
+            graph.PredecessorCounts[nodeIdx] = predecessorCount;
+        }
+
+        graph.NodeAccessOffsets[nodeCount] = graph.NodeAccesses.GetSize();
+
+        // Flatten the successor lists
+        graph.SuccessorOffsets.Resize(nodeCount + 1);
+        graph.Successors.Clear();
+        for (uint32 nodeIdx = 0; nodeIdx < nodeCount; nodeIdx++)
+        {
+            graph.SuccessorOffsets[nodeIdx] = graph.Successors.GetSize();
+            for (uint32 successor : successors[nodeIdx])
+            {
+                graph.Successors.PushBack(successor);
+            }
         }
 
-        ECSCore* pECS = ECSCore::GetInstance();
-        pECS->PerformComponentRegistrations();
-        pECS->PerformComponentDeletions();
-        pECS->PerformEntityDeletions();
-        SetPhase(upcomingPhase);
+        graph.SuccessorOffsets[nodeCount] = graph.Successors.GetSize();
+
+        graph.RemainingPredecessors.Resize(nodeCount);
+        graph.ShouldExecute.Resize(nodeCount);
+        graph.ExecutionTimesMS.Resize(nodeCount);
+        std::fill_n(graph.ExecutionTimesMS.GetData(), nodeCount, 0.0f);
     }
 
-    void JobScheduler::AccumulateRegularJobs()
+    bool JobScheduler::HasSameAccesses(const JobGraph& graph)
     {
-        for (uint32 phase = 0; phase < PHASE_COUNT; phase++)
+        const uint32 nodeCount = graph.Jobs.GetSize();
+        if (graph.NodeAccessOffsets.GetSize() != nodeCount + 1)
         {
-            IDDVector<RegularJob>& regularJobs = m_RegularJobs[phase];
-            const TArray<uint32>& jobIDs = regularJobs.GetIDs();
-            TArray<uint32>& regularJobIDsToTick = m_RegularJobIDsToTick[phase];
+            return false;
+        }
 
-            for (uint32 jobIdx = 0; jobIdx < regularJobs.Size(); jobIdx++)
+        for (uint32 nodeIdx = 0; nodeIdx < nodeCount; nodeIdx++)
+        {
+            const TArray<ComponentAccess>& components = graph.Jobs[nodeIdx]->Components;
+            const uint32 accessesBegin = graph.NodeAccessOffsets[nodeIdx];
+            if (graph.NodeAccessOffsets[nodeIdx + 1] - accessesBegin != components.GetSize())
             {
-                RegularJob& regularJob = regularJobs[jobIdx];
-                // Increase the accumulator only if the regular job has a non-zero tick period
-                regularJob.Accumulator += m_DeltaTime * (regularJob.TickPeriod > 0.0f);
-                if (regularJob.Accumulator >= regularJob.TickPeriod)
+                return false;
+            }
+
+            for (uint32 accessIdx = 0; accessIdx < components.GetSize(); accessIdx++)
+            {
+                const ComponentAccess& builtAccess = graph.NodeAccesses[accessesBegin + accessIdx];
+                if (builtAccess.pTID != components[accessIdx].pTID || builtAccess.Permissions != components[accessIdx].Permissions)
                 {
-                    m_RegularJobsToAccumulate[phase].insert(jobIDs[jobIdx]);
-                    regularJobIDsToTick.PushBack(jobIDs[jobIdx]);
+                    return false;
                 }
             }
         }
-    }
 
-    bool JobScheduler::PhaseJobsExist() const
-    {
-        return (m_CurrentPhase < PHASE_COUNT && !m_RegularJobIDsToTick[m_CurrentPhase].IsEmpty()) || !m_JobIndices[m_CurrentPhase].IsEmpty();
+        return true;
     }
 }
@@ -70,6 +70,7 @@ namespace LambdaEngine
 	*/
 	static Clock g_Clock;
 	static Timestamp g_FixedTimestep = Timestamp::Seconds(1.0 / 60.0);
+	static bool g_Headless = false;
 
 	/*
 	* EngineLoop
@@ -119,6 +120,16 @@ namespace LambdaEngine
 			}
 
 			END_PROFILING_SEGMENT("Full Frame");
+
+			// Nothing waits for vsync when headless, sleep until the next fixed tick instead of spinning
+			if (g_Headless && isRunning)
+			{
+				const Timestamp untilFixedTick = g_FixedTimestep - accumulator;
+				if (untilFixedTick.AsMilliSeconds() >= 1)
+				{
+					Thread::Sleep(int32(untilFixedTick.AsMilliSeconds()));
+				}
+			}
 		}
 	}
 
@@ -129,9 +140,12 @@ namespace LambdaEngine
 			return false;
 		}
 
-		if (!RenderSystem::GetInstance().Init())
+		if (!g_Headless)
 		{
-			return false;
+			if (!RenderSystem::GetInstance().Init())
+			{
+				return false;
+			}
 		}
 
 		if (!PhysicsSystem::GetInstance()->Init())
@@ -183,6 +197,12 @@ namespace LambdaEngine
 		// Audio
 		PROFILE_FUNCTION("AudioAPI::Tick", AudioAPI::Tick());
 
+		// Resources
+		PROFILE_FUNCTION("ResourceManager::TickStreaming", ResourceManager::TickStreaming());
+
+		// The physics step started by the last fixed tick has to be done before anything moves characters
+		PROFILE_FUNCTION("PhysicsSystem::FetchResults", PhysicsSystem::GetInstance()->FetchResults());
+
 		// States / ECS-systems
 		PROFILE_FUNCTION("ClientSystem::StaticTickMainThread", ClientSystem::StaticTickMainThread(delta));
 		PROFILE_FUNCTION("ServerSystem::StaticTickMainThread", ServerSystem::StaticTickMainThread(delta));
@@ -196,6 +216,11 @@ namespace LambdaEngine
 		PROFILE_FUNCTION("Game::Tick", Game::Get().Tick(delta));
 
 		// Rendering
+		if (g_Headless)
+		{
+			return true;
+		}
+
 #if DEBUG_INFO_ENABLED
 		// TODO: Move to somewere else, does someone have a suggestion?
 		ImGuiRenderer::Get().DrawUI([delta]
@@ -262,9 +287,14 @@ namespace LambdaEngine
 
 	void EngineLoop::FixedTick(Timestamp delta)
 	{
+		PROFILE_FUNCTION("PhysicsSystem::FetchResults", PhysicsSystem::GetInstance()->FetchResults());
+
 		PROFILE_FUNCTION("Game::FixedTick", Game::Get().FixedTick(delta));
 		PROFILE_FUNCTION("NetworkUtils::FixedTick", NetworkUtils::FixedTick(delta));
 		PROFILE_FUNCTION("StateManager::FixedTick", StateManager::GetInstance()->FixedTick(delta));
+
+		// Simulated while the engine waits for the next frame, and fetched before the next tick moves anything
+		PROFILE_FUNCTION("PhysicsSystem::FixedTick", PhysicsSystem::GetInstance()->FixedTick(delta));
 	}
 
 	bool EngineLoop::PreInit(const argh::parser& flagParser)
@@ -292,6 +322,18 @@ namespace LambdaEngine
 
 		SetFixedTimestep(Timestamp::Seconds(1.0 / EngineConfig::GetDoubleProperty(EConfigOption::CONFIG_OPTION_FIXED_TIMESTEMP)));
 
+#ifdef LAMBDA_PLATFORM_LINUX
+		// There are no window or render backends on Linux, only the dedicated server runs there
+		g_Headless = true;
+#else
+		g_Headless = EngineConfig::GetBoolProperty(EConfigOption::CONFIG_OPTION_HEADLESS);
+#endif
+
+		if (EngineConfig::GetBoolProperty(EConfigOption::CONFIG_OPTION_ECS_ARCHETYPE_STORAGE))
+		{
+			ECSCore::GetInstance()->EnableArchetypeStorage();
+		}
+
 		if (!ThreadPool::Init())
 		{
 			return false;
@@ -329,9 +371,12 @@ namespace LambdaEngine
 			return false;
 		}
 
-		if (!RenderAPI::Init())
+		if (!g_Headless)
 		{
-			return false;
+			if (!RenderAPI::Init())
+			{
+				return false;
+			}
 		}
 
 		if (!AudioAPI::Init())
@@ -354,9 +399,12 @@ namespace LambdaEngine
 			return false;
 		}
 
-		if (!GUIApplication::Init())
+		if (!g_Headless)
 		{
-			return false;
+			if (!GUIApplication::Init())
+			{
+				return false;
+			}
 		}
 
 		if (!InheritanceComponentOwner::GetInstance()->Init())
@@ -379,9 +427,12 @@ namespace LambdaEngine
 
 	bool EngineLoop::PreRelease()
 	{
-		RenderAPI::GetGraphicsQueue()->Flush();
-		RenderAPI::GetComputeQueue()->Flush();
-		RenderAPI::GetCopyQueue()->Flush();
+		if (!g_Headless)
+		{
+			RenderAPI::GetGraphicsQueue()->Flush();
+			RenderAPI::GetComputeQueue()->Flush();
+			RenderAPI::GetCopyQueue()->Flush();
+		}
 
 		PlatformNetworkUtils::PreRelease();
 
@@ -404,14 +455,17 @@ namespace LambdaEngine
 			return false;
 		}
 
-		if (!GUIApplication::Release())
+		if (!g_Headless)
 		{
-			return false;
-		}
+			if (!GUIApplication::Release())
+			{
+				return false;
+			}
 
-		if (!RenderSystem::GetInstance().Release())
-		{
-			return false;
+			if (!RenderSystem::GetInstance().Release())
+			{
+				return false;
+			}
 		}
 
 		if (!ResourceManager::Release())
@@ -424,9 +478,12 @@ namespace LambdaEngine
 			return false;
 		}
 
-		if (!StagingBufferCache::Release())
+		if (!g_Headless)
 		{
-			return false;
+			if (!StagingBufferCache::Release())
+			{
+				return false;
+			}
 		}
 
 		if (!AudioAPI::Release())
@@ -459,9 +516,12 @@ namespace LambdaEngine
 		Thread::Release();
 		PlatformNetworkUtils::PostRelease();
 
-		if (!RenderAPI::Release())
+		if (!g_Headless)
 		{
-			return false;
+			if (!RenderAPI::Release())
+			{
+				return false;
+			}
 		}
 
 		if (!CommonApplication::PostRelease())
@@ -494,4 +554,9 @@ namespace LambdaEngine
 	{
 		return g_Clock.GetTotalTime();
 	}
+
+	bool EngineLoop::IsHeadless()
+	{
+		return g_Headless;
+	}
 }
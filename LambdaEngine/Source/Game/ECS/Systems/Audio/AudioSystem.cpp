@@ -65,7 +65,11 @@ namespace LambdaEngine
 
 			for (auto soundInstancePair : audibleComponent.SoundInstances3D)
 			{
-				soundInstancePair.second->SetPosition(positionComponent.Position);
+				// The null audio device used by headless engines does not create sound instances
+				if (soundInstancePair.second != nullptr)
+				{
+					soundInstancePair.second->SetPosition(positionComponent.Position);
+				}
 			}
 		}
 
@@ -2,14 +2,17 @@
 
 #include "ECS/ECSCore.h"
 #include "Engine/EngineConfig.h"
+#include "Engine/EngineLoop.h"
 #include "Game/ECS/Components/Physics/Transform.h"
 #include "Game/ECS/Components/Rendering/CameraComponent.h"
 #include "Game/ECS/Components/Rendering/MeshComponent.h"
 #include "Input/API/InputActionSystem.h"
 #include "Physics/PhysX/FilterShader.h"
 #include "Resources/ResourceManager.h"
+#include "Threading/API/ThreadPool.h"
 
-#define PVD_HOST "127.0.0.1"	// The IP address to stream debug visualization data to
+#define PVD_HOST "127.0.0.1"		// The IP address to stream debug visualization data to
+#define SCENE_QUERIES_PER_JOB 16u	// Batched scene queries are split into jobs of this many queries
 
 namespace LambdaEngine
 {
@@ -31,8 +34,9 @@ namespace LambdaEngine
 		PX_RELEASE(m_pDefaultMaterial);
 		PX_RELEASE(m_pCooking);
 		PX_RELEASE(m_pControllerManager);
-		PX_RELEASE(m_pDispatcher);
 		PX_RELEASE(m_pScene);
+		SAFEDELETE(m_pDispatcher);
+		m_CollisionMeshCache.Release();
 		PX_RELEASE(m_pPhysics);
 
 		if(m_pVisDbg)
@@ -143,18 +147,18 @@ namespace LambdaEngine
 		cookingParams.meshWeldTolerance					= 0.1f;
 		m_pCooking->setParams(cookingParams);
 
-		m_pDispatcher = PxDefaultCpuDispatcherCreate(2);
-		if (!m_pDispatcher)
-		{
-			LOG_ERROR("PhysX CPU dispatcher creation failed");
-			return false;
-		}
+		// Cooked meshes are kept on disk, so levels are only cooked the first time they are loaded
+		m_CollisionMeshCache.Init(m_pPhysics, m_pCooking);
+
+		// PhysX tasks are executed by the engine's thread pool rather than by threads of its own
+		m_pDispatcher = DBG_NEW PhysXCpuDispatcher(EngineConfig::GetUint32Property(EConfigOption::CONFIG_OPTION_PHYSICS_WORKER_THREADS));
+		LOG_INFO("PhysX dispatches its tasks to %u worker threads", m_pDispatcher->getWorkerCount());
 
 		const glm::vec3 gravity = GRAVITATIONAL_ACCELERATION * -g_DefaultUp;
 		const PxVec3 gravityPX = { gravity.x, gravity.y, gravity.z };
 
 		PxSceneDesc sceneDesc(m_pPhysics->getTolerancesScale());
-		sceneDesc.flags						= PxSceneFlag::eENABLE_CCD;
+		sceneDesc.flags						= PxSceneFlag::eENABLE_CCD | PxSceneFlag::eENABLE_ACTIVE_ACTORS;
 		sceneDesc.gravity					= gravityPX;
 		sceneDesc.cpuDispatcher				= m_pDispatcher;
 		sceneDesc.filterShader				= FilterShader;
@@ -179,37 +183,36 @@ namespace LambdaEngine
 
 	void PhysicsSystem::Tick(Timestamp deltaTime)
 	{
-		const float32 dt = (float32)deltaTime.AsSeconds();
+		// The engine loop fetches the step before the ECS tick, this only waits if nothing did
+		FetchResults();
 
-		m_pScene->simulate(dt);
-		m_pScene->fetchResults(true);
+		// Transforms are rendered one step behind the simulation, between the two latest poses
+		const float64 stepTime = EngineLoop::GetFixedTimestep().AsSeconds();
+		m_TimeSinceStep += deltaTime.AsSeconds();
 
-		ECSCore* pECS = ECSCore::GetInstance();
-		const ComponentArray<DynamicCollisionComponent>* pDynamicCollisionComponents = pECS->GetComponentArray<DynamicCollisionComponent>();
-		ComponentArray<PositionComponent>* pPositionComponents = pECS->GetComponentArray<PositionComponent>();
-		ComponentArray<RotationComponent>* pRotationComponents = pECS->GetComponentArray<RotationComponent>();
-		ComponentArray<VelocityComponent>* pVelocityComponents = pECS->GetComponentArray<VelocityComponent>();
+		InterpolateMovedActors(float32(std::min(m_TimeSinceStep / stepTime, 1.0)));
+	}
 
-		for (Entity entity : m_DynamicCollisionEntities)
-		{
-			const DynamicCollisionComponent& collisionComp = pDynamicCollisionComponents->GetConstData(entity);
-			PxRigidDynamic* pActor = collisionComp.pActor;
-			if (!pActor->isSleeping())
-			{
-				PositionComponent& positionComp = pPositionComponents->GetData(entity);
-				RotationComponent& rotationComp = pRotationComponents->GetData(entity);
-				VelocityComponent& velocityComp = pVelocityComponents->GetData(entity);
+	void PhysicsSystem::FixedTick(Timestamp delta)
+	{
+		// One step per fixed tick, so that the scene advances the same on the server and clients
+		FetchResults();
 
-				const PxTransform transformPX = pActor->getGlobalPose();
-				const PxVec3& positionPX = transformPX.p;
-				positionComp.Position = { positionPX.x, positionPX.y, positionPX.z };
+		m_pScene->simulate((float32)delta.AsSeconds());
+		m_IsSimulating = true;
+		m_TimeSinceStep = 0.0;
+	}
 
-				const PxQuat& quatPX = transformPX.q;
-				rotationComp.Quaternion = { quatPX.w, quatPX.x, quatPX.y, quatPX.z };
+	void PhysicsSystem::FetchResults()
+	{
+		if (m_IsSimulating)
+		{
+			// The step's tasks run on the thread pool, so the waiting thread helps with them instead of blocking
+			ThreadPool::WaitUntil([this] { return m_pScene->checkResults(false); });
+			m_pScene->fetchResults(true);
+			m_IsSimulating = false;
 
-				const PxVec3 velocityPX = pActor->getLinearVelocity();
-				velocityComp.Velocity = { velocityPX.x, velocityPX.y, velocityPX.z };
-			}
+			UpdateMovedActors();
 		}
 	}
 
@@ -348,53 +351,60 @@ namespace LambdaEngine
 	{
 		const glm::vec3& position = overlapInfo.Position;
 		const glm::quat& rotation = overlapInfo.Rotation;
-		const GeometryParameters& geometryParams = overlapInfo.GeometryParams;
-
-		QueryFilterData filterData = {};
-		if (pFilterData)
-		{
-			filterData = *pFilterData;
-		}
 
-		PxQueryFilterData filterDataPX;
-		filterDataPX.flags = PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER | PxQueryFlag::eNO_BLOCK;
-		filterDataPX.data.word0 = filterData.IncludedGroup;
-		filterDataPX.data.word1 = filterData.ExcludedGroup;
-		filterDataPX.data.word2 = filterData.ExcludedEntity;
+		const PxQueryFilterData filterDataPX = CreateQueryFilterData(
+			pFilterData ? pFilterData : overlapInfo.pFilterData,
+			PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER | PxQueryFlag::eNO_BLOCK);
 
-		// There's no default constructor for PxGeometry, so a sphere is used as a default
+		const PxGeometryHolder queryGeometry = CreateQueryGeometry(overlapInfo.GeometryType, overlapInfo.GeometryParams);
+		const PxTransform transform = overlapInfo.GeometryType == EGeometryType::PLANE ?
+			CreatePlaneTransform(position, rotation) :
+			PxTransform(position.x, position.y, position.z, PxQuat(rotation.x, rotation.y, rotation.z, rotation.w));
 
-		PxTransform transform = PxTransform(position.x, position.y, position.z, PxQuat(rotation.x, rotation.y, rotation.z, rotation.w));
+		return m_pScene->overlap(queryGeometry.any(), transform, overlaps, filterDataPX, &m_RaycastQueryFilterCallback);
+	}
 
-		switch (overlapInfo.GeometryType)
+	void PhysicsSystem::ExecuteQueryBatch(SceneQueryBatch& batch)
+	{
+		const uint32 raycastCount	= batch.Raycasts.GetSize();
+		const uint32 sweepCount		= batch.Sweeps.GetSize();
+		const uint32 overlapCount	= batch.Overlaps.GetSize();
+		const uint32 maxHitCount	= std::max(batch.MaxTouchesPerQuery, 1u);
+
+		// Every query writes to its own slots, which lets the jobs run without any synchronization
+		batch.RaycastResults.Resize(raycastCount);
+		batch.RaycastHits.Resize(raycastCount * maxHitCount);
+		batch.SweepResults.Resize(sweepCount);
+		batch.SweepHits.Resize(sweepCount * maxHitCount);
+		batch.OverlapResults.Resize(overlapCount);
+		batch.OverlapHits.Resize(overlapCount * maxHitCount);
+
+		JobCounter queryJobs;
+		const uint32 queryCount = raycastCount + sweepCount + overlapCount;
+		for (uint32 firstQuery = 0; firstQuery < queryCount; firstQuery += SCENE_QUERIES_PER_JOB)
 		{
-			case EGeometryType::BOX:
-			{
-				PxBoxGeometry queryGeometry(PxVec3(geometryParams.HalfExtents.x, geometryParams.HalfExtents.y, geometryParams.HalfExtents.z));
-				return m_pScene->overlap(queryGeometry, transform, overlaps, filterDataPX, &m_RaycastQueryFilterCallback);
-			}
-			case EGeometryType::CAPSULE:
-			{
-				PxCapsuleGeometry queryGeometry(geometryParams.Radius, geometryParams.HalfHeight);
-				return m_pScene->overlap(queryGeometry, transform, overlaps, filterDataPX, &m_RaycastQueryFilterCallback);
-			}
-			case EGeometryType::PLANE:
-			{
-				transform = CreatePlaneTransform(position, rotation);
-				PxPlaneGeometry queryGeometry;
-				return m_pScene->overlap(queryGeometry, transform, overlaps, filterDataPX, &m_RaycastQueryFilterCallback);
-			}
-			case EGeometryType::MESH:
-			{
-				PxTriangleMeshGeometry queryGeometry = CreateTriangleMeshGeometry(geometryParams.pMesh, glm::vec3(1.0f));
-				return m_pScene->overlap(queryGeometry, transform, overlaps, filterDataPX, &m_RaycastQueryFilterCallback);
-			}
-			default:
+			ThreadPool::Execute(queryJobs, [this, &batch, firstQuery, queryCount, raycastCount, sweepCount]()
 			{
-				PxSphereGeometry queryGeometry(geometryParams.Radius);
-				return m_pScene->overlap(queryGeometry, transform, overlaps, filterDataPX, &m_RaycastQueryFilterCallback);
-			}
+				const uint32 lastQuery = std::min(firstQuery + SCENE_QUERIES_PER_JOB, queryCount);
+				for (uint32 queryIdx = firstQuery; queryIdx < lastQuery; queryIdx++)
+				{
+					if (queryIdx < raycastCount)
+					{
+						ExecuteBatchedRaycast(batch, queryIdx);
+					}
+					else if (queryIdx < raycastCount + sweepCount)
+					{
+						ExecuteBatchedSweep(batch, queryIdx - raycastCount);
+					}
+					else
+					{
+						ExecuteBatchedOverlap(batch, queryIdx - raycastCount - sweepCount);
+					}
+				}
+			});
 		}
+
+		ThreadPool::Wait(queryJobs);
 	}
 
 	void PhysicsSystem::onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pPairs, PxU32 nbPairs)
@@ -403,6 +413,13 @@ namespace LambdaEngine
 		{
 			const PxContactPair& contactPair = pPairs[pairIdx];
 
+			// Ignore pairs when actors or shapes have been deleted during the simulation
+			if ((pairHeader.flags & (PxContactPairHeaderFlag::eREMOVED_ACTOR_0 | PxContactPairHeaderFlag::eREMOVED_ACTOR_1)) ||
+				(contactPair.flags & (PxContactPairFlag::eREMOVED_SHAPE_0 | PxContactPairFlag::eREMOVED_SHAPE_1)))
+			{
+				continue;
+			}
+
 			TArray<PxContactPairPoint> contactPoints(contactPair.contactCount);
 			if (contactPair.events & (PxPairFlag::eNOTIFY_TOUCH_FOUND | PxPairFlag::eNOTIFY_CONTACT_POINTS))
 			{
@@ -520,7 +537,6 @@ namespace LambdaEngine
 
 	PxTriangleMeshGeometry PhysicsSystem::CreateTriangleMeshGeometry(const Mesh* pMesh, const glm::vec3& scale) const
 	{
-		/* Perform mesh 'cooking'; generate an optimized collision mesh from triangle data */
 		const TArray<Vertex>& vertices = pMesh->Vertices;
 
 		PxTriangleMeshDesc meshDesc;
@@ -535,18 +551,13 @@ namespace LambdaEngine
 		meshDesc.triangles.stride	= 3 * sizeof(uint32);
 		meshDesc.triangles.data		= indices.GetData();
 
-		PxDefaultMemoryOutputStream writeBuffer;
-		PxTriangleMeshCookingResult::Enum result;
-		bool status = m_pCooking->cookTriangleMesh(meshDesc, writeBuffer, &result);
-		if (!status)
+		// The mesh is only cooked if it is neither in memory nor on disk already
+		PxTriangleMesh* pTriangleMesh = m_CollisionMeshCache.GetTriangleMesh(meshDesc);
+		if (!pTriangleMesh)
 		{
-			LOG_WARNING("Failed to cook mesh with %d vertices", vertices.GetSize());
 			return nullptr;
 		}
 
-		PxDefaultMemoryInputData readBuffer(writeBuffer.getData(), writeBuffer.getSize());
-		PxTriangleMesh* pTriangleMesh = m_pPhysics->createTriangleMesh(readBuffer);
-
 		// Create a geometry instance of the mesh and scale it
 		return PxTriangleMeshGeometry(pTriangleMesh, PxMeshScale({ scale.x, scale.y, scale.z }));
 	}
@@ -593,11 +604,28 @@ namespace LambdaEngine
 		const PxVec3 directionPX = { direction.x, direction.y, direction.z };
 
 		const PxHitFlags hitFlags = PxHitFlag::ePOSITION | PxHitFlag::eNORMAL;
+		const PxQueryFilterData filterDataPX = CreateQueryFilterData(raycastInfo.pFilterData, queryFlags);
+		return m_pScene->raycast(originPX, directionPX, raycastInfo.MaxDistance, raycastBuffer, hitFlags, filterDataPX, &m_RaycastQueryFilterCallback);
+	}
+
+	PxGeometryHolder PhysicsSystem::CreateQueryGeometry(EGeometryType geometryType, const GeometryParameters& geometryParams) const
+	{
+		switch (geometryType)
+		{
+			case EGeometryType::BOX:		return PxBoxGeometry(PxVec3(geometryParams.HalfExtents.x, geometryParams.HalfExtents.y, geometryParams.HalfExtents.z));
+			case EGeometryType::CAPSULE:	return PxCapsuleGeometry(geometryParams.Radius, geometryParams.HalfHeight);
+			case EGeometryType::PLANE:		return PxPlaneGeometry();
+			case EGeometryType::MESH:		return CreateTriangleMeshGeometry(geometryParams.pMesh, glm::vec3(1.0f));
+			default:						return PxSphereGeometry(geometryParams.Radius);
+		}
+	}
 
+	PxQueryFilterData PhysicsSystem::CreateQueryFilterData(const QueryFilterData* pFilterData, PxQueryFlags queryFlags)
+	{
 		QueryFilterData filterData = {};
-		if (raycastInfo.pFilterData)
+		if (pFilterData)
 		{
-			filterData = *raycastInfo.pFilterData;
+			filterData = *pFilterData;
 		}
 
 		PxQueryFilterData filterDataPX;
@@ -605,8 +633,116 @@ namespace LambdaEngine
 		filterDataPX.data.word0 = filterData.IncludedGroup;
 		filterDataPX.data.word1 = filterData.ExcludedGroup;
 		filterDataPX.data.word2 = filterData.ExcludedEntity;
+		return filterDataPX;
+	}
 
-		return m_pScene->raycast(originPX, directionPX, raycastInfo.MaxDistance, raycastBuffer, hitFlags, filterDataPX, &m_RaycastQueryFilterCallback);
+	void PhysicsSystem::ExecuteBatchedRaycast(SceneQueryBatch& batch, uint32 queryIdx)
+	{
+		const RaycastInfo& raycastInfo = batch.Raycasts[queryIdx];
+		SceneQueryResult& result = batch.RaycastResults[queryIdx];
+		const uint32 maxTouches = batch.MaxTouchesPerQuery;
+
+		result.FirstHit = queryIdx * std::max(maxTouches, 1u);
+		result.HitCount = 0;
+
+		PxQueryFlags queryFlags = PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER;
+		if (maxTouches > 0)
+		{
+			queryFlags |= PxQueryFlag::eNO_BLOCK;
+		}
+
+		PxRaycastBuffer raycastBuffer(batch.RaycastHits.GetData() + result.FirstHit, maxTouches);
+		if (RaycastInternal(raycastInfo, raycastBuffer, queryFlags))
+		{
+			if (maxTouches > 0)
+			{
+				result.HitCount = raycastBuffer.getNbTouches();
+			}
+			else
+			{
+				batch.RaycastHits[result.FirstHit] = raycastBuffer.block;
+				result.HitCount = 1;
+			}
+		}
+	}
+
+	void PhysicsSystem::ExecuteBatchedSweep(SceneQueryBatch& batch, uint32 queryIdx)
+	{
+		const SweepQueryInfo& sweepInfo = batch.Sweeps[queryIdx];
+		SceneQueryResult& result = batch.SweepResults[queryIdx];
+		const uint32 maxTouches = batch.MaxTouchesPerQuery;
+
+		result.FirstHit = queryIdx * std::max(maxTouches, 1u);
+		result.HitCount = 0;
+
+		PxQueryFlags queryFlags = PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER;
+		if (maxTouches > 0)
+		{
+			queryFlags |= PxQueryFlag::eNO_BLOCK;
+		}
+
+		const glm::vec3& position = sweepInfo.Position;
+		const glm::quat& rotation = sweepInfo.Rotation;
+		const PxTransform transform(position.x, position.y, position.z, PxQuat(rotation.x, rotation.y, rotation.z, rotation.w));
+		const PxVec3 directionPX = { sweepInfo.Direction.x, sweepInfo.Direction.y, sweepInfo.Direction.z };
+
+		const PxGeometryHolder queryGeometry = CreateQueryGeometry(sweepInfo.GeometryType, sweepInfo.GeometryParams);
+		const PxQueryFilterData filterDataPX = CreateQueryFilterData(sweepInfo.pFilterData, queryFlags);
+		const PxHitFlags hitFlags = PxHitFlag::ePOSITION | PxHitFlag::eNORMAL;
+
+		PxSweepBuffer sweepBuffer(batch.SweepHits.GetData() + result.FirstHit, maxTouches);
+		if (m_pScene->sweep(queryGeometry.any(), transform, directionPX, sweepInfo.MaxDistance, sweepBuffer, hitFlags, filterDataPX, &m_RaycastQueryFilterCallback))
+		{
+			if (maxTouches > 0)
+			{
+				result.HitCount = sweepBuffer.getNbTouches();
+			}
+			else
+			{
+				batch.SweepHits[result.FirstHit] = sweepBuffer.block;
+				result.HitCount = 1;
+			}
+		}
+	}
+
+	void PhysicsSystem::ExecuteBatchedOverlap(SceneQueryBatch& batch, uint32 queryIdx)
+	{
+		const OverlapQueryInfo& overlapInfo = batch.Overlaps[queryIdx];
+		SceneQueryResult& result = batch.OverlapResults[queryIdx];
+		const uint32 maxTouches = batch.MaxTouchesPerQuery;
+
+		result.FirstHit = queryIdx * std::max(maxTouches, 1u);
+		result.HitCount = 0;
+
+		if (maxTouches > 0)
+		{
+			PxOverlapBuffer overlapBuffer(batch.OverlapHits.GetData() + result.FirstHit, maxTouches);
+			if (QueryOverlap(overlapInfo, overlapBuffer))
+			{
+				result.HitCount = overlapBuffer.getNbTouches();
+			}
+		}
+		else
+		{
+			// Without touches any overlapping shape is reported as the blocking hit
+			const glm::vec3& position = overlapInfo.Position;
+			const glm::quat& rotation = overlapInfo.Rotation;
+			const PxTransform transform = overlapInfo.GeometryType == EGeometryType::PLANE ?
+				CreatePlaneTransform(position, rotation) :
+				PxTransform(position.x, position.y, position.z, PxQuat(rotation.x, rotation.y, rotation.z, rotation.w));
+
+			const PxGeometryHolder queryGeometry = CreateQueryGeometry(overlapInfo.GeometryType, overlapInfo.GeometryParams);
+			const PxQueryFilterData filterDataPX = CreateQueryFilterData(
+				overlapInfo.pFilterData,
+				PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | PxQueryFlag::ePREFILTER | PxQueryFlag::eANY_HIT);
+
+			PxOverlapBuffer overlapBuffer;
+			if (m_pScene->overlap(queryGeometry.any(), transform, overlapBuffer, filterDataPX, &m_RaycastQueryFilterCallback))
+			{
+				batch.OverlapHits[result.FirstHit] = overlapBuffer.block;
+				result.HitCount = 1;
+			}
+		}
 	}
 
 	void PhysicsSystem::StaticCollisionDestructor(StaticCollisionComponent& collisionComponent, Entity entity)
@@ -709,6 +845,22 @@ namespace LambdaEngine
 		if (pActor)
 		{
 			m_pScene->removeActor(*pActor);
+
+			ActorUserData* pUserData = reinterpret_cast<ActorUserData*>(pActor->userData);
+			if (pUserData->IsInterpolated)
+			{
+				for (uint32 actorIdx = 0; actorIdx < m_MovedActors.GetSize(); actorIdx++)
+				{
+					if (m_MovedActors[actorIdx] == pActor)
+					{
+						m_MovedActors[actorIdx] = m_MovedActors.GetBack();
+						m_MovedActors.PopBack();
+						break;
+					}
+				}
+
+				pUserData->IsInterpolated = false;
+			}
 		}
 	}
 
@@ -762,6 +914,11 @@ namespace LambdaEngine
 
 		FinalizeCollisionActor(collisionInfo, pActor);
 
+		ActorUserData* pUserData = reinterpret_cast<ActorUserData*>(pActor->userData);
+		pUserData->PreviousPose	= transformPX;
+		pUserData->CurrentPose	= transformPX;
+		pUserData->IsDynamic	= true;
+
 		return { pActor };
 	}
 
@@ -835,6 +992,79 @@ namespace LambdaEngine
 		pUserData->Entity = collisionInfo.Entity;
 	}
 
+	void PhysicsSystem::UpdateMovedActors()
+	{
+		// Actors moved by the previous step are interpolated to their last pose once more before they are dropped
+		uint32 keptCount = 0;
+		for (PxRigidDynamic* pActor : m_MovedActors)
+		{
+			ActorUserData* pUserData = reinterpret_cast<ActorUserData*>(pActor->userData);
+			pUserData->PreviousPose = pUserData->CurrentPose;
+
+			if (pUserData->IsMoving)
+			{
+				pUserData->IsMoving = false;
+				m_MovedActors[keptCount++] = pActor;
+			}
+			else
+			{
+				pUserData->IsInterpolated = false;
+			}
+		}
+
+		m_MovedActors.Resize(keptCount);
+
+		ComponentArray<VelocityComponent>* pVelocityComponents = ECSCore::GetInstance()->GetComponentArray<VelocityComponent>();
+
+		PxU32 activeActorCount = 0;
+		PxActor** ppActiveActors = m_pScene->getActiveActors(activeActorCount);
+		for (PxU32 actorIdx = 0; actorIdx < activeActorCount; actorIdx++)
+		{
+			// Character controllers and other actors without a dynamic collision component are not written back
+			PxRigidDynamic* pActor = ppActiveActors[actorIdx]->is<PxRigidDynamic>();
+			ActorUserData* pUserData = pActor ? reinterpret_cast<ActorUserData*>(pActor->userData) : nullptr;
+			if (!pUserData || !pUserData->IsDynamic)
+			{
+				continue;
+			}
+
+			pUserData->PreviousPose	= pUserData->CurrentPose;
+			pUserData->CurrentPose	= pActor->getGlobalPose();
+			pUserData->IsMoving		= true;
+
+			if (!pUserData->IsInterpolated)
+			{
+				pUserData->IsInterpolated = true;
+				m_MovedActors.PushBack(pActor);
+			}
+
+			const PxVec3 velocityPX = pActor->getLinearVelocity();
+			pVelocityComponents->GetData(pUserData->Entity).Velocity = { velocityPX.x, velocityPX.y, velocityPX.z };
+		}
+	}
+
+	void PhysicsSystem::InterpolateMovedActors(float32 alpha)
+	{
+		ECSCore* pECS = ECSCore::GetInstance();
+		ComponentArray<PositionComponent>* pPositionComponents = pECS->GetComponentArray<PositionComponent>();
+		ComponentArray<RotationComponent>* pRotationComponents = pECS->GetComponentArray<RotationComponent>();
+
+		for (PxRigidDynamic* pActor : m_MovedActors)
+		{
+			const ActorUserData* pUserData = reinterpret_cast<const ActorUserData*>(pActor->userData);
+			const PxTransform& previousPX	= pUserData->PreviousPose;
+			const PxTransform& currentPX	= pUserData->CurrentPose;
+
+			const glm::vec3 previousPosition	= { previousPX.p.x, previousPX.p.y, previousPX.p.z };
+			const glm::vec3 currentPosition		= { currentPX.p.x, currentPX.p.y, currentPX.p.z };
+			pPositionComponents->GetData(pUserData->Entity).Position = glm::mix(previousPosition, currentPosition, alpha);
+
+			const glm::quat previousRotation	= { previousPX.q.w, previousPX.q.x, previousPX.q.y, previousPX.q.z };
+			const glm::quat currentRotation		= { currentPX.q.w, currentPX.q.x, currentPX.q.y, currentPX.q.z };
+			pRotationComponents->GetData(pUserData->Entity).Quaternion = glm::slerp(previousRotation, currentRotation, alpha);
+		}
+	}
+
 	void PhysicsSystem::TriggerCallbacks(const std::array<PxRigidActor*, 2>& actors, const std::array<PxShape*, 2>& shapes) const
 	{
 		ActorUserData* pActorUserDatas[2] =
@@ -1,6 +1,7 @@
 #include "Game/ECS/Systems/Rendering/AnimationSystem.h"
 #include "Game/ECS/Components/Rendering/AnimationComponent.h"
 #include "Game/ECS/Components/Rendering/MeshComponent.h"
+#include "Game/ECS/Components/Rendering/CameraComponent.h"
 #include "Game/ECS/Components/Misc/InheritanceComponent.h"
 
 #include "Resources/ResourceManager.h"
@@ -13,6 +14,33 @@
 
 namespace LambdaEngine
 {
+	/*
+	* Same as translate * toMat4(rotation) * scale, without the matrix products
+	*/
+	FORCEINLINE static glm::mat4 SQTToMatrix(const SQT& sqt)
+	{
+		glm::mat4 transform = glm::toMat4(sqt.Rotation);
+		transform[0] *= sqt.Scale.x;
+		transform[1] *= sqt.Scale.y;
+		transform[2] *= sqt.Scale.z;
+		transform[3] = glm::vec4(sqt.Translation, 1.0f);
+		return transform;
+	}
+
+	/*
+	* Product of two affine transforms. The bottom row is always (0, 0, 0, 1), so each column only needs
+	* three multiply-adds of whole columns
+	*/
+	FORCEINLINE static glm::mat4 MultiplyAffine(const glm::mat4& lhs, const glm::mat4& rhs)
+	{
+		glm::mat4 result;
+		result[0] = lhs[0] * rhs[0].x + lhs[1] * rhs[0].y + lhs[2] * rhs[0].z;
+		result[1] = lhs[0] * rhs[1].x + lhs[1] * rhs[1].y + lhs[2] * rhs[1].z;
+		result[2] = lhs[0] * rhs[2].x + lhs[1] * rhs[2].y + lhs[2] * rhs[2].z;
+		result[3] = lhs[0] * rhs[3].x + lhs[1] * rhs[3].y + lhs[2] * rhs[3].z + lhs[3];
+		return result;
+	}
+
 	bool AnimationSystem::Init()
 	{
 		SystemRegistration systemReg = {};
@@ -33,6 +61,14 @@ namespace LambdaEngine
 					{ R, ParentComponent::Type() }
 				},
 			},
+			{
+				.pSubscriber = &m_CameraEntities,
+				.ComponentAccesses =
+				{
+					{ R, CameraComponent::Type() },
+					{ R, PositionComponent::Type() }
+				},
+			},
 		};
 
 		systemReg.Phase = 0;
@@ -50,7 +86,7 @@ namespace LambdaEngine
 	{
 	}
 
-	void AnimationSystem::Animate(AnimationComponent& animation)
+	void AnimationSystem::Animate(AnimationComponent& animation, float64 deltaTimeInSeconds, uint32 maxJointDepth, PoseCache* pPoseCache)
 	{
 		// Make sure we have enough matrices
 		Skeleton& skeleton = *animation.Pose.pSkeleton;
@@ -64,46 +100,72 @@ namespace LambdaEngine
 			animation.Pose.GlobalTransforms.Resize(skeleton.Joints.GetSize(), glm::mat4(1.0f));
 		}
 
-		// Call the graphs tick
+		// A graph that plays a single clip only advances its time here, the clip is sampled below unless another instance already has
 		VALIDATE(animation.pGraph != nullptr);
-		animation.pGraph->Tick(skeleton, GetDeltaTimeInSeconds());
+		AnimationGraph& graph = *animation.pGraph;
+		graph.SetMaxJointDepth(maxJointDepth);
+
+		ClipNode* pClip = pPoseCache == nullptr || graph.IsTransitioning() ? nullptr : graph.GetCurrentState()->GetOutputClip();
+		if (pClip && pClip->GetAnimation())
+		{
+			pClip->SetDeferSampling(true);
+		}
+		else
+		{
+			pClip = nullptr;
+		}
+
+		// Call the graphs tick
+		graph.Tick(skeleton, deltaTimeInSeconds);
+
+		PoseCacheKey poseKey;
+		if (pClip)
+		{
+			pClip->SetDeferSampling(false);
+
+			poseKey.pAnimation		= pClip->GetAnimation();
+			poseKey.pSkeleton		= &skeleton;
+			poseKey.Subframe		= uint32(glm::round(pClip->GetFrame() * ANIMATION_POSE_CACHE_SUBFRAMES));
+			poseKey.MaxJointDepth	= maxJointDepth;
+			if (pPoseCache->Find(poseKey, animation.Pose.GlobalTransforms))
+			{
+				return;
+			}
 
-		// Create localtransforms
-		const TArray<SQT>& currentFrame = animation.pGraph->GetCurrentFrame();
+			// Sampled at the rounded time, so every instance that finds this pose gets exactly what it would have evaluated
+			pClip->Sample(skeleton, float64(poseKey.Subframe) / ANIMATION_POSE_CACHE_SUBFRAMES);
+		}
+
+		// Create localtransforms, joints left out by the LOD use the bind pose
+		const TArray<SQT>& currentFrame = pClip ? pClip->GetResult() : graph.GetCurrentFrame();
 		for (uint32 i = 0; i < currentFrame.GetSize(); i++)
 		{
 			const SQT& sqt = currentFrame[i];
 			if (sqt.JointID != INVALID_JOINT_ID)
 			{
-				glm::mat4 transform	= glm::translate(glm::identity<glm::mat4>(), sqt.Translation);
-				transform			= transform * glm::toMat4(sqt.Rotation);
-				transform			= glm::scale(transform, sqt.Scale);
-				animation.Pose.LocalTransforms[sqt.JointID] = transform;
+				animation.Pose.LocalTransforms[sqt.JointID] = skeleton.JointDepths[sqt.JointID] <= maxJointDepth ? SQTToMatrix(sqt) : skeleton.RelativeTransforms[sqt.JointID];
 			}
 		}
 
-		// Create global transforms
-		for (uint32 i = 0; i < skeleton.Joints.GetSize(); i++)
+		// Create model space transforms in one pass, parents are evaluated before their children
+		const TArray<glm::mat4>& localTransforms = animation.Pose.LocalTransforms;
+		TArray<glm::mat4>& globalTransforms = animation.Pose.GlobalTransforms;
+		for (JointIndexType jointID : skeleton.EvaluationOrder)
 		{
-			const Joint& joint = skeleton.Joints[i];
-			animation.Pose.GlobalTransforms[i] = 
-				skeleton.InverseGlobalTransform * 
-				ApplyParent(joint, skeleton, animation.Pose.LocalTransforms) * 
-				joint.InvBindTransform;
+			const JointIndexType parentID = skeleton.Joints[jointID].ParentBoneIndex;
+			const glm::mat4& parentTransform = parentID == INVALID_JOINT_ID ? skeleton.RootNodeTransform : globalTransforms[parentID];
+			globalTransforms[jointID] = MultiplyAffine(parentTransform, localTransforms[jointID]);
 		}
-	}
 
-	glm::mat4 AnimationSystem::ApplyParent(const Joint& joint, Skeleton& skeleton, TArray<glm::mat4>& matrices)
-	{
-		const int32 parentID	= joint.ParentBoneIndex;
-		const int32 myID		= skeleton.JointMap[joint.Name];
-		if (parentID == INVALID_JOINT_ID)
+		// Move into skinning space once every child has read its parent
+		for (uint32 i = 0; i < skeleton.Joints.GetSize(); i++)
 		{
-			return skeleton.RootNodeTransform * matrices[myID];
+			globalTransforms[i] = MultiplyAffine(skeleton.InverseGlobalTransform, MultiplyAffine(globalTransforms[i], skeleton.Joints[i].InvBindTransform));
 		}
-		else
+
+		if (pClip)
 		{
-			return ApplyParent(skeleton.Joints[parentID], skeleton, matrices) * matrices[myID];
+			pPoseCache->Insert(poseKey, globalTransforms);
 		}
 	}
 
@@ -130,26 +192,71 @@ namespace LambdaEngine
 		// Animation system has its own clock to keep track of time
 		m_Clock.Tick();
 
+		// Animation LOD is picked by the distance to the active camera
+		const ComponentArray<CameraComponent>* pCameraComponents = pECSCore->GetComponentArray<CameraComponent>();
+		const ComponentArray<PositionComponent>* pPositionComponents = pECSCore->GetComponentArray<PositionComponent>();
+
+		bool hasCamera = false;
+		glm::vec3 cameraPosition = glm::vec3(0.0f);
+		for (Entity entity : m_CameraEntities.GetIDs())
+		{
+			if (pCameraComponents->GetConstData(entity).IsActive)
+			{
+				cameraPosition	= pPositionComponents->GetConstData(entity).Position;
+				hasCamera		= true;
+				break;
+			}
+		}
+
+		m_FrameIndex++;
+		m_PoseCache.Reset(m_AnimationEntities.Size());
+
+		const float64 deltaTimeInSeconds = GetDeltaTimeInSeconds();
+
+		JobCounter animationJobs;
 		for (Entity entity : m_AnimationEntities.GetIDs())
 		{
 			AnimationComponent& animation = pAnimationComponents->GetData(entity);
-			if (!animation.IsPaused)
+			if (animation.IsPaused)
 			{
-				std::function<void()> func = [this, &animation]
+				continue;
+			}
+
+			animation.PendingTime += deltaTimeInSeconds;
+
+			uint32 updateInterval	= 1;
+			uint32 maxJointDepth	= UINT32_MAX;
+			if (hasCamera && !animation.IgnoreLOD && pPositionComponents->HasComponent(entity))
+			{
+				const float32 distance = glm::distance(cameraPosition, pPositionComponents->GetConstData(entity).Position);
+				if (distance > ANIMATION_LOD2_DISTANCE)
 				{
-					Animate(animation);
-				};
+					updateInterval	= 4;
+					maxJointDepth	= ANIMATION_LOD2_MAX_JOINT_DEPTH;
+				}
+				else if (distance > ANIMATION_LOD1_DISTANCE)
+				{
+					updateInterval	= 2;
+				}
+			}
 
-				m_JobIndices.EmplaceBack(ThreadPool::Execute(func));
+			// Skipped updates are staggered by entity so the work is spread out over the frames
+			if (((m_FrameIndex + entity) & (updateInterval - 1)) != 0)
+			{
+				continue;
 			}
+
+			const float64 animationTime = animation.PendingTime;
+			animation.PendingTime = 0.0;
+
+			ThreadPool::Execute(animationJobs, [this, &animation, animationTime, maxJointDepth]
+			{
+				Animate(animation, animationTime, maxJointDepth, &m_PoseCache);
+			});
 		}
 
 		// Wait for all jobs to finish
-		for (uint32 index : m_JobIndices)
-		{
-			ThreadPool::Join(index);
-		}
-		m_JobIndices.Clear();
+		ThreadPool::Wait(animationJobs);
 
 		//Update Attached Animation Components
 		const ComponentArray<ParentComponent>* pParentComponents = pECSCore->GetComponentArray<ParentComponent>();
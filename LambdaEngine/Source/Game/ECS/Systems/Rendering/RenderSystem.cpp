@@ -50,6 +50,8 @@
 
 #include "Debug/Profiler.h"
 
+#include "Threading/API/ThreadPool.h"
+
 namespace LambdaEngine
 {
 	RenderSystem RenderSystem::s_Instance;
@@ -291,7 +293,7 @@ namespace LambdaEngine
 			{
 				{
 					FShaderStageFlag::SHADER_STAGE_FLAG_COMPUTE_SHADER,
-					4,
+					sizeof(SkinningConstants),
 					0
 				}
 			};
@@ -831,9 +833,32 @@ namespace LambdaEngine
 		PROFILE_FUNCTION("StagingBufferCache::Tick", StagingBufferCache::Tick());
 		PROFILE_FUNCTION("RenderSystem::CleanBuffers", CleanBuffers());
 
+		// Cull every view on the job system while the buffers are updated, the culling jobs only write the visible instance ranges
+		const CullingFrustum cameraFrustum = CullingFrustum::FromViewProjection(
+			m_PerFrameData.CamData.Projection * m_PerFrameData.CamData.View,
+			glm::vec3(m_PerFrameData.CamData.Position),
+			INSTANCE_CULLER_MIN_RADIUS_PER_DISTANCE);
+		const CullingFrustum directionalLightFrustum = CullingFrustum::FromViewProjection(m_LightBufferData.DirL_ProjViews, glm::vec3(0.0f), 0.0f);
+
+		const CullingFrustum* pCameraFrustum			= !m_CameraEntities.Empty() ? &cameraFrustum : nullptr;
+		const CullingFrustum* pDirectionalLightFrustum	= m_DirectionalExist ? &directionalLightFrustum : nullptr;
+
+		JobCounter cullingJobs;
+		ThreadPool::Execute(cullingJobs, [this, pCameraFrustum]
+		{
+			CullInstances(ECullingView::CULLING_VIEW_CAMERA, pCameraFrustum);
+		});
+
+		ThreadPool::Execute(cullingJobs, [this, pDirectionalLightFrustum]
+		{
+			CullInstances(ECullingView::CULLING_VIEW_DIRECTIONAL_LIGHT, pDirectionalLightFrustum);
+		});
+
 		PROFILE_FUNCTION("RenderSystem::UpdateBuffers", UpdateBuffers());
 		PROFILE_FUNCTION("RenderSystem::UpdateRenderGraph", UpdateRenderGraph());
 
+		PROFILE_FUNCTION("RenderSystem::CullInstances", ThreadPool::Wait(cullingJobs));
+
 		PROFILE_FUNCTION("m_pRenderGraph->Update", m_pRenderGraph->Update(delta, (uint32)m_ModFrameIndex, m_BackBufferIndex));
 
 		PROFILE_FUNCTION("m_pRenderGraph->Render", m_pRenderGraph->Render(m_ModFrameIndex, m_BackBufferIndex));
@@ -915,6 +940,11 @@ namespace LambdaEngine
 		m_LightsBufferDirty					= true;
 		m_PointLightsDirty					= true;
 
+		for (const auto& renderStageCullingView : m_RenderStageCullingViews)
+		{
+			m_pRenderGraph->SetRenderStageCullingView(renderStageCullingView.first, renderStageCullingView.second);
+		}
+
 		UpdateRenderGraph();
 	}
 
@@ -941,6 +971,19 @@ namespace LambdaEngine
 
 	}
 
+	void RenderSystem::SetRenderStageCullingView(const String& renderStageName, ECullingView cullingView)
+	{
+		if (m_pRenderGraph != nullptr)
+		{
+			m_RenderStageCullingViews[renderStageName] = cullingView;
+			m_pRenderGraph->SetRenderStageCullingView(renderStageName, cullingView);
+		}
+		else
+		{
+			LOG_WARNING("SetRenderStageCullingView failed - Rendergraph not initilised");
+		}
+	}
+
 	void RenderSystem::SetPaintMaskColor(uint32 index, const glm::vec3& color)
 	{
 		if (index < m_PaintMaskColors.GetSize())
@@ -1261,17 +1304,21 @@ bool RenderSystem::InitIntegrationLUT()
 
 				// Vertices
 				{
+					// Animated meshes are skinned from the packed vertices when there are any, the skinned vertices always use the full layout
+					const bool isVertexBufferPacked = isAnimated && !pMesh->PackedVertices.IsEmpty();
+					const void* pVertexData = isVertexBufferPacked ? (const void*)pMesh->PackedVertices.GetData() : (const void*)pMesh->Vertices.GetData();
+
 					BufferDesc vertexStagingBufferDesc = {};
 					vertexStagingBufferDesc.DebugName	= "Vertex Staging Buffer";
 					vertexStagingBufferDesc.MemoryType	= EMemoryType::MEMORY_TYPE_CPU_VISIBLE;
 					vertexStagingBufferDesc.Flags		= FBufferFlag::BUFFER_FLAG_COPY_SRC;
-					vertexStagingBufferDesc.SizeInBytes = pMesh->Vertices.GetSize() * sizeof(Vertex);
+					vertexStagingBufferDesc.SizeInBytes = isVertexBufferPacked ? pMesh->PackedVertices.GetSize() * sizeof(PackedVertex) : pMesh->Vertices.GetSize() * sizeof(Vertex);
 
 					Buffer* pVertexStagingBuffer = RenderAPI::GetDevice()->CreateBuffer(&vertexStagingBufferDesc);
 					VALIDATE(pVertexStagingBuffer != nullptr);
 
 					void* pMapped = pVertexStagingBuffer->Map();
-					memcpy(pMapped, pMesh->Vertices.GetData(), vertexStagingBufferDesc.SizeInBytes);
+					memcpy(pMapped, pVertexData, vertexStagingBufferDesc.SizeInBytes);
 					pVertexStagingBuffer->Unmap();
 
 					BufferDesc vertexBufferDesc = {};
@@ -1281,7 +1328,10 @@ bool RenderSystem::InitIntegrationLUT()
 					vertexBufferDesc.SizeInBytes	= vertexStagingBufferDesc.SizeInBytes;
 
 					meshEntry.pVertexBuffer = RenderAPI::GetDevice()->CreateBuffer(&vertexBufferDesc);
-					meshEntry.VertexCount	= pMesh->Vertices.GetSize();
+					meshEntry.VertexCount			= pMesh->Vertices.GetSize();
+					meshEntry.IsVertexBufferPacked	= isVertexBufferPacked;
+					meshEntry.PackedPositionMin		= pMesh->PackedPositionMin;
+					meshEntry.PackedPositionExtent	= pMesh->PackedPositionExtent;
 					VALIDATE(meshEntry.pVertexBuffer != nullptr);
 
 					m_PendingBufferUpdates.PushBack({ pVertexStagingBuffer, 0, meshEntry.pVertexBuffer, 0, vertexBufferDesc.SizeInBytes });
@@ -1300,6 +1350,7 @@ bool RenderSystem::InitIntegrationLUT()
 					else
 					{
 						vertexBufferDesc.DebugName		= "Animated Vertices Buffer";
+						vertexBufferDesc.SizeInBytes	= pMesh->Vertices.GetSize() * sizeof(Vertex);
 						meshEntry.pAnimatedVertexBuffer = RenderAPI::GetDevice()->CreateBuffer(&vertexBufferDesc);
 						VALIDATE(meshEntry.pAnimatedVertexBuffer != nullptr);
 
@@ -1338,6 +1389,22 @@ bool RenderSystem::InitIntegrationLUT()
 					}
 				}
 
+				// Culling bounds, the BoundingBox of the mesh is centered on the average position so they are taken from the vertices
+				{
+					meshEntry.IsCullable = !isAnimated && !pMesh->Vertices.IsEmpty();
+					if (meshEntry.IsCullable)
+					{
+						meshEntry.LocalBoundsMin = glm::vec3(FLT_MAX);
+						meshEntry.LocalBoundsMax = glm::vec3(-FLT_MAX);
+						for (const Vertex& vertex : pMesh->Vertices)
+						{
+							const glm::vec3 position = vertex.ExtractPosition();
+							meshEntry.LocalBoundsMin = glm::min(meshEntry.LocalBoundsMin, position);
+							meshEntry.LocalBoundsMax = glm::max(meshEntry.LocalBoundsMax, position);
+						}
+					}
+				}
+
 				// Indices
 				{
 					BufferDesc indexStagingBufferDesc = {};
@@ -1627,6 +1694,16 @@ bool RenderSystem::InitIntegrationLUT()
 		instance.TeamIndex					= teamIndex;
 		meshAndInstancesIt->second.RasterInstances.PushBack(instance);
 
+		if (meshAndInstancesIt->second.IsCullable)
+		{
+			glm::vec3 boundsMin;
+			glm::vec3 boundsMax;
+			InstanceCuller::TransformBounds(meshAndInstancesIt->second.LocalBoundsMin, meshAndInstancesIt->second.LocalBoundsMax, transform, boundsMin, boundsMax);
+
+			const uint32 cullingProxy = m_InstanceCuller.AddInstance(boundsMin, boundsMax, &meshAndInstancesIt->second, instanceKey.InstanceIndex);
+			meshAndInstancesIt->second.CullingProxies.PushBack(cullingProxy);
+		}
+
 		m_DirtyRasterInstanceBuffers.insert(&meshAndInstancesIt->second);
 
 		//Update Dirty Draw Args
@@ -1764,6 +1841,20 @@ bool RenderSystem::InitIntegrationLUT()
 		rasterInstances.PopBack();
 		m_DirtyRasterInstanceBuffers.insert(&meshAndInstancesIt->second);
 
+		if (meshAndInstancesIt->second.IsCullable)
+		{
+			TArray<uint32>& cullingProxies = meshAndInstancesIt->second.CullingProxies;
+			m_InstanceCuller.RemoveInstance(cullingProxies[instanceIndex]);
+
+			cullingProxies[instanceIndex] = cullingProxies.GetBack();
+			cullingProxies.PopBack();
+
+			if (instanceIndex < cullingProxies.GetSize())
+			{
+				m_InstanceCuller.SetInstanceIndex(cullingProxies[instanceIndex], instanceIndex);
+			}
+		}
+
 		Entity swappedEntityID = meshAndInstancesIt->second.EntityIDs.GetBack();
 		meshAndInstancesIt->second.EntityIDs[instanceIndex] = swappedEntityID;
 		meshAndInstancesIt->second.EntityIDs.PopBack();
@@ -1839,6 +1930,15 @@ bool RenderSystem::InitIntegrationLUT()
 		pRasterInstanceToUpdate->PrevTransform	= pRasterInstanceToUpdate->Transform;
 		pRasterInstanceToUpdate->Transform		= transform;
 		m_DirtyRasterInstanceBuffers.insert(&meshAndInstancesIt->second);
+
+		if (meshAndInstancesIt->second.IsCullable)
+		{
+			glm::vec3 boundsMin;
+			glm::vec3 boundsMax;
+			InstanceCuller::TransformBounds(meshAndInstancesIt->second.LocalBoundsMin, meshAndInstancesIt->second.LocalBoundsMax, transform, boundsMin, boundsMax);
+
+			m_InstanceCuller.MoveInstance(meshAndInstancesIt->second.CullingProxies[instanceKeyIt->second.InstanceIndex], boundsMin, boundsMax);
+		}
 	}
 
 	void RenderSystem::RebuildBLAS(Entity entity, GUID_Lambda meshGUID, bool isAnimated, bool forceUniqueResources, bool manualResourceDeletion)
@@ -1855,7 +1955,7 @@ bool RenderSystem::InitIntegrationLUT()
 				m_pASBuilder->BuildTriBLAS(
 					pMeshEntry->BLASIndex,
 					0U,
-					pMeshEntry->pVertexBuffer,
+					pMeshEntry->pAnimatedVertexBuffer ? pMeshEntry->pAnimatedVertexBuffer : pMeshEntry->pVertexBuffer,
 					pMeshEntry->pIndexBuffer,
 					pMeshEntry->VertexCount,
 					sizeof(Vertex),
@@ -2492,6 +2592,11 @@ bool RenderSystem::InitIntegrationLUT()
 				drawArg.pDescriptorSet				= meshEntryPair.second.pDrawArgDescriptorSet;
 				drawArg.pExtensionDataDescriptorSet	= meshEntryPair.second.pDrawArgDescriptorExtensionsSet;
 
+				for (uint32 v = 0; v < (uint32)ECullingView::CULLING_VIEW_COUNT; v++)
+				{
+					drawArg.ppVisibleInstanceRanges[v] = &meshEntryPair.second.VisibleInstanceRanges[v];
+				}
+
 				drawArgs.PushBack(drawArg);
 			}
 		}
@@ -2632,8 +2737,9 @@ bool RenderSystem::InitIntegrationLUT()
 			meshEntry.pAnimationDescriptorSet	= RenderAPI::GetDevice()->CreateDescriptorSet("Animation Descriptor Set", m_SkinningPipelineLayout.Get(), 0, m_AnimationDescriptorHeap.Get());
 
 			const uint64 offset = 0;
-			uint64 size = meshEntry.VertexCount * sizeof(Vertex);
+			uint64 size = meshEntry.VertexCount * (meshEntry.IsVertexBufferPacked ? sizeof(PackedVertex) : sizeof(Vertex));
 			meshEntry.pAnimationDescriptorSet->WriteBufferDescriptors(&meshEntry.pVertexBuffer,			&offset, &size,			0, 1, EDescriptorType::DESCRIPTOR_TYPE_UNORDERED_ACCESS_BUFFER);
+			size = meshEntry.VertexCount * sizeof(Vertex);
 			meshEntry.pAnimationDescriptorSet->WriteBufferDescriptors(&meshEntry.pAnimatedVertexBuffer,	&offset, &size,			1, 1, EDescriptorType::DESCRIPTOR_TYPE_UNORDERED_ACCESS_BUFFER);
 			meshEntry.pAnimationDescriptorSet->WriteBufferDescriptors(&meshEntry.pBoneMatrixBuffer,		&offset, &sizeInBytes,	2, 1, EDescriptorType::DESCRIPTOR_TYPE_UNORDERED_ACCESS_BUFFER);
 			size = meshEntry.VertexCount * sizeof(VertexJointData);
@@ -2661,8 +2767,14 @@ bool RenderSystem::InitIntegrationLUT()
 			pCommandList->BindDescriptorSetCompute(pMeshEntry->pAnimationDescriptorSet, m_SkinningPipelineLayout.Get(), 0);
 			pCommandList->BindComputePipeline(pPipeline);
 
+			SkinningConstants skinningConstants;
+			skinningConstants.VertexCount			= pMeshEntry->VertexCount;
+			skinningConstants.IsVertexBufferPacked	= pMeshEntry->IsVertexBufferPacked ? 1 : 0;
+			skinningConstants.PackedPositionMin		= glm::vec4(pMeshEntry->PackedPositionMin, 0.0f);
+			skinningConstants.PackedPositionExtent	= glm::vec4(pMeshEntry->PackedPositionExtent, 0.0f);
+			pCommandList->SetConstantRange(m_SkinningPipelineLayout.Get(), FShaderStageFlag::SHADER_STAGE_FLAG_COMPUTE_SHADER, &skinningConstants, sizeof(SkinningConstants), 0);
+
 			const uint32 vertexCount = pMeshEntry->VertexCount;
-			pCommandList->SetConstantRange(m_SkinningPipelineLayout.Get(), FShaderStageFlag::SHADER_STAGE_FLAG_COMPUTE_SHADER, &vertexCount, sizeof(uint32), 0);
 
 			const uint32 workGroupCount = std::max<uint32>((uint32)AlignUp(vertexCount, THREADS_PER_WORKGROUP) / THREADS_PER_WORKGROUP, 1u);
 			pCommandList->Dispatch(workGroupCount, 1, 1);
@@ -3075,6 +3187,53 @@ bool RenderSystem::InitIntegrationLUT()
 		}
 	}
 
+	void RenderSystem::CullInstances(ECullingView cullingView, const CullingFrustum* pFrustum)
+	{
+		const uint32 cullingViewIndex = static_cast<uint32>(cullingView);
+
+		for (auto& meshEntryPair : m_MeshAndInstancesMap)
+		{
+			MeshEntry& meshEntry = meshEntryPair.second;
+			TArray<DrawArgInstanceRange>& visibleInstanceRanges = meshEntry.VisibleInstanceRanges[cullingViewIndex];
+			visibleInstanceRanges.Clear();
+
+			if ((!meshEntry.IsCullable || pFrustum == nullptr) && !meshEntry.RasterInstances.IsEmpty())
+			{
+				visibleInstanceRanges.PushBack({ 0, meshEntry.RasterInstances.GetSize() });
+			}
+		}
+
+		if (pFrustum == nullptr)
+		{
+			return;
+		}
+
+		TArray<CulledInstance>& visibleInstances = m_VisibleInstances[cullingViewIndex];
+		visibleInstances.Clear();
+		m_InstanceCuller.Cull(*pFrustum, visibleInstances);
+
+		// Sort the instances by MeshEntry and index so that neighbouring visible instances are drawn with a single draw
+		std::sort(visibleInstances.GetData(), visibleInstances.GetData() + visibleInstances.GetSize(), [](const CulledInstance& lhs, const CulledInstance& rhs)
+			{
+				return lhs.pUserData != rhs.pUserData ? lhs.pUserData < rhs.pUserData : lhs.InstanceIndex < rhs.InstanceIndex;
+			});
+
+		for (const CulledInstance& visibleInstance : visibleInstances)
+		{
+			MeshEntry* pMeshEntry = reinterpret_cast<MeshEntry*>(visibleInstance.pUserData);
+			TArray<DrawArgInstanceRange>& visibleInstanceRanges = pMeshEntry->VisibleInstanceRanges[cullingViewIndex];
+
+			if (!visibleInstanceRanges.IsEmpty() && visibleInstanceRanges.GetBack().FirstInstance + visibleInstanceRanges.GetBack().InstanceCount == visibleInstance.InstanceIndex)
+			{
+				visibleInstanceRanges.GetBack().InstanceCount++;
+			}
+			else
+			{
+				visibleInstanceRanges.PushBack({ visibleInstance.InstanceIndex, 1 });
+			}
+		}
+	}
+
 	void RenderSystem::UpdateRenderGraph()
 	{
 		if (!m_DirtyDrawArgs.empty())
@@ -29,6 +29,11 @@
 #elif defined(LAMBDA_PLATFORM_MACOS)
 	#define aligned_malloc(sizeInBytes, alignment) 				aligned_alloc(sizeInBytes, alignment)
 
+	#define debug_malloc(sizeInBytes, pFileName, lineNumber)	malloc(sizeInBytes); (void)pFileName; (void)lineNumber
+#elif defined(LAMBDA_PLATFORM_LINUX)
+	// aligned_alloc requires the size to be a multiple of the alignment
+	#define aligned_malloc(sizeInBytes, alignment) 				aligned_alloc(alignment, ((sizeInBytes) + (alignment) - 1) & ~(uint64(alignment) - 1))
+
 	#define debug_malloc(sizeInBytes, pFileName, lineNumber)	malloc(sizeInBytes); (void)pFileName; (void)lineNumber
 #endif
 
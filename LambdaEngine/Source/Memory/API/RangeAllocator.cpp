@@ -0,0 +1,298 @@
+#include "Memory/API/RangeAllocator.h"
+
+#include <bit>
+
+namespace LambdaEngine
+{
+	void RangeAllocator::Init(uint32 capacity)
+	{
+		m_Blocks.Clear();
+		m_UnusedBlocks		= INVALID_BLOCK;
+		m_Capacity			= capacity;
+		m_FreeSize			= capacity;
+		m_FreeRangeCount	= 0;
+
+		m_FirstLevelBitmap = 0;
+		for (uint32 firstLevel = 0; firstLevel < FIRST_LEVEL_COUNT; firstLevel++)
+		{
+			m_SecondLevelBitmaps[firstLevel] = 0;
+			for (uint32 secondLevel = 0; secondLevel < SECOND_LEVEL_COUNT; secondLevel++)
+			{
+				m_FreeLists[firstLevel][secondLevel] = INVALID_BLOCK;
+			}
+		}
+
+		if (capacity > 0)
+		{
+			const uint32 block = AllocateBlock();
+			m_Blocks[block].Offset	= 0;
+			m_Blocks[block].Size	= capacity;
+			InsertFreeBlock(block);
+		}
+	}
+
+	bool RangeAllocator::Allocate(uint32 size, RangeAllocation& allocation)
+	{
+		if (size == 0)
+		{
+			return false;
+		}
+
+		uint32 block = FindFreeBlock(size);
+		if (block == INVALID_BLOCK)
+		{
+			// The search skips the list the size maps to, one of its first blocks may still be large enough
+			uint32 firstLevel;
+			uint32 secondLevel;
+			MapSize(size, firstLevel, secondLevel);
+
+			uint32 candidate = m_FreeLists[firstLevel][secondLevel];
+			for (uint32 attempt = 0; attempt < MAX_FALLBACK_CANDIDATES && candidate != INVALID_BLOCK; attempt++, candidate = m_Blocks[candidate].NextFree)
+			{
+				if (m_Blocks[candidate].Size >= size)
+				{
+					block = candidate;
+					break;
+				}
+			}
+
+			if (block == INVALID_BLOCK)
+			{
+				return false;
+			}
+		}
+
+		RemoveFreeBlock(block);
+
+		// The rest of the block is returned as a free block of its own
+		if (m_Blocks[block].Size > size)
+		{
+			const uint32 remainder = AllocateBlock();
+			Block& usedBlock		= m_Blocks[block];
+			Block& remainderBlock	= m_Blocks[remainder];
+
+			remainderBlock.Offset		= usedBlock.Offset + size;
+			remainderBlock.Size			= usedBlock.Size - size;
+			remainderBlock.PrevPhysical	= block;
+			remainderBlock.NextPhysical	= usedBlock.NextPhysical;
+			if (usedBlock.NextPhysical != INVALID_BLOCK)
+			{
+				m_Blocks[usedBlock.NextPhysical].PrevPhysical = remainder;
+			}
+
+			usedBlock.NextPhysical	= remainder;
+			usedBlock.Size			= size;
+			InsertFreeBlock(remainder);
+		}
+
+		m_FreeSize -= size;
+
+		allocation.Offset	= m_Blocks[block].Offset;
+		allocation.Size		= size;
+		allocation.Handle	= block;
+		return true;
+	}
+
+	void RangeAllocator::Free(const RangeAllocation& allocation)
+	{
+		uint32 block = allocation.Handle;
+		if (block == INVALID_BLOCK)
+		{
+			return;
+		}
+
+		VALIDATE(block < m_Blocks.GetSize() && !m_Blocks[block].IsFree);
+		m_FreeSize += m_Blocks[block].Size;
+
+		const uint32 next = m_Blocks[block].NextPhysical;
+		if (next != INVALID_BLOCK && m_Blocks[next].IsFree)
+		{
+			RemoveFreeBlock(next);
+
+			Block& freedBlock = m_Blocks[block];
+			freedBlock.Size			+= m_Blocks[next].Size;
+			freedBlock.NextPhysical	= m_Blocks[next].NextPhysical;
+			if (freedBlock.NextPhysical != INVALID_BLOCK)
+			{
+				m_Blocks[freedBlock.NextPhysical].PrevPhysical = block;
+			}
+
+			ReleaseBlock(next);
+		}
+
+		const uint32 prev = m_Blocks[block].PrevPhysical;
+		if (prev != INVALID_BLOCK && m_Blocks[prev].IsFree)
+		{
+			RemoveFreeBlock(prev);
+
+			Block& prevBlock = m_Blocks[prev];
+			prevBlock.Size			+= m_Blocks[block].Size;
+			prevBlock.NextPhysical	= m_Blocks[block].NextPhysical;
+			if (prevBlock.NextPhysical != INVALID_BLOCK)
+			{
+				m_Blocks[prevBlock.NextPhysical].PrevPhysical = prev;
+			}
+
+			ReleaseBlock(block);
+			block = prev;
+		}
+
+		InsertFreeBlock(block);
+	}
+
+	RangeAllocatorStatistics RangeAllocator::GetStatistics() const
+	{
+		RangeAllocatorStatistics statistics = {};
+		statistics.Capacity			= m_Capacity;
+		statistics.UsedSize			= m_Capacity - m_FreeSize;
+		statistics.FreeSize			= m_FreeSize;
+		statistics.FreeRangeCount	= m_FreeRangeCount;
+
+		// The largest free range is in the last non-empty list
+		if (m_FirstLevelBitmap != 0)
+		{
+			const uint32 firstLevel		= 31 - std::countl_zero(m_FirstLevelBitmap);
+			const uint32 secondLevel	= 31 - std::countl_zero(m_SecondLevelBitmaps[firstLevel]);
+			for (uint32 block = m_FreeLists[firstLevel][secondLevel]; block != INVALID_BLOCK; block = m_Blocks[block].NextFree)
+			{
+				statistics.LargestFreeRange = std::max(statistics.LargestFreeRange, m_Blocks[block].Size);
+			}
+		}
+
+		if (m_FreeSize > 0)
+		{
+			statistics.Fragmentation = 1.0f - float32(statistics.LargestFreeRange) / float32(m_FreeSize);
+		}
+
+		return statistics;
+	}
+
+	uint32 RangeAllocator::AllocateBlock()
+	{
+		if (m_UnusedBlocks != INVALID_BLOCK)
+		{
+			const uint32 block = m_UnusedBlocks;
+			m_UnusedBlocks = m_Blocks[block].NextFree;
+			m_Blocks[block] = Block();
+			return block;
+		}
+
+		m_Blocks.PushBack(Block());
+		return m_Blocks.GetSize() - 1;
+	}
+
+	void RangeAllocator::ReleaseBlock(uint32 block)
+	{
+		m_Blocks[block] = Block();
+		m_Blocks[block].NextFree = m_UnusedBlocks;
+		m_UnusedBlocks = block;
+	}
+
+	void RangeAllocator::InsertFreeBlock(uint32 block)
+	{
+		uint32 firstLevel;
+		uint32 secondLevel;
+		MapSize(m_Blocks[block].Size, firstLevel, secondLevel);
+
+		const uint32 head = m_FreeLists[firstLevel][secondLevel];
+		Block& freeBlock = m_Blocks[block];
+		freeBlock.PrevFree	= INVALID_BLOCK;
+		freeBlock.NextFree	= head;
+		freeBlock.IsFree	= true;
+		if (head != INVALID_BLOCK)
+		{
+			m_Blocks[head].PrevFree = block;
+		}
+
+		m_FreeLists[firstLevel][secondLevel] = block;
+		m_SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+		m_FirstLevelBitmap |= 1u << firstLevel;
+		m_FreeRangeCount++;
+	}
+
+	void RangeAllocator::RemoveFreeBlock(uint32 block)
+	{
+		uint32 firstLevel;
+		uint32 secondLevel;
+		MapSize(m_Blocks[block].Size, firstLevel, secondLevel);
+
+		Block& freeBlock = m_Blocks[block];
+		if (freeBlock.PrevFree != INVALID_BLOCK)
+		{
+			m_Blocks[freeBlock.PrevFree].NextFree = freeBlock.NextFree;
+		}
+		else
+		{
+			m_FreeLists[firstLevel][secondLevel] = freeBlock.NextFree;
+			if (freeBlock.NextFree == INVALID_BLOCK)
+			{
+				m_SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+				if (m_SecondLevelBitmaps[firstLevel] == 0)
+				{
+					m_FirstLevelBitmap &= ~(1u << firstLevel);
+				}
+			}
+		}
+
+		if (freeBlock.NextFree != INVALID_BLOCK)
+		{
+			m_Blocks[freeBlock.NextFree].PrevFree = freeBlock.PrevFree;
+		}
+
+		freeBlock.PrevFree	= INVALID_BLOCK;
+		freeBlock.NextFree	= INVALID_BLOCK;
+		freeBlock.IsFree	= false;
+		m_FreeRangeCount--;
+	}
+
+	uint32 RangeAllocator::FindFreeBlock(uint32 size) const
+	{
+		// The size is rounded up to the next list, so that every block in the list that is found is large enough
+		if (size >= SECOND_LEVEL_COUNT)
+		{
+			const uint32 roundUp = (1u << (31 - std::countl_zero(size) - SECOND_LEVEL_LOG2)) - 1;
+			if (size > UINT32_MAX - roundUp)
+			{
+				return INVALID_BLOCK;
+			}
+
+			size += roundUp;
+		}
+
+		uint32 firstLevel;
+		uint32 secondLevel;
+		MapSize(size, firstLevel, secondLevel);
+
+		uint32 secondLevelBitmap = m_SecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+		if (secondLevelBitmap == 0)
+		{
+			const uint32 firstLevelBitmap = firstLevel + 1 < FIRST_LEVEL_COUNT ? m_FirstLevelBitmap & (~0u << (firstLevel + 1)) : 0;
+			if (firstLevelBitmap == 0)
+			{
+				return INVALID_BLOCK;
+			}
+
+			firstLevel = std::countr_zero(firstLevelBitmap);
+			secondLevelBitmap = m_SecondLevelBitmaps[firstLevel];
+		}
+
+		secondLevel = std::countr_zero(secondLevelBitmap);
+		return m_FreeLists[firstLevel][secondLevel];
+	}
+
+	void RangeAllocator::MapSize(uint32 size, uint32& firstLevel, uint32& secondLevel)
+	{
+		// Sizes below the second level count get one list each, larger sizes are split in lists per power of two
+		if (size < SECOND_LEVEL_COUNT)
+		{
+			firstLevel	= 0;
+			secondLevel	= size;
+		}
+		else
+		{
+			const uint32 log2 = 31 - std::countl_zero(size);
+			firstLevel	= log2 - SECOND_LEVEL_LOG2 + 1;
+			secondLevel	= (size >> (log2 - SECOND_LEVEL_LOG2)) - SECOND_LEVEL_COUNT;
+		}
+	}
+}
@@ -0,0 +1,94 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Memory/Linux/LinuxMemory.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fcntl.h>
+
+#include <unistd.h>
+
+namespace LambdaEngine
+{
+	/*
+	* munmap needs the size of the mapping, unlike VirtualFree on Windows. The size is stored in an extra page in front
+	* of the memory returned to the caller, so that the returned memory still starts at a page boundary
+	*/
+	void* LinuxMemory::VirtualAlloc(uint64 sizeInBytes)
+	{
+		const uint64 pageSize	= GetPageSize();
+		const uint64 totalSize	= sizeInBytes + pageSize;
+
+		void* pMapping = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (pMapping == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		*reinterpret_cast<uint64*>(pMapping) = totalSize;
+		return reinterpret_cast<byte*>(pMapping) + pageSize;
+	}
+
+	bool LinuxMemory::VirtualProtect(void* pMemory, uint64 sizeInBytes)
+	{
+		return mprotect(pMemory, sizeInBytes, PROT_NONE) == 0;
+	}
+
+	bool LinuxMemory::VirtualFree(void* pMemory)
+	{
+		if (pMemory == nullptr)
+		{
+			return false;
+		}
+
+		void* pMapping = reinterpret_cast<byte*>(pMemory) - GetPageSize();
+		const uint64 totalSize = *reinterpret_cast<uint64*>(pMapping);
+		return munmap(pMapping, totalSize) == 0;
+	}
+
+	uint64 LinuxMemory::GetPageSize()
+	{
+		const long pageSize = sysconf(_SC_PAGESIZE);
+		return pageSize > 0 ? uint64(pageSize) : 0;
+	}
+
+	uint64 LinuxMemory::GetAllocationGranularity()
+	{
+		// mmap places mappings at page granularity
+		return GetPageSize();
+	}
+	const void* LinuxMemory::MapFile(const char* pFilepath, uint64& sizeInBytes)
+	{
+		sizeInBytes = 0;
+
+		const int32 file = open(pFilepath, O_RDONLY);
+		if (file == -1)
+		{
+			return nullptr;
+		}
+
+		// The mapping keeps the file alive, so the descriptor can be closed right away
+		struct stat fileStat;
+		void* pMapping = MAP_FAILED;
+		if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0)
+		{
+			pMapping = mmap(nullptr, size_t(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		}
+
+		close(file);
+		if (pMapping == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		sizeInBytes = uint64(fileStat.st_size);
+		return pMapping;
+	}
+
+	bool LinuxMemory::UnmapFile(const void* pMemory, uint64 sizeInBytes)
+	{
+		return munmap(const_cast<void*>(pMemory), size_t(sizeInBytes)) == 0;
+	}
+}
+
+#endif
@@ -4,6 +4,11 @@
 #include <mach/mach.h>
 #include <mach/mach_vm.h>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fcntl.h>
+
 #include <unistd.h>
 
 namespace LambdaEngine
@@ -55,4 +60,38 @@ namespace LambdaEngine
 		return 0;
 	}
 
+	const void* MacMemory::MapFile(const char* pFilepath, uint64& sizeInBytes)
+	{
+		sizeInBytes = 0;
+
+		const int32 file = open(pFilepath, O_RDONLY);
+		if (file == -1)
+		{
+			return nullptr;
+		}
+
+		// The mapping keeps the file alive, so the descriptor can be closed right away
+		struct stat fileStat;
+		void* pMapping = MAP_FAILED;
+		if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0)
+		{
+			pMapping = mmap(nullptr, size_t(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		}
+
+		close(file);
+		if (pMapping == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		sizeInBytes = uint64(fileStat.st_size);
+		return pMapping;
+	}
+
+	bool MacMemory::UnmapFile(const void* pMemory, uint64 sizeInBytes)
+	{
+		return munmap(const_cast<void*>(pMemory), size_t(sizeInBytes)) == 0;
+	}
+}
+
 #endif
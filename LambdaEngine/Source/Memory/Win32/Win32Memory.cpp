@@ -47,6 +47,47 @@ namespace LambdaEngine
 
 		return uint64(systemInfo.dwAllocationGranularity);
 	}
+	const void* Win32Memory::MapFile(const char* pFilepath, uint64& sizeInBytes)
+	{
+		sizeInBytes = 0;
+
+		HANDLE hFile = ::CreateFileA(pFilepath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (hFile == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+
+		LARGE_INTEGER fileSize = { };
+		if (!::GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart == 0)
+		{
+			::CloseHandle(hFile);
+			return nullptr;
+		}
+
+		// The view keeps the mapping and the file alive, so both handles can be closed right away
+		HANDLE hMapping = ::CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+		::CloseHandle(hFile);
+		if (!hMapping)
+		{
+			return nullptr;
+		}
+
+		LPVOID pView = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+		::CloseHandle(hMapping);
+		if (!pView)
+		{
+			return nullptr;
+		}
+
+		sizeInBytes = uint64(fileSize.QuadPart);
+		return pView;
+	}
+
+	bool Win32Memory::UnmapFile(const void* pMemory, uint64 sizeInBytes)
+	{
+		UNREFERENCED_VARIABLE(sizeInBytes);
+		return ::UnmapViewOfFile(pMemory);
+	}
 }
 
 #endif
\ No newline at end of file
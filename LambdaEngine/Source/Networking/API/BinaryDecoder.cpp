@@ -5,7 +5,9 @@
 namespace LambdaEngine
 {
 	BinaryDecoder::BinaryDecoder(NetworkSegment* pPacket) :
-		m_pNetworkPacket(pPacket)
+		m_pNetworkPacket(pPacket),
+		m_BitBuffer(0),
+		m_BitCount(0)
 	{
 
 	}
@@ -82,6 +84,7 @@ namespace LambdaEngine
 
 	bool BinaryDecoder::ReadBuffer(uint8* pBuffer, uint16 bytesToRead)
 	{
+		AlignBits();
 		return m_pNetworkPacket->Read(pBuffer, bytesToRead);
 	}
 
@@ -105,6 +108,71 @@ namespace LambdaEngine
 		return ReadBuffer((uint8*)&value.data, sizeof(glm::quat));
 	}
 
+	bool BinaryDecoder::ReadBits(uint32& value, uint8 bitCount)
+	{
+		ASSERT(bitCount > 0 && bitCount <= 32);
+
+		while (m_BitCount < bitCount)
+		{
+			uint8 byte;
+			if (!m_pNetworkPacket->Read(&byte, sizeof(byte)))
+				return false;
+
+			m_BitBuffer |= uint64(byte) << m_BitCount;
+			m_BitCount += 8;
+		}
+
+		const uint64 mask = (uint64(1) << bitCount) - 1;
+		value = uint32(m_BitBuffer & mask);
+		m_BitBuffer >>= bitCount;
+		m_BitCount -= bitCount;
+		return true;
+	}
+
+	void BinaryDecoder::AlignBits()
+	{
+		// The bits left are the padding of a byte that has already been read
+		m_BitBuffer	= 0;
+		m_BitCount	= 0;
+	}
+
+	bool BinaryDecoder::ReadQuantizedFloat(float32& value, float32 min, float32 max, uint8 bitCount)
+	{
+		uint32 quantized;
+		if (!ReadBits(quantized, bitCount))
+			return false;
+
+		value = DequantizeFloat(quantized, min, max, bitCount);
+		return true;
+	}
+
+	bool BinaryDecoder::ReadQuantizedVec3(glm::vec3& value, float32 min, float32 max, uint8 bitCount)
+	{
+		return
+			ReadQuantizedFloat(value.x, min, max, bitCount) &&
+			ReadQuantizedFloat(value.y, min, max, bitCount) &&
+			ReadQuantizedFloat(value.z, min, max, bitCount);
+	}
+
+	bool BinaryDecoder::ReadQuantizedQuat(glm::quat& value, uint8 bitCount)
+	{
+		QuantizedQuat quantized;
+		if (!ReadQuantizedQuat(quantized, bitCount))
+			return false;
+
+		value = DequantizeQuat(quantized, bitCount);
+		return true;
+	}
+
+	bool BinaryDecoder::ReadQuantizedQuat(QuantizedQuat& value, uint8 bitCount)
+	{
+		return
+			ReadBits(value.LargestIndex, 2) &&
+			ReadBits(value.Components[0], bitCount) &&
+			ReadBits(value.Components[1], bitCount) &&
+			ReadBits(value.Components[2], bitCount);
+	}
+
 	NetworkSegment* BinaryDecoder::GetPacket()
 	{
 		return m_pNetworkPacket;
@@ -5,14 +5,16 @@
 namespace LambdaEngine
 {
 	BinaryEncoder::BinaryEncoder(NetworkSegment* pPacket) :
-		m_pNetworkPacket(pPacket)
+		m_pNetworkPacket(pPacket),
+		m_BitBuffer(0),
+		m_BitCount(0)
 	{
 
 	}
 
 	BinaryEncoder::~BinaryEncoder()
 	{
-
+		FlushBits();
 	}
 
 	bool BinaryEncoder::WriteInt8(int8 value)
@@ -80,6 +82,9 @@ namespace LambdaEngine
 
 	bool BinaryEncoder::WriteBuffer(const uint8* pBuffer, uint16 size)
 	{
+		if (!FlushBits())
+			return false;
+
 		return m_pNetworkPacket->Write(pBuffer, size);
 	}
 
@@ -102,4 +107,63 @@ namespace LambdaEngine
 	{
 		return WriteBuffer((const uint8*)&value.data, sizeof(glm::quat));
 	}
+
+	bool BinaryEncoder::WriteBits(uint32 value, uint8 bitCount)
+	{
+		ASSERT(bitCount > 0 && bitCount <= 32);
+
+		const uint64 mask = (uint64(1) << bitCount) - 1;
+		m_BitBuffer |= (uint64(value) & mask) << m_BitCount;
+		m_BitCount += bitCount;
+
+		while (m_BitCount >= 8)
+		{
+			const uint8 byte = uint8(m_BitBuffer);
+			if (!m_pNetworkPacket->Write(&byte, sizeof(byte)))
+				return false;
+
+			m_BitBuffer >>= 8;
+			m_BitCount -= 8;
+		}
+
+		return true;
+	}
+
+	bool BinaryEncoder::FlushBits()
+	{
+		if (m_BitCount == 0)
+			return true;
+
+		const uint8 byte = uint8(m_BitBuffer);
+		m_BitBuffer	= 0;
+		m_BitCount	= 0;
+		return m_pNetworkPacket->Write(&byte, sizeof(byte));
+	}
+
+	bool BinaryEncoder::WriteQuantizedFloat(float32 value, float32 min, float32 max, uint8 bitCount)
+	{
+		return WriteBits(QuantizeFloat(value, min, max, bitCount), bitCount);
+	}
+
+	bool BinaryEncoder::WriteQuantizedVec3(const glm::vec3& value, float32 min, float32 max, uint8 bitCount)
+	{
+		return
+			WriteQuantizedFloat(value.x, min, max, bitCount) &&
+			WriteQuantizedFloat(value.y, min, max, bitCount) &&
+			WriteQuantizedFloat(value.z, min, max, bitCount);
+	}
+
+	bool BinaryEncoder::WriteQuantizedQuat(const glm::quat& value, uint8 bitCount)
+	{
+		return WriteQuantizedQuat(QuantizeQuat(value, bitCount), bitCount);
+	}
+
+	bool BinaryEncoder::WriteQuantizedQuat(const QuantizedQuat& value, uint8 bitCount)
+	{
+		return
+			WriteBits(value.LargestIndex, 2) &&
+			WriteBits(value.Components[0], bitCount) &&
+			WriteBits(value.Components[1], bitCount) &&
+			WriteBits(value.Components[2], bitCount);
+	}
 }
\ No newline at end of file
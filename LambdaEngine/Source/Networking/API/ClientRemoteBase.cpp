@@ -33,6 +33,7 @@ namespace LambdaEngine
 		m_TerminationApproved(false),
 		m_BufferIndex(0),
 		m_ReceivedPackets(),
+		m_LockDecode(),
 		m_LockReceivedPackets()
 	{
 		s_Instances++;
@@ -273,12 +274,18 @@ namespace LambdaEngine
 
 	void ClientRemoteBase::DecodeReceivedPackets()
 	{
+		DecodeReceivedPackets(GetTransceiver());
+	}
+
+	void ClientRemoteBase::DecodeReceivedPackets(PacketTransceiverBase* pTransceiver)
+	{
+		std::scoped_lock<SpinLock> decodeLock(m_LockDecode);
 		if (m_State == STATE_CONNECTING || m_State == STATE_CONNECTED)
 		{
 			TArray<NetworkSegment*> packets;
 			PacketManagerBase* pPacketManager = GetPacketManager();
 			bool hasDiscardedResends = false;
-			if (!pPacketManager->QueryBegin(GetTransceiver(), packets, hasDiscardedResends))
+			if (!pPacketManager->QueryBegin(pTransceiver, packets, hasDiscardedResends))
 			{
 				Disconnect("Receive Error");
 				return;
@@ -13,16 +13,19 @@ namespace LambdaEngine
 	THashTable<NetWorker*, uint8> NetWorker::s_NetworkersToDelete;
 
 	NetWorker::NetWorker() : 
-		m_pThreadReceiver(nullptr),
 		m_pThreadTransmitter(nullptr),
+		m_ReceiverThreadCount(1),
+		m_pReceiverStatistics(nullptr),
 		m_Run(false),
 		m_ThreadsStarted(false),
-		m_ReceiverStopped(false),
+		m_ReceiverThreadsAlive(0),
+		m_ReceiversRunning(0),
 		m_Initiated(false),
 		m_ThreadsTerminated(true),
 		m_Release(false),
 		m_pReceiveBuffer()
 	{
+		m_pReceiverStatistics = DBG_NEW NetworkWorkerStatistics[m_ReceiverThreadCount];
 		s_Instances++;
 	}
 
@@ -31,9 +34,43 @@ namespace LambdaEngine
 		if (!m_Release)
 			LOG_ERROR("[NetWorker]: Do not use delete on a NetWorker object. Use the Release() function!");
 
+		SAFEDELETE_ARRAY(m_pReceiverStatistics);
 		s_Instances--;
 	}
 
+	void NetWorker::SetReceiverThreadCount(uint32 count)
+	{
+		std::scoped_lock<SpinLock> lock(m_Lock);
+		if (!m_ThreadsTerminated)
+		{
+			LOG_WARNING("[NetWorker]: The receiver thread count can only be changed while the threads are stopped");
+			return;
+		}
+
+		count = std::max(count, 1u);
+		if (count != m_ReceiverThreadCount)
+		{
+			SAFEDELETE_ARRAY(m_pReceiverStatistics);
+			m_pReceiverStatistics = DBG_NEW NetworkWorkerStatistics[count];
+			m_ReceiverThreadCount = count;
+		}
+	}
+
+	uint32 NetWorker::GetReceiverThreadCount() const
+	{
+		return m_ReceiverThreadCount;
+	}
+
+	const NetworkWorkerStatistics* NetWorker::GetReceiverStatistics(uint32 workerIndex) const
+	{
+		return workerIndex < m_ReceiverThreadCount ? &m_pReceiverStatistics[workerIndex] : nullptr;
+	}
+
+	NetworkWorkerStatistics* NetWorker::GetMutableReceiverStatistics(uint32 workerIndex)
+	{
+		return workerIndex < m_ReceiverThreadCount ? &m_pReceiverStatistics[workerIndex] : nullptr;
+	}
+
 	void NetWorker::Flush()
 	{
 		std::scoped_lock<SpinLock> lock(m_Lock);
@@ -71,7 +108,7 @@ namespace LambdaEngine
 
 	bool NetWorker::ThreadsAreRunning() const
 	{
-		return m_pThreadReceiver != nullptr && m_pThreadTransmitter != nullptr;
+		return m_ReceiverThreadsAlive > 0 && m_pThreadTransmitter != nullptr;
 	}
 
 	bool NetWorker::ThreadsHasTerminated() const
@@ -99,6 +136,13 @@ namespace LambdaEngine
 			m_ThreadsStarted = false;
 			m_Initiated = false;
 			m_ThreadsTerminated = false;
+			m_ReceiverThreadsAlive = m_ReceiverThreadCount;
+			m_ReceiversRunning = m_ReceiverThreadCount;
+
+			for (uint32 workerIndex = 0; workerIndex < m_ReceiverThreadCount; workerIndex++)
+			{
+				m_pReceiverStatistics[workerIndex].Reset();
+			}
 
 			m_pThreadTransmitter = Thread::Create(
 				name + "_TRANSMITTER",
@@ -106,11 +150,14 @@ namespace LambdaEngine
 				std::bind_front(&NetWorker::ThreadTransmitterDeleted, this)
 			);
 
-			m_pThreadReceiver = Thread::Create(
-				name + "_RECEIVER",
-				std::bind_front(&NetWorker::ThreadReceiver, this),
-				std::bind_front(&NetWorker::ThreadReceiverDeleted, this)
-			);
+			for (uint32 workerIndex = 0; workerIndex < m_ReceiverThreadCount; workerIndex++)
+			{
+				Thread::Create(
+					m_ReceiverThreadCount > 1 ? name + "_RECEIVER_" + std::to_string(workerIndex) : name + "_RECEIVER",
+					std::bind_front(&NetWorker::ThreadReceiver, this, workerIndex),
+					std::bind_front(&NetWorker::ThreadReceiverDeleted, this)
+				);
+			}
 			m_ThreadsStarted = true;
 			return true;
 		}
@@ -129,17 +176,17 @@ namespace LambdaEngine
 
 		RunTransmitter();
 
-		while (!m_ReceiverStopped);
+		while (m_ReceiversRunning > 0);
 	}
 
-	void NetWorker::ThreadReceiver()
+	void NetWorker::ThreadReceiver(uint32 workerIndex)
 	{
 		while (!m_Initiated);
 
-		RunReceiver();
+		RunReceiver(workerIndex);
 
 		Flush();
-		m_ReceiverStopped = true;
+		m_ReceiversRunning--;
 	}
 
 	void NetWorker::ThreadTransmitterDeleted()
@@ -149,18 +196,19 @@ namespace LambdaEngine
 			m_pThreadTransmitter = nullptr;
 		}
 
-		if (!m_pThreadReceiver)
+		if (m_ReceiverThreadsAlive == 0)
 			ThreadsDeleted();
 	}
 
 	void NetWorker::ThreadReceiverDeleted()
 	{
+		bool lastReceiver = false;
 		{
 			std::scoped_lock<SpinLock> lock(m_Lock);
-			m_pThreadReceiver = nullptr;
+			lastReceiver = --m_ReceiverThreadsAlive == 0;
 		}
 
-		if (!m_pThreadTransmitter)
+		if (lastReceiver && !m_pThreadTransmitter)
 			ThreadsDeleted();
 	}
 
@@ -316,4 +316,49 @@ namespace LambdaEngine
 	{
 		m_SaltRemote = salt;
 	}
+
+	NetworkWorkerStatistics::NetworkWorkerStatistics()
+	{
+		Reset();
+	}
+
+	uint32 NetworkWorkerStatistics::GetPacketsReceived() const
+	{
+		return m_PacketsReceived;
+	}
+
+	uint32 NetworkWorkerStatistics::GetBytesReceived() const
+	{
+		return m_BytesReceived;
+	}
+
+	uint32 NetworkWorkerStatistics::GetNewConnections() const
+	{
+		return m_NewConnections;
+	}
+
+	Timestamp NetworkWorkerStatistics::GetDecodeTime() const
+	{
+		return Timestamp::NanoSeconds(m_DecodeTimeNanoSeconds);
+	}
+
+	void NetworkWorkerStatistics::Reset()
+	{
+		m_PacketsReceived		= 0;
+		m_BytesReceived			= 0;
+		m_NewConnections		= 0;
+		m_DecodeTimeNanoSeconds	= 0;
+	}
+
+	void NetworkWorkerStatistics::RegisterPacketReceived(uint32 bytes, Timestamp decodeTime)
+	{
+		m_PacketsReceived.fetch_add(1, std::memory_order_relaxed);
+		m_BytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+		m_DecodeTimeNanoSeconds.fetch_add(decodeTime.AsNanoSeconds(), std::memory_order_relaxed);
+	}
+
+	void NetworkWorkerStatistics::RegisterNewConnection()
+	{
+		m_NewConnections.fetch_add(1, std::memory_order_relaxed);
+	}
 }
\ No newline at end of file
@@ -5,19 +5,20 @@
 
 #include "Engine/EngineLoop.h"
 
+#include <algorithm>
 #include <stdlib.h>
 
 namespace LambdaEngine
 {
 	PacketManagerBase::PacketManagerBase(const PacketManagerDesc& desc) :
 		m_SegmentPool(desc.PoolSize),
-		m_QueueIndex(0)
+		m_SegmentsToSend(desc.PoolSize)
 	{
+		m_SegmentsToFlush.Reserve(desc.PoolSize);
 	}
 
 	uint32 PacketManagerBase::EnqueueSegmentReliable(NetworkSegment* pSegment, IPacketListener* pListener)
 	{
-		std::scoped_lock<SpinLock> lock(m_LockSegmentsToSend);
 		if (pSegment == nullptr)
 		{
 			ASSERT(pSegment != nullptr);
@@ -25,85 +26,172 @@ namespace LambdaEngine
 		}
 
 		uint32 reliableUID = m_Statistics.RegisterReliableSegmentSent();
-		uint32 UID = EnqueueSegment(pSegment, reliableUID);
-		m_SegmentsWaitingForAck.insert({ reliableUID, SegmentInfo{ pSegment, pListener, UINT64_MAX, 0} });
-		return UID;
+		return EnqueueSegment(pSegment, pListener, reliableUID);
 	}
 
 	uint32 PacketManagerBase::EnqueueSegmentUnreliable(NetworkSegment* pSegment)
 	{
-		std::scoped_lock<SpinLock> lock(m_LockSegmentsToSend);
-		return EnqueueSegment(pSegment, 0);
+		return EnqueueSegment(pSegment, nullptr, 0);
 	}
 
-	uint32 PacketManagerBase::EnqueueSegment(NetworkSegment* pSegment, uint32 reliableUID)
+	uint32 PacketManagerBase::EnqueueSegment(NetworkSegment* pSegment, IPacketListener* pListener, uint32 reliableUID)
 	{
 		pSegment->GetHeader().UID = m_Statistics.RegisterUniqueSegment(pSegment->GetType());
 		pSegment->GetHeader().ReliableUID = reliableUID;
-		InsertSegment(pSegment);
-		return pSegment->GetHeader().UID;
-	}
-
-	void PacketManagerBase::InsertSegment(NetworkSegment* pSegment)
-	{
-		m_SegmentsToSend[m_QueueIndex].insert(pSegment);
 
 #if LAMBDA_ENABLE_ASSERTS
 		if (pSegment->GetType() < 1000)
 			VALIDATE(pSegment->GetBufferSize() > 0)
 #endif
+
+		// Every queued segment belongs to the segment pool and the queue is as large as the pool, so it can not fill up
+		if (!m_SegmentsToSend.Enqueue({ pSegment, pListener }))
+		{
+			LOG_ERROR("[PacketManagerBase]: Send queue is full, dropping segment %s", pSegment->ToString().c_str());
+			ASSERT(false);
+		}
+
+		return pSegment->GetHeader().UID;
+	}
+
+	void PacketManagerBase::InsertResend(ReliableSegmentInfo& segmentInfo)
+	{
+		segmentInfo.LastSent = UINT64_MAX;
+		m_ResendUIDs.PushBack(segmentInfo.ReliableUID);
+	}
+
+	bool PacketManagerBase::HasSegmentsToSend() const
+	{
+		return !m_SegmentsToSend.IsEmpty();
 	}
 
 	void PacketManagerBase::Flush(PacketTransceiverBase* pTransceiver)
 	{
-		std::scoped_lock<SpinLock> lock1(m_LockSegmentsToSend);
-		std::set<NetworkSegment*, NetworkSegmentUIDOrder>& segments = m_SegmentsToSend[m_QueueIndex];
+		// Only one thread may consume the send queue at a time
+		std::scoped_lock<SpinLock> lock1(m_LockFlush);
 
-		m_QueueIndex = (m_QueueIndex + 1) % 2;
+		m_SegmentsToFlush.Clear();
 
-		while (!segments.empty())
+		// The segments are collected under the lock, acks are handled on the receiver thread while they are transmitted
 		{
-			Bundle bundle;
-			uint32 seq = pTransceiver->Transmit(&m_SegmentPool, segments, bundle.ReliableUIDs, m_IPEndPoint, &m_Statistics);
+			std::scoped_lock<SpinLock> lock2(m_LockSegmentsWaitingForAck);
 
-			if (!bundle.ReliableUIDs.empty())
+			for (uint32 reliableUID : m_ResendUIDs)
 			{
-				std::scoped_lock<SpinLock> lock2(m_LockBundles);
+				// Segments acked since they were queued for a resend are no longer in the buffer
+				ReliableSegmentInfo* pSegmentInfo = m_SegmentsWaitingForAck.Find(reliableUID);
+				if (pSegmentInfo && pSegmentInfo->LastSent == UINT64_MAX)
+				{
+					m_SegmentsToFlush.PushBack(pSegmentInfo->Segment);
+				}
+			}
+			m_ResendUIDs.Clear();
 
-				bundle.Timestamp = EngineLoop::GetTimeSinceStart();
+			QueuedSegment queuedSegment;
+			while (m_SegmentsToSend.Dequeue(queuedSegment))
+			{
+				NetworkSegment* pSegment = queuedSegment.pSegment;
+				if (pSegment->IsReliable())
+				{
+					ReliableSegmentInfo segmentInfo;
+					segmentInfo.Segment		= pSegment;
+					segmentInfo.Listener	= queuedSegment.pListener;
+					segmentInfo.LastSent	= UINT64_MAX;
+					segmentInfo.ReliableUID	= pSegment->GetReliableUID();
+					m_SegmentsWaitingForAck.Insert(segmentInfo);
+				}
+
+				m_SegmentsToFlush.PushBack(pSegment);
+			}
+
+			if (m_SegmentsToFlush.IsEmpty())
+			{
+				return;
+			}
+
+			m_IsTransmitting = true;
+		}
+
+		// Transmit in the order the segments were enqueued, resends have older UIDs and go first
+		std::sort(m_SegmentsToFlush.GetData(), m_SegmentsToFlush.GetData() + m_SegmentsToFlush.GetSize(), NetworkSegmentUIDOrder());
+
+		uint32 segmentIndex = 0;
+		while (segmentIndex < m_SegmentsToFlush.GetSize())
+		{
+			m_ReliableUIDsSent.Clear();
+			uint32 seq = pTransceiver->Transmit(m_SegmentsToFlush, segmentIndex, m_ReliableUIDsSent, m_IPEndPoint, &m_Statistics);
+
+			if (!m_ReliableUIDsSent.IsEmpty())
+			{
+				Timestamp timestamp = EngineLoop::GetTimeSinceStart();
 
-				for (uint32 reliableID : bundle.ReliableUIDs)
 				{
-					m_SegmentsWaitingForAck[reliableID].LastSent = bundle.Timestamp;
+					std::scoped_lock<SpinLock> lock2(m_LockSegmentsWaitingForAck);
+					for (uint32 reliableUID : m_ReliableUIDsSent)
+					{
+						ReliableSegmentInfo* pSegmentInfo = m_SegmentsWaitingForAck.Find(reliableUID);
+						if (pSegmentInfo)
+						{
+							pSegmentInfo->LastSent = timestamp;
+						}
+					}
 				}
 
-				m_Bundles.insert({ seq, bundle });
-				//LOG_WARNING("Adding bundle with SEQ: %d", seq);
+				if (seq != UINT32_MAX)
+				{
+					std::scoped_lock<SpinLock> lock3(m_LockBundles);
+
+					Bundle& bundle = m_Bundles[seq % PACKET_BUNDLE_BUFFER_SIZE];
+					bundle.ReliableUIDs	= m_ReliableUIDsSent;
+					bundle.Timestamp	= timestamp;
+					bundle.Sequence		= seq;
+					//LOG_WARNING("Adding bundle with SEQ: %d", seq);
+				}
 			}
 		}
+
+		// Unreliable segments are done with once they have been transmitted
+		for (NetworkSegment* pSegment : m_SegmentsToFlush)
+		{
+			if (!pSegment->IsReliable())
+			{
+				m_SegmentsToFree.PushBack(pSegment);
+			}
+		}
+
+		// Reliable segments acked while they were being transmitted could not be freed by HandleAcks
+		{
+			std::scoped_lock<SpinLock> lock2(m_LockSegmentsWaitingForAck);
+			m_IsTransmitting = false;
+			for (NetworkSegment* pSegment : m_SegmentsAckedWhileTransmitting)
+			{
+				m_SegmentsToFree.PushBack(pSegment);
+			}
+			m_SegmentsAckedWhileTransmitting.Clear();
+		}
+
+#ifdef LAMBDA_CONFIG_DEBUG
+		m_SegmentPool.FreeSegments(m_SegmentsToFree, "PacketManagerBase::Flush");
+#else
+		m_SegmentPool.FreeSegments(m_SegmentsToFree);
+#endif
 	}
 
 	void PacketManagerBase::DeleteOldBundles()
 	{
 		static const Timestamp& maxAllowedTime = Timestamp::Seconds(2);
 
-		TArray<uint32> bundlesToDelete;
-
 		std::scoped_lock<SpinLock> lock(m_LockBundles);
 		Timestamp currentTime = EngineLoop::GetTimeSinceStart();
-		for (auto& pair : m_Bundles)
+		for (Bundle& bundle : m_Bundles)
 		{
-			if (currentTime - pair.second.Timestamp > maxAllowedTime)
+			if (bundle.Sequence != 0 && currentTime - bundle.Timestamp > maxAllowedTime)
 			{
-				bundlesToDelete.PushBack(pair.first);
+				//LOG_WARNING("Removing bundle with SEQ: %d", bundle.Sequence);
+				bundle.Sequence = 0;
+				bundle.ReliableUIDs.Clear();
 			}
 		}
-
-		for (uint32 seq : bundlesToDelete)
-		{
-			//LOG_WARNING("Removing bundle with SEQ: %d", seq);
-			m_Bundles.erase(seq);
-		}
 	}
 
 	void PacketManagerBase::Tick(Timestamp delta)
@@ -145,16 +233,26 @@ namespace LambdaEngine
 
 	void PacketManagerBase::Reset()
 	{
-		std::scoped_lock<SpinLock> lock1(m_LockSegmentsToSend);
-		std::scoped_lock<SpinLock> lock2(m_LockBundles);
-		m_SegmentsToSend[0] = {};
-		m_SegmentsToSend[1] = {};
-		m_SegmentsWaitingForAck.clear();
-		m_Bundles.clear();
+		std::scoped_lock<SpinLock> lock1(m_LockFlush);
+		std::scoped_lock<SpinLock> lock2(m_LockSegmentsWaitingForAck);
+		std::scoped_lock<SpinLock> lock3(m_LockBundles);
+
+		// The queued segments are returned to the pool when it is reset below
+		QueuedSegment queuedSegment;
+		while (m_SegmentsToSend.Dequeue(queuedSegment));
+
+		m_SegmentsWaitingForAck.Clear();
+		m_SegmentsAckedWhileTransmitting.Clear();
+		m_ResendUIDs.Clear();
+
+		for (Bundle& bundle : m_Bundles)
+		{
+			bundle.Sequence = 0;
+			bundle.ReliableUIDs.Clear();
+		}
 
 		m_SegmentPool.Reset();
 		m_Statistics.Reset();
-		m_QueueIndex = 0;
 	}
 
 	bool PacketManagerBase::QueryBegin(PacketTransceiverBase* pTransceiver, TArray<NetworkSegment*>& segmentsReturned, bool& hasDiscardedResends)
@@ -191,25 +289,38 @@ namespace LambdaEngine
 		TArray<uint32> ackedReliableUIDs;
 		GetReliableUIDsFromAckedPackets(ackedPackets, ackedReliableUIDs);
 
-		TArray<SegmentInfo> segmentsAcked;
-		GetReliableSegmentInfosFromUIDs(ackedReliableUIDs, segmentsAcked);
+		if (ackedReliableUIDs.IsEmpty())
+			return;
 
 		TArray<NetworkSegment*> packetsToFree;
-		packetsToFree.Reserve(segmentsAcked.GetSize());
-
-		std::scoped_lock<SpinLock> lock(m_LockSegmentsToSend);
+		packetsToFree.Reserve(ackedReliableUIDs.GetSize());
 
-		for (SegmentInfo& segmentInfo : segmentsAcked)
 		{
-			if (segmentInfo.Listener)
+			std::scoped_lock<SpinLock> lock(m_LockSegmentsWaitingForAck);
+
+			for (uint32 reliableUID : ackedReliableUIDs)
 			{
-				segmentInfo.Listener->OnPacketDelivered(segmentInfo.Segment);
+				ReliableSegmentInfo* pSegmentInfo = m_SegmentsWaitingForAck.Find(reliableUID);
+				if (pSegmentInfo)
+				{
+					if (pSegmentInfo->Listener)
+					{
+						pSegmentInfo->Listener->OnPacketDelivered(pSegmentInfo->Segment);
+					}
+
+					// A flush may be encoding the segment right now, it is then freed once the flush is done
+					if (m_IsTransmitting)
+					{
+						m_SegmentsAckedWhileTransmitting.PushBack(pSegmentInfo->Segment);
+					}
+					else
+					{
+						packetsToFree.PushBack(pSegmentInfo->Segment);
+					}
+
+					m_SegmentsWaitingForAck.Remove(reliableUID);
+				}
 			}
-
-			m_SegmentsToSend[0].erase(segmentInfo.Segment);
-			m_SegmentsToSend[1].erase(segmentInfo.Segment);
-
-			packetsToFree.PushBack(segmentInfo.Segment);
 		}
 
 #ifdef LAMBDA_CONFIG_DEBUG
@@ -224,22 +335,21 @@ namespace LambdaEngine
 	*/
 	void PacketManagerBase::GetReliableUIDsFromAckedPackets(const TSet<uint32>& ackedPackets, TArray<uint32>& ackedReliableUIDs)
 	{
-		ackedReliableUIDs.Reserve(128);
 		std::scoped_lock<SpinLock> lock(m_LockBundles);
 
 		Timestamp timestamp = 0;
 		uint8 timestamps = 0;
 		for (uint32 ack : ackedPackets)
 		{
-			auto iterator = m_Bundles.find(ack);
-			if (iterator != m_Bundles.end())
+			Bundle& bundle = m_Bundles[ack % PACKET_BUNDLE_BUFFER_SIZE];
+			if (bundle.Sequence == ack && ack != 0)
 			{
-				Bundle& bundle = iterator->second;
 				for (uint32 reliableUID : bundle.ReliableUIDs)
 					ackedReliableUIDs.PushBack(reliableUID);
 
 				timestamp += bundle.Timestamp;
-				m_Bundles.erase(iterator);
+				bundle.Sequence = 0;
+				bundle.ReliableUIDs.Clear();
 				timestamps++;
 			}
 			/*else
@@ -255,22 +365,6 @@ namespace LambdaEngine
 		}
 	}
 
-	void PacketManagerBase::GetReliableSegmentInfosFromUIDs(const TArray<uint32>& ackedReliableUIDs, TArray<SegmentInfo>& ackedReliableSegments)
-	{
-		ackedReliableSegments.Reserve(128);
-		std::scoped_lock<SpinLock> lock(m_LockSegmentsToSend);
-
-		for (uint32 reliableUID : ackedReliableUIDs)
-		{
-			auto iterator = m_SegmentsWaitingForAck.find(reliableUID);
-			if (iterator != m_SegmentsWaitingForAck.end())
-			{
-				ackedReliableSegments.PushBack(iterator->second);
-				m_SegmentsWaitingForAck.erase(iterator);
-			}
-		}
-	}
-
 	void PacketManagerBase::RegisterRTT(Timestamp rtt)
 	{
 		static constexpr float64 scalar1 = 1.0 / 20.0;
@@ -20,9 +20,9 @@ namespace LambdaEngine
 
 	}
 
-	uint32 PacketTransceiverBase::Transmit(SegmentPool* pSegmentPool, std::set<NetworkSegment*, NetworkSegmentUIDOrder>& segments, std::set<uint32>& reliableUIDsSent, const IPEndPoint& ipEndPoint, NetworkStatistics* pStatistics)
+	uint32 PacketTransceiverBase::Transmit(const TArray<NetworkSegment*>& segments, uint32& segmentIndex, TArray<uint32>& reliableUIDsSent, const IPEndPoint& ipEndPoint, NetworkStatistics* pStatistics)
 	{
-		if (segments.empty())
+		if (segmentIndex >= segments.GetSize())
 			return 0;
 
 		PacketTranscoder::Header header;
@@ -34,9 +34,9 @@ namespace LambdaEngine
 		header.Ack		= pStatistics->GetLastReceivedSequenceNr();
 		header.AckBits	= pStatistics->GetReceivedSequenceBits();
 
-		//LOG_ERROR("%d: PacketTransceiverBase::Transmit(%s), SEQ: %d", (int32)EngineLoop::GetTimeSinceStart().AsMilliSeconds(), (*segments.begin())->ToString().c_str(), header.Sequence);
+		//LOG_ERROR("%d: PacketTransceiverBase::Transmit(%s), SEQ: %d", (int32)EngineLoop::GetTimeSinceStart().AsMilliSeconds(), segments[segmentIndex]->ToString().c_str(), header.Sequence);
 
-		PacketTranscoder::EncodeSegments(m_pSendBuffer, MAXIMUM_SEGMENT_SIZE, pSegmentPool, segments, reliableUIDsSent, bytesWritten, &header);
+		PacketTranscoder::EncodeSegments(m_pSendBuffer, MAXIMUM_SEGMENT_SIZE, segments, segmentIndex, reliableUIDsSent, bytesWritten, &header);
 
 		pStatistics->RegisterBytesSent(bytesWritten);
 
@@ -94,6 +94,22 @@ namespace LambdaEngine
 		return true;
 	}
 
+	uint32 PacketTransceiverBase::GetBytesReceived() const
+	{
+		return (uint32)m_BytesReceived;
+	}
+
+	const uint8* PacketTransceiverBase::GetReceivedData() const
+	{
+		return m_pReceiveBuffer;
+	}
+
+	void PacketTransceiverBase::SetReceivedData(const uint8* pBuffer, uint32 size)
+	{
+		m_BytesReceived = (int32)std::min<uint32>(size, UINT16_MAX);
+		memcpy(m_pReceiveBuffer, pBuffer, m_BytesReceived);
+	}
+
 	void PacketTransceiverBase::SetIgnoreSaltMissmatch(bool ignore)
 	{
 		m_IgnoreSaltMissmatch = ignore;
@@ -7,18 +7,16 @@
 
 namespace LambdaEngine
 {
-	void PacketTranscoder::EncodeSegments(uint8* buffer, uint16 bufferSize, SegmentPool* pSegmentPool, std::set<NetworkSegment*, NetworkSegmentUIDOrder>& segmentsToEncode, std::set<uint32>& reliableUIDsSent, uint16& bytesWritten, Header* pHeader)
+	void PacketTranscoder::EncodeSegments(uint8* buffer, uint16 bufferSize, const TArray<NetworkSegment*>& segmentsToEncode, uint32& segmentIndex, TArray<uint32>& reliableUIDsSent, uint16& bytesWritten, Header* pHeader)
 	{
 		pHeader->Size = sizeof(Header);
 		pHeader->Segments = 0;
 
 		bytesWritten = 0;
 
-		TArray<NetworkSegment*> segmentsToFree;
-
-		for (auto it = segmentsToEncode.begin(); it != segmentsToEncode.end();)
+		for (; segmentIndex < segmentsToEncode.GetSize(); segmentIndex++)
 		{
-			NetworkSegment* pSegment = *it;
+			NetworkSegment* pSegment = segmentsToEncode[segmentIndex];
 
 			//LOG_ERROR("%d: PacketTranscoder::EncodeSegments(%s)", (int32)EngineLoop::GetTimeSinceStart().AsMilliSeconds(), pSegment->ToString().c_str());
 
@@ -26,14 +24,11 @@ namespace LambdaEngine
 
 			if (pSegment->GetTotalSize() + pHeader->Size <= bufferSize)
 			{
-				it = segmentsToEncode.erase(it);
 				pHeader->Size += WriteSegment(buffer + pHeader->Size, pSegment);
 				pHeader->Segments++;
 
 				if (pSegment->IsReliable())
-					reliableUIDsSent.insert(pSegment->GetReliableUID());
-				else
-					segmentsToFree.PushBack(pSegment);
+					reliableUIDsSent.PushBack(pSegment->GetReliableUID());
 			}
 			else
 			{
@@ -41,12 +36,6 @@ namespace LambdaEngine
 			}
 		}
 
-#ifdef LAMBDA_CONFIG_DEBUG
-		pSegmentPool->FreeSegments(segmentsToFree, "PacketTranscoder::EncodeSegments");
-#else
-		pSegmentPool->FreeSegments(segmentsToFree);
-#endif
-
 		memcpy(buffer, pHeader, sizeof(Header));
 
 		bytesWritten = pHeader->Size;
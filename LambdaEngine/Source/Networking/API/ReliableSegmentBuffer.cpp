@@ -0,0 +1,98 @@
+#include "Networking/API/ReliableSegmentBuffer.h"
+
+#include <bit>
+
+namespace LambdaEngine
+{
+	ReliableSegmentBuffer::ReliableSegmentBuffer() :
+		m_Slots(RELIABLE_SEGMENT_BUFFER_INITIAL_CAPACITY),
+		m_OldestUID(0),
+		m_NewestUID(0),
+		m_Count(0)
+	{
+	}
+
+	void ReliableSegmentBuffer::Insert(const ReliableSegmentInfo& segmentInfo)
+	{
+		const uint32 reliableUID = segmentInfo.ReliableUID;
+		ASSERT(reliableUID != 0);
+
+		if (m_Count == 0)
+		{
+			m_OldestUID = reliableUID;
+			m_NewestUID = reliableUID;
+		}
+		else
+		{
+			/*	Segments are usually inserted in UID order, but two threads enqueueing at the same time can have their
+				segments inserted in the opposite order of their UIDs */
+			const uint32 oldestUID = int32(reliableUID - m_OldestUID) < 0 ? reliableUID : m_OldestUID;
+			const uint32 newestUID = int32(reliableUID - m_NewestUID) > 0 ? reliableUID : m_NewestUID;
+
+			const uint32 requiredCapacity = newestUID - oldestUID + 1;
+			if (requiredCapacity > m_Slots.GetSize())
+			{
+				Grow(requiredCapacity);
+			}
+
+			m_OldestUID = oldestUID;
+			m_NewestUID = newestUID;
+		}
+
+		ReliableSegmentInfo& slot = m_Slots[reliableUID & (m_Slots.GetSize() - 1)];
+		ASSERT(slot.ReliableUID == 0);
+
+		slot = segmentInfo;
+		m_Count++;
+	}
+
+	void ReliableSegmentBuffer::Remove(uint32 reliableUID)
+	{
+		ReliableSegmentInfo* pSegmentInfo = Find(reliableUID);
+		if (pSegmentInfo == nullptr)
+		{
+			return;
+		}
+
+		*pSegmentInfo = {};
+		m_Count--;
+
+		if (m_Count > 0 && reliableUID == m_OldestUID)
+		{
+			// Move the window up to the next segment that is still waiting for an ack
+			const uint32 mask = m_Slots.GetSize() - 1;
+			while (m_Slots[m_OldestUID & mask].ReliableUID != m_OldestUID)
+			{
+				m_OldestUID++;
+			}
+		}
+	}
+
+	void ReliableSegmentBuffer::Clear()
+	{
+		for (ReliableSegmentInfo& segmentInfo : m_Slots)
+		{
+			segmentInfo = {};
+		}
+
+		m_OldestUID	= 0;
+		m_NewestUID	= 0;
+		m_Count		= 0;
+	}
+
+	void ReliableSegmentBuffer::Grow(uint32 requiredCapacity)
+	{
+		TArray<ReliableSegmentInfo> slots(std::bit_ceil(requiredCapacity));
+		const uint32 mask = slots.GetSize() - 1;
+
+		for (const ReliableSegmentInfo& segmentInfo : m_Slots)
+		{
+			if (segmentInfo.ReliableUID != 0)
+			{
+				slots[segmentInfo.ReliableUID & mask] = segmentInfo;
+			}
+		}
+
+		m_Slots = std::move(slots);
+	}
+}
@@ -63,6 +63,12 @@ namespace LambdaEngine
 			m_ClientsToRemove.Clear();
 		}
 
+		for (ClientLookupShard& shard : m_ClientLookupShards)
+		{
+			std::scoped_lock<SpinLock> lock(shard.Lock);
+			shard.Clients.clear();
+		}
+
 		TerminateThreads(reason);
 
 		std::scoped_lock<SpinLock> lock(m_Lock);
@@ -234,40 +240,53 @@ namespace LambdaEngine
 
 	ClientRemoteBase* ServerBase::GetClient(const IPEndPoint& endPoint)
 	{
-		std::scoped_lock<SpinLock> lock(m_LockClients);
-		auto pIterator = m_Clients.find(endPoint);
-		if (pIterator != m_Clients.end())
+		ClientLookupShard& shard = GetClientLookupShard(endPoint);
+
+		std::scoped_lock<SpinLock> lock(shard.Lock);
+		auto pIterator = shard.Clients.find(endPoint);
+		if (pIterator != shard.Clients.end())
 		{
 			return pIterator->second;
 		}
 
-		if (!m_ClientsToAdd.IsEmpty())
+		return nullptr;
+	}
+
+	ServerBase::ClientLookupShard& ServerBase::GetClientLookupShard(const IPEndPoint& endPoint)
+	{
+		return m_ClientLookupShards[endPoint.GetHash() % SERVER_CLIENT_LOOKUP_SHARD_COUNT];
+	}
+
+	void ServerBase::RemoveFromClientLookup(ClientRemoteBase* pClient)
+	{
+		ClientLookupShard& shard = GetClientLookupShard(pClient->GetEndPoint());
+
+		// A rejected client is never added, and must not remove a newer client connecting from the same endpoint
+		std::scoped_lock<SpinLock> lock(shard.Lock);
+		auto pIterator = shard.Clients.find(pClient->GetEndPoint());
+		if (pIterator != shard.Clients.end() && pIterator->second == pClient)
 		{
-			std::scoped_lock<SpinLock> lock2(m_LockClientVectors);
-			for (uint32 i = 0; i < m_ClientsToAdd.GetSize(); i++)
-			{
-				if (m_ClientsToAdd[i]->GetEndPoint() == endPoint)
-					return m_ClientsToAdd[i];
-			}
+			shard.Clients.erase(pIterator);
 		}
-
-		return nullptr;
 	}
 
-	void ServerBase::HandleNewConnection(ClientRemoteBase* pClient)
+	bool ServerBase::HandleNewConnection(ClientRemoteBase* pClient)
 	{
 		if (!IsAcceptingConnections())
 		{
 			pClient->SendServerNotAccepting();
+			return false;
 		}
 		else if (GetClientCount() >= GetDescription().MaxClients)
 		{
 			pClient->SendServerFull();
+			return false;
 		}
 		else
 		{
 			std::scoped_lock<SpinLock> lock(m_LockClientVectors);
 			m_ClientsToAdd.PushBack(pClient);
+			return true;
 		}
 	}
 
@@ -311,6 +330,7 @@ namespace LambdaEngine
 			std::scoped_lock<SpinLock> lock(m_LockClients);
 
 			TArray<ClientRemoteBase*> clientsApproved;
+			TArray<ClientRemoteBase*> clientsRemoved;
 			TArray<ClientRemoteBase*> unconnectedClientsToTick;
 			{
 				std::scoped_lock<SpinLock> lock2(m_LockClientVectors);
@@ -325,6 +345,7 @@ namespace LambdaEngine
 
 					m_Clients.erase(m_ClientsToRemove[i]->GetEndPoint());
 					m_UIDToClient.erase(m_ClientsToRemove[i]->GetUID());
+					clientsRemoved.PushBack(m_ClientsToRemove[i]);
 					m_ClientsToRemove[i]->OnTerminationApproved();
 				}
 
@@ -345,6 +366,12 @@ namespace LambdaEngine
 
 				m_ClientsToRemove.Clear();
 			}
+
+			// Shard locks are never held together with m_LockClientVectors, so shards are updated after releasing it
+			for (ClientRemoteBase* pClient : clientsRemoved)
+			{
+				RemoveFromClientLookup(pClient);
+			}
 				
 			for (ClientRemoteBase* pClient : unconnectedClientsToTick)
 			{
@@ -365,18 +392,21 @@ namespace LambdaEngine
 		while (!ShouldTerminate())
 		{
 			YieldTransmitter();
-			{
-				std::scoped_lock<SpinLock> lock(m_LockClients);
-				for (auto& pair : m_Clients)
-					pair.second->TransmitPackets();
+			TransmitClientPackets();
+		}
+	}
 
-				if (!m_ClientsToAdd.IsEmpty())
-				{
-					std::scoped_lock<SpinLock> lock2(m_LockClientVectors);
-					for (ClientRemoteBase* pClient : m_ClientsToAdd)
-						pClient->TransmitPackets();
-				}
-			}
+	void ServerBase::TransmitClientPackets()
+	{
+		std::scoped_lock<SpinLock> lock(m_LockClients);
+		for (auto& pair : m_Clients)
+			pair.second->TransmitPackets();
+
+		if (!m_ClientsToAdd.IsEmpty())
+		{
+			std::scoped_lock<SpinLock> lock2(m_LockClientVectors);
+			for (ClientRemoteBase* pClient : m_ClientsToAdd)
+				pClient->TransmitPackets();
 		}
 	}
 
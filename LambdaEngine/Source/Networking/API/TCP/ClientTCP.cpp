@@ -60,8 +60,10 @@ namespace LambdaEngine
 		return nullptr;
 	}
 
-	void ClientTCP::RunReceiver()
+	void ClientTCP::RunReceiver(uint32 workerIndex)
 	{
+		UNREFERENCED_VARIABLE(workerIndex);
+
 		IPEndPoint dummy;
 		while (!ShouldTerminate())
 		{
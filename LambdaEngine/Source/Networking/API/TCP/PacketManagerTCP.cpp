@@ -56,7 +56,7 @@ namespace LambdaEngine
 #endif
 
 
-		if (hasReliableSegment && m_SegmentsToSend[m_QueueIndex].empty())
+		if (hasReliableSegment && !HasSegmentsToSend())
 		{
 #ifdef LAMBDA_CONFIG_DEBUG
 			NetworkSegment* pSegment = m_SegmentPool.RequestFreeSegment("PacketManagerTCP_NETWORK_ACK");
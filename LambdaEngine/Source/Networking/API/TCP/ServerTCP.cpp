@@ -46,8 +46,10 @@ namespace LambdaEngine
 		return nullptr;
 	}
 
-	void ServerTCP::RunReceiver()
+	void ServerTCP::RunReceiver(uint32 workerIndex)
 	{
+		UNREFERENCED_VARIABLE(workerIndex);
+
 		while (!ShouldTerminate())
 		{
 			ISocketTCP* socket = ((ISocketTCP*)m_pSocket)->Accept();
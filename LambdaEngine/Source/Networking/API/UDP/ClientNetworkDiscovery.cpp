@@ -87,8 +87,9 @@ namespace LambdaEngine
 				std::scoped_lock<SpinLock> lock(*m_pLockEndPoints);
 				for (const IPEndPoint& endpoint : *m_pEndPoints)
 				{
-					std::set<NetworkSegment*, NetworkSegmentUIDOrder> packets;
-					TSet<uint32> reliableUIDs;
+					TArray<NetworkSegment*> packets;
+					TArray<uint32> reliableUIDs;
+					uint32 segmentIndex = 0;
 
 #ifdef LAMBDA_DEBUG
 					NetworkSegment* pResponse = m_SegmentPool.RequestFreeSegment("ClientNetworkDiscovery");
@@ -97,21 +98,29 @@ namespace LambdaEngine
 #endif
 
 					pResponse->GetHeader().Type = NetworkSegment::TYPE_NETWORK_DISCOVERY;
-					packets.insert(pResponse);
+					packets.PushBack(pResponse);
 
 					BinaryEncoder encoder(pResponse);
 					encoder.WriteString(m_NameOfGame);
 					encoder.WriteBool(*endpoint.GetAddress() == *IPAddress::BROADCAST);
 
-					m_Transceiver.Transmit(&m_SegmentPool, packets, reliableUIDs, endpoint, &m_Statistics);
+					m_Transceiver.Transmit(packets, segmentIndex, reliableUIDs, endpoint, &m_Statistics);
+
+#ifdef LAMBDA_DEBUG
+					m_SegmentPool.FreeSegment(pResponse, "ClientNetworkDiscovery");
+#else
+					m_SegmentPool.FreeSegment(pResponse);
+#endif
 				}
 			}
 			YieldTransmitter();
 		}
 	}
 
-	void ClientNetworkDiscovery::RunReceiver()
+	void ClientNetworkDiscovery::RunReceiver(uint32 workerIndex)
 	{
+		UNREFERENCED_VARIABLE(workerIndex);
+
 		IPEndPoint sender;
 
 		while (!ShouldTerminate())
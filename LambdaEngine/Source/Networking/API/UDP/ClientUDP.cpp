@@ -70,8 +70,10 @@ namespace LambdaEngine
 		return nullptr;
 	}
 
-	void ClientUDP::RunReceiver()
+	void ClientUDP::RunReceiver(uint32 workerIndex)
 	{
+		UNREFERENCED_VARIABLE(workerIndex);
+
 		IPEndPoint sender;
 		while (!ShouldTerminate())
 		{
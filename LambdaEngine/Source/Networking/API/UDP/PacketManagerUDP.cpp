@@ -90,7 +90,7 @@ namespace LambdaEngine
 			UntangleReliableSegments(segmentsReturned);
 
 
-		if (hasReliableSegment && m_SegmentsToSend[m_QueueIndex].empty())
+		if (hasReliableSegment && !HasSegmentsToSend())
 		{
 #ifdef LAMBDA_CONFIG_DEBUG
 			NetworkSegment* pSegment = m_SegmentPool.RequestFreeSegment("PacketManagerUDP_NETWORK_ACK");
@@ -135,14 +135,13 @@ namespace LambdaEngine
 
 		Timestamp currentTime = EngineLoop::GetTimeSinceStart();
 
-		TArray<std::pair<const uint32, SegmentInfo>> messagesToDelete;
+		TArray<ReliableSegmentInfo> messagesToDelete;
 
 		{
-			std::scoped_lock<SpinLock> lock(m_LockSegmentsToSend);
+			std::scoped_lock<SpinLock> lock(m_LockSegmentsWaitingForAck);
 
-			for (auto& pair : m_SegmentsWaitingForAck)
+			m_SegmentsWaitingForAck.ForEach([&](ReliableSegmentInfo& messageInfo)
 			{
-				SegmentInfo& messageInfo = pair.second;
 				if (messageInfo.LastSent != UINT64_MAX && (currentTime - messageInfo.LastSent).AsMilliSeconds() > pingMillis)
 				{
 					messageInfo.Retries++;
@@ -151,8 +150,7 @@ namespace LambdaEngine
 
 					if (messageInfo.Retries < m_MaxRetries)
 					{
-						InsertSegment(messageInfo.Segment);
-						messageInfo.LastSent = UINT64_MAX;
+						InsertResend(messageInfo);
 						if (messageInfo.Listener)
 							messageInfo.Listener->OnPacketResent(messageInfo.Segment, messageInfo.Retries);
 
@@ -160,19 +158,17 @@ namespace LambdaEngine
 					}
 					else
 					{
-						messagesToDelete.PushBack(pair);
+						messagesToDelete.PushBack(messageInfo);
 					}
 				}
-			}
+			});
 
-			for (auto& pair : messagesToDelete)
-				m_SegmentsWaitingForAck.erase(pair.first);
+			for (const ReliableSegmentInfo& messageInfo : messagesToDelete)
+				m_SegmentsWaitingForAck.Remove(messageInfo.ReliableUID);
 		}
 		
-		for (auto& pair : messagesToDelete)
+		for (ReliableSegmentInfo& messageInfo : messagesToDelete)
 		{
-			SegmentInfo& messageInfo = pair.second;
-
 			if (messageInfo.Listener)
 				messageInfo.Listener->OnPacketMaxTriesReached(messageInfo.Segment, messageInfo.Retries);
 
@@ -7,14 +7,29 @@
 
 #include "Log/Log.h"
 
+#include <algorithm>
+
 namespace LambdaEngine
 {
 	PacketTransceiverUDP::PacketTransceiverUDP() :
 		m_pSocket(nullptr),
 		m_ReceivingLossRatio(0.0f),
-		m_TransmittingLossRatio(0.0f)
+		m_TransmittingLossRatio(0.0f),
+		m_TransmitBatchThread(),
+		m_TransmitBatch(),
+		m_TransmitBatchCount(0),
+		m_pTransmitBatchBuffers(),
+		m_ReceiveBatch(),
+		m_ReceiveBatchCount(0),
+		m_ReceiveBatchIndex(0),
+		m_pReceiveBatchBuffers()
 	{
-
+		for (uint32 i = 0; i < PACKET_TRANSCEIVER_UDP_BATCH_SIZE; i++)
+		{
+			m_TransmitBatch[i].pBuffer		= m_pTransmitBatchBuffers[i];
+			m_ReceiveBatch[i].pBuffer		= m_pReceiveBatchBuffers[i];
+			m_ReceiveBatch[i].BufferSize	= MAXIMUM_SEGMENT_SIZE;
+		}
 	}
 
 	PacketTransceiverUDP::~PacketTransceiverUDP()
@@ -33,13 +48,48 @@ namespace LambdaEngine
 		}
 		#endif
 
+		if (m_TransmitBatchThread.load(std::memory_order_acquire) == std::this_thread::get_id())
+		{
+			ASSERT(bytesToSend <= MAXIMUM_SEGMENT_SIZE);
+
+			// pBuffer is reused for the next packet so it has to be copied
+			UDPDatagram& datagram = m_TransmitBatch[m_TransmitBatchCount++];
+			memcpy(datagram.pBuffer, pBuffer, bytesToSend);
+			datagram.BufferSize	= bytesToSend;
+			datagram.EndPoint	= ipEndPoint;
+
+			bytesSent = (int32)bytesToSend;
+
+			// Send failures while flushing are treated as packet loss, the packet was already handed to the batch
+			if (m_TransmitBatchCount == PACKET_TRANSCEIVER_UDP_BATCH_SIZE)
+				FlushTransmitBatch();
+
+			return true;
+		}
+
 		return m_pSocket->SendTo(pBuffer, bytesToSend, bytesSent, ipEndPoint);
 	}
 
 	bool PacketTransceiverUDP::ReceiveData(uint8* pBuffer, uint32 size, int32& bytesReceived, IPEndPoint& pIPEndPoint)
 	{
-		if (!m_pSocket->ReceiveFrom(pBuffer, size, bytesReceived, pIPEndPoint))
-			return false;
+		bytesReceived = 0;
+
+		if (m_ReceiveBatchIndex == m_ReceiveBatchCount)
+		{
+			m_ReceiveBatchIndex = 0;
+			m_ReceiveBatchCount = 0;
+
+			if (!m_pSocket->ReceiveFromBatch(m_ReceiveBatch, PACKET_TRANSCEIVER_UDP_BATCH_SIZE, m_ReceiveBatchCount))
+				return false;
+
+			if (m_ReceiveBatchCount == 0)
+				return true;
+		}
+
+		const UDPDatagram& datagram = m_ReceiveBatch[m_ReceiveBatchIndex++];
+		bytesReceived = std::min<int32>(datagram.Bytes, (int32)size);
+		memcpy(pBuffer, datagram.pBuffer, bytesReceived);
+		pIPEndPoint = datagram.EndPoint;
 
 #ifndef LAMBDA_CONFIG_PRODUCTION
 		if (m_ReceivingLossRatio > 0.0f && Random::Float32() <= m_ReceivingLossRatio)
@@ -60,6 +110,9 @@ namespace LambdaEngine
 	void PacketTransceiverUDP::SetSocket(ISocket* pSocket)
 	{
 		m_pSocket = (ISocketUDP*)pSocket;
+		m_TransmitBatchCount	= 0;
+		m_ReceiveBatchCount		= 0;
+		m_ReceiveBatchIndex		= 0;
 	}
 
 	void PacketTransceiverUDP::SetSimulateReceivingPacketLoss(float32 lossRatio)
@@ -72,6 +125,29 @@ namespace LambdaEngine
 		m_TransmittingLossRatio = lossRatio;
 	}
 
+	void PacketTransceiverUDP::BeginTransmitBatch()
+	{
+		ASSERT(m_TransmitBatchCount == 0);
+		m_TransmitBatchThread.store(std::this_thread::get_id(), std::memory_order_release);
+	}
+
+	void PacketTransceiverUDP::EndTransmitBatch()
+	{
+		FlushTransmitBatch();
+		m_TransmitBatchThread.store(std::thread::id(), std::memory_order_release);
+	}
+
+	bool PacketTransceiverUDP::FlushTransmitBatch()
+	{
+		if (m_TransmitBatchCount == 0)
+			return true;
+
+		uint32 sent = 0;
+		bool result = m_pSocket->SendToBatch(m_TransmitBatch, m_TransmitBatchCount, sent);
+		m_TransmitBatchCount = 0;
+		return result;
+	}
+
 	/*
 	* Updates the last Received Sequence number and corresponding bits.
 	*/
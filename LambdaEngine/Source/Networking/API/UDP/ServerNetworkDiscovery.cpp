@@ -110,8 +110,10 @@ namespace LambdaEngine
 		
 	}
 
-	void ServerNetworkDiscovery::RunReceiver()
+	void ServerNetworkDiscovery::RunReceiver(uint32 workerIndex)
 	{
+		UNREFERENCED_VARIABLE(workerIndex);
+
 		IPEndPoint sender;
 
 		while (!ShouldTerminate())
@@ -142,8 +144,9 @@ namespace LambdaEngine
 			bool isLAN;
 			if (decoder.ReadString(str) && str == m_NameOfGame && decoder.ReadBool(isLAN))
 			{
-				std::set<NetworkSegment*, NetworkSegmentUIDOrder> packets;
-				TSet<uint32> reliableUIDs;
+				TArray<NetworkSegment*> packets;
+				TArray<uint32> reliableUIDs;
+				uint32 segmentIndex = 0;
 
 #ifdef LAMBDA_DEBUG
 				NetworkSegment* pResponse = m_SegmentPool.RequestFreeSegment("ClientNetworkDiscovery");
@@ -152,7 +155,7 @@ namespace LambdaEngine
 #endif
 
 				pResponse->GetHeader().Type = NetworkSegment::TYPE_NETWORK_DISCOVERY;
-				packets.insert(pResponse);
+				packets.PushBack(pResponse);
 
 				BinaryEncoder encoder(pResponse);
 				encoder.WriteString(m_NameOfGame);
@@ -161,7 +164,13 @@ namespace LambdaEngine
 				encoder.WriteUInt64(m_ServerUID);
 				m_pHandler->OnNetworkDiscoveryPreTransmit(encoder);
 
-				m_Transceiver.Transmit(&m_SegmentPool, packets, reliableUIDs, sender, &m_Statistics);
+				m_Transceiver.Transmit(packets, segmentIndex, reliableUIDs, sender, &m_Statistics);
+
+#ifdef LAMBDA_DEBUG
+				m_SegmentPool.FreeSegment(pResponse, "ServerNetworkDiscovery");
+#else
+				m_SegmentPool.FreeSegment(pResponse);
+#endif
 			}
 		}
 	}
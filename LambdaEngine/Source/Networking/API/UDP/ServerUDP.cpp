@@ -8,25 +8,52 @@
 
 #include "Math/Random.h"
 
+#include "Engine/EngineLoop.h"
+
 #include "Log/Log.h"
 
 namespace LambdaEngine
 {
 	ServerUDP::ServerUDP(const ServerDesc& desc) :
 		ServerBase(desc),
-		m_Transciver()
+		m_Transciver(),
+		m_ReceiveTransceivers(),
+		m_ReceiverQueues()
 	{
-		
+		SetReceiverThreadCount(desc.ReceiverThreadCount);
+
+		m_ReceiveTransceivers.Resize(GetReceiverThreadCount());
+		for (PacketTransceiverUDP*& pTransceiver : m_ReceiveTransceivers)
+		{
+			pTransceiver = DBG_NEW PacketTransceiverUDP();
+		}
+
+		m_ReceiverQueues.Resize(GetReceiverThreadCount());
+		for (uint32 workerIndex = 1; workerIndex < GetReceiverThreadCount(); workerIndex++)
+		{
+			m_ReceiverQueues[workerIndex] = DBG_NEW ReceiverQueue();
+		}
 	}
 
 	ServerUDP::~ServerUDP()
 	{
-		
+		for (PacketTransceiverUDP* pTransceiver : m_ReceiveTransceivers)
+		{
+			SAFEDELETE(pTransceiver);
+		}
+
+		for (ReceiverQueue* pQueue : m_ReceiverQueues)
+		{
+			SAFEDELETE(pQueue);
+		}
 	}
 
 	void ServerUDP::SetSimulateReceivingPacketLoss(float32 lossRatio)
 	{
-		m_Transciver.SetSimulateReceivingPacketLoss(lossRatio);
+		for (PacketTransceiverUDP* pTransceiver : m_ReceiveTransceivers)
+		{
+			pTransceiver->SetSimulateReceivingPacketLoss(lossRatio);
+		}
 	}
 
 	void ServerUDP::SetSimulateTransmittingPacketLoss(float32 lossRatio)
@@ -42,6 +69,11 @@ namespace LambdaEngine
 			if (pSocket->Bind(GetEndPoint()))
 			{
 				m_Transciver.SetSocket(pSocket);
+				for (PacketTransceiverUDP* pTransceiver : m_ReceiveTransceivers)
+				{
+					pTransceiver->SetSocket(pSocket);
+				}
+
 				LOG_INFO("[ServerUDP]: Started %s", GetEndPoint().ToString().c_str());
 				return pSocket;
 			}
@@ -53,44 +85,172 @@ namespace LambdaEngine
 		return nullptr;
 	}
 
-	void ServerUDP::RunReceiver()
+	/*
+	* Every client is pinned to one receiver thread by the hash of its endpoint. Only the first receiver thread reads the
+	* socket, it decodes the datagrams of its own clients and forwards the rest in the order they arrived, so the packets
+	* of a client are always decoded in order and never by two threads at once.
+	*/
+	void ServerUDP::RunReceiver(uint32 workerIndex)
+	{
+		if (workerIndex == 0)
+		{
+			RunSocketReceiver();
+		}
+		else
+		{
+			RunQueueReceiver(workerIndex);
+		}
+	}
+
+	void ServerUDP::RunSocketReceiver()
 	{
 		IPEndPoint sender;
+		PacketTransceiverUDP* pTransceiver = m_ReceiveTransceivers[0];
 
 		while (!ShouldTerminate())
 		{
-			if (!m_Transciver.ReceiveBegin(sender))
+			if (!pTransceiver->ReceiveBegin(sender))
 				continue;
 
-			bool newConnection = false;
-			ClientRemoteUDP* pClient = GetOrCreateClient(sender, newConnection);
+			uint32 workerIndex = GetReceiverIndex(sender);
+			if (workerIndex == 0)
+			{
+				DecodeReceived(0, pTransceiver, sender);
+			}
+			else
+			{
+				ForwardReceived(workerIndex, pTransceiver, sender);
+			}
+		}
 
-			if (newConnection)
+		for (ReceiverQueue* pQueue : m_ReceiverQueues)
+		{
+			if (pQueue)
 			{
-				HandleNewConnection(pClient);
+				std::scoped_lock<std::mutex> lock(pQueue->Mutex);
+				pQueue->Condition.notify_one();
+			}
+		}
+	}
+
+	void ServerUDP::RunQueueReceiver(uint32 workerIndex)
+	{
+		ForwardedDatagram datagram;
+		PacketTransceiverUDP* pTransceiver = m_ReceiveTransceivers[workerIndex];
+		ReceiverQueue* pQueue = m_ReceiverQueues[workerIndex];
+
+		while (!ShouldTerminate())
+		{
+			if (pQueue->Datagrams.Dequeue(datagram))
+			{
+				pTransceiver->SetReceivedData(datagram.pBuffer, datagram.Bytes);
+				DecodeReceived(workerIndex, pTransceiver, datagram.Sender);
+				continue;
 			}
 
-			pClient->DecodeReceivedPackets();
+			// The timeout covers a datagram forwarded right before IsWaiting was set
+			std::unique_lock<std::mutex> lock(pQueue->Mutex);
+			pQueue->IsWaiting = true;
+			pQueue->Condition.wait_for(lock, std::chrono::milliseconds(SERVER_UDP_RECEIVER_WAIT_MS), [this, pQueue]
+			{
+				return !pQueue->Datagrams.IsEmpty() || ShouldTerminate();
+			});
+			pQueue->IsWaiting = false;
 		}
 	}
 
-	ClientRemoteUDP* ServerUDP::GetOrCreateClient(const IPEndPoint& sender, bool& newConnection)
+	void ServerUDP::ForwardReceived(uint32 workerIndex, const PacketTransceiverUDP* pTransceiver, const IPEndPoint& sender)
 	{
-		ClientRemoteBase* pClient = GetClient(sender);
-		if (pClient)
+		static thread_local ForwardedDatagram s_Datagram;
+		s_Datagram.Sender	= sender;
+		s_Datagram.Bytes	= std::min<uint32>(pTransceiver->GetBytesReceived(), MAXIMUM_SEGMENT_SIZE);
+		memcpy(s_Datagram.pBuffer, pTransceiver->GetReceivedData(), s_Datagram.Bytes);
+
+		// A full queue drops the datagram, which the protocol handles like any other lost UDP packet
+		ReceiverQueue* pQueue = m_ReceiverQueues[workerIndex];
+		if (pQueue->Datagrams.Enqueue(s_Datagram) && pQueue->IsWaiting)
 		{
-			newConnection = false;
-			return (ClientRemoteUDP*)pClient;
+			std::scoped_lock<std::mutex> lock(pQueue->Mutex);
+			pQueue->Condition.notify_one();
 		}
-		else
+	}
+
+	void ServerUDP::DecodeReceived(uint32 workerIndex, PacketTransceiverUDP* pTransceiver, const IPEndPoint& sender)
+	{
+		NetworkWorkerStatistics* pStatistics = GetMutableReceiverStatistics(workerIndex);
+		Timestamp decodeStart = EngineLoop::GetTimeSinceStart();
+
+		bool newConnection = false;
+		ClientRemoteUDP* pClient = GetOrCreateClient(sender, newConnection);
+
+		if (newConnection)
+		{
+			pStatistics->RegisterNewConnection();
+		}
+
+		pClient->DecodeReceivedPackets(pTransceiver);
+
+		pStatistics->RegisterPacketReceived(pTransceiver->GetBytesReceived(), EngineLoop::GetTimeSinceStart() - decodeStart);
+	}
+
+	uint32 ServerUDP::GetReceiverIndex(const IPEndPoint& sender) const
+	{
+		return (uint32)(sender.GetHash() % GetReceiverThreadCount());
+	}
+
+	/*
+	* Every client sends through m_Transciver, so batching it lets the socket send the packets of all clients
+	* for a tick with as few system calls as possible
+	*/
+	void ServerUDP::RunTransmitter()
+	{
+		while (!ShouldTerminate())
 		{
-			newConnection = true;
+			YieldTransmitter();
 
-			ClientRemoteDesc desc = {};
-			memcpy(&desc, &GetDescription(), sizeof(ServerDesc));
-			desc.Server = this;
+			m_Transciver.BeginTransmitBatch();
+			TransmitClientPackets();
+			m_Transciver.EndTransmitBatch();
+		}
+	}
+
+	/*
+	* Only the receiver thread the sender is pinned to creates its client, so the shard lock is only held while
+	* looking up and inserting, and HandleNewConnection is free to send packets without blocking the other threads
+	*/
+	ClientRemoteUDP* ServerUDP::GetOrCreateClient(const IPEndPoint& sender, bool& newConnection)
+	{
+		ClientLookupShard& shard = GetClientLookupShard(sender);
 
-			return DBG_NEW ClientRemoteUDP(desc, sender, &m_Transciver);
+		{
+			std::scoped_lock<SpinLock> lock(shard.Lock);
+			auto pIterator = shard.Clients.find(sender);
+			if (pIterator != shard.Clients.end())
+			{
+				newConnection = false;
+				return (ClientRemoteUDP*)pIterator->second;
+			}
 		}
+
+		newConnection = true;
+
+		ClientRemoteDesc desc = {};
+		memcpy(&desc, &GetDescription(), sizeof(ServerDesc));
+		desc.Server = this;
+
+		ClientRemoteUDP* pClient = DBG_NEW ClientRemoteUDP(desc, sender, &m_Transciver);
+
+		// Added before HandleNewConnection, so a client the server registers is already in its shard when removed
+		{
+			std::scoped_lock<SpinLock> lock(shard.Lock);
+			shard.Clients.insert({ sender, pClient });
+		}
+
+		if (!HandleNewConnection(pClient))
+		{
+			RemoveFromClientLookup(pClient);
+		}
+
+		return pClient;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Log/Log.h"
+
+#include "Networking/Linux/LinuxIPAddress.h"
+
+#include <arpa/inet.h>
+
+namespace LambdaEngine
+{
+	LinuxIPAddress::LinuxIPAddress(const std::string& address, uint64 hash) :
+		IPAddress(address, hash)
+	{
+		if (address == ADDRESS_ANY)
+		{
+			m_Addr.s_addr = htonl(INADDR_ANY);
+		}
+		else if (address == ADDRESS_BROADCAST)
+		{
+			m_Addr.s_addr = htonl(INADDR_BROADCAST);
+		}
+		else if (address == ADDRESS_LOOPBACK)
+		{
+			m_Addr.s_addr = htonl(INADDR_LOOPBACK);
+		}
+		else if (!inet_pton(AF_INET, address.c_str(), &m_Addr))
+		{
+			LOG_ERROR("[LinuxIPAddress]: Faild to convert [%s] to a valid IP-Address", address.c_str());
+			m_IsValid = false;
+		}
+	}
+
+	LinuxIPAddress::~LinuxIPAddress()
+	{
+
+	}
+
+	struct in_addr* LinuxIPAddress::GetLinuxAddr()
+	{
+		return &m_Addr;
+	}
+}
+#endif
@@ -0,0 +1,39 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Networking/Linux/LinuxNetworkUtils.h"
+#include "Networking/Linux/LinuxSocketTCP.h"
+#include "Networking/Linux/LinuxSocketUDP.h"
+#include "Networking/Linux/LinuxIPAddress.h"
+
+namespace LambdaEngine
+{
+	bool LinuxNetworkUtils::Init()
+	{
+		return NetworkUtils::Init();
+	}
+
+	void LinuxNetworkUtils::PreRelease()
+	{
+		NetworkUtils::PreRelease();
+	}
+
+	void LinuxNetworkUtils::PostRelease()
+	{
+		NetworkUtils::PostRelease();
+	}
+
+	ISocketTCP* LinuxNetworkUtils::CreateSocketTCP()
+	{
+		return DBG_NEW LinuxSocketTCP();
+	}
+
+	ISocketUDP* LinuxNetworkUtils::CreateSocketUDP()
+	{
+		return DBG_NEW LinuxSocketUDP();
+	}
+
+	IPAddress* LinuxNetworkUtils::CreateIPAddress(const std::string& address, uint64 hash)
+	{
+		return DBG_NEW LinuxIPAddress(address, hash);
+	}
+}
+#endif
@@ -0,0 +1,127 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Networking/Linux/LinuxSocketTCP.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <arpa/inet.h>
+
+namespace LambdaEngine
+{
+	LinuxSocketTCP::LinuxSocketTCP()
+		: m_Port(0)
+	{
+		m_Socket = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+		if (m_Socket == INVALID_SOCKET)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to create TCP socket");
+			PrintLastError(error);
+		}
+	}
+
+	LinuxSocketTCP::LinuxSocketTCP(int32 socket, const char* pAddress, uint16 port)
+		: LinuxSocketBase<ISocketTCP>(socket),
+		m_Address(pAddress),
+		m_Port(port)
+	{
+	}
+
+	bool LinuxSocketTCP::Listen()
+	{
+		int32 result = listen(m_Socket, 64);
+		if (result == SOCKET_ERROR)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to listen");
+			PrintLastError(error);
+			return false;
+		}
+		return true;
+	}
+
+	ISocketTCP* LinuxSocketTCP::Accept()
+	{
+		struct sockaddr_in socketAddress;
+		socklen_t size = sizeof(struct sockaddr_in);
+		int32 socket = accept4(m_Socket, (struct sockaddr*)&socketAddress, &size, SOCK_CLOEXEC);
+
+		if (socket == INVALID_SOCKET)
+		{
+			int32 error = errno;
+
+			// shutdown on a listening socket makes accept fail with EINVAL
+			if (!IsClosed() && error != EINTR && error != EINVAL)
+			{
+				LOG_ERROR_CRIT("Failed to accept Socket");
+				PrintLastError(error);
+			}
+			return nullptr;
+		}
+
+		char pAddress[INET_ADDRSTRLEN];
+		inet_ntop(AF_INET, &socketAddress.sin_addr, pAddress, INET_ADDRSTRLEN);
+		uint16 port = ntohs(socketAddress.sin_port);
+
+		return DBG_NEW LinuxSocketTCP(socket, pAddress, port);
+	}
+
+	bool LinuxSocketTCP::Send(const uint8* pBuffer, uint32 bytesToSend, int32& bytesSent)
+	{
+		// MSG_NOSIGNAL keeps a peer that already disconnected from raising SIGPIPE
+		bytesSent = (int32)send(m_Socket, pBuffer, bytesToSend, MSG_NOSIGNAL);
+		if (bytesSent == SOCKET_ERROR)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to send data");
+			PrintLastError(error);
+			return false;
+		}
+		return true;
+	}
+
+	bool LinuxSocketTCP::Receive(uint8* pBuffer, uint32 size, int32& bytesReceived)
+	{
+		bytesReceived = (int32)recv(m_Socket, pBuffer, size, 0);
+		if (bytesReceived == SOCKET_ERROR)
+		{
+			bytesReceived = 0;
+			int32 error = errno;
+
+			if (IsClosed())
+				return true;
+			else if ((error == EAGAIN || error == EWOULDBLOCK) && IsNonBlocking())
+				return true;
+			else if (error == ECONNRESET || error == ECONNABORTED)
+				return false;
+
+			LOG_ERROR_CRIT("Failed to receive data");
+			PrintLastError(error);
+			return false;
+		}
+		else if (bytesReceived == 0)
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	bool LinuxSocketTCP::EnableNaglesAlgorithm(bool enable)
+	{
+		const int32 noDelay = enable ? 1 : 0;
+		if (setsockopt(m_Socket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay)) == SOCKET_ERROR)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to set socket option Nagle's Algorithm (TCP_NODELAY), [Enable=%d]", enable);
+			PrintLastError(error);
+			return false;
+		}
+
+		return true;
+	}
+}
+#endif
@@ -0,0 +1,294 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Networking/Linux/LinuxSocketUDP.h"
+
+#include "Log/Log.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include <algorithm>
+
+namespace LambdaEngine
+{
+	LinuxSocketUDP::LinuxSocketUDP()
+		: LinuxSocketBase<ISocketUDP>(),
+		m_EpollFD(INVALID_SOCKET),
+		m_WakeFD(INVALID_SOCKET)
+	{
+		m_Socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP);
+		if (m_Socket == INVALID_SOCKET)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to create UDP socket");
+			PrintLastError(error);
+			return;
+		}
+
+		m_EpollFD	= epoll_create1(EPOLL_CLOEXEC);
+		m_WakeFD	= eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (m_EpollFD == INVALID_SOCKET || m_WakeFD == INVALID_SOCKET)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to create epoll instance for UDP socket");
+			PrintLastError(error);
+			return;
+		}
+
+		struct epoll_event socketEvent = {};
+		socketEvent.events	= EPOLLIN;
+		socketEvent.data.fd	= m_Socket;
+
+		struct epoll_event wakeEvent = {};
+		wakeEvent.events	= EPOLLIN;
+		wakeEvent.data.fd	= m_WakeFD;
+
+		if (epoll_ctl(m_EpollFD, EPOLL_CTL_ADD, m_Socket, &socketEvent) == SOCKET_ERROR ||
+			epoll_ctl(m_EpollFD, EPOLL_CTL_ADD, m_WakeFD, &wakeEvent) == SOCKET_ERROR)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to register UDP socket with epoll");
+			PrintLastError(error);
+		}
+	}
+
+	LinuxSocketUDP::~LinuxSocketUDP()
+	{
+		Close();
+
+		if (m_EpollFD != INVALID_SOCKET)
+			close(m_EpollFD);
+
+		if (m_WakeFD != INVALID_SOCKET)
+			close(m_WakeFD);
+	}
+
+	bool LinuxSocketUDP::SendTo(const uint8* pBuffer, uint32 bytesToSend, int32& bytesSent, const IPEndPoint& ipEndPoint)
+	{
+		struct sockaddr_in socketAddress;
+		IPEndPointToSocketAddress(&ipEndPoint, &socketAddress);
+
+		bytesSent = (int32)sendto(m_Socket, pBuffer, bytesToSend, 0, (struct sockaddr*)&socketAddress, sizeof(struct sockaddr_in));
+		if (bytesSent == SOCKET_ERROR)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to send data to %s", ipEndPoint.ToString().c_str());
+			PrintLastError(error);
+			return false;
+		}
+		return true;
+	}
+
+	bool LinuxSocketUDP::ReceiveFrom(uint8* pBuffer, uint32 size, int32& bytesReceived, IPEndPoint& ipEndPoint)
+	{
+		bytesReceived = 0;
+
+		if (!WaitForDatagrams())
+			return false;
+
+		struct sockaddr_in socketAddress;
+		socklen_t socketAddressSize = sizeof(struct sockaddr_in);
+
+		int32 result = (int32)recvfrom(m_Socket, pBuffer, size, MSG_DONTWAIT, (struct sockaddr*)&socketAddress, &socketAddressSize);
+		if (result == SOCKET_ERROR)
+		{
+			int32 error = errno;
+
+			// Another receiver thread got to the datagram first
+			if (error == EAGAIN || error == EWOULDBLOCK || error == EINTR || error == ECONNREFUSED)
+				return !IsClosed();
+			else if (IsClosed())
+				return false;
+
+			LOG_ERROR_CRIT("Failed to receive datagram packet");
+			PrintLastError(error);
+			return false;
+		}
+
+		bytesReceived = result;
+		SocketAddressToIPEndPoint(&socketAddress, ipEndPoint);
+		return true;
+	}
+
+	bool LinuxSocketUDP::SendToBatch(UDPDatagram* pDatagrams, uint32 count, uint32& sent)
+	{
+		struct mmsghdr messages[LINUX_SOCKET_UDP_MAX_BATCH];
+		struct iovec buffers[LINUX_SOCKET_UDP_MAX_BATCH];
+		struct sockaddr_in socketAddresses[LINUX_SOCKET_UDP_MAX_BATCH];
+
+		bool result = true;
+		uint32 datagramIndex = 0;
+		sent = 0;
+
+		while (datagramIndex < count)
+		{
+			const uint32 batchSize = std::min(count - datagramIndex, LINUX_SOCKET_UDP_MAX_BATCH);
+			for (uint32 i = 0; i < batchSize; i++)
+			{
+				UDPDatagram& datagram = pDatagrams[datagramIndex + i];
+				IPEndPointToSocketAddress(&datagram.EndPoint, &socketAddresses[i]);
+
+				buffers[i].iov_base	= datagram.pBuffer;
+				buffers[i].iov_len	= datagram.BufferSize;
+
+				messages[i] = {};
+				messages[i].msg_hdr.msg_name	= &socketAddresses[i];
+				messages[i].msg_hdr.msg_namelen	= sizeof(struct sockaddr_in);
+				messages[i].msg_hdr.msg_iov		= &buffers[i];
+				messages[i].msg_hdr.msg_iovlen	= 1;
+			}
+
+			int32 messagesSent = sendmmsg(m_Socket, messages, batchSize, 0);
+			if (messagesSent == SOCKET_ERROR)
+			{
+				int32 error = errno;
+				if (error == EINTR)
+					continue;
+
+				// sendmmsg stops at the first datagram that fails, skip it so one bad endpoint does not drop the rest
+				LOG_ERROR_CRIT("Failed to send data to %s", pDatagrams[datagramIndex].EndPoint.ToString().c_str());
+				PrintLastError(error);
+				pDatagrams[datagramIndex].Bytes = 0;
+				datagramIndex++;
+				result = false;
+				continue;
+			}
+
+			for (int32 i = 0; i < messagesSent; i++)
+			{
+				pDatagrams[datagramIndex + i].Bytes = (int32)messages[i].msg_len;
+			}
+
+			datagramIndex += (uint32)messagesSent;
+			sent += (uint32)messagesSent;
+		}
+
+		return result;
+	}
+
+	bool LinuxSocketUDP::ReceiveFromBatch(UDPDatagram* pDatagrams, uint32 count, uint32& received)
+	{
+		received = 0;
+
+		if (count == 0)
+			return true;
+
+		if (!WaitForDatagrams())
+			return false;
+
+		struct mmsghdr messages[LINUX_SOCKET_UDP_MAX_BATCH];
+		struct iovec buffers[LINUX_SOCKET_UDP_MAX_BATCH];
+		struct sockaddr_in socketAddresses[LINUX_SOCKET_UDP_MAX_BATCH];
+
+		const uint32 batchSize = std::min(count, LINUX_SOCKET_UDP_MAX_BATCH);
+		for (uint32 i = 0; i < batchSize; i++)
+		{
+			buffers[i].iov_base	= pDatagrams[i].pBuffer;
+			buffers[i].iov_len	= pDatagrams[i].BufferSize;
+
+			messages[i] = {};
+			messages[i].msg_hdr.msg_name	= &socketAddresses[i];
+			messages[i].msg_hdr.msg_namelen	= sizeof(struct sockaddr_in);
+			messages[i].msg_hdr.msg_iov		= &buffers[i];
+			messages[i].msg_hdr.msg_iovlen	= 1;
+		}
+
+		int32 result = recvmmsg(m_Socket, messages, batchSize, MSG_DONTWAIT, nullptr);
+		if (result == SOCKET_ERROR)
+		{
+			int32 error = errno;
+
+			// Another receiver thread got to the datagrams first
+			if (error == EAGAIN || error == EWOULDBLOCK || error == EINTR || error == ECONNREFUSED)
+				return !IsClosed();
+			else if (IsClosed())
+				return false;
+
+			LOG_ERROR_CRIT("Failed to receive datagram packets");
+			PrintLastError(error);
+			return false;
+		}
+
+		for (int32 i = 0; i < result; i++)
+		{
+			UDPDatagram& datagram = pDatagrams[i];
+			datagram.Bytes = (int32)messages[i].msg_len;
+			SocketAddressToIPEndPoint(&socketAddresses[i], datagram.EndPoint);
+		}
+
+		received = (uint32)result;
+		return true;
+	}
+
+	bool LinuxSocketUDP::EnableBroadcast(bool enable)
+	{
+		const int32 broadcast = enable ? 1 : 0;
+		if (setsockopt(m_Socket, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast)) == SOCKET_ERROR)
+		{
+			int32 error = errno;
+			LOG_ERROR_CRIT("Failed to set Broadcast option [Enable=%d]", enable);
+			PrintLastError(error);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool LinuxSocketUDP::Close()
+	{
+		if (!IsClosed() && m_WakeFD != INVALID_SOCKET)
+		{
+			// Wakes every thread waiting in WaitForDatagrams, the counter is never read so it stays signaled
+			const uint64 value = 1;
+			if (write(m_WakeFD, &value, sizeof(value)) == SOCKET_ERROR)
+			{
+				int32 error = errno;
+				LOG_ERROR_CRIT("Failed to wake UDP socket receivers");
+				PrintLastError(error);
+			}
+		}
+
+		return LinuxSocketBase<ISocketUDP>::Close();
+	}
+
+	bool LinuxSocketUDP::WaitForDatagrams()
+	{
+		if (IsNonBlocking())
+			return !IsClosed();
+
+		struct epoll_event events[2];
+		while (!IsClosed())
+		{
+			int32 eventCount = epoll_wait(m_EpollFD, events, 2, -1);
+			if (eventCount == SOCKET_ERROR)
+			{
+				int32 error = errno;
+				if (error == EINTR)
+					continue;
+
+				LOG_ERROR_CRIT("Failed to wait for datagram packets");
+				PrintLastError(error);
+				return false;
+			}
+
+			bool hasDatagrams = false;
+			for (int32 i = 0; i < eventCount; i++)
+			{
+				if (events[i].data.fd == m_WakeFD)
+					return false;
+
+				hasDatagrams = true;
+			}
+
+			if (hasDatagrams)
+				return true;
+		}
+
+		return false;
+	}
+}
+#endif
@@ -50,10 +50,12 @@ namespace LambdaEngine
 			return false;
 		}
 
-		inet_ntop(socketAddress.sin_family, &socketAddress.sin_addr, m_pReceiveAddressBuffer, s_ReceiveAddressBufferSize);
+		// Several receiver threads can share the socket, so the address is not written to a member
+		char pAddressBuffer[s_ReceiveAddressBufferSize];
+		inet_ntop(socketAddress.sin_family, &socketAddress.sin_addr, pAddressBuffer, s_ReceiveAddressBufferSize);
 		uint16 port = ntohs(socketAddress.sin_port);
 
-		pIPEndPoint.SetEndPoint(IPAddress::Get(m_pReceiveAddressBuffer), port);
+		pIPEndPoint.SetEndPoint(IPAddress::Get(pAddressBuffer), port);
 
 		return true;
 	}
@@ -0,0 +1,208 @@
+#include "Physics/PhysX/CollisionMeshCache.h"
+
+#include "Containers/TArray.h"
+
+#include "Log/Log.h"
+
+#include "Resources/ResourcePaths.h"
+
+#include "Utilities/FileUtilities.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace LambdaEngine
+{
+	using namespace physx;
+
+	struct CollisionMeshCacheHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 Size;
+	};
+
+	// Only the cooking parameters that change the cooked data are part of the key
+	struct CollisionMeshKeyHeader
+	{
+		uint32	Version;
+		uint32	PhysXVersion;
+		uint32	MeshFlags;
+		uint32	PointCount;
+		uint32	TriangleCount;
+		uint32	MidphaseType;
+		uint32	PrimitivesPerLeaf;
+		uint32	PreprocessFlags;
+		uint32	SuppressRemapTable;
+		float32	WeldTolerance;
+		float32	LengthScale;
+		float32	SpeedScale;
+	};
+
+	CollisionMeshCache::~CollisionMeshCache()
+	{
+		Release();
+	}
+
+	void CollisionMeshCache::Init(PxPhysics* pPhysics, PxCooking* pCooking)
+	{
+		m_pPhysics = pPhysics;
+		m_pCooking = pCooking;
+	}
+
+	void CollisionMeshCache::Release()
+	{
+		std::scoped_lock<SpinLock> lock(m_Lock);
+		for (auto& meshPair : m_TriangleMeshes)
+		{
+			meshPair.second->release();
+		}
+
+		m_TriangleMeshes.clear();
+	}
+
+	PxTriangleMesh* CollisionMeshCache::GetTriangleMesh(const PxTriangleMeshDesc& meshDesc)
+	{
+		SHA256Hash key;
+		ComputeKey(meshDesc, key);
+
+		{
+			std::scoped_lock<SpinLock> lock(m_Lock);
+			auto meshIt = m_TriangleMeshes.find(key);
+			if (meshIt != m_TriangleMeshes.end())
+			{
+				return meshIt->second;
+			}
+		}
+
+		PxTriangleMesh* pTriangleMesh = LoadTriangleMesh(key);
+		if (!pTriangleMesh)
+		{
+			/* Perform mesh 'cooking'; generate an optimized collision mesh from triangle data */
+			PxDefaultMemoryOutputStream cookedData;
+			PxTriangleMeshCookingResult::Enum result;
+			if (!m_pCooking->cookTriangleMesh(meshDesc, cookedData, &result))
+			{
+				LOG_WARNING("Failed to cook mesh with %u vertices", meshDesc.points.count);
+				return nullptr;
+			}
+
+			StoreTriangleMesh(key, cookedData);
+
+			PxDefaultMemoryInputData readBuffer(cookedData.getData(), cookedData.getSize());
+			pTriangleMesh = m_pPhysics->createTriangleMesh(readBuffer);
+			if (!pTriangleMesh)
+			{
+				return nullptr;
+			}
+		}
+
+		// Another thread may have created the same mesh in the meantime, the first one is kept
+		std::scoped_lock<SpinLock> lock(m_Lock);
+		auto [meshIt, inserted] = m_TriangleMeshes.insert({ key, pTriangleMesh });
+		if (!inserted)
+		{
+			pTriangleMesh->release();
+		}
+
+		return meshIt->second;
+	}
+
+	void CollisionMeshCache::ComputeKey(const PxTriangleMeshDesc& meshDesc, SHA256Hash& key) const
+	{
+		const PxCookingParams& cookingParams = m_pCooking->getParams();
+		const PxMeshMidPhase::Enum midphaseType = cookingParams.midphaseDesc.getType();
+
+		CollisionMeshKeyHeader keyHeader = {};
+		keyHeader.Version				= COLLISION_MESH_CACHE_VERSION;
+		keyHeader.PhysXVersion			= PX_PHYSICS_VERSION;
+		keyHeader.MeshFlags				= uint32(PxU16(meshDesc.flags));
+		keyHeader.PointCount			= meshDesc.points.count;
+		keyHeader.TriangleCount			= meshDesc.triangles.count;
+		keyHeader.MidphaseType			= uint32(midphaseType);
+		keyHeader.PrimitivesPerLeaf		= midphaseType == PxMeshMidPhase::eBVH34 ? cookingParams.midphaseDesc.mBVH34Desc.numPrimsPerLeaf : 0;
+		keyHeader.PreprocessFlags		= uint32(cookingParams.meshPreprocessParams);
+		keyHeader.SuppressRemapTable	= cookingParams.suppressTriangleMeshRemapTable ? 1 : 0;
+		keyHeader.WeldTolerance			= cookingParams.meshWeldTolerance;
+		keyHeader.LengthScale			= cookingParams.scale.length;
+		keyHeader.SpeedScale			= cookingParams.scale.speed;
+
+		// Points and triangles are usually interleaved with other data, only the parts that are cooked are hashed
+		TArray<PxVec3> positions(meshDesc.points.count);
+		const byte* pPoints = reinterpret_cast<const byte*>(meshDesc.points.data);
+		for (uint32 pointIdx = 0; pointIdx < meshDesc.points.count; pointIdx++)
+		{
+			memcpy(&positions[pointIdx], pPoints + pointIdx * meshDesc.points.stride, sizeof(PxVec3));
+		}
+
+		const uint32 triangleSize = meshDesc.flags.isSet(PxMeshFlag::e16_BIT_INDICES) ? 3 * sizeof(PxU16) : 3 * sizeof(PxU32);
+		TArray<byte> triangles(meshDesc.triangles.count * triangleSize);
+		const byte* pTriangles = reinterpret_cast<const byte*>(meshDesc.triangles.data);
+		for (uint32 triangleIdx = 0; triangleIdx < meshDesc.triangles.count; triangleIdx++)
+		{
+			memcpy(triangles.GetData() + triangleIdx * triangleSize, pTriangles + triangleIdx * meshDesc.triangles.stride, triangleSize);
+		}
+
+		SHA256 sha = SHA256();
+		sha.Init();
+		sha.Update(reinterpret_cast<const byte*>(&keyHeader), sizeof(CollisionMeshKeyHeader));
+		sha.Update(reinterpret_cast<const byte*>(positions.GetData()), uint32(positions.GetSize() * sizeof(PxVec3)));
+		sha.Update(triangles.GetData(), triangles.GetSize());
+
+		memset(key.Data, 0, DIGEST_SIZE);
+		sha.Final(key.Data);
+	}
+
+	PxTriangleMesh* CollisionMeshCache::LoadTriangleMesh(const SHA256Hash& key) const
+	{
+		std::ifstream file(GetEntryPath(key), std::ifstream::in | std::ifstream::binary);
+		if (!file)
+		{
+			return nullptr;
+		}
+
+		CollisionMeshCacheHeader header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(CollisionMeshCacheHeader));
+		if (!file || header.Magic != COLLISION_MESH_CACHE_MAGIC || header.Version != COLLISION_MESH_CACHE_VERSION || header.Size == 0)
+		{
+			return nullptr;
+		}
+
+		TArray<byte> cookedData(header.Size);
+		file.read(reinterpret_cast<char*>(cookedData.GetData()), std::streamsize(header.Size));
+		if (!file)
+		{
+			return nullptr;
+		}
+
+		// PhysX validates the cooked data itself and fails if it was cooked for another version or platform
+		PxDefaultMemoryInputData readBuffer(cookedData.GetData(), header.Size);
+		return m_pPhysics->createTriangleMesh(readBuffer);
+	}
+
+	void CollisionMeshCache::StoreTriangleMesh(const SHA256Hash& key, const PxDefaultMemoryOutputStream& cookedData) const
+	{
+		std::error_code error;
+		std::filesystem::create_directories(COLLISION_CACHE_DIR, error);
+
+		CollisionMeshCacheHeader header = {};
+		header.Magic	= COLLISION_MESH_CACHE_MAGIC;
+		header.Version	= COLLISION_MESH_CACHE_VERSION;
+		header.Size		= cookedData.getSize();
+
+		// Threads cooking the same mesh never see half an entry
+		const String entryPath = GetEntryPath(key);
+		AtomicFileWriter writer(entryPath);
+		writer.Write(&header, sizeof(CollisionMeshCacheHeader));
+		writer.Write(cookedData.getData(), cookedData.getSize());
+		if (!writer.Commit())
+		{
+			LOG_WARNING("[CollisionMeshCache]: Failed to write \"%s\"", entryPath.c_str());
+		}
+	}
+
+	String CollisionMeshCache::GetEntryPath(const SHA256Hash& key)
+	{
+		return COLLISION_CACHE_DIR + ToHexString(key.Data, DIGEST_SIZE) + ".pxtm";
+	}
+}
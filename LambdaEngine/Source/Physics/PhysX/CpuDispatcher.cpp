@@ -0,0 +1,37 @@
+#include "Physics/PhysX/CpuDispatcher.h"
+
+#include "Debug/CPUProfiler.h"
+
+#include <algorithm>
+
+namespace LambdaEngine
+{
+	PhysXCpuDispatcher::PhysXCpuDispatcher(uint32 workerCount)
+		: m_WorkerCount(workerCount == 0 ? ThreadPool::GetThreadCount() : std::min(workerCount, ThreadPool::GetThreadCount()))
+	{
+	}
+
+	PhysXCpuDispatcher::~PhysXCpuDispatcher()
+	{
+		ThreadPool::Wait(m_Tasks);
+	}
+
+	void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
+	{
+		ThreadPool::Execute(m_Tasks, [&task]
+		{
+			{
+				LAMBDA_PROFILER_SCOPE(task.getName());
+				task.run();
+			}
+
+			// Releasing a task can submit the tasks that were waiting for it
+			task.release();
+		});
+	}
+
+	uint32_t PhysXCpuDispatcher::getWorkerCount() const
+	{
+		return m_WorkerCount;
+	}
+}
@@ -103,6 +103,7 @@ namespace LambdaEngine
 	AnimationState::AnimationState()
 		: m_pOwnerGraph(nullptr)
 		, m_pFinalNode(nullptr)
+		, m_pOutputClip(nullptr)
 		, m_NodeAllocator()
 		, m_Nodes()
 		, m_Name()
@@ -113,6 +114,7 @@ namespace LambdaEngine
 	AnimationState::AnimationState(const String& name)
 		: m_pOwnerGraph(nullptr)
 		, m_pFinalNode(nullptr)
+		, m_pOutputClip(nullptr)
 		, m_NodeAllocator()
 		, m_Nodes()
 		, m_Name(name)
@@ -123,12 +125,14 @@ namespace LambdaEngine
 	AnimationState::AnimationState(const String& name, GUID_Lambda animationGUID, float64 playbackSpeed, bool isLooping)
 		: m_pOwnerGraph(nullptr)
 		, m_pFinalNode(nullptr)
+		, m_pOutputClip(nullptr)
 		, m_NodeAllocator()
 		, m_Nodes()
 		, m_Name(name)
 	{
 		ClipNode* pClip = CreateClipNode(animationGUID, playbackSpeed, isLooping);
 		m_pFinalNode = CreateOutputNode(pClip);
+		m_pOutputClip = pClip;
 	}
 
 	AnimationState::~AnimationState()
@@ -185,6 +189,7 @@ namespace LambdaEngine
 
 	AnimationGraph::AnimationGraph()
 		: m_IsBlending(false)
+		, m_MaxJointDepth(UINT32_MAX)
 		, m_pCurrentTransition(nullptr)
 		, m_pCurrentState(nullptr)
 		, m_States()
@@ -194,6 +199,7 @@ namespace LambdaEngine
 
 	AnimationGraph::AnimationGraph(AnimationState* pAnimationState)
 		: m_IsBlending(false)
+		, m_MaxJointDepth(UINT32_MAX)
 		, m_pCurrentTransition(nullptr)
 		, m_pCurrentState(nullptr)
 		, m_States()
@@ -89,6 +89,8 @@ namespace LambdaEngine
 
 	void ClipNode::Tick(const Skeleton& skeleton, float64 deltaTimeInSeconds)
 	{
+		const float64 previousProgress = m_LocalTimeInSeconds / m_DurationInSeconds;
+
 		// Get localtime for the animation-clip
 		m_RunningTime += deltaTimeInSeconds;
 		float64 localTime = m_RunningTime * fabs(m_PlaybackSpeed);
@@ -117,6 +119,13 @@ namespace LambdaEngine
 			}
 		}
 
+		// A looping clip that wrapped around has passed the end of the previous loop as well
+		const bool hasWrapped = m_IsLooping && localTime < m_LocalTimeInSeconds;
+		if (hasWrapped)
+		{
+			HandleTriggers(previousProgress, 1.0);
+		}
+
 		// Reset loop
 		if (IsLoopFinished())
 		{
@@ -130,125 +139,84 @@ namespace LambdaEngine
 			m_NormalizedTime = 1.0 - m_NormalizedTime;
 		}
 
-		// Make sure we have enough matrices
-		Animation& animation = *m_pAnimation;
-		const uint32 numJoints = skeleton.Joints.GetSize();
-		if (m_FrameData.GetSize() < numJoints)
+		if (!m_DeferSampling)
 		{
-			m_FrameData.Resize(numJoints, SQT(glm::vec3(0.0f), glm::vec3(1.0f), glm::identity<glm::quat>()));
-		}
-
-		const float64 timestamp	= m_NormalizedTime * animation.DurationInTicks;
-		for (Animation::Channel& channel : animation.Channels)
-		{
-			// Retrive the bone ID
-			auto it = skeleton.JointMap.find(channel.Name);
-			if (it != skeleton.JointMap.end())
-			{
-				// Sample SQT for this animation
-				glm::vec3 position	= SamplePosition(channel, timestamp);
-				glm::quat rotation	= SampleRotation(channel, timestamp);
-				glm::vec3 scale		= SampleScale(channel, timestamp);
-
-				const JointIndexType jointID = it->second;
-				m_FrameData[jointID] = SQT(position, scale, rotation, jointID);
-			}
+			Sample(skeleton, GetFrame());
 		}
 
 		// Handle triggers
-		if (m_Triggers.GetSize() > 0)
+		HandleTriggers(hasWrapped ? 0.0 : previousProgress, m_LocalTimeInSeconds / m_DurationInSeconds);
+	}
+
+	void ClipNode::HandleTriggers(float64 beginProgress, float64 endProgress)
+	{
+		// Every trigger that the elapsed time passed fires, a tick can step over a trigger when the animation LOD
+		// updates the graph less often. Triggers still fire slightly early as they always have
+		constexpr float64 EPSILON = 0.025;
+		for (ClipTrigger& trigger : m_Triggers)
 		{
-			for (ClipTrigger& trigger : m_Triggers)
+			if (!trigger.IsTriggered)
 			{
-				if (!trigger.IsTriggered)
+				const float64 triggerProgress = m_PlaybackSpeed < 0.0 ? 1.0 - trigger.TriggerAt : trigger.TriggerAt;
+				if (triggerProgress >= beginProgress && triggerProgress <= endProgress + EPSILON)
 				{
-					constexpr float64 EPSILON = 0.025;
-					if (trigger.TriggerAt >= (m_NormalizedTime - EPSILON) && trigger.TriggerAt <= (m_NormalizedTime + EPSILON))
-					{
-						AnimationGraph& graph = *m_pParent->GetOwner();
-						trigger.Func(*this, graph);
-						trigger.IsTriggered = true;
-						break;
-					}
+					AnimationGraph& graph = *m_pParent->GetOwner();
+					trigger.Func(*this, graph);
+					trigger.IsTriggered = true;
 				}
 			}
 		}
 	}
 
-	glm::vec3 ClipNode::SamplePosition(Animation::Channel& channel, float64 time)
+	void ClipNode::Sample(const Skeleton& skeleton, float64 frame)
 	{
-		// If the clip is looping the last frame is redundant
-		const uint32 numPositions = m_IsLooping ? channel.Positions.GetSize() - 1 : channel.Positions.GetSize();
-
-		Animation::Channel::KeyFrame pos0 = channel.Positions[0];
-		Animation::Channel::KeyFrame pos1 = channel.Positions[0];
-		if (numPositions > 1)
+		// Make sure we have enough matrices
+		Animation& animation = *m_pAnimation;
+		const uint32 numJoints = skeleton.Joints.GetSize();
+		if (m_FrameData.GetSize() < numJoints)
 		{
-			for (uint32 i = 0; i < (numPositions - 1); i++)
-			{
-				if (time <= channel.Positions[i + 1].Time)
-				{
-					pos0 = channel.Positions[i];
-					pos1 = channel.Positions[i + 1];
-					break;
-				}
-			}
+			m_FrameData.Resize(numJoints, SQT(glm::vec3(0.0f), glm::vec3(1.0f), glm::identity<glm::quat>()));
 		}
 
-		const float64 factor	= (pos1.Time != pos0.Time) ? (time - pos0.Time) / (pos1.Time - pos0.Time) : 0.0f;
-		glm::vec3 position		= glm::mix(pos0.Value, pos1.Value, glm::vec3(float32(factor)));
-		return position;
-	}
+		if (m_pBoundSkeleton != &skeleton)
+		{
+			BindSkeleton(skeleton);
+		}
 
-	glm::vec3 ClipNode::SampleScale(Animation::Channel& channel, float64 time)
-	{
-		// If the clip is looping the last frame is redundant
-		const uint32 numScales = m_IsLooping ? channel.Scales.GetSize() - 1 : channel.Scales.GetSize();
+		// Joints deeper than the graph's LOD allows are left out, the animation system poses them from the bind pose
+		const uint32 maxJointDepth = m_pParent->GetOwner()->GetMaxJointDepth();
 
-		Animation::Channel::KeyFrame scale0 = channel.Scales[0];
-		Animation::Channel::KeyFrame scale1 = channel.Scales[0];
-		if (numScales > 1)
+		// Frames are evenly spaced, so the two frames around the current time are found directly
+		const uint32	lastFrame	= animation.FrameCount - 1;
+		const uint32	frame0		= std::min(uint32(frame), lastFrame);
+		const uint32	frame1		= std::min(frame0 + 1, lastFrame);
+		const float32	factor		= glm::clamp(float32(frame - float64(frame0)), 0.0f, 1.0f);
+		for (uint32 channelIndex = 0; channelIndex < animation.Channels.GetSize(); channelIndex++)
 		{
-			for (uint32 i = 0; i < (numScales - 1); i++)
+			const JointIndexType jointID = m_ChannelJoints[channelIndex];
+			if (jointID != INVALID_JOINT_ID && skeleton.JointDepths[jointID] <= maxJointDepth)
 			{
-				if (time <= channel.Scales[i + 1].Time)
-				{
-					scale0 = channel.Scales[i];
-					scale1 = channel.Scales[i + 1];
-					break;
-				}
+				const Animation::Channel& channel = animation.Channels[channelIndex];
+				m_FrameData[jointID] = SQT(
+					channel.Positions.Sample(frame0, frame1, factor),
+					channel.Scales.Sample(frame0, frame1, factor),
+					channel.Rotations.Sample(frame0, frame1, factor),
+					jointID);
 			}
 		}
-
-		const float64 factor = (scale1.Time != scale0.Time) ? (time - scale0.Time) / (scale1.Time - scale0.Time) : 0.0f;
-		glm::vec3 scale = glm::mix(scale0.Value, scale1.Value, glm::vec3(float32(factor)));
-		return scale;
 	}
 
-	glm::quat ClipNode::SampleRotation(Animation::Channel& channel, float64 time)
+	void ClipNode::BindSkeleton(const Skeleton& skeleton)
 	{
-		// If the clip is looping the last frame is redundant
-		const uint32 numRotations = m_IsLooping ? channel.Rotations.GetSize() - 1 : channel.Rotations.GetSize();
-
-		Animation::Channel::RotationKeyFrame rot0 = channel.Rotations[0];
-		Animation::Channel::RotationKeyFrame rot1 = channel.Rotations[0];
-		if (numRotations > 1)
+		const TArray<Animation::Channel>& channels = m_pAnimation->Channels;
+		m_ChannelJoints.Resize(channels.GetSize());
+		for (uint32 channelIndex = 0; channelIndex < channels.GetSize(); channelIndex++)
 		{
-			for (uint32 i = 0; i < (numRotations - 1); i++)
-			{
-				if (time <= channel.Rotations[i + 1].Time)
-				{
-					rot0 = channel.Rotations[i];
-					rot1 = channel.Rotations[i + 1];
-					break;
-				}
-			}
+			auto it = skeleton.JointMap.find(channels[channelIndex].Name);
+			m_ChannelJoints[channelIndex] = (it != skeleton.JointMap.end()) ? it->second : JointIndexType(INVALID_JOINT_ID);
 		}
 
-		const float64 factor = (rot1.Time != rot0.Time) ? (time - rot0.Time) / (rot1.Time - rot0.Time) : 0.0;
-		glm::quat rotation	= glm::slerp(rot0.Value, rot1.Value, float32(factor));
-		rotation			= glm::normalize(rotation);
-		return rotation;
+		m_pBoundSkeleton = &skeleton;
 	}
 
 	void ClipNode::OnLoopFinish()
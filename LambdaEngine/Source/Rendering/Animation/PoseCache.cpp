@@ -0,0 +1,54 @@
+#include "Rendering/Animation/PoseCache.h"
+
+namespace LambdaEngine
+{
+	void PoseCache::Reset(uint32 maxPoses)
+	{
+		m_Entries.clear();
+		m_PoseCount = 0;
+
+		if (m_Poses.GetSize() < maxPoses)
+		{
+			m_Poses.Resize(maxPoses);
+		}
+	}
+
+	bool PoseCache::Find(const PoseCacheKey& key, TArray<glm::mat4>& globalTransforms)
+	{
+		uint32 poseIndex;
+		{
+			std::scoped_lock<SpinLock> lock(m_Lock);
+			auto it = m_Entries.find(key);
+			if (it == m_Entries.end())
+			{
+				return false;
+			}
+
+			poseIndex = it->second;
+		}
+
+		// Inserted poses are never written again this frame, so the copy does not have to hold the lock
+		globalTransforms = m_Poses[poseIndex];
+		return true;
+	}
+
+	void PoseCache::Insert(const PoseCacheKey& key, const TArray<glm::mat4>& globalTransforms)
+	{
+		uint32 poseIndex;
+		{
+			std::scoped_lock<SpinLock> lock(m_Lock);
+			if (m_PoseCount >= m_Poses.GetSize() || m_Entries.count(key) > 0)
+			{
+				return;
+			}
+
+			poseIndex = m_PoseCount++;
+		}
+
+		// The pose is copied before the key is published, two instances racing for the same key both claim a pose
+		m_Poses[poseIndex] = globalTransforms;
+
+		std::scoped_lock<SpinLock> lock(m_Lock);
+		m_Entries.insert({ key, poseIndex });
+	}
+}
@@ -0,0 +1,515 @@
+#include "Rendering/InstanceCuller.h"
+
+#include <cfloat>
+#include <xmmintrin.h>
+
+namespace LambdaEngine
+{
+	enum class EFrustumTestResult : uint8
+	{
+		OUTSIDE		= 0,
+		INTERSECTS	= 1,
+		INSIDE		= 2,
+	};
+
+	FORCEINLINE static float32 SurfaceArea(const glm::vec3& min, const glm::vec3& max)
+	{
+		const glm::vec3 size = max - min;
+		return size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	/*
+	* Tests the box against four planes at a time, the box is outside as soon as it lies behind a single plane and
+	* inside if it lies in front of all of them
+	*/
+	FORCEINLINE static EFrustumTestResult TestFrustum(const CullingFrustum& frustum, const glm::vec3& min, const glm::vec3& max)
+	{
+		const glm::vec3 center = (min + max) * 0.5f;
+		const glm::vec3 extent = (max - min) * 0.5f;
+
+		const __m128 centerX = _mm_set1_ps(center.x);
+		const __m128 centerY = _mm_set1_ps(center.y);
+		const __m128 centerZ = _mm_set1_ps(center.z);
+		const __m128 extentX = _mm_set1_ps(extent.x);
+		const __m128 extentY = _mm_set1_ps(extent.y);
+		const __m128 extentZ = _mm_set1_ps(extent.z);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 zero = _mm_setzero_ps();
+
+		int32 intersectMask = 0;
+		for (uint32 p = 0; p < 8; p += 4)
+		{
+			const __m128 planeX = _mm_load_ps(&frustum.PlanesX[p]);
+			const __m128 planeY = _mm_load_ps(&frustum.PlanesY[p]);
+			const __m128 planeZ = _mm_load_ps(&frustum.PlanesZ[p]);
+			const __m128 planeW = _mm_load_ps(&frustum.PlanesW[p]);
+
+			// Signed distance from the center and the projected radius of the box along each normal
+			const __m128 distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(planeX, centerX), _mm_mul_ps(planeY, centerY)),
+				_mm_add_ps(_mm_mul_ps(planeZ, centerZ), planeW));
+			const __m128 radius = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, planeX), extentX), _mm_mul_ps(_mm_andnot_ps(signMask, planeY), extentY)),
+				_mm_mul_ps(_mm_andnot_ps(signMask, planeZ), extentZ));
+
+			if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), zero)) != 0)
+			{
+				return EFrustumTestResult::OUTSIDE;
+			}
+
+			intersectMask |= _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(distance, radius), zero));
+		}
+
+		return intersectMask != 0 ? EFrustumTestResult::INTERSECTS : EFrustumTestResult::INSIDE;
+	}
+
+	/*
+	* Everything within the box is too small for its distance if even the bounding sphere of the whole box is
+	*/
+	FORCEINLINE static bool IsTooSmall(const CullingFrustum& frustum, const glm::vec3& min, const glm::vec3& max)
+	{
+		const float32 radius	= glm::length(max - min) * 0.5f;
+		const float32 distance	= glm::length((min + max) * 0.5f - frustum.ViewPosition) - radius;
+		return radius < distance * frustum.MinRadiusPerDistance;
+	}
+
+	/*
+	* CullingFrustum
+	*/
+	CullingFrustum CullingFrustum::FromViewProjection(const glm::mat4& viewProjection, const glm::vec3& viewPosition, float32 minRadiusPerDistance)
+	{
+		const glm::mat4 rows = glm::transpose(viewProjection);
+		const glm::vec4 row0 = rows[0];
+		const glm::vec4 row1 = rows[1];
+		const glm::vec4 row2 = rows[2];
+		const glm::vec4 row3 = rows[3];
+
+		// The near plane is taken for a depth range of [-1, 1], which is further back than a [0, 1] near plane and so still conservative
+		const glm::vec4 planes[6] =
+		{
+			row3 + row0,
+			row3 - row0,
+			row3 + row1,
+			row3 - row1,
+			row3 + row2,
+			row3 - row2,
+		};
+
+		CullingFrustum frustum;
+		for (uint32 p = 0; p < 8; p++)
+		{
+			glm::vec4 plane = planes[glm::min<uint32>(p, 5)];
+
+			// Projections with an infinite far plane have no far plane to test against
+			const float32 length = glm::length(glm::vec3(plane));
+			plane = length > FLT_EPSILON ? plane / length : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+			frustum.PlanesX[p] = plane.x;
+			frustum.PlanesY[p] = plane.y;
+			frustum.PlanesZ[p] = plane.z;
+			frustum.PlanesW[p] = plane.w;
+		}
+
+		frustum.ViewPosition			= viewPosition;
+		frustum.MinRadiusPerDistance	= minRadiusPerDistance;
+		return frustum;
+	}
+
+	/*
+	* InstanceCuller
+	*/
+	uint32 InstanceCuller::AddInstance(const glm::vec3& min, const glm::vec3& max, void* pUserData, uint32 instanceIndex)
+	{
+		const uint32 proxy = AllocateNode();
+
+		Node& node = m_Nodes[proxy];
+		node.Min			= min - glm::vec3(INSTANCE_CULLER_AABB_MARGIN);
+		node.Max			= max + glm::vec3(INSTANCE_CULLER_AABB_MARGIN);
+		node.Height			= 0;
+		node.pUserData		= pUserData;
+		node.InstanceIndex	= instanceIndex;
+
+		InsertLeaf(proxy);
+		m_InstanceCount++;
+		return proxy;
+	}
+
+	void InstanceCuller::RemoveInstance(uint32 proxy)
+	{
+		VALIDATE(proxy < m_Nodes.GetSize() && m_Nodes[proxy].IsLeaf());
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		m_InstanceCount--;
+	}
+
+	void InstanceCuller::MoveInstance(uint32 proxy, const glm::vec3& min, const glm::vec3& max)
+	{
+		VALIDATE(proxy < m_Nodes.GetSize() && m_Nodes[proxy].IsLeaf());
+
+		Node& node = m_Nodes[proxy];
+		if (glm::all(glm::greaterThanEqual(min, node.Min)) && glm::all(glm::lessThanEqual(max, node.Max)))
+		{
+			return;
+		}
+
+		RemoveLeaf(proxy);
+
+		Node& movedNode = m_Nodes[proxy];
+		movedNode.Min = min - glm::vec3(INSTANCE_CULLER_AABB_MARGIN);
+		movedNode.Max = max + glm::vec3(INSTANCE_CULLER_AABB_MARGIN);
+
+		InsertLeaf(proxy);
+	}
+
+	void InstanceCuller::SetInstanceIndex(uint32 proxy, uint32 instanceIndex)
+	{
+		VALIDATE(proxy < m_Nodes.GetSize() && m_Nodes[proxy].IsLeaf());
+		m_Nodes[proxy].InstanceIndex = instanceIndex;
+	}
+
+	void InstanceCuller::Cull(const CullingFrustum& frustum, TArray<CulledInstance>& visible) const
+	{
+		if (m_Root == INVALID_NODE)
+		{
+			return;
+		}
+
+		// The top bit marks subtrees that lie entirely within the frustum, their leaves only need the distance test
+		constexpr uint32 INSIDE_BIT = 0x80000000;
+		const bool distanceCulling = frustum.MinRadiusPerDistance > 0.0f;
+
+		TArray<uint32> stack;
+		stack.Reserve(64);
+		stack.PushBack(m_Root);
+
+		while (!stack.IsEmpty())
+		{
+			const uint32 entry = stack.GetBack();
+			stack.PopBack();
+
+			const uint32 nodeIndex	= entry & ~INSIDE_BIT;
+			bool isInside			= (entry & INSIDE_BIT) != 0;
+			const Node& node		= m_Nodes[nodeIndex];
+
+			if (distanceCulling && IsTooSmall(frustum, node.Min, node.Max))
+			{
+				continue;
+			}
+
+			if (!isInside)
+			{
+				const EFrustumTestResult result = TestFrustum(frustum, node.Min, node.Max);
+				if (result == EFrustumTestResult::OUTSIDE)
+				{
+					continue;
+				}
+
+				isInside = result == EFrustumTestResult::INSIDE;
+			}
+
+			if (node.IsLeaf())
+			{
+				CulledInstance& culledInstance = visible.PushBack(CulledInstance());
+				culledInstance.pUserData		= node.pUserData;
+				culledInstance.InstanceIndex	= node.InstanceIndex;
+			}
+			else
+			{
+				const uint32 insideBit = isInside ? INSIDE_BIT : 0;
+				stack.PushBack(node.Child0 | insideBit);
+				stack.PushBack(node.Child1 | insideBit);
+			}
+		}
+	}
+
+	void InstanceCuller::Clear()
+	{
+		m_Nodes.Clear();
+		m_Root			= INVALID_NODE;
+		m_FreeList		= INVALID_NODE;
+		m_InstanceCount	= 0;
+	}
+
+	void InstanceCuller::TransformBounds(const glm::vec3& min, const glm::vec3& max, const glm::mat4& transform, glm::vec3& transformedMin, glm::vec3& transformedMax)
+	{
+		const glm::vec3 center = glm::vec3(transform * glm::vec4((min + max) * 0.5f, 1.0f));
+		const glm::vec3 extent = (max - min) * 0.5f;
+
+		// Every axis of the result is reached by the box corner that follows the signs of that row of the matrix
+		const glm::mat3 absTransform = glm::mat3(glm::abs(glm::vec3(transform[0])), glm::abs(glm::vec3(transform[1])), glm::abs(glm::vec3(transform[2])));
+		const glm::vec3 transformedExtent = absTransform * extent;
+
+		transformedMin = center - transformedExtent;
+		transformedMax = center + transformedExtent;
+	}
+
+	uint32 InstanceCuller::AllocateNode()
+	{
+		if (m_FreeList == INVALID_NODE)
+		{
+			m_Nodes.PushBack(Node());
+			return m_Nodes.GetSize() - 1;
+		}
+
+		const uint32 node = m_FreeList;
+		m_FreeList = m_Nodes[node].Parent;
+		m_Nodes[node] = Node();
+		return node;
+	}
+
+	void InstanceCuller::FreeNode(uint32 node)
+	{
+		m_Nodes[node]			= Node();
+		m_Nodes[node].Parent	= m_FreeList;
+		m_FreeList				= node;
+	}
+
+	void InstanceCuller::InsertLeaf(uint32 leaf)
+	{
+		if (m_Root == INVALID_NODE)
+		{
+			m_Root = leaf;
+			m_Nodes[leaf].Parent = INVALID_NODE;
+			return;
+		}
+
+		const glm::vec3 leafMin = m_Nodes[leaf].Min;
+		const glm::vec3 leafMax = m_Nodes[leaf].Max;
+
+		// Walk down towards the sibling that is cheapest to pair the leaf with, every node above it grows by the same amount
+		uint32 sibling = m_Root;
+		while (!m_Nodes[sibling].IsLeaf())
+		{
+			const Node& node = m_Nodes[sibling];
+
+			const float32 area			= SurfaceArea(node.Min, node.Max);
+			const float32 combinedArea	= SurfaceArea(glm::min(node.Min, leafMin), glm::max(node.Max, leafMax));
+
+			// Cost of creating a new parent for this node and the leaf, and the cost pushed down to the children
+			const float32 cost				= 2.0f * combinedArea;
+			const float32 inheritanceCost	= 2.0f * (combinedArea - area);
+
+			float32 childCosts[2];
+			const uint32 children[2] = { node.Child0, node.Child1 };
+			for (uint32 c = 0; c < 2; c++)
+			{
+				const Node& child = m_Nodes[children[c]];
+				const float32 childCombinedArea = SurfaceArea(glm::min(child.Min, leafMin), glm::max(child.Max, leafMax));
+				childCosts[c] = child.IsLeaf() ? childCombinedArea + inheritanceCost : childCombinedArea - SurfaceArea(child.Min, child.Max) + inheritanceCost;
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+			{
+				break;
+			}
+
+			sibling = childCosts[0] < childCosts[1] ? children[0] : children[1];
+		}
+
+		const uint32 oldParent = m_Nodes[sibling].Parent;
+		const uint32 newParent = AllocateNode();
+
+		Node& parentNode = m_Nodes[newParent];
+		parentNode.Parent	= oldParent;
+		parentNode.Min		= glm::min(m_Nodes[sibling].Min, leafMin);
+		parentNode.Max		= glm::max(m_Nodes[sibling].Max, leafMax);
+		parentNode.Height	= m_Nodes[sibling].Height + 1;
+		parentNode.Child0	= sibling;
+		parentNode.Child1	= leaf;
+
+		if (oldParent != INVALID_NODE)
+		{
+			Node& oldParentNode = m_Nodes[oldParent];
+			if (oldParentNode.Child0 == sibling)
+			{
+				oldParentNode.Child0 = newParent;
+			}
+			else
+			{
+				oldParentNode.Child1 = newParent;
+			}
+		}
+		else
+		{
+			m_Root = newParent;
+		}
+
+		m_Nodes[sibling].Parent	= newParent;
+		m_Nodes[leaf].Parent	= newParent;
+
+		Refit(m_Nodes[leaf].Parent);
+	}
+
+	void InstanceCuller::RemoveLeaf(uint32 leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = INVALID_NODE;
+			return;
+		}
+
+		const uint32 parent			= m_Nodes[leaf].Parent;
+		const uint32 grandParent	= m_Nodes[parent].Parent;
+		const uint32 sibling		= m_Nodes[parent].Child0 == leaf ? m_Nodes[parent].Child1 : m_Nodes[parent].Child0;
+
+		if (grandParent != INVALID_NODE)
+		{
+			Node& grandParentNode = m_Nodes[grandParent];
+			if (grandParentNode.Child0 == parent)
+			{
+				grandParentNode.Child0 = sibling;
+			}
+			else
+			{
+				grandParentNode.Child1 = sibling;
+			}
+
+			m_Nodes[sibling].Parent = grandParent;
+			FreeNode(parent);
+
+			Refit(grandParent);
+		}
+		else
+		{
+			m_Root = sibling;
+			m_Nodes[sibling].Parent = INVALID_NODE;
+			FreeNode(parent);
+		}
+
+		m_Nodes[leaf].Parent = INVALID_NODE;
+	}
+
+	uint32 InstanceCuller::Balance(uint32 indexA)
+	{
+		Node& a = m_Nodes[indexA];
+		if (a.IsLeaf() || a.Height < 2)
+		{
+			return indexA;
+		}
+
+		const uint32 indexB = a.Child0;
+		const uint32 indexC = a.Child1;
+		Node& b = m_Nodes[indexB];
+		Node& c = m_Nodes[indexC];
+
+		const int32 balance = c.Height - b.Height;
+
+		// Rotate C up
+		if (balance > 1)
+		{
+			const uint32 indexF = c.Child0;
+			const uint32 indexG = c.Child1;
+			Node& f = m_Nodes[indexF];
+			Node& g = m_Nodes[indexG];
+
+			c.Child0	= indexA;
+			c.Parent	= a.Parent;
+			a.Parent	= indexC;
+
+			if (c.Parent != INVALID_NODE)
+			{
+				Node& parent = m_Nodes[c.Parent];
+				if (parent.Child0 == indexA)
+				{
+					parent.Child0 = indexC;
+				}
+				else
+				{
+					parent.Child1 = indexC;
+				}
+			}
+			else
+			{
+				m_Root = indexC;
+			}
+
+			// The taller child of C stays with it, the other one replaces C under A
+			const bool keepF = f.Height > g.Height;
+			const uint32 indexKept	= keepF ? indexF : indexG;
+			const uint32 indexMoved	= keepF ? indexG : indexF;
+			Node& kept	= m_Nodes[indexKept];
+			Node& moved	= m_Nodes[indexMoved];
+
+			c.Child1		= indexKept;
+			a.Child1		= indexMoved;
+			moved.Parent	= indexA;
+
+			a.Min		= glm::min(b.Min, moved.Min);
+			a.Max		= glm::max(b.Max, moved.Max);
+			a.Height	= 1 + glm::max(b.Height, moved.Height);
+			c.Min		= glm::min(a.Min, kept.Min);
+			c.Max		= glm::max(a.Max, kept.Max);
+			c.Height	= 1 + glm::max(a.Height, kept.Height);
+			return indexC;
+		}
+
+		// Rotate B up
+		if (balance < -1)
+		{
+			const uint32 indexD = b.Child0;
+			const uint32 indexE = b.Child1;
+			Node& d = m_Nodes[indexD];
+			Node& e = m_Nodes[indexE];
+
+			b.Child0	= indexA;
+			b.Parent	= a.Parent;
+			a.Parent	= indexB;
+
+			if (b.Parent != INVALID_NODE)
+			{
+				Node& parent = m_Nodes[b.Parent];
+				if (parent.Child0 == indexA)
+				{
+					parent.Child0 = indexB;
+				}
+				else
+				{
+					parent.Child1 = indexB;
+				}
+			}
+			else
+			{
+				m_Root = indexB;
+			}
+
+			const bool keepD = d.Height > e.Height;
+			const uint32 indexKept	= keepD ? indexD : indexE;
+			const uint32 indexMoved	= keepD ? indexE : indexD;
+			Node& kept	= m_Nodes[indexKept];
+			Node& moved	= m_Nodes[indexMoved];
+
+			b.Child1		= indexKept;
+			a.Child0		= indexMoved;
+			moved.Parent	= indexA;
+
+			a.Min		= glm::min(c.Min, moved.Min);
+			a.Max		= glm::max(c.Max, moved.Max);
+			a.Height	= 1 + glm::max(c.Height, moved.Height);
+			b.Min		= glm::min(a.Min, kept.Min);
+			b.Max		= glm::max(a.Max, kept.Max);
+			b.Height	= 1 + glm::max(a.Height, kept.Height);
+			return indexB;
+		}
+
+		return indexA;
+	}
+
+	void InstanceCuller::Refit(uint32 node)
+	{
+		while (node != INVALID_NODE)
+		{
+			node = Balance(node);
+
+			Node& current		= m_Nodes[node];
+			const Node& child0	= m_Nodes[current.Child0];
+			const Node& child1	= m_Nodes[current.Child1];
+
+			current.Min		= glm::min(child0.Min, child1.Min);
+			current.Max		= glm::max(child0.Max, child1.Max);
+			current.Height	= 1 + glm::max(child0.Height, child1.Height);
+
+			node = current.Parent;
+		}
+	}
+}
@@ -24,20 +24,13 @@ namespace LambdaEngine
 			m_AliveIndices.Reserve(m_MaxParticleCount);
 			m_ParticleIndexData.Reserve(m_MaxParticleCount);
 
-			constexpr uint32 chunkReservationSize = 10;
-			m_FreeParticleChunks.Reserve(chunkReservationSize);
-
 			// Initilize Default Particle Texture
 			m_DefaultAtlasTextureGUID = ResourceManager::LoadTextureFromFile("Particles/ParticleAtlas.png", EFormat::FORMAT_R8G8B8A8_UNORM, true, true);
 			constexpr uint32 DEFAULT_ATLAS_TILE_SIZE = 64U;
 			CreateAtlasTextureInstance(m_DefaultAtlasTextureGUID, DEFAULT_ATLAS_TILE_SIZE);
 
-			// Create one particle chunk spanning the whole particle array
-			ParticleChunk chunk = {};
-			chunk.Offset = 0;
-			chunk.Size = m_MaxParticleCount;
-
-			m_FreeParticleChunks.PushBack(chunk);
+			// Particle chunks are allocated from one range spanning the whole particle array
+			m_ParticleAllocator.Init(m_MaxParticleCount);
 
 			BufferDesc bufferDesc = {};
 			bufferDesc.MemoryType	= EMemoryType::MEMORY_TYPE_GPU;
@@ -942,40 +935,12 @@ namespace LambdaEngine
 	bool ParticleManager::AllocateParticleChunk(ParticleChunk& chunk)
 	{
 		// TODO: Handle override max capacity particle request
-		if (m_FreeParticleChunks.IsEmpty())
+		RangeAllocation allocation;
+		if (!m_ParticleAllocator.Allocate(chunk.Size, allocation))
 			return false;
 
-		// Assign fitting chunk to emitter
-		bool foundChunk = false;
-
-		for (uint32 i = 0; i < m_FreeParticleChunks.GetSize(); i++)
-		{
-			ParticleChunk& freeChunk = m_FreeParticleChunks[i];
-			ParticleChunk& emitterChunk = chunk;
-
-			if (emitterChunk.Size <= freeChunk.Size)
-			{
-				emitterChunk.Offset = freeChunk.Offset;
-
-				uint32 diff = freeChunk.Size - emitterChunk.Size;
-				if (diff == 0)
-				{
-					m_FreeParticleChunks.Erase(m_FreeParticleChunks.Begin() + i);
-				}
-				else
-				{
-					freeChunk.Offset += emitterChunk.Size;
-					freeChunk.Size -= emitterChunk.Size;
-				}
-
-				foundChunk = true;
-				break;
-			}
-		}
-
-		// TODO: Handle override max capacity particle request
-		if (!foundChunk)
-			return false;
+		chunk.Offset = allocation.Offset;
+		chunk.AllocationHandle = allocation.Handle;
 
 #if DEBUG_PARTICLE
 		LOG_INFO("[ParticleManager]: Allocated Chunk[offset: %u, size: %u]", chunk.Offset, chunk.Size);
@@ -984,69 +949,55 @@ namespace LambdaEngine
 		return true;
 	}
 
-	bool ParticleManager::FreeParticleChunk(ParticleChunk chunk)
+	void ParticleManager::FreeParticleChunk(ParticleChunk& chunk)
 	{
-		// Find if freed particle chunk can be merged with existing one
-		bool inserted = false;
+		RangeAllocation allocation;
+		allocation.Offset = chunk.Offset;
+		allocation.Size = chunk.Size;
+		allocation.Handle = chunk.AllocationHandle;
+		m_ParticleAllocator.Free(allocation);
 
-		inserted = MergeParticleChunk(chunk);
-
-		// If merge was not possible insert at proper offset location
-		for (auto chunkIt = m_FreeParticleChunks.begin(); chunkIt != m_FreeParticleChunks.end() && !inserted; chunkIt++)
-		{
-			if (chunk.Offset > chunkIt->Offset)
-			{
-				m_FreeParticleChunks.Insert(chunkIt, chunk);
-				inserted = true;
-			}
-		}
-
-		// If free chunk has not been inserted yet beginning should be the proper insertion
-		if (!inserted) {
-			m_FreeParticleChunks.Insert(m_FreeParticleChunks.begin(), chunk);
-			inserted = true;
-		}
+		chunk.AllocationHandle = UINT32_MAX;
 
 #if DEBUG_PARTICLE
+		const RangeAllocatorStatistics statistics = m_ParticleAllocator.GetStatistics();
 		LOG_INFO("[ParticleManager]: Freed Chunk: [offset: %u, size : %u]", chunk.Offset, chunk.Size);
-		LOG_INFO("[ParticleManager]: Current Free Chunks:");
-		for (uint32 i = 0; i < m_FreeParticleChunks.GetSize(); i++)
-		{
-			LOG_INFO("\tFree chunk%u - [offset: %u, size : %u] ", i, m_FreeParticleChunks[i].Offset, m_FreeParticleChunks[i].Size);
-		}
+		LOG_INFO("[ParticleManager]: Free particles: %u in %u chunks, largest chunk: %u, fragmentation: %.2f",
+			statistics.FreeSize,
+			statistics.FreeRangeCount,
+			statistics.LargestFreeRange,
+			statistics.Fragmentation);
 #endif
-		return inserted;
 	}
 
-	bool ParticleManager::MergeParticleChunk(const ParticleChunk& chunk)
+	void ParticleManager::CoalesceDirtyParticleChunks()
 	{
-		bool inserted = false;
-		for (auto chunkIt = m_FreeParticleChunks.begin(); chunkIt != m_FreeParticleChunks.end() && !inserted; chunkIt++)
+		if (m_DirtyParticleChunks.GetSize() < 2)
+			return;
+
+		std::sort(m_DirtyParticleChunks.GetData(), m_DirtyParticleChunks.GetData() + m_DirtyParticleChunks.GetSize(),
+			[](const ParticleChunk& chunk0, const ParticleChunk& chunk1)
+			{
+				return chunk0.Offset < chunk1.Offset;
+			});
+
+		// Only chunks that overlap or touch are merged, the particles between two chunks are simulated on the GPU and must not be overwritten
+		uint32 mergedCount = 0;
+		for (uint32 i = 1; i < m_DirtyParticleChunks.GetSize(); i++)
 		{
-			if (chunk.Offset + chunk.Size == chunkIt->Offset)
+			ParticleChunk& mergedChunk = m_DirtyParticleChunks[mergedCount];
+			const ParticleChunk& chunk = m_DirtyParticleChunks[i];
+			if (chunk.Offset <= mergedChunk.Offset + mergedChunk.Size)
 			{
-				chunkIt->Offset -= chunk.Size;
-				chunkIt->Size += chunk.Size;
-				// If merge successful remove from chunk
-				if (MergeParticleChunk(*chunkIt))
-				{
-					m_FreeParticleChunks.Erase(chunkIt);
-				}
-				inserted = true;
+				mergedChunk.Size = std::max(mergedChunk.Size, chunk.Offset + chunk.Size - mergedChunk.Offset);
 			}
-			else if (chunkIt->Offset + chunkIt->Size == chunk.Offset)
+			else
 			{
-				chunkIt->Size += chunk.Size;
-				// If merge successful remove from chunk
-				if (MergeParticleChunk(*chunkIt))
-				{
-					m_FreeParticleChunks.Erase(chunkIt);
-				}
-				inserted = true;
+				m_DirtyParticleChunks[++mergedCount] = chunk;
 			}
 		}
 
-		return inserted;
+		m_DirtyParticleChunks.Resize(mergedCount + 1);
 	}
 
 	void ParticleManager::CleanBuffers()
@@ -1133,6 +1084,8 @@ namespace LambdaEngine
 		}
 
 		{
+			CoalesceDirtyParticleChunks();
+
 			// Create offset and buffer size array
 			uint32 dirtyChunks = m_DirtyParticleChunks.GetSize();
 			TArray<uint32> offsets(dirtyChunks);
@@ -522,6 +522,22 @@ namespace LambdaEngine
 		}
 	}
 
+	void RenderGraph::SetRenderStageCullingView(const String& renderStageName, ECullingView cullingView)
+	{
+		auto it = m_RenderStageMap.find(renderStageName);
+
+		if (it != m_RenderStageMap.end())
+		{
+			RenderStage* pRenderStage = &m_pRenderStages[it->second];
+			pRenderStage->CullingView = cullingView;
+		}
+		else
+		{
+			LOG_WARNING("SetRenderStageCullingView failed, render stage with name \"%s\" could not be found", renderStageName.c_str());
+			return;
+		}
+	}
+
 	void RenderGraph::Update(LambdaEngine::Timestamp delta, uint32 modFrameIndex, uint32 backBufferIndex)
 	{
 		UNREFERENCED_VARIABLE(modFrameIndex);
@@ -4466,11 +4482,14 @@ namespace LambdaEngine
 					pGraphicsCommandList->SetConstantRange(pRenderStage->pPipelineLayout, pRenderStage->PipelineStageMask, pDrawIterationPushConstants->pData, pDrawIterationPushConstants->DataSize, pDrawIterationPushConstants->Offset);
 				}
 
+				const uint32 cullingViewIndex = static_cast<uint32>(pRenderStage->CullingView);
+
 				if (pRenderStage->DrawType == ERenderStageDrawType::SCENE_INSTANCES)
 				{
 					for (const DrawArg& drawArg : pRenderStage->DrawArgs)
 					{
-						if (drawArg.InstanceCount > 0)
+						const TArray<DrawArgInstanceRange>* pVisibleInstanceRanges = pRenderStage->CullingView != ECullingView::CULLING_VIEW_NONE ? drawArg.ppVisibleInstanceRanges[cullingViewIndex] : nullptr;
+						if (drawArg.InstanceCount > 0 && (pVisibleInstanceRanges == nullptr || !pVisibleInstanceRanges->IsEmpty()))
 						{
 							pGraphicsCommandList->BindIndexBuffer(drawArg.pIndexBuffer, 0, EIndexType::INDEX_TYPE_UINT32);
 
@@ -4484,7 +4503,21 @@ namespace LambdaEngine
 								}
 							}
 
-							pGraphicsCommandList->DrawIndexInstanced(drawArg.IndexCount, drawArg.InstanceCount, 0, 0, 0);
+							if (pVisibleInstanceRanges != nullptr)
+							{
+								for (const DrawArgInstanceRange& instanceRange : *pVisibleInstanceRanges)
+								{
+									if (instanceRange.FirstInstance < drawArg.InstanceCount)
+									{
+										const uint32 instanceCount = std::min(instanceRange.InstanceCount, drawArg.InstanceCount - instanceRange.FirstInstance);
+										pGraphicsCommandList->DrawIndexInstanced(drawArg.IndexCount, instanceCount, 0, 0, instanceRange.FirstInstance);
+									}
+								}
+							}
+							else
+							{
+								pGraphicsCommandList->DrawIndexInstanced(drawArg.IndexCount, drawArg.InstanceCount, 0, 0, 0);
+							}
 						}
 					}
 				}
@@ -4492,7 +4525,8 @@ namespace LambdaEngine
 				{
 					for (const DrawArg& drawArg : pRenderStage->DrawArgs)
 					{
-						if (drawArg.InstanceCount > 0)
+						const TArray<DrawArgInstanceRange>* pVisibleInstanceRanges = pRenderStage->CullingView != ECullingView::CULLING_VIEW_NONE ? drawArg.ppVisibleInstanceRanges[cullingViewIndex] : nullptr;
+						if (drawArg.InstanceCount > 0 && (pVisibleInstanceRanges == nullptr || !pVisibleInstanceRanges->IsEmpty()))
 						{
 							if (drawArg.pDescriptorSet != nullptr)
 							{
@@ -4504,24 +4538,20 @@ namespace LambdaEngine
 								}
 							}
 
-							const uint32 maxTaskCount = m_Features.MaxDrawMeshTasksCount;
-							const uint32 totalMeshletCount = drawArg.MeshletCount * drawArg.InstanceCount;
-							if (totalMeshletCount > maxTaskCount)
+							if (pVisibleInstanceRanges != nullptr)
 							{
-								int32 meshletsLeft = static_cast<int32>(totalMeshletCount);
-								int32 meshletOffset = 0;
-								while (meshletsLeft > 0)
+								for (const DrawArgInstanceRange& instanceRange : *pVisibleInstanceRanges)
 								{
-									int32 meshletCount = std::min<int32>(maxTaskCount, meshletsLeft);
-									pGraphicsCommandList->DispatchMesh(meshletCount, meshletOffset);
-
-									meshletOffset += meshletCount;
-									meshletsLeft -= meshletCount;
+									if (instanceRange.FirstInstance < drawArg.InstanceCount)
+									{
+										const uint32 instanceCount = std::min(instanceRange.InstanceCount, drawArg.InstanceCount - instanceRange.FirstInstance);
+										DispatchMeshInstances(pGraphicsCommandList, drawArg.MeshletCount, instanceRange.FirstInstance, instanceCount);
+									}
 								}
 							}
 							else
 							{
-								pGraphicsCommandList->DispatchMesh(totalMeshletCount, 0);
+								DispatchMeshInstances(pGraphicsCommandList, drawArg.MeshletCount, 0, drawArg.InstanceCount);
 							}
 						}
 					}
@@ -4631,6 +4661,31 @@ namespace LambdaEngine
 		}
 	}
 
+	void RenderGraph::DispatchMeshInstances(CommandList* pCommandList, uint32 meshletCount, uint32 firstInstance, uint32 instanceCount)
+	{
+		// The mesh shaders find the instance of a meshlet from the workgroup ID, which starts at the first task
+		const uint32 maxTaskCount = m_Features.MaxDrawMeshTasksCount;
+		const uint32 totalMeshletCount = meshletCount * instanceCount;
+		const uint32 firstMeshlet = meshletCount * firstInstance;
+		if (totalMeshletCount > maxTaskCount)
+		{
+			int32 meshletsLeft = static_cast<int32>(totalMeshletCount);
+			int32 meshletOffset = static_cast<int32>(firstMeshlet);
+			while (meshletsLeft > 0)
+			{
+				int32 taskCount = std::min<int32>(maxTaskCount, meshletsLeft);
+				pCommandList->DispatchMesh(taskCount, meshletOffset);
+
+				meshletOffset += taskCount;
+				meshletsLeft -= taskCount;
+			}
+		}
+		else
+		{
+			pCommandList->DispatchMesh(totalMeshletCount, firstMeshlet);
+		}
+	}
+
 	void RenderGraph::PipelineTextureBarriers(CommandList* pCommandList, const TArray<PipelineTextureBarrierDesc>& textureBarriers, FPipelineStageFlags srcPipelineStage, FPipelineStageFlags dstPipelineStage)
 	{
 		uint32 remaining = textureBarriers.GetSize() % MAX_IMAGE_BARRIERS;
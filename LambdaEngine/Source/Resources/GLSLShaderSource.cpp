@@ -1,5 +1,6 @@
 #include "Resources/GLSLShaderSource.h"
 #include "Resources/GLSLang.h"
+#include "Resources/ShaderCache.h"
 
 #include "Rendering/Core/API/GraphicsDevice.h"
 #include "Rendering/Core/API/Shader.h"
@@ -22,6 +23,37 @@ namespace LambdaEngine
 	}
 
 	Shader* GLSLShaderSource::Compile(const String& name, const String& defines)
+	{
+		TArray<uint32> sourceSPIRV;
+
+		SHA256Hash cacheKey;
+		const bool isCacheable = ShaderCache::ComputeKey(m_Desc.Source, m_Desc.Directory, m_Desc.ShaderStage, defines, cacheKey);
+		if (!isCacheable || !ShaderCache::Load(cacheKey, &sourceSPIRV, nullptr))
+		{
+			if (!CompileToSPIRV(defines, sourceSPIRV))
+			{
+				return nullptr;
+			}
+
+			if (isCacheable)
+			{
+				ShaderCache::Store(cacheKey, sourceSPIRV, nullptr);
+			}
+		}
+
+		const uint32 sourceSize = static_cast<uint32>(sourceSPIRV.GetSize()) * sizeof(uint32);
+
+		ShaderDesc shaderDesc = { };
+		shaderDesc.DebugName	= name;
+		shaderDesc.Source		= TArray<byte>(reinterpret_cast<byte*>(sourceSPIRV.GetData()), reinterpret_cast<byte*>(sourceSPIRV.GetData()) + sourceSize);
+		shaderDesc.EntryPoint	= m_Desc.EntryPoint;
+		shaderDesc.Stage		= m_Desc.ShaderStage;
+		shaderDesc.Lang			= EShaderLang::SHADER_LANG_SPIRV;
+
+		return RenderAPI::GetDevice()->CreateShader(&shaderDesc);
+	}
+
+	bool GLSLShaderSource::CompileToSPIRV(const String& defines, TArray<uint32>& sourceSPIRV)
 	{
 		EShLanguage shaderType = ConvertShaderStageToEShLanguage(m_Desc.ShaderStage);
 		glslang::TShader shader(shaderType);
@@ -50,7 +82,7 @@ namespace LambdaEngine
 		if (!shader.preprocess(pResources, defaultVersion, ENoProfile, false, false, messages, &preprocessedGLSL, includer))
 		{
 			LOG_ERROR("[GLSLShaderSource]: GLSL Preprocessing failed for: \"%s\"\nDefines:\n%s\n%s\n%s", m_Desc.Name.c_str(), defines.c_str(), shader.getInfoLog(), shader.getInfoDebugLog());
-			return nullptr;
+			return false;
 		}
 
 		const char* pPreprocessedGLSL = preprocessedGLSL.c_str();
@@ -59,7 +91,7 @@ namespace LambdaEngine
 		if (!shader.parse(pResources, defaultVersion, false, messages))
 		{
 			LOG_ERROR("[GLSLShaderSource]: GLSL Parsing failed: \"%s\"\nDefines:\n%s\n%s\n%s", m_Desc.Name.c_str(), defines.c_str(), shader.getInfoLog(), shader.getInfoDebugLog());
-			return nullptr;
+			return false;
 		}
 
 		glslang::TProgram program;
@@ -68,28 +100,16 @@ namespace LambdaEngine
 		if (!program.link(messages))
 		{
 			LOG_ERROR("[GLSLShaderSource]: GLSL Linking failed: \"%s\"\nDefines:\n%s\n%s\n%s", m_Desc.Name.c_str(), defines.c_str(), shader.getInfoLog(), shader.getInfoDebugLog());
-			return nullptr;
+			return false;
 		}
 
 		glslang::TIntermediate* pIntermediate = program.getIntermediate(shaderType);
 
-		TArray<uint32> sourceSPIRV;
-
 		spv::SpvBuildLogger logger;
 		glslang::SpvOptions spvOptions;
 		std::vector<uint32> std_sourceSPIRV;
 		glslang::GlslangToSpv(*pIntermediate, std_sourceSPIRV, &logger, &spvOptions);
 		sourceSPIRV.Assign(std_sourceSPIRV.data(), std_sourceSPIRV.data() + std_sourceSPIRV.size());
-
-		const uint32 sourceSize = static_cast<uint32>(sourceSPIRV.GetSize()) * sizeof(uint32);
-
-		ShaderDesc shaderDesc = { };
-		shaderDesc.DebugName	= name;
-		shaderDesc.Source		= TArray<byte>(reinterpret_cast<byte*>(sourceSPIRV.GetData()), reinterpret_cast<byte*>(sourceSPIRV.GetData()) + sourceSize);
-		shaderDesc.EntryPoint	= m_Desc.EntryPoint;
-		shaderDesc.Stage		= m_Desc.ShaderStage;
-		shaderDesc.Lang			= EShaderLang::SHADER_LANG_SPIRV;
-
-		return RenderAPI::GetDevice()->CreateShader(&shaderDesc);
+		return true;
 	}
 }
\ No newline at end of file
@@ -2,6 +2,14 @@
 
 #include "Containers/TUniquePtr.h"
 
+#include "Threading/API/ThreadPool.h"
+
+#include "Log/Log.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace LambdaEngine
@@ -33,6 +41,48 @@ namespace LambdaEngine
 		return pMesh;
 	}
 
+	void MeshFactory::BakeSkeletonEvaluationOrder(Skeleton* pSkeleton)
+	{
+		const uint32 jointCount = pSkeleton->Joints.GetSize();
+
+		TArray<TArray<JointIndexType>> children(jointCount);
+		TArray<JointIndexType>& order = pSkeleton->EvaluationOrder;
+		order.Clear();
+		order.Reserve(jointCount);
+
+		TArray<uint8>& depths = pSkeleton->JointDepths;
+		depths.Assign(jointCount, uint8(0));
+
+		for (uint32 jointID = 0; jointID < jointCount; jointID++)
+		{
+			const JointIndexType parentID = pSkeleton->Joints[jointID].ParentBoneIndex;
+			if (parentID == INVALID_JOINT_ID)
+			{
+				order.PushBack(JointIndexType(jointID));
+			}
+			else
+			{
+				children[parentID].PushBack(JointIndexType(jointID));
+			}
+		}
+
+		// Breadth first from the roots, a joint is only added after its parent
+		for (uint32 i = 0; i < order.GetSize(); i++)
+		{
+			const JointIndexType jointID = order[i];
+			for (JointIndexType childID : children[jointID])
+			{
+				depths[childID] = uint8(std::min<uint32>(depths[jointID] + 1, UINT8_MAX));
+				order.PushBack(childID);
+			}
+		}
+
+		if (order.GetSize() != jointCount)
+		{
+			LOG_ERROR("[MeshFactory]: Skeleton hierarchy has a cycle, %u of %u joints can be evaluated", order.GetSize(), jointCount);
+		}
+	}
+
 	/*
 	* Generation of meshlets
 	* Reference: https://github.com/microsoft/DirectX-Graphics-Samples/tree/master/Samples/Desktop/D3D12MeshShaders
@@ -51,6 +101,7 @@ namespace LambdaEngine
 	{
 		TArray<MeshIndexType> UniqueVertexIndices;
 		TArray<PackedTriangle> PrimitiveIndices;
+		MeshletCullingBounds Bounds;
 	};
 
 	static glm::vec3 ComputeNormal(glm::vec3 positions[3])
@@ -60,38 +111,32 @@ namespace LambdaEngine
 		return glm::normalize(glm::cross(e0, e1));
 	}
 
-	static void GenerateAdjecenyList(Mesh* pMesh, uint32* pAdjecency)
+	/*
+	* Maps every vertex to the first vertex with the same position, so that triangles are adjacent across seams
+	*/
+	static void GeneratePositionIndices(const Mesh* pMesh, TArray<MeshIndexType>& indexList)
 	{
-		const uint32 indexCount = pMesh->Indices.GetSize();
 		const uint32 vertexCount = pMesh->Vertices.GetSize();
-		const uint32 triangleCount = (indexCount / 3);
-
-		const MeshIndexType* pIndices = pMesh->Indices.GetData();
 		const Vertex* pVertices = pMesh->Vertices.GetData();
 
-		TArray<MeshIndexType> indexList(vertexCount);
+		indexList.Resize(vertexCount);
 
-		std::unordered_map<size_t, MeshIndexType> uniquePositions;
+		// Keyed by the position itself, keying by its hash merged positions whose hashes collided
+		std::unordered_map<glm::vec3, MeshIndexType> uniquePositions;
 		uniquePositions.reserve(vertexCount);
 
-		std::hash<glm::vec3> hasher;
 		for (uint32 i = 0; i < vertexCount; i++)
 		{
-			size_t hash = hasher(pVertices[i].ExtractPosition());
-
-			auto it = uniquePositions.find(hash);
-			if (it != uniquePositions.end())
-			{
-				indexList[i] = it->second;
-			}
-			else
-			{
-				uniquePositions.insert(std::make_pair(hash, static_cast<MeshIndexType>(i)));
-				indexList[i] = static_cast<MeshIndexType>(i);
-			}
+			auto it = uniquePositions.insert(std::make_pair(pVertices[i].ExtractPosition(), static_cast<MeshIndexType>(i))).first;
+			indexList[i] = it->second;
 		}
+	}
 
-		const uint32 hashSize = vertexCount / 3;
+	static void GenerateAdjecenyList(const Vertex* pVertices, const MeshIndexType* pIndices, uint32 indexCount, const TArray<MeshIndexType>& indexList, uint32* pAdjecency)
+	{
+		const uint32 triangleCount = (indexCount / 3);
+
+		const uint32 hashSize = std::max(triangleCount, 1u);
 		TUniquePtr<EdgeEntry[]> entries(DBG_NEW EdgeEntry[triangleCount * 3]);
 		TUniquePtr<EdgeEntry* []> hashTable(DBG_NEW EdgeEntry * [hashSize]);
 		ZERO_MEMORY(hashTable.Get(), sizeof(EdgeEntry*) * hashSize);
@@ -351,17 +396,92 @@ namespace LambdaEngine
 		return (reuseWeight * reuseScore) + (oriWeight * oriScore);
 	}
 
-	static void Meshletize(Mesh* pMesh, uint32 maxVerts, uint32 maxPrims, TArray<InlineMeshlet>& output)
+	static void ComputeMeshletBounds(const Vertex* pVertices, InlineMeshlet& meshlet)
 	{
-		MeshIndexType* pIndices = pMesh->Indices.GetData();
-		Vertex* pVertices = pMesh->Vertices.GetData();
+		MeshletCullingBounds& bounds = meshlet.Bounds;
 
-		const uint32 vertexCount = pMesh->Vertices.GetSize();
-		const uint32 indexCount = pMesh->Indices.GetSize();
+		glm::vec3 minimum(FLT_MAX);
+		glm::vec3 maximum(-FLT_MAX);
+		for (MeshIndexType vertexIndex : meshlet.UniqueVertexIndices)
+		{
+			const glm::vec3 position = pVertices[vertexIndex].ExtractPosition();
+			minimum = glm::min(minimum, position);
+			maximum = glm::max(maximum, position);
+		}
+
+		bounds.Center = (minimum + maximum) * 0.5f;
+		bounds.Radius = 0.0f;
+		for (MeshIndexType vertexIndex : meshlet.UniqueVertexIndices)
+		{
+			bounds.Radius = std::max(bounds.Radius, glm::distance(bounds.Center, pVertices[vertexIndex].ExtractPosition()));
+		}
+
+		// Front facing normals for the clockwise winding the rasterizer defaults to
+		TArray<glm::vec3> normals;
+		TArray<glm::vec3> corners;
+		normals.Reserve(meshlet.PrimitiveIndices.GetSize());
+		corners.Reserve(meshlet.PrimitiveIndices.GetSize());
+
+		glm::vec3 normalSum(0.0f);
+		for (const PackedTriangle& triangle : meshlet.PrimitiveIndices)
+		{
+			const glm::vec3 p0 = pVertices[meshlet.UniqueVertexIndices[triangle.i0]].ExtractPosition();
+			const glm::vec3 p1 = pVertices[meshlet.UniqueVertexIndices[triangle.i1]].ExtractPosition();
+			const glm::vec3 p2 = pVertices[meshlet.UniqueVertexIndices[triangle.i2]].ExtractPosition();
+
+			const glm::vec3 normal = glm::cross(p2 - p0, p1 - p0);
+			const float32 length = glm::length(normal);
+			if (length > 0.0f)
+			{
+				normals.PushBack(normal / length);
+				corners.PushBack(p0);
+				normalSum += normal / length;
+			}
+		}
+
+		bounds.ConeApex		= bounds.Center;
+		bounds.ConeAxis		= glm::vec3(0.0f, 0.0f, 1.0f);
+		bounds.ConeCutoff	= 1.0f;
+
+		const float32 normalSumLength = glm::length(normalSum);
+		if (normalSumLength <= 0.0f)
+		{
+			return;
+		}
+
+		const glm::vec3 axis = normalSum / normalSumLength;
+
+		float32 minDot = 1.0f;
+		for (const glm::vec3& normal : normals)
+		{
+			minDot = std::min(minDot, glm::dot(axis, normal));
+		}
+
+		// Past roughly 84 degrees the cone would almost never cull anything
+		if (minDot <= 0.1f)
+		{
+			return;
+		}
+
+		// The apex is moved back along the axis until every triangle plane is in front of it
+		float32 maxT = 0.0f;
+		for (uint32 i = 0; i < normals.GetSize(); i++)
+		{
+			const float32 t = glm::dot(bounds.Center - corners[i], normals[i]) / glm::dot(axis, normals[i]);
+			maxT = std::max(maxT, t);
+		}
+
+		bounds.ConeApex		= bounds.Center - axis * maxT;
+		bounds.ConeAxis		= axis;
+		bounds.ConeCutoff	= glm::sqrt(1.0f - minDot * minDot);
+	}
+
+	static void Meshletize(const Vertex* pVertices, uint32 vertexCount, const MeshIndexType* pIndices, uint32 indexCount, const TArray<MeshIndexType>& indexList, uint32 maxVerts, uint32 maxPrims, TArray<InlineMeshlet>& output)
+	{
 		const uint32 triangleCount = (indexCount / 3);
 
 		TArray<uint32> adjecenyList(indexCount);
-		GenerateAdjecenyList(pMesh, adjecenyList.GetData());
+		GenerateAdjecenyList(pVertices, pIndices, indexCount, indexList, adjecenyList.GetData());
 		adjecenyList.ShrinkToFit();
 
 		output.Clear();
@@ -534,20 +654,71 @@ namespace LambdaEngine
 			output.GetBack().PrimitiveIndices.ShrinkToFit();
 			output.GetBack().UniqueVertexIndices.ShrinkToFit();
 		}
+
+		for (InlineMeshlet& meshlet : output)
+		{
+			ComputeMeshletBounds(pVertices, meshlet);
+		}
 	}
 
 	void MeshFactory::GenerateMeshlets(Mesh* pMesh, uint32 maxVerts, uint32 maxPrims)
 	{
+		TArray<MeshIndexType> positionIndices;
+		GeneratePositionIndices(pMesh, positionIndices);
+
+		// Triangles are split into contiguous chunks that are meshletized on their own, the triangles have already been
+		// ordered for locality so little is lost at the chunk boundaries
+		const uint32 triangleCount	= pMesh->Indices.GetSize() / 3;
+		const uint32 chunkCount		= std::max((triangleCount + MESHLET_TRIANGLES_PER_JOB - 1) / MESHLET_TRIANGLES_PER_JOB, 1u);
+
+		TArray<TArray<InlineMeshlet>> chunkMeshlets(chunkCount);
+		if (chunkCount == 1)
+		{
+			Meshletize(pMesh->Vertices.GetData(), pMesh->Vertices.GetSize(), pMesh->Indices.GetData(), pMesh->Indices.GetSize(), positionIndices, maxVerts, maxPrims, chunkMeshlets[0]);
+		}
+		else
+		{
+			JobCounter meshletJobs;
+			for (uint32 chunk = 0; chunk < chunkCount; chunk++)
+			{
+				ThreadPool::Execute(meshletJobs, [pMesh, &positionIndices, &chunkMeshlets, chunk, triangleCount, maxVerts, maxPrims]
+				{
+					const uint32 firstTriangle		= chunk * MESHLET_TRIANGLES_PER_JOB;
+					const uint32 chunkTriangleCount	= std::min(triangleCount - firstTriangle, uint32(MESHLET_TRIANGLES_PER_JOB));
+					Meshletize(
+						pMesh->Vertices.GetData(),
+						pMesh->Vertices.GetSize(),
+						pMesh->Indices.GetData() + firstTriangle * 3,
+						chunkTriangleCount * 3,
+						positionIndices,
+						maxVerts,
+						maxPrims,
+						chunkMeshlets[chunk]);
+				});
+			}
+
+			ThreadPool::Wait(meshletJobs);
+		}
+
 		TArray<InlineMeshlet> builtMeshlets;
-		Meshletize(pMesh, maxVerts, maxPrims, builtMeshlets);
+		for (TArray<InlineMeshlet>& meshlets : chunkMeshlets)
+		{
+			for (InlineMeshlet& meshlet : meshlets)
+			{
+				builtMeshlets.PushBack(std::move(meshlet));
+			}
+		}
 
 		uint32 uniqueVertexIndexCount	= 0;
 		uint32 primitiveIndexCount		= 0;
 		const uint32 meshletCount		= static_cast<uint32>(builtMeshlets.GetSize());
 
 		pMesh->Meshlets.Resize(meshletCount);
+		pMesh->MeshletBounds.Resize(meshletCount);
 		for (uint32 i = 0; i < meshletCount; i++)
 		{
+			pMesh->MeshletBounds[i] = builtMeshlets[i].Bounds;
+
 			pMesh->Meshlets[i].VertOffset	= uniqueVertexIndexCount;
 			pMesh->Meshlets[i].VertCount	= static_cast<uint32>(builtMeshlets[i].UniqueVertexIndices.GetSize());
 			uniqueVertexIndexCount += static_cast<uint32>(builtMeshlets[i].UniqueVertexIndices.GetSize());
@@ -619,4 +790,522 @@ namespace LambdaEngine
 		//}
 		//LOG_INFO("--------------------------------------------");
 	}
+
+	/*
+	* Mesh optimization
+	* References: Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+	*             Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw"
+	*/
+	static_assert(sizeof(Vertex) == 8 * sizeof(uint64));
+	static_assert(sizeof(VertexJointData) == 2 * sizeof(uint64));
+
+	static uint64 HashVertex(const Vertex& vertex, const VertexJointData* pJointData)
+	{
+		// Every word of the vertex is mixed in, std::hash<Vertex> leaves out the tangent and combines the rest poorly
+		uint64 words[10];
+		uint32 wordCount = 8;
+		memcpy(words, &vertex, sizeof(Vertex));
+		if (pJointData)
+		{
+			memcpy(words + 8, pJointData, sizeof(VertexJointData));
+			wordCount = 10;
+		}
+
+		uint64 hash = 0xcbf29ce484222325ull;
+		for (uint32 i = 0; i < wordCount; i++)
+		{
+			hash ^= words[i];
+			hash *= 0x9e3779b97f4a7c15ull;
+			hash ^= hash >> 29;
+		}
+
+		return hash;
+	}
+
+	static float32 ComputeVertexScore(int32 cachePosition, uint32 activeTriangleCount)
+	{
+		constexpr float32 CACHE_DECAY_POWER		= 1.5f;
+		constexpr float32 LAST_TRIANGLE_SCORE	= 0.75f;
+		constexpr float32 VALENCE_BOOST_SCALE	= 2.0f;
+		constexpr float32 VALENCE_BOOST_POWER	= 0.5f;
+
+		// Vertices without triangles left are never wanted
+		if (activeTriangleCount == 0)
+		{
+			return -1.0f;
+		}
+
+		float32 score = 0.0f;
+		if (cachePosition >= 0)
+		{
+			// The vertices of the last triangle get a fixed score so that strips are not favoured over fans
+			if (cachePosition < 3)
+			{
+				score = LAST_TRIANGLE_SCORE;
+			}
+			else
+			{
+				const float32 scaler = 1.0f / float32(MESH_OPTIMIZER_CACHE_SIZE - 3);
+				score = powf(1.0f - float32(cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+			}
+		}
+
+		// Vertices with few triangles left are finished off so that they do not have to be loaded again later
+		score += VALENCE_BOOST_SCALE * powf(float32(activeTriangleCount), -VALENCE_BOOST_POWER);
+		return score;
+	}
+
+	static void OptimizeVertexCache(TArray<MeshIndexType>& indices, uint32 vertexCount)
+	{
+		const uint32 indexCount		= indices.GetSize();
+		const uint32 triangleCount	= indexCount / 3;
+		if (triangleCount == 0)
+		{
+			return;
+		}
+
+		// The triangles of every vertex, the first activeCounts[vertex] of them have not been emitted yet
+		TArray<uint32> activeCounts(vertexCount, 0u);
+		for (MeshIndexType index : indices)
+		{
+			activeCounts[index]++;
+		}
+
+		TArray<uint32> triangleOffsets(vertexCount + 1, 0u);
+		for (uint32 vertex = 0; vertex < vertexCount; vertex++)
+		{
+			triangleOffsets[vertex + 1] = triangleOffsets[vertex] + activeCounts[vertex];
+		}
+
+		TArray<uint32> vertexTriangles(indexCount);
+		TArray<uint32> fillCounts(vertexCount, 0u);
+		for (uint32 i = 0; i < indexCount; i++)
+		{
+			const MeshIndexType vertex = indices[i];
+			vertexTriangles[triangleOffsets[vertex] + fillCounts[vertex]++] = i / 3;
+		}
+
+		TArray<int32> cachePositions(vertexCount, -1);
+		TArray<float32> vertexScores(vertexCount);
+		for (uint32 vertex = 0; vertex < vertexCount; vertex++)
+		{
+			vertexScores[vertex] = ComputeVertexScore(-1, activeCounts[vertex]);
+		}
+
+		TArray<uint8> isEmitted(triangleCount, uint8(0));
+		int32 bestTriangle		= 0;
+		float32 bestScore		= -FLT_MAX;
+		for (uint32 triangle = 0; triangle < triangleCount; triangle++)
+		{
+			const float32 score =
+				vertexScores[indices[triangle * 3 + 0]] +
+				vertexScores[indices[triangle * 3 + 1]] +
+				vertexScores[indices[triangle * 3 + 2]];
+
+			if (score > bestScore)
+			{
+				bestScore		= score;
+				bestTriangle	= int32(triangle);
+			}
+		}
+
+		// The cache holds three extra entries while a triangle is added, the vertices pushed out are then rescored
+		MeshIndexType cache[MESH_OPTIMIZER_CACHE_SIZE + 3];
+		MeshIndexType nextCache[MESH_OPTIMIZER_CACHE_SIZE + 3];
+		uint32 cacheSize = 0;
+
+		TArray<MeshIndexType> output;
+		output.Reserve(indexCount);
+
+		uint32 nextUnemitted = 0;
+		for (uint32 emitted = 0; emitted < triangleCount; emitted++)
+		{
+			// When no triangle around the cache is left, continue with the first one in the input order
+			if (bestTriangle < 0)
+			{
+				while (isEmitted[nextUnemitted])
+				{
+					nextUnemitted++;
+				}
+
+				bestTriangle = int32(nextUnemitted);
+			}
+
+			const uint32 triangle = uint32(bestTriangle);
+			isEmitted[triangle] = 1;
+
+			uint32 nextCacheSize = 0;
+			for (uint32 corner = 0; corner < 3; corner++)
+			{
+				const MeshIndexType vertex = indices[triangle * 3 + corner];
+				output.PushBack(vertex);
+
+				// Remove the triangle from the active triangles of the vertex
+				uint32* pTriangles = vertexTriangles.GetData() + triangleOffsets[vertex];
+				for (uint32 i = 0; i < activeCounts[vertex]; i++)
+				{
+					if (pTriangles[i] == triangle)
+					{
+						std::swap(pTriangles[i], pTriangles[activeCounts[vertex] - 1]);
+						activeCounts[vertex]--;
+						break;
+					}
+				}
+
+				if (std::find(nextCache, nextCache + nextCacheSize, vertex) == nextCache + nextCacheSize)
+				{
+					nextCache[nextCacheSize++] = vertex;
+				}
+			}
+
+			const uint32 triangleVertexCount = nextCacheSize;
+			for (uint32 i = 0; i < cacheSize; i++)
+			{
+				if (std::find(nextCache, nextCache + triangleVertexCount, cache[i]) == nextCache + triangleVertexCount)
+				{
+					nextCache[nextCacheSize++] = cache[i];
+				}
+			}
+
+			for (uint32 i = 0; i < nextCacheSize; i++)
+			{
+				const MeshIndexType vertex = nextCache[i];
+				cachePositions[vertex]	= i < MESH_OPTIMIZER_CACHE_SIZE ? int32(i) : -1;
+				vertexScores[vertex]	= ComputeVertexScore(cachePositions[vertex], activeCounts[vertex]);
+			}
+
+			// Only the triangles around the cache change score, the best of them is emitted next
+			bestTriangle	= -1;
+			bestScore		= -FLT_MAX;
+			for (uint32 i = 0; i < nextCacheSize; i++)
+			{
+				const MeshIndexType vertex = nextCache[i];
+				const uint32* pTriangles = vertexTriangles.GetData() + triangleOffsets[vertex];
+				for (uint32 j = 0; j < activeCounts[vertex]; j++)
+				{
+					const uint32 activeTriangle = pTriangles[j];
+					const float32 score =
+						vertexScores[indices[activeTriangle * 3 + 0]] +
+						vertexScores[indices[activeTriangle * 3 + 1]] +
+						vertexScores[indices[activeTriangle * 3 + 2]];
+
+					if (score > bestScore)
+					{
+						bestScore		= score;
+						bestTriangle	= int32(activeTriangle);
+					}
+				}
+			}
+
+			cacheSize = std::min<uint32>(nextCacheSize, MESH_OPTIMIZER_CACHE_SIZE);
+			memcpy(cache, nextCache, sizeof(MeshIndexType) * cacheSize);
+		}
+
+		indices = std::move(output);
+	}
+
+	static void OptimizeOverdraw(TArray<MeshIndexType>& indices, const TArray<Vertex>& vertices)
+	{
+		const uint32 triangleCount = indices.GetSize() / 3;
+		if (triangleCount == 0)
+		{
+			return;
+		}
+
+		// Misses of every triangle in the cache optimized order
+		TArray<uint8> triangleMisses(triangleCount);
+		TArray<uint32> timestamps(vertices.GetSize(), 0u);
+		uint32 time		= MESH_STATISTICS_CACHE_SIZE + 1;
+		uint32 misses	= 0;
+		for (uint32 triangle = 0; triangle < triangleCount; triangle++)
+		{
+			uint8 triangleMissCount = 0;
+			for (uint32 corner = 0; corner < 3; corner++)
+			{
+				const MeshIndexType vertex = indices[triangle * 3 + corner];
+				if (time - timestamps[vertex] > MESH_STATISTICS_CACHE_SIZE)
+				{
+					timestamps[vertex] = time++;
+					triangleMissCount++;
+				}
+			}
+
+			triangleMisses[triangle] = triangleMissCount;
+			misses += triangleMissCount;
+		}
+
+		// A cluster starts where the cache was flushed, or once the cluster so far is close enough to the ACMR of the
+		// whole mesh. The cache is cold at the start of every cluster since they are drawn in another order afterwards
+		const float32 acmrThreshold = MESH_OVERDRAW_THRESHOLD * float32(misses) / float32(triangleCount);
+		TArray<uint32> clusterStarts;
+		uint32 clusterMisses = 0;
+		for (uint32 triangle = 0; triangle < triangleCount; triangle++)
+		{
+			const uint32 clusterSize = clusterStarts.IsEmpty() ? 0 : triangle - clusterStarts.GetBack();
+			const bool isSoftBoundary = clusterSize > 0 && float32(clusterMisses) / float32(clusterSize) <= acmrThreshold;
+			if (clusterStarts.IsEmpty() || triangleMisses[triangle] == 3 || isSoftBoundary)
+			{
+				clusterStarts.PushBack(triangle);
+				clusterMisses = 0;
+				time += MESH_STATISTICS_CACHE_SIZE + 1;
+			}
+
+			for (uint32 corner = 0; corner < 3; corner++)
+			{
+				const MeshIndexType vertex = indices[triangle * 3 + corner];
+				if (time - timestamps[vertex] > MESH_STATISTICS_CACHE_SIZE)
+				{
+					timestamps[vertex] = time++;
+					clusterMisses++;
+				}
+			}
+		}
+
+		const uint32 clusterCount = clusterStarts.GetSize();
+		clusterStarts.PushBack(triangleCount);
+
+		// Clusters facing away from the center of the mesh are likely to occlude the others and are drawn first
+		TArray<glm::vec3> clusterCentroids(clusterCount, glm::vec3(0.0f));
+		TArray<glm::vec3> clusterNormals(clusterCount, glm::vec3(0.0f));
+		glm::vec3 meshCentroid(0.0f);
+		float32 meshArea = 0.0f;
+		for (uint32 cluster = 0; cluster < clusterCount; cluster++)
+		{
+			float32 clusterArea = 0.0f;
+			for (uint32 triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; triangle++)
+			{
+				const glm::vec3 p0 = vertices[indices[triangle * 3 + 0]].ExtractPosition();
+				const glm::vec3 p1 = vertices[indices[triangle * 3 + 1]].ExtractPosition();
+				const glm::vec3 p2 = vertices[indices[triangle * 3 + 2]].ExtractPosition();
+
+				// The length of the cross product weights every triangle by its area
+				const glm::vec3 normal = glm::cross(p2 - p0, p1 - p0);
+				const float32 area = glm::length(normal);
+
+				clusterCentroids[cluster]	+= (p0 + p1 + p2) * (area / 3.0f);
+				clusterNormals[cluster]		+= normal;
+				clusterArea					+= area;
+			}
+
+			meshCentroid	+= clusterCentroids[cluster];
+			meshArea		+= clusterArea;
+			clusterCentroids[cluster] = clusterArea > 0.0f ? clusterCentroids[cluster] / clusterArea : glm::vec3(0.0f);
+		}
+
+		meshCentroid = meshArea > 0.0f ? meshCentroid / meshArea : glm::vec3(0.0f);
+
+		TArray<std::pair<float32, uint32>> sortedClusters(clusterCount);
+		for (uint32 cluster = 0; cluster < clusterCount; cluster++)
+		{
+			const float32 normalLength = glm::length(clusterNormals[cluster]);
+			const glm::vec3 normal = normalLength > 0.0f ? clusterNormals[cluster] / normalLength : glm::vec3(0.0f);
+			sortedClusters[cluster] = std::make_pair(glm::dot(clusterCentroids[cluster] - meshCentroid, normal), cluster);
+		}
+
+		std::stable_sort(sortedClusters.GetData(), sortedClusters.GetData() + sortedClusters.GetSize(), [](const std::pair<float32, uint32>& a, const std::pair<float32, uint32>& b)
+			{
+				return a.first > b.first;
+			});
+
+		TArray<MeshIndexType> output;
+		output.Reserve(indices.GetSize());
+		for (const std::pair<float32, uint32>& sortedCluster : sortedClusters)
+		{
+			const uint32 cluster = sortedCluster.second;
+			for (uint32 index = clusterStarts[cluster] * 3; index < clusterStarts[cluster + 1] * 3; index++)
+			{
+				output.PushBack(indices[index]);
+			}
+		}
+
+		indices = std::move(output);
+	}
+
+	static void OptimizeVertexFetch(Mesh* pMesh)
+	{
+		// Vertices are stored in the order they are first used, unused vertices are dropped
+		const uint32 vertexCount = pMesh->Vertices.GetSize();
+		TArray<MeshIndexType> remap(vertexCount, MeshIndexType(UINT32_MAX));
+		uint32 newVertexCount = 0;
+		for (MeshIndexType& index : pMesh->Indices)
+		{
+			if (remap[index] == UINT32_MAX)
+			{
+				remap[index] = newVertexCount++;
+			}
+
+			index = remap[index];
+		}
+
+		const bool hasJointData = pMesh->VertexJointData.GetSize() == vertexCount;
+
+		TArray<Vertex> vertices(newVertexCount);
+		TArray<VertexJointData> vertexJointData(hasJointData ? newVertexCount : 0);
+		for (uint32 vertex = 0; vertex < vertexCount; vertex++)
+		{
+			if (remap[vertex] != UINT32_MAX)
+			{
+				vertices[remap[vertex]] = pMesh->Vertices[vertex];
+				if (hasJointData)
+				{
+					vertexJointData[remap[vertex]] = pMesh->VertexJointData[vertex];
+				}
+			}
+		}
+
+		pMesh->Vertices = std::move(vertices);
+		if (hasJointData)
+		{
+			pMesh->VertexJointData = std::move(vertexJointData);
+		}
+	}
+
+	uint32 MeshFactory::RemoveDuplicateVertices(Mesh* pMesh)
+	{
+		const uint32 vertexCount = pMesh->Vertices.GetSize();
+		const bool hasJointData = pMesh->VertexJointData.GetSize() == vertexCount;
+
+		// Open addressing with linear probing, the table holds the new index of every unique vertex
+		uint32 tableSize = 1;
+		while (tableSize < vertexCount * 2)
+		{
+			tableSize <<= 1;
+		}
+
+		const uint32 tableMask = tableSize - 1;
+		TArray<uint32> table(tableSize, UINT32_MAX);
+		TArray<MeshIndexType> remap(vertexCount);
+
+		Vertex* pVertices = pMesh->Vertices.GetData();
+		VertexJointData* pJointData = hasJointData ? pMesh->VertexJointData.GetData() : nullptr;
+
+		// Unique vertices are compacted in place, a vertex is never moved past one that has not been visited yet
+		uint32 uniqueCount = 0;
+		for (uint32 vertex = 0; vertex < vertexCount; vertex++)
+		{
+			uint32 slot = uint32(HashVertex(pVertices[vertex], pJointData ? &pJointData[vertex] : nullptr)) & tableMask;
+			while (true)
+			{
+				const uint32 existing = table[slot];
+				if (existing == UINT32_MAX)
+				{
+					table[slot]				= uniqueCount;
+					remap[vertex]			= uniqueCount;
+					pVertices[uniqueCount]	= pVertices[vertex];
+					if (pJointData)
+					{
+						pJointData[uniqueCount] = pJointData[vertex];
+					}
+
+					uniqueCount++;
+					break;
+				}
+
+				if (memcmp(&pVertices[existing], &pVertices[vertex], sizeof(Vertex)) == 0 &&
+					(!pJointData || memcmp(&pJointData[existing], &pJointData[vertex], sizeof(VertexJointData)) == 0))
+				{
+					remap[vertex] = existing;
+					break;
+				}
+
+				slot = (slot + 1) & tableMask;
+			}
+		}
+
+		for (MeshIndexType& index : pMesh->Indices)
+		{
+			index = remap[index];
+		}
+
+		pMesh->Vertices.Resize(uniqueCount);
+		if (hasJointData)
+		{
+			pMesh->VertexJointData.Resize(uniqueCount);
+		}
+
+		return uniqueCount;
+	}
+
+	void MeshFactory::OptimizeMesh(Mesh* pMesh, MeshOptimizationStats* pStats)
+	{
+		if (pStats)
+		{
+			pStats->VertexCountBefore = pMesh->Vertices.GetSize();
+			ComputeVertexCacheStats(pMesh->Indices, pMesh->Vertices.GetSize(), pStats->ACMRBefore, pStats->ATVRBefore);
+		}
+
+		RemoveDuplicateVertices(pMesh);
+
+		// Triangle order only means something for triangle lists
+		if (pMesh->Indices.GetSize() % 3 == 0)
+		{
+			OptimizeVertexCache(pMesh->Indices, pMesh->Vertices.GetSize());
+			OptimizeOverdraw(pMesh->Indices, pMesh->Vertices);
+		}
+
+		OptimizeVertexFetch(pMesh);
+
+		if (pStats)
+		{
+			pStats->VertexCountAfter = pMesh->Vertices.GetSize();
+			ComputeVertexCacheStats(pMesh->Indices, pMesh->Vertices.GetSize(), pStats->ACMRAfter, pStats->ATVRAfter);
+		}
+	}
+
+	void MeshFactory::PackVertices(Mesh* pMesh)
+	{
+		const TArray<Vertex>& vertices = pMesh->Vertices;
+
+		// The BoundingBox of the mesh is centered on the average position, so the bounds are taken from the vertices
+		glm::vec3 minPosition = vertices.IsEmpty() ? glm::vec3(0.0f) : vertices[0].ExtractPosition();
+		glm::vec3 maxPosition = minPosition;
+		for (const Vertex& vertex : vertices)
+		{
+			minPosition = glm::min(minPosition, vertex.ExtractPosition());
+			maxPosition = glm::max(maxPosition, vertex.ExtractPosition());
+		}
+
+		pMesh->PackedPositionMin	= minPosition;
+		pMesh->PackedPositionExtent	= maxPosition - minPosition;
+
+		// Flat meshes have no extent along one of the axes
+		auto quantizePosition = [&](uint32 axis, float32 value) -> uint32
+		{
+			return maxPosition[axis] > minPosition[axis] ? QuantizeFloat(value, minPosition[axis], maxPosition[axis], 16) : 0;
+		};
+
+		pMesh->PackedVertices.Resize(vertices.GetSize());
+		for (uint32 v = 0; v < vertices.GetSize(); v++)
+		{
+			const Vertex& vertex = vertices[v];
+			const glm::vec3 position = vertex.ExtractPosition();
+			const uint32 paintBits = glm::floatBitsToUint(vertex.PositionXYZPaintBitsW.w) & 0xffff;
+
+			PackedVertex& packedVertex = pMesh->PackedVertices[v];
+			packedVertex.PositionXY			= quantizePosition(0, position.x) | (quantizePosition(1, position.y) << 16);
+			packedVertex.PositionZPaintBits	= quantizePosition(2, position.z) | (paintBits << 16);
+			packedVertex.NormalTangent		= PackOctahedral16(vertex.ExtractNormal()) | (PackOctahedral16(vertex.ExtractTangent()) << 16);
+			packedVertex.TexCoord			= glm::packHalf2x16(glm::vec2(vertex.TexCoordXYOriginalPosZW.x, vertex.TexCoordXYOriginalPosZW.y));
+		}
+	}
+
+	void MeshFactory::ComputeVertexCacheStats(const TArray<MeshIndexType>& indices, uint32 vertexCount, float32& acmr, float32& atvr)
+	{
+		// A vertex is in the FIFO cache if fewer than the cache size misses happened since it was loaded
+		TArray<uint32> timestamps(vertexCount, 0u);
+		uint32 time		= MESH_STATISTICS_CACHE_SIZE + 1;
+		uint32 misses	= 0;
+		for (MeshIndexType index : indices)
+		{
+			if (time - timestamps[index] > MESH_STATISTICS_CACHE_SIZE)
+			{
+				timestamps[index] = time++;
+				misses++;
+			}
+		}
+
+		const uint32 triangleCount = indices.GetSize() / 3;
+		acmr = triangleCount > 0 ? float32(misses) / float32(triangleCount) : 0.0f;
+		atvr = vertexCount > 0 ? float32(misses) / float32(vertexCount) : 0.0f;
+	}
 }
@@ -385,31 +385,15 @@ namespace LambdaEngine
 
 	uint32 MeshTessellator::MergeDuplicateVertices(const TArray<Vertex>& unmergedVertices, Mesh* pMesh)
 	{
-		THashTable<Vertex, MeshIndexType> vertexToIndex;
-		vertexToIndex.reserve(unmergedVertices.GetSize());
-
-		uint32 currentIndex = 0;
-		uint32 uniqueVertices = 0;
+		// Every vertex starts out with an index of its own, MeshFactory then merges the duplicates
+		pMesh->Vertices = unmergedVertices;
+		pMesh->Indices.Resize(unmergedVertices.GetSize());
 		for (uint32 i = 0; i < unmergedVertices.GetSize(); i++)
 		{
-			const Vertex& vertex = unmergedVertices[i];
-			auto it = vertexToIndex.find(vertex);
-			if (it == vertexToIndex.end())
-			{
-				vertexToIndex[vertex] = currentIndex;
-				pMesh->Vertices.PushBack(vertex);
-				pMesh->Indices.PushBack(currentIndex);
-				currentIndex++;
-				uniqueVertices++;
-			}
-			else
-			{
-				uint32 existingIndex = it->second;
-				pMesh->Indices.PushBack(existingIndex);
-			}
+			pMesh->Indices[i] = i;
 		}
 
-		return uniqueVertices;
+		return MeshFactory::RemoveDuplicateVertices(pMesh);
 	}
 
 	void MeshTessellator::ReleaseTessellationBuffers()
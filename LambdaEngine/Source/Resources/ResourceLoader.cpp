@@ -1,5 +1,7 @@
 #include "Resources/ResourceLoader.h"
 #include "Resources/ResourcePaths.h"
+#include "Resources/SceneCache.h"
+#include "Resources/ShaderCache.h"
 
 #include "Rendering/Core/API/CommandAllocator.h"
 #include "Rendering/Core/API/CommandList.h"
@@ -28,9 +30,12 @@
 
 #include "Game/ECS/Components/Physics/Transform.h"
 
+#include "Engine/EngineLoop.h"
+
 #include "Resources/MeshTessellator.h"
 
 #include <cstdio>
+#include <algorithm>
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -153,6 +158,12 @@ namespace LambdaEngine
 	*/
 	bool ResourceLoader::Init()
 	{
+		// Headless engines only load meshes and animations, which do not need any device resources
+		if (EngineLoop::IsHeadless())
+		{
+			return true;
+		}
+
 		// Init resources
 		s_pCopyCommandAllocator = RenderAPI::GetDevice()->CreateCommandAllocator("ResourceLoader Copy CommandAllocator", ECommandQueueType::COMMAND_QUEUE_TYPE_GRAPHICS);
 		if (s_pCopyCommandAllocator == nullptr)
@@ -224,6 +235,11 @@ namespace LambdaEngine
 
 	bool ResourceLoader::Release()
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return true;
+		}
+
 		// Cubemap gen
 		ReleaseCubemapGen();
 
@@ -251,6 +267,12 @@ namespace LambdaEngine
 		aiTextureType type,
 		uint32 index)
 	{
+		// There is no device to upload textures to when running headless
+		if (EngineLoop::IsHeadless())
+		{
+			return nullptr;
+		}
+
 		if (pMaterial->GetTextureCount(type) > index)
 		{
 			aiString str;
@@ -333,6 +355,13 @@ namespace LambdaEngine
 
 					pLoadedTexture->Flags = AssimpTextureFlagToLambdaTextureFlag(type);
 
+					LoadedTextureSource& source = context.TextureSources.PushBack({});
+					source.pTexture	= pLoadedTexture;
+					source.Name		= name;
+					source.Width	= textureWidth;
+					source.Height	= textureHeight;
+					source.EmbeddedPixels.Assign(pTextureData, pTextureData + 4u * textureWidth * textureHeight);
+
 					if (loadedWithSTBI)
 					{
 						stbi_image_free(pTextureData);
@@ -365,6 +394,10 @@ namespace LambdaEngine
 					pLoadedTexture->pTexture = ResourceLoader::LoadTextureArrayFromFile(name, context.DirectoryPath, &name, 1, EFormat::FORMAT_R8G8B8A8_UNORM, true, true);
 					pLoadedTexture->Flags = AssimpTextureFlagToLambdaTextureFlag(type);
 
+					LoadedTextureSource& source = context.TextureSources.PushBack({});
+					source.pTexture	= pLoadedTexture;
+					source.Name		= name;
+
 					context.LoadedTextures[name] = pLoadedTexture;
 					return context.pTextures->PushBack(pLoadedTexture);
 				}
@@ -569,6 +602,11 @@ namespace LambdaEngine
 		pMesh->Indices.Resize(numVertices);
 		memcpy(pMesh->Indices.GetData(), pIndices, sizeof(uint32) * numIndices);
 
+		if (EngineLoop::IsHeadless())
+		{
+			return pMesh;
+		}
+
 		if (useMeshletCache)
 		{
 			LoadMeshletsFromCache(name, pMesh);
@@ -1200,26 +1238,181 @@ namespace LambdaEngine
 		return pTexture;
 	}
 
+	Texture* ResourceLoader::LoadTextureMiplevelsFromMemory(
+		const String& name,
+		const void* pData,
+		uint32 width,
+		uint32 height,
+		uint32 miplevels,
+		EFormat format)
+	{
+		TextureDesc textureDesc = {};
+		textureDesc.DebugName	= name;
+		textureDesc.MemoryType	= EMemoryType::MEMORY_TYPE_GPU;
+		textureDesc.Format		= format;
+		textureDesc.Type		= ETextureType::TEXTURE_TYPE_2D;
+		textureDesc.Flags		= FTextureFlag::TEXTURE_FLAG_COPY_DST | FTextureFlag::TEXTURE_FLAG_SHADER_RESOURCE;
+		textureDesc.Width		= width;
+		textureDesc.Height		= height;
+		textureDesc.Depth		= 1;
+		textureDesc.ArrayCount	= 1;
+		textureDesc.Miplevels	= miplevels;
+		textureDesc.SampleCount = 1;
+
+		Texture* pTexture = RenderAPI::GetDevice()->CreateTexture(&textureDesc);
+		if (pTexture == nullptr)
+		{
+			LOG_ERROR("Failed to create texture for \"%s\"", name.c_str());
+			return nullptr;
+		}
+
+		uint64 dataSize = 0;
+		for (uint32 miplevel = 0; miplevel < miplevels; miplevel++)
+		{
+			dataSize += TextureMiplevelSize(format, width, height, miplevel);
+		}
+
+		BufferDesc bufferDesc	= { };
+		bufferDesc.DebugName	= "Texture Copy Buffer";
+		bufferDesc.MemoryType	= EMemoryType::MEMORY_TYPE_CPU_VISIBLE;
+		bufferDesc.Flags		= FBufferFlag::BUFFER_FLAG_COPY_SRC;
+		bufferDesc.SizeInBytes	= dataSize;
+
+		Buffer* pTextureData = RenderAPI::GetDevice()->CreateBuffer(&bufferDesc);
+		if (pTextureData == nullptr)
+		{
+			LOG_ERROR("Failed to create copy buffer for \"%s\"", name.c_str());
+			SAFERELEASE(pTexture);
+			return nullptr;
+		}
+
+		void* pTextureDataDst = pTextureData->Map();
+		memcpy(pTextureDataDst, pData, dataSize);
+		pTextureData->Unmap();
+
+		const uint64 waitValue = s_CopySignalValue - 1;
+		s_pCopyFence->Wait(waitValue, UINT64_MAX);
+
+		s_pCopyCommandAllocator->Reset();
+		s_pCopyCommandList->Begin(nullptr);
+
+		PipelineTextureBarrierDesc transitionToCopyDstBarrier = {};
+		transitionToCopyDstBarrier.pTexture				= pTexture;
+		transitionToCopyDstBarrier.StateBefore			= ETextureState::TEXTURE_STATE_UNKNOWN;
+		transitionToCopyDstBarrier.StateAfter			= ETextureState::TEXTURE_STATE_COPY_DST;
+		transitionToCopyDstBarrier.QueueBefore			= ECommandQueueType::COMMAND_QUEUE_TYPE_NONE;
+		transitionToCopyDstBarrier.QueueAfter			= ECommandQueueType::COMMAND_QUEUE_TYPE_NONE;
+		transitionToCopyDstBarrier.SrcMemoryAccessFlags	= 0;
+		transitionToCopyDstBarrier.DstMemoryAccessFlags	= FMemoryAccessFlag::MEMORY_ACCESS_FLAG_MEMORY_WRITE;
+		transitionToCopyDstBarrier.TextureFlags			= textureDesc.Flags;
+		transitionToCopyDstBarrier.Miplevel				= 0;
+		transitionToCopyDstBarrier.MiplevelCount		= textureDesc.Miplevels;
+		transitionToCopyDstBarrier.ArrayIndex			= 0;
+		transitionToCopyDstBarrier.ArrayCount			= textureDesc.ArrayCount;
+
+		s_pCopyCommandList->PipelineTextureBarriers(
+			FPipelineStageFlag::PIPELINE_STAGE_FLAG_TOP,
+			FPipelineStageFlag::PIPELINE_STAGE_FLAG_COPY,
+			&transitionToCopyDstBarrier, 1);
+
+		uint64 bufferOffset = 0;
+		for (uint32 miplevel = 0; miplevel < miplevels; miplevel++)
+		{
+			CopyTextureBufferDesc copyDesc = {};
+			copyDesc.BufferOffset	= bufferOffset;
+			copyDesc.BufferRowPitch	= 0;
+			copyDesc.BufferHeight	= 0;
+			copyDesc.Width			= std::max(width >> miplevel, 1u);
+			copyDesc.Height			= std::max(height >> miplevel, 1u);
+			copyDesc.Depth			= 1;
+			copyDesc.Miplevel		= miplevel;
+			copyDesc.MiplevelCount	= 1;
+			copyDesc.ArrayIndex		= 0;
+			copyDesc.ArrayCount		= 1;
+
+			s_pCopyCommandList->CopyTextureFromBuffer(pTextureData, pTexture, copyDesc);
+			bufferOffset += TextureMiplevelSize(format, width, height, miplevel);
+		}
+
+		PipelineTextureBarrierDesc transitionToShaderReadBarrier = {};
+		transitionToShaderReadBarrier.pTexture				= pTexture;
+		transitionToShaderReadBarrier.StateBefore			= ETextureState::TEXTURE_STATE_COPY_DST;
+		transitionToShaderReadBarrier.StateAfter			= ETextureState::TEXTURE_STATE_SHADER_READ_ONLY;
+		transitionToShaderReadBarrier.QueueBefore			= ECommandQueueType::COMMAND_QUEUE_TYPE_NONE;
+		transitionToShaderReadBarrier.QueueAfter			= ECommandQueueType::COMMAND_QUEUE_TYPE_NONE;
+		transitionToShaderReadBarrier.SrcMemoryAccessFlags	= FMemoryAccessFlag::MEMORY_ACCESS_FLAG_MEMORY_WRITE;
+		transitionToShaderReadBarrier.DstMemoryAccessFlags	= FMemoryAccessFlag::MEMORY_ACCESS_FLAG_MEMORY_READ;
+		transitionToShaderReadBarrier.TextureFlags			= textureDesc.Flags;
+		transitionToShaderReadBarrier.Miplevel				= 0;
+		transitionToShaderReadBarrier.MiplevelCount			= textureDesc.Miplevels;
+		transitionToShaderReadBarrier.ArrayIndex			= 0;
+		transitionToShaderReadBarrier.ArrayCount			= textureDesc.ArrayCount;
+
+		s_pCopyCommandList->PipelineTextureBarriers(
+			FPipelineStageFlag::PIPELINE_STAGE_FLAG_COPY,
+			FPipelineStageFlag::PIPELINE_STAGE_FLAG_BOTTOM,
+			&transitionToShaderReadBarrier, 1);
+
+		s_pCopyCommandList->End();
+
+		if (!RenderAPI::GetGraphicsQueue()->ExecuteCommandLists(
+			&s_pCopyCommandList, 1,
+			FPipelineStageFlag::PIPELINE_STAGE_FLAG_COPY,
+			nullptr, 0,
+			s_pCopyFence, s_CopySignalValue))
+		{
+			LOG_ERROR("Texture could not be created as command list could not be executed for \"%s\"", name.c_str());
+			SAFERELEASE(pTextureData);
+			SAFERELEASE(pTexture);
+
+			return nullptr;
+		}
+		else
+		{
+			s_CopySignalValue++;
+		}
+
+		//Todo: Remove this wait after garbage collection works
+		RenderAPI::GetGraphicsQueue()->Flush();
+
+		SAFERELEASE(pTextureData);
+
+		return pTexture;
+	}
+
 	Shader* ResourceLoader::LoadShaderFromFile(const String& filepath, FShaderStageFlag stage, EShaderLang lang, const String& entryPoint)
 	{
 		const String file = ConvertSlashes(filepath);
 
+		TArray<uint32> sourceSPIRV;
+		if (!CompileShaderFromFile(file, stage, lang, sourceSPIRV))
+		{
+			return nullptr;
+		}
+
+		return CreateShaderFromSPIRV(file, sourceSPIRV, stage, lang, entryPoint);
+	}
+
+	bool ResourceLoader::CompileShaderFromFile(const String& filepath, FShaderStageFlag stage, EShaderLang lang, TArray<uint32>& sourceSPIRV)
+	{
+		const String file = ConvertSlashes(filepath);
+
 		byte* pShaderRawSource = nullptr;
 		uint32 shaderRawSourceSize = 0;
 
-		TArray<uint32> sourceSPIRV;
 		if (lang == EShaderLang::SHADER_LANG_GLSL)
 		{
 			if (!ReadDataFromFile(file, "r", &pShaderRawSource, &shaderRawSourceSize))
 			{
 				LOG_ERROR("Failed to open shader file \"%s\"", file.c_str());
-				return nullptr;
+				return false;
 			}
 
 			if (!CompileGLSLToSPIRV(file, reinterpret_cast<char*>(pShaderRawSource), stage, &sourceSPIRV, nullptr))
 			{
 				LOG_ERROR("Failed to compile GLSL to SPIRV for \"%s\"", file.c_str());
-				return nullptr;
+				Malloc::Free(pShaderRawSource);
+				return false;
 			}
 		}
 		else if (lang == EShaderLang::SHADER_LANG_SPIRV)
@@ -1227,26 +1420,29 @@ namespace LambdaEngine
 			if (!ReadDataFromFile(file, "rb", &pShaderRawSource, &shaderRawSourceSize))
 			{
 				LOG_ERROR("Failed to open shader file \"%s\"", file.c_str());
-				return nullptr;
+				return false;
 			}
 
 			sourceSPIRV.Resize(static_cast<uint32>(glm::ceil(static_cast<float32>(shaderRawSourceSize) / sizeof(uint32))));
 			memcpy(sourceSPIRV.GetData(), pShaderRawSource, shaderRawSourceSize);
 		}
 
+		Malloc::Free(pShaderRawSource);
+		return true;
+	}
+
+	Shader* ResourceLoader::CreateShaderFromSPIRV(const String& name, const TArray<uint32>& sourceSPIRV, FShaderStageFlag stage, EShaderLang lang, const String& entryPoint)
+	{
 		const uint32 sourceSize = static_cast<uint32>(sourceSPIRV.GetSize()) * sizeof(uint32);
 
 		ShaderDesc shaderDesc = { };
-		shaderDesc.DebugName	= file;
-		shaderDesc.Source		= TArray<byte>(reinterpret_cast<byte*>(sourceSPIRV.GetData()), reinterpret_cast<byte*>(sourceSPIRV.GetData()) + sourceSize);
+		shaderDesc.DebugName	= name;
+		shaderDesc.Source		= TArray<byte>(reinterpret_cast<const byte*>(sourceSPIRV.GetData()), reinterpret_cast<const byte*>(sourceSPIRV.GetData()) + sourceSize);
 		shaderDesc.EntryPoint	= entryPoint;
 		shaderDesc.Stage		= stage;
 		shaderDesc.Lang			= lang;
 
-		Shader* pShader = RenderAPI::GetDevice()->CreateShader(&shaderDesc);
-		Malloc::Free(pShaderRawSource);
-
-		return pShader;
+		return RenderAPI::GetDevice()->CreateShader(&shaderDesc);
 	}
 
 	Shader* ResourceLoader::LoadShaderFromMemory(
@@ -1450,6 +1646,29 @@ namespace LambdaEngine
 		return true;
 	}
 
+	void* ResourceLoader::LoadPixelsFromFile(const String& filepath, uint32& width, uint32& height)
+	{
+		int32 texWidth	= 0;
+		int32 texHeight	= 0;
+		int32 bpp		= 0;
+
+		void* pPixels = (void*)stbi_load(ConvertSlashes(filepath).c_str(), &texWidth, &texHeight, &bpp, STBI_rgb_alpha);
+		if (pPixels == nullptr)
+		{
+			LOG_ERROR("Failed to load texture file: \"%s\"", filepath.c_str());
+			return nullptr;
+		}
+
+		width	= uint32(texWidth);
+		height	= uint32(texHeight);
+		return pPixels;
+	}
+
+	void ResourceLoader::FreePixels(void* pPixels)
+	{
+		stbi_image_free(pPixels);
+	}
+
 	bool ResourceLoader::InitCubemapGen()
 	{
 		//Create Descriptor Heap
@@ -1835,6 +2054,8 @@ namespace LambdaEngine
 			}
 		}
 
+		MeshFactory::BakeSkeletonEvaluationOrder(pSkeleton);
+
 		// Find root node
 		for (uint32 jointID = 0; jointID < pSkeleton->Joints.GetSize(); jointID++)
 		{
@@ -2076,6 +2297,110 @@ namespace LambdaEngine
 		}
 	}
 
+	/*
+	* Samples assimp keys at frameCount evenly spaced times. The keys are sorted by time and so are the samples, so the
+	* key cursor only moves forward
+	*/
+	template<typename TKeyAI, typename TValue, typename TInterpolate>
+	static void ResampleKeys(const TKeyAI* pKeysAI, uint32 keyCount, float64 durationInTicks, uint32 frameCount, TArray<TValue>& samples, TInterpolate interpolate)
+	{
+		samples.Resize(frameCount);
+
+		uint32 cursor = 0;
+		for (uint32 frame = 0; frame < frameCount; frame++)
+		{
+			const float64 time = (durationInTicks * frame) / (frameCount - 1);
+			while (cursor + 1 < keyCount && pKeysAI[cursor + 1].mTime <= time)
+			{
+				cursor++;
+			}
+
+			const TKeyAI& key0		= pKeysAI[cursor];
+			const TKeyAI& key1		= pKeysAI[std::min(cursor + 1, keyCount - 1)];
+			const float64 factor	= (key1.mTime > key0.mTime) ? glm::clamp((time - key0.mTime) / (key1.mTime - key0.mTime), 0.0, 1.0) : 0.0;
+			samples[frame] = interpolate(key0.mValue, key1.mValue, float32(factor));
+		}
+	}
+
+	/*
+	* Lowers keySpacing to the smallest gap between two keys of the track
+	*/
+	template<typename TKeyAI>
+	static void FindKeySpacing(const TKeyAI* pKeysAI, uint32 keyCount, float64& keySpacing)
+	{
+		for (uint32 keyIndex = 1; keyIndex < keyCount; keyIndex++)
+		{
+			const float64 gap = pKeysAI[keyIndex].mTime - pKeysAI[keyIndex - 1].mTime;
+			if (gap > 0.0)
+			{
+				keySpacing = std::min(keySpacing, gap);
+			}
+		}
+	}
+
+	static bool IsOnKeyGrid(float64 time, float64 keySpacing)
+	{
+		const float64 steps = time / keySpacing;
+		return std::abs(steps - std::round(steps)) < 0.01;
+	}
+
+	template<typename TKeyAI>
+	static bool AreKeysOnGrid(const TKeyAI* pKeysAI, uint32 keyCount, float64 keySpacing)
+	{
+		for (uint32 keyIndex = 0; keyIndex < keyCount; keyIndex++)
+		{
+			if (!IsOnKeyGrid(pKeysAI[keyIndex].mTime, keySpacing))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void CookVec3Track(const TArray<glm::vec3>& samples, Animation::Vec3Track& track)
+	{
+		glm::vec3 minValue = samples[0];
+		glm::vec3 maxValue = samples[0];
+		for (const glm::vec3& sample : samples)
+		{
+			minValue = glm::min(minValue, sample);
+			maxValue = glm::max(maxValue, sample);
+		}
+
+		track.Min		= minValue;
+		track.Extent	= maxValue - minValue;
+
+		// A track that never changes only needs one frame
+		const uint32 frameCount = (track.Extent == glm::vec3(0.0f)) ? 1 : samples.GetSize();
+		track.Values.Resize(frameCount * 3);
+		for (uint32 frame = 0; frame < frameCount; frame++)
+		{
+			for (uint32 component = 0; component < 3; component++)
+			{
+				const float32 extent		= track.Extent[component];
+				const float32 normalized	= extent > 0.0f ? (samples[frame][component] - minValue[component]) / extent : 0.0f;
+				track.Values[frame * 3 + component] = uint16(glm::clamp(normalized, 0.0f, 1.0f) * float32(UINT16_MAX) + 0.5f);
+			}
+		}
+	}
+
+	static void CookRotationTrack(const TArray<glm::quat>& samples, Animation::RotationTrack& track)
+	{
+		track.Values.Resize(samples.GetSize());
+
+		bool isConstant = true;
+		for (uint32 frame = 0; frame < samples.GetSize(); frame++)
+		{
+			track.Values[frame] = PackQuantizedQuat(QuantizeQuat(samples[frame], ANIMATION_ROTATION_BITS), ANIMATION_ROTATION_BITS);
+			isConstant = isConstant && track.Values[frame] == track.Values[0];
+		}
+
+		if (isConstant)
+		{
+			track.Values.Resize(1);
+		}
+	}
+
 	void ResourceLoader::LoadAnimation(SceneLoadingContext& context, const aiAnimation* pAnimationAI)
 	{
 		VALIDATE(pAnimationAI != nullptr);
@@ -2084,49 +2409,107 @@ namespace LambdaEngine
 		pAnimation->Name			= pAnimationAI->mName.C_Str();
 		pAnimation->DurationInTicks	= pAnimationAI->mDuration;
 		pAnimation->TicksPerSecond	= (pAnimationAI->mTicksPerSecond != 0.0) ? pAnimationAI->mTicksPerSecond : 30.0;
-		pAnimationAI->mChannels[0]->mNodeName;
+
+		// Resample at the density of the most detailed track
+		uint32 frameCount = 2;
+		float64 keySpacing = DBL_MAX;
+		for (uint32 channelIndex = 0; channelIndex < pAnimationAI->mNumChannels; channelIndex++)
+		{
+			const aiNodeAnim* pChannel = pAnimationAI->mChannels[channelIndex];
+			frameCount = std::max({ frameCount, pChannel->mNumPositionKeys, pChannel->mNumRotationKeys, pChannel->mNumScalingKeys });
+
+			FindKeySpacing(pChannel->mPositionKeys, pChannel->mNumPositionKeys, keySpacing);
+			FindKeySpacing(pChannel->mRotationKeys, pChannel->mNumRotationKeys, keySpacing);
+			FindKeySpacing(pChannel->mScalingKeys, pChannel->mNumScalingKeys, keySpacing);
+		}
+
+		/*
+		* Frames span the whole clip, but the keys do not have to start at zero or end at the duration. When every key
+		* lies on one evenly spaced grid the frames are placed on that grid instead, so the keys are kept as they are
+		*/
+		if (keySpacing < DBL_MAX && IsOnKeyGrid(pAnimation->DurationInTicks, keySpacing))
+		{
+			bool isOnGrid = true;
+			for (uint32 channelIndex = 0; channelIndex < pAnimationAI->mNumChannels && isOnGrid; channelIndex++)
+			{
+				const aiNodeAnim* pChannel = pAnimationAI->mChannels[channelIndex];
+				isOnGrid =
+					AreKeysOnGrid(pChannel->mPositionKeys, pChannel->mNumPositionKeys, keySpacing) &&
+					AreKeysOnGrid(pChannel->mRotationKeys, pChannel->mNumRotationKeys, keySpacing) &&
+					AreKeysOnGrid(pChannel->mScalingKeys, pChannel->mNumScalingKeys, keySpacing);
+			}
+
+			// A few closely spaced keys in a long clip would make the grid much denser than the keys themselves
+			const float64 gridFrameCount = std::round(pAnimation->DurationInTicks / keySpacing) + 1.0;
+			if (isOnGrid && gridFrameCount <= float64(frameCount) * 2.0)
+			{
+				frameCount = std::max(uint32(gridFrameCount), 2u);
+			}
+		}
+
+		pAnimation->FrameCount = frameCount;
+
+		const auto lerpVec3 = [](const aiVector3D& value0, const aiVector3D& value1, float32 factor)
+		{
+			return glm::mix(glm::vec3(value0.x, value0.y, value0.z), glm::vec3(value1.x, value1.y, value1.z), factor);
+		};
+
+		const auto slerpQuat = [](const aiQuaternion& value0, const aiQuaternion& value1, float32 factor)
+		{
+			return glm::slerp(glm::quat(value0.w, value0.x, value0.y, value0.z), glm::quat(value1.w, value1.x, value1.y, value1.z), factor);
+		};
+
+		TArray<glm::vec3> vec3Samples;
+		TArray<glm::quat> quatSamples;
 
 		pAnimation->Channels.Resize(pAnimationAI->mNumChannels);
 		for (uint32 channelIndex = 0; channelIndex < pAnimationAI->mNumChannels; channelIndex++)
 		{
-			aiNodeAnim* pChannel = pAnimationAI->mChannels[channelIndex];
-			pAnimation->Channels[channelIndex].Name = pChannel->mNodeName.C_Str();
+			const aiNodeAnim* pChannel = pAnimationAI->mChannels[channelIndex];
+			Animation::Channel& channel = pAnimation->Channels[channelIndex];
+			channel.Name = pChannel->mNodeName.C_Str();
 
-			pAnimation->Channels[channelIndex].Positions.Resize(pChannel->mNumPositionKeys);
-			for (uint32 i = 0; i < pChannel->mNumPositionKeys; i++)
+			if (pChannel->mNumPositionKeys > 0)
 			{
-				pAnimation->Channels[channelIndex].Positions[i].Time	= pChannel->mPositionKeys[i].mTime;
-				pAnimation->Channels[channelIndex].Positions[i].Value.x	= pChannel->mPositionKeys[i].mValue.x;
-				pAnimation->Channels[channelIndex].Positions[i].Value.y = pChannel->mPositionKeys[i].mValue.y;
-				pAnimation->Channels[channelIndex].Positions[i].Value.z = pChannel->mPositionKeys[i].mValue.z;
+				ResampleKeys(pChannel->mPositionKeys, pChannel->mNumPositionKeys, pAnimation->DurationInTicks, frameCount, vec3Samples, lerpVec3);
+			}
+			else
+			{
+				vec3Samples.Assign(frameCount, glm::vec3(0.0f));
 			}
 
-			pAnimation->Channels[channelIndex].Scales.Resize(pChannel->mNumScalingKeys);
-			for (uint32 i = 0; i < pChannel->mNumScalingKeys; i++)
+			CookVec3Track(vec3Samples, channel.Positions);
+
+			if (pChannel->mNumScalingKeys > 0)
 			{
-				pAnimation->Channels[channelIndex].Scales[i].Time		= pChannel->mScalingKeys[i].mTime;
-				pAnimation->Channels[channelIndex].Scales[i].Value.x	= pChannel->mScalingKeys[i].mValue.x;
-				pAnimation->Channels[channelIndex].Scales[i].Value.y	= pChannel->mScalingKeys[i].mValue.y;
-				pAnimation->Channels[channelIndex].Scales[i].Value.z	= pChannel->mScalingKeys[i].mValue.z;
+				ResampleKeys(pChannel->mScalingKeys, pChannel->mNumScalingKeys, pAnimation->DurationInTicks, frameCount, vec3Samples, lerpVec3);
+			}
+			else
+			{
+				vec3Samples.Assign(frameCount, glm::vec3(1.0f));
 			}
 
-			pAnimation->Channels[channelIndex].Rotations.Resize(pChannel->mNumRotationKeys);
-			for (uint32 i = 0; i < pChannel->mNumRotationKeys; i++)
+			CookVec3Track(vec3Samples, channel.Scales);
+
+			if (pChannel->mNumRotationKeys > 0)
+			{
+				ResampleKeys(pChannel->mRotationKeys, pChannel->mNumRotationKeys, pAnimation->DurationInTicks, frameCount, quatSamples, slerpQuat);
+			}
+			else
 			{
-				pAnimation->Channels[channelIndex].Rotations[i].Time	= pChannel->mRotationKeys[i].mTime;
-				pAnimation->Channels[channelIndex].Rotations[i].Value.x	= pChannel->mRotationKeys[i].mValue.x;
-				pAnimation->Channels[channelIndex].Rotations[i].Value.y	= pChannel->mRotationKeys[i].mValue.y;
-				pAnimation->Channels[channelIndex].Rotations[i].Value.z	= pChannel->mRotationKeys[i].mValue.z;
-				pAnimation->Channels[channelIndex].Rotations[i].Value.w = pChannel->mRotationKeys[i].mValue.w;
+				quatSamples.Assign(frameCount, glm::identity<glm::quat>());
 			}
+
+			CookRotationTrack(quatSamples, channel.Rotations);
 		}
 
 		context.pAnimations->EmplaceBack(pAnimation);
 
 #ifdef RESOURCE_LOADER_LOGS_ENABLED
-		LOG_INFO("Loaded animation \"%s\", NumChannels=%u, Duration=%.4f ticks, TicksPerSecond=%.4f",
+		LOG_INFO("Loaded animation \"%s\", NumChannels=%u, NumFrames=%u, Duration=%.4f ticks, TicksPerSecond=%.4f",
 			pAnimation->Name.GetString().c_str(),
 			pAnimation->Channels.GetSize(),
+			pAnimation->FrameCount,
 			pAnimation->DurationInTicks,
 			pAnimation->TicksPerSecond);
 #endif
@@ -2176,14 +2559,6 @@ namespace LambdaEngine
 			return false;
 		}
 
-		Assimp::Importer importer;
-		const aiScene* pScene = importer.ReadFile(filepath, sceneLoadRequest.AssimpFlags);
-		if (!pScene || pScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !pScene->mRootNode)
-		{
-			LOG_ERROR("Failed to load scene '%s'. Error: %s", filepath.c_str(), importer.GetErrorString());
-			return false;
-		}
-
 		SceneLoadingContext context =
 		{
 			.Filename					= filepath.substr(lastPathDivisor + 1),
@@ -2197,9 +2572,31 @@ namespace LambdaEngine
 			.pAnimations				= sceneLoadRequest.pAnimations,
 			.pMaterials					= sceneLoadRequest.pMaterials,
 			.pTextures					= sceneLoadRequest.pTextures,
-			.ShouldTessellate			= sceneLoadRequest.ShouldTessellate
+			.ShouldTessellate			= sceneLoadRequest.ShouldTessellate && !EngineLoop::IsHeadless()
 		};
 
+		// Assimp only runs when the scene has not been cooked for this request or its source has changed since
+		if (SceneCache::Load(sceneLoadRequest, context))
+		{
+			return true;
+		}
+
+		// Tangents, generated texture coordinates and the vertex cache order are only used when rendering
+		int32 assimpFlags = sceneLoadRequest.AssimpFlags;
+		if (EngineLoop::IsHeadless())
+		{
+			assimpFlags &= ~(aiProcess_CalcTangentSpace | aiProcess_GenUVCoords | aiProcess_ImproveCacheLocality);
+		}
+
+		Assimp::Importer importer;
+		const aiScene* pScene = importer.ReadFile(filepath, assimpFlags);
+		if (!pScene || pScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !pScene->mRootNode)
+		{
+			LOG_ERROR("Failed to load scene '%s'. Error: %s", filepath.c_str(), importer.GetErrorString());
+			return false;
+		}
+
+
 		// Metadata
 		if (pScene->mMetaData)
 		{
@@ -2287,9 +2684,26 @@ namespace LambdaEngine
 			}
 		}
 
-		// Release MeshTessellation Buffers
-		MeshTessellator::GetInstance().ReleaseTessellationBuffers();
+		// Release MeshTessellation Buffers, loads on the streaming workers never tessellate and must not touch them
+		if (context.TessellatedMeshCount > 0)
+		{
+			MeshTessellator::GetInstance().ReleaseTessellationBuffers();
+		}
+
+		if (context.OptimizedTriangleCount > 0)
+		{
+			const float32 triangleCount = float32(context.OptimizedTriangleCount);
+			LOG_INFO("Optimized meshes of '%s': ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, vertices %u -> %u",
+				filepath.c_str(),
+				context.CacheMissesBefore / triangleCount,
+				context.CacheMissesAfter / triangleCount,
+				context.VertexCountBefore > 0 ? context.CacheMissesBefore / float32(context.VertexCountBefore) : 0.0f,
+				context.VertexCountAfter > 0 ? context.CacheMissesAfter / float32(context.VertexCountAfter) : 0.0f,
+				context.VertexCountBefore,
+				context.VertexCountAfter);
+		}
 
+		SceneCache::Store(sceneLoadRequest, context);
 		return true;
 	}
 
@@ -2379,6 +2793,7 @@ namespace LambdaEngine
 					if (tessellateMesh && pMeshAI->mNumBones == 0)
 					{
 						MeshTessellator::GetInstance().Tessellate(pMesh);
+						context.TessellatedMeshCount++;
 					}
 
 					if (context.pMaterials)
@@ -2403,7 +2818,28 @@ namespace LambdaEngine
 						}
 					}
 
-					MeshFactory::GenerateMeshlets(pMesh, MAX_VERTS, MAX_PRIMS);
+					// Meshlets are only used when rendering, and so is the order of the vertices and triangles
+					if (!EngineLoop::IsHeadless())
+					{
+						MeshOptimizationStats optimizationStats;
+						MeshFactory::OptimizeMesh(pMesh, &optimizationStats);
+
+						const uint32 triangleCount = pMesh->Indices.GetSize() / 3;
+						context.OptimizedTriangleCount	+= triangleCount;
+						context.VertexCountBefore		+= optimizationStats.VertexCountBefore;
+						context.VertexCountAfter		+= optimizationStats.VertexCountAfter;
+						context.CacheMissesBefore		+= optimizationStats.ACMRBefore * triangleCount;
+						context.CacheMissesAfter		+= optimizationStats.ACMRAfter * triangleCount;
+
+						// Skinning reads the compact vertices, this has to happen after the vertices have been reordered
+						if (pMesh->pSkeleton)
+						{
+							MeshFactory::PackVertices(pMesh);
+						}
+
+						MeshFactory::GenerateMeshlets(pMesh, MAX_VERTS, MAX_PRIMS);
+					}
+
 					context.Meshes.EmplaceBack(pMesh);
 
 					MeshComponent newMeshComponent;
@@ -2458,6 +2894,17 @@ namespace LambdaEngine
 		int32 size					= int32(source.size());
 		const char* pFinalSource	= source.c_str();
 
+		// Get Directory Path of File
+		size_t found				= filepath.find_last_of("/\\");
+		std::string directoryPath	= filepath.substr(0, found);
+
+		SHA256Hash cacheKey;
+		const bool isCacheable = ShaderCache::ComputeKey(source, directoryPath, stage, "", cacheKey);
+		if (isCacheable && ShaderCache::Load(cacheKey, pSourceSPIRV, pReflection))
+		{
+			return true;
+		}
+
 		EShLanguage shaderType = ConvertShaderStageToEShLanguage(stage);
 		glslang::TShader shader(shaderType);
 
@@ -2476,11 +2923,6 @@ namespace LambdaEngine
 		shader.setEnvTarget(glslang::EShTargetSpv, targetVersion);
 
 		DirStackFileIncluder includer;
-
-		// Get Directory Path of File
-		size_t found				= filepath.find_last_of("/\\");
-		std::string directoryPath	= filepath.substr(0, found);
-
 		includer.pushExternalLocalDirectory(directoryPath);
 
 		//std::string preprocessedGLSL;
@@ -2512,26 +2954,45 @@ namespace LambdaEngine
 
 		glslang::TIntermediate* pIntermediate = program.getIntermediate(shaderType);
 
-
-
-		if (pSourceSPIRV != nullptr)
+		// Both outputs are generated when the result is cached, so that the entry serves later requests for either
+		TArray<uint32> sourceSPIRV;
+		if (pSourceSPIRV != nullptr || isCacheable)
 		{
 			spv::SpvBuildLogger logger;
 			glslang::SpvOptions spvOptions;
 			std::vector<uint32> std_sourceSPIRV;
 			glslang::GlslangToSpv(*pIntermediate, std_sourceSPIRV, &logger, &spvOptions);
-			pSourceSPIRV->Assign(std_sourceSPIRV.data(), std_sourceSPIRV.data() + std_sourceSPIRV.size());
+			sourceSPIRV.Assign(std_sourceSPIRV.data(), std_sourceSPIRV.data() + std_sourceSPIRV.size());
 		}
 
-		if (pReflection != nullptr)
+		// Reflection that is only generated for the cache is left out of the entry if it fails
+		ShaderReflection reflection = {};
+		bool hasReflection = false;
+		if (pReflection != nullptr || isCacheable)
 		{
-			if (!CreateShaderReflection(pIntermediate, stage, pReflection))
+			hasReflection = CreateShaderReflection(pIntermediate, stage, &reflection);
+			if (!hasReflection && pReflection != nullptr)
 			{
 				LOG_ERROR("Failed to Create Shader Reflection");
 				return false;
 			}
 		}
 
+		if (isCacheable)
+		{
+			ShaderCache::Store(cacheKey, sourceSPIRV, hasReflection ? &reflection : nullptr);
+		}
+
+		if (pSourceSPIRV != nullptr)
+		{
+			*pSourceSPIRV = std::move(sourceSPIRV);
+		}
+
+		if (pReflection != nullptr)
+		{
+			*pReflection = reflection;
+		}
+
 		return true;
 	}
 
@@ -2554,8 +3015,14 @@ namespace LambdaEngine
 
 	void ResourceLoader::LoadMeshletsFromCache(const String& name, Mesh* pMesh)
 	{
+		// Bumped when meshlet generation changes, entries written before are then generated again
+		constexpr uint32 MESHLET_CACHE_MAGIC	= 0x4853454d; // "MESH"
+		constexpr uint32 MESHLET_CACHE_VERSION	= 2;
+
 		struct MeshletCacheHeader
 		{
+			uint32 Magic;
+			uint32 Version;
 			uint32 MeshletCount;
 			uint32 PrimitiveIndexCount;
 			uint32 UniqueIndexCount;
@@ -2566,39 +3033,51 @@ namespace LambdaEngine
 		std::fstream file;
 		file.open(meshletCachePath, std::fstream::in | std::fstream::binary);
 
-		// If file doesn't exist, create it. Otherwise, load meshlets from file to memory.
-		if (!file)
+		// Load meshlets from the file if it exists and was written by this version
+		if (file)
 		{
-			file.open(meshletCachePath, std::fstream::out | std::fstream::binary);
+			MeshletCacheHeader header = {};
+			file.read((char*)&header, sizeof(MeshletCacheHeader));
+			if (file && header.Magic == MESHLET_CACHE_MAGIC && header.Version == MESHLET_CACHE_VERSION)
+			{
+				pMesh->Meshlets.Resize(header.MeshletCount);
+				pMesh->MeshletBounds.Resize(header.MeshletCount);
+				pMesh->PrimitiveIndices.Resize(header.PrimitiveIndexCount);
+				pMesh->UniqueIndices.Resize(header.UniqueIndexCount);
+
+				file.read((char*)pMesh->Meshlets.GetData(), header.MeshletCount * sizeof(Meshlet));
+				file.read((char*)pMesh->MeshletBounds.GetData(), header.MeshletCount * sizeof(MeshletCullingBounds));
+				file.read((char*)pMesh->PrimitiveIndices.GetData(), header.PrimitiveIndexCount * sizeof(PackedTriangle));
+				file.read((char*)pMesh->UniqueIndices.GetData(), header.UniqueIndexCount * sizeof(uint32));
+				if (file)
+				{
+					return;
+				}
+			}
 
-			MeshFactory::GenerateMeshlets(pMesh, MAX_VERTS, MAX_PRIMS);
+			file.close();
+		}
 
-			const MeshletCacheHeader header =
-			{
-				.MeshletCount = pMesh->Meshlets.GetSize(),
-				.PrimitiveIndexCount = pMesh->PrimitiveIndices.GetSize(),
-				.UniqueIndexCount = pMesh->UniqueIndices.GetSize()
-			};
+		// Otherwise generate the meshlets and write them to the file
+		file.open(meshletCachePath, std::fstream::out | std::fstream::binary | std::fstream::trunc);
 
-			file.write((const char*)&header, sizeof(MeshletCacheHeader));
+		MeshFactory::GenerateMeshlets(pMesh, MAX_VERTS, MAX_PRIMS);
 
-			file.write((const char*)pMesh->Meshlets.GetData(), header.MeshletCount * sizeof(Meshlet));
-			file.write((const char*)pMesh->PrimitiveIndices.GetData(), header.PrimitiveIndexCount * sizeof(PackedTriangle));
-			file.write((const char*)pMesh->UniqueIndices.GetData(), header.UniqueIndexCount * sizeof(uint32));
-		}
-		else
+		const MeshletCacheHeader header =
 		{
-			MeshletCacheHeader header;
-			file.read((char*)&header, sizeof(MeshletCacheHeader));
+			.Magic = MESHLET_CACHE_MAGIC,
+			.Version = MESHLET_CACHE_VERSION,
+			.MeshletCount = pMesh->Meshlets.GetSize(),
+			.PrimitiveIndexCount = pMesh->PrimitiveIndices.GetSize(),
+			.UniqueIndexCount = pMesh->UniqueIndices.GetSize()
+		};
 
-			pMesh->Meshlets.Resize(header.MeshletCount);
-			pMesh->PrimitiveIndices.Resize(header.PrimitiveIndexCount);
-			pMesh->UniqueIndices.Resize(header.UniqueIndexCount);
+		file.write((const char*)&header, sizeof(MeshletCacheHeader));
 
-			file.read((char*)pMesh->Meshlets.GetData(), header.MeshletCount * sizeof(Meshlet));
-			file.read((char*)pMesh->PrimitiveIndices.GetData(), header.PrimitiveIndexCount * sizeof(PackedTriangle));
-			file.read((char*)pMesh->UniqueIndices.GetData(), header.UniqueIndexCount * sizeof(uint32));
-		}
+		file.write((const char*)pMesh->Meshlets.GetData(), header.MeshletCount * sizeof(Meshlet));
+		file.write((const char*)pMesh->MeshletBounds.GetData(), header.MeshletCount * sizeof(MeshletCullingBounds));
+		file.write((const char*)pMesh->PrimitiveIndices.GetData(), header.PrimitiveIndexCount * sizeof(PackedTriangle));
+		file.write((const char*)pMesh->UniqueIndices.GetData(), header.UniqueIndexCount * sizeof(uint32));
 
 		file.close();
 	}
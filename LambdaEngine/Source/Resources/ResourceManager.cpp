@@ -18,12 +18,17 @@
 
 #include "Application/API/Events/EventQueue.h"
 
+#include "Engine/EngineLoop.h"
+
+#include "Threading/API/ThreadPool.h"
+
 #include "Containers/TUniquePtr.h"
 
 #include "Resources/MeshTessellator.h"
 
 #include <assimp/postprocess.h>
 
+#include <algorithm>
 #include <utility>
 #include <unordered_set>
 
@@ -109,8 +114,23 @@ namespace LambdaEngine
 
 	TSet<GUID_Lambda> ResourceManager::s_UnloadedGUIDs;
 
+	std::unordered_map<String, StreamingRequest*>		ResourceManager::s_StreamingRequests;
+	std::unordered_map<GUID_Lambda, StreamingRequest*>	ResourceManager::s_StreamingGUIDs;
+	TArray<StreamingRequest*>							ResourceManager::s_PendingUploads;
+	TSet<GUID_Lambda>									ResourceManager::s_FailedStreamingGUIDs;
+
 	bool ResourceManager::Init()
 	{
+		// Headless engines have no graphics or audio device, only meshes, animations and CPU side materials are loaded.
+		// Texture, shader and sound loads return GUID_NONE
+		ResourceStreamer::Init();
+
+		if (EngineLoop::IsHeadless())
+		{
+			InitDefaultResources();
+			return true;
+		}
+
 		InitMaterialCreation();
 		InitDefaultResources();
 
@@ -123,11 +143,33 @@ namespace LambdaEngine
 
 	bool ResourceManager::Release()
 	{
-		EventQueue::UnregisterEventHandler<ShaderRecompileEvent>(&OnShaderRecompileEvent);
+		ResourceStreamer::Release();
 
-		ReleaseMaterialCreation();
+		// Cancelled requests are only tracked by GUID, so that is where every outstanding request is found
+		TArray<StreamingRequest*> outstandingRequests;
+		for (auto& streamingGUIDPair : s_StreamingGUIDs)
+		{
+			outstandingRequests.PushBack(streamingGUIDPair.second);
+		}
 
-		MeshTessellator::GetInstance().Release();
+		for (StreamingRequest* pRequest : outstandingRequests)
+		{
+			pRequest->IsCancelled = true;
+			CompleteStreamingRequest(pRequest);
+		}
+
+		s_StreamingRequests.clear();
+		s_StreamingGUIDs.clear();
+		s_PendingUploads.Clear();
+
+		if (!EngineLoop::IsHeadless())
+		{
+			EventQueue::UnregisterEventHandler<ShaderRecompileEvent>(&OnShaderRecompileEvent);
+
+			ReleaseMaterialCreation();
+
+			MeshTessellator::GetInstance().Release();
+		}
 
 		SAFEDELETE_ALL(s_Meshes);
 		SAFEDELETE_ALL(s_Materials);
@@ -220,12 +262,13 @@ namespace LambdaEngine
 			}
 		}
 
+		const bool headless = EngineLoop::IsHeadless();
 		for (uint32 i = 0; i < materials.GetSize(); i++)
 		{
 			LoadedMaterial* pLoadedMaterial = materials[i];
 			MaterialLoadDesc& materialLoadConfig = materialLoadConfigurations[i];
 
-			GUID_Lambda guid = RegisterLoadedMaterial(
+			GUID_Lambda guid = headless ? GUID_MATERIAL_DEFAULT : RegisterLoadedMaterial(
 				"Scene Material " + std::to_string(i),
 				pLoadedMaterial,
 				materialLoadConfig);
@@ -294,6 +337,8 @@ namespace LambdaEngine
 
 	void ResourceManager::LoadMeshFromFile(const String& filename, GUID_Lambda& meshGUID, bool shouldTessellate)
 	{
+		FinishStreaming(MESH_DIR + filename, shouldTessellate);
+
 		if (auto loadedMeshGUID = s_MeshNamesToGUIDs.find(filename); loadedMeshGUID != s_MeshNamesToGUIDs.end())
 		{
 			meshGUID = loadedMeshGUID->second;
@@ -330,6 +375,8 @@ namespace LambdaEngine
 
 	void ResourceManager::LoadMeshFromFile(const String& filename, GUID_Lambda& meshGUID, TArray<GUID_Lambda>& animations, bool shouldTessellate)
 	{
+		FinishStreaming(MESH_DIR + filename, shouldTessellate);
+
 		if (auto loadedMeshGUID = s_MeshNamesToGUIDs.find(filename); loadedMeshGUID != s_MeshNamesToGUIDs.end())
 		{
 			meshGUID = loadedMeshGUID->second;
@@ -425,7 +472,14 @@ namespace LambdaEngine
 			//	assimpFlags |= aiProcess_PopulateArmatureData;
 			//}
 
-		Mesh* pMesh = ResourceLoader::LoadMeshFromFile(MESH_DIR + filename, &materials, &textures, nullptr, assimpFlags, shouldTessellate);
+		const bool headless = EngineLoop::IsHeadless();
+		Mesh* pMesh = ResourceLoader::LoadMeshFromFile(
+			MESH_DIR + filename,
+			headless ? nullptr : &materials,
+			headless ? nullptr : &textures,
+			nullptr,
+			assimpFlags,
+			shouldTessellate);
 
 		//Spinlock
 		{
@@ -532,7 +586,14 @@ namespace LambdaEngine
 		TArray<LoadedMaterial*> materials;
 		TArray<LoadedTexture*> textures;
 		TArray<TextureView*> textureViewsToDelete;
-		Mesh* pMesh = ResourceLoader::LoadMeshFromFile(MESH_DIR + filename, &materials, &textures, &rawAnimations, assimpFlags, shouldTessellate);
+		const bool headless = EngineLoop::IsHeadless();
+		Mesh* pMesh = ResourceLoader::LoadMeshFromFile(
+			MESH_DIR + filename,
+			headless ? nullptr : &materials,
+			headless ? nullptr : &textures,
+			&rawAnimations,
+			assimpFlags,
+			shouldTessellate);
 
 		//Spinlock
 		{
@@ -694,6 +755,11 @@ namespace LambdaEngine
 		GUID_Lambda roughnessMap,
 		const MaterialProperties& properties)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_MATERIAL_DEFAULT;
+		}
+
 		auto loadedMaterialGUID = s_MaterialNamesToGUIDs.find(name);
 		if (loadedMaterialGUID != s_MaterialNamesToGUIDs.end())
 		{
@@ -789,6 +855,13 @@ namespace LambdaEngine
 		bool generateMips,
 		bool linearFilteringMips)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
+		FinishStreaming(TEXTURE_DIR + name);
+
 		auto loadedTextureGUID = s_TextureNamesToGUIDs.find(name);
 		if (loadedTextureGUID != s_TextureNamesToGUIDs.end())
 		{
@@ -839,6 +912,11 @@ namespace LambdaEngine
 		bool generateMips,
 		bool linearFilteringMips)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
 		auto loadedTextureGUID = s_TextureNamesToGUIDs.find(name);
 		if (loadedTextureGUID != s_TextureNamesToGUIDs.end())
 		{
@@ -897,12 +975,161 @@ namespace LambdaEngine
 		return LoadTextureArrayFromFile(filename, &filename, 1, format, generateMips, linearFiltering);
 	}
 
+	GUID_Lambda ResourceManager::LoadTextureFromFileAsync(
+		const String& filename,
+		EFormat format,
+		bool generateMips,
+		bool linearFilteringMips,
+		EStreamingPriority priority)
+	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
+		if (format != EFormat::FORMAT_R8G8B8A8_UNORM)
+		{
+			return LoadTextureFromFile(filename, format, generateMips, linearFilteringMips);
+		}
+
+		auto loadedTextureGUID = s_TextureNamesToGUIDs.find(filename);
+		if (loadedTextureGUID != s_TextureNamesToGUIDs.end())
+		{
+			return loadedTextureGUID->second;
+		}
+
+		const String filepath = TEXTURE_DIR + filename;
+		auto streamingRequestIt = s_StreamingRequests.find(filepath);
+		if (streamingRequestIt != s_StreamingRequests.end())
+		{
+			return streamingRequestIt->second->GUID;
+		}
+
+		StreamingRequest* pRequest = DBG_NEW StreamingRequest();
+		pRequest->Type					= EStreamingRequestType::STREAMING_REQUEST_TYPE_TEXTURE;
+		pRequest->Priority				= priority;
+		pRequest->GUID					= s_NextFreeGUID++;
+		pRequest->Name					= filename;
+		pRequest->Filepath				= filepath;
+		pRequest->Format				= format;
+		pRequest->GenerateMips			= generateMips;
+		pRequest->LinearFilteringMips	= linearFilteringMips;
+
+		s_StreamingRequests[filepath]		= pRequest;
+		s_StreamingGUIDs[pRequest->GUID]	= pRequest;
+
+		ResourceStreamer::Submit(pRequest);
+		return pRequest->GUID;
+	}
+
+	GUID_Lambda ResourceManager::LoadMeshFromFileAsync(const String& filename, EStreamingPriority priority, bool shouldTessellate)
+	{
+		if (auto loadedMeshGUID = s_MeshNamesToGUIDs.find(filename); loadedMeshGUID != s_MeshNamesToGUIDs.end())
+		{
+			return loadedMeshGUID->second;
+		}
+
+		const String filepath = MESH_DIR + filename;
+		auto streamingRequestIt = s_StreamingRequests.find(filepath);
+		if (streamingRequestIt != s_StreamingRequests.end())
+		{
+			streamingRequestIt->second->ShouldTessellate |= shouldTessellate;
+			return streamingRequestIt->second->GUID;
+		}
+
+		StreamingRequest* pRequest = DBG_NEW StreamingRequest();
+		pRequest->Type		= EStreamingRequestType::STREAMING_REQUEST_TYPE_MESH;
+		pRequest->Priority	= priority;
+		pRequest->GUID		= s_NextFreeGUID++;
+		pRequest->Name		= filename;
+		pRequest->Filepath	= filepath;
+		pRequest->ShouldTessellate = shouldTessellate;
+		pRequest->AssimpFlags =
+			aiProcess_FlipWindingOrder |
+			aiProcess_FlipUVs |
+			aiProcess_CalcTangentSpace |
+			aiProcess_FindInstances |
+			aiProcess_GenSmoothNormals |
+			aiProcess_JoinIdenticalVertices |
+			aiProcess_ImproveCacheLocality |
+			aiProcess_LimitBoneWeights |
+			aiProcess_RemoveRedundantMaterials |
+			aiProcess_Triangulate |
+			aiProcess_GenUVCoords |
+			aiProcess_FindDegenerates |
+			aiProcess_OptimizeMeshes |
+			aiProcess_OptimizeGraph |
+			aiProcess_FindInvalidData;
+
+		s_StreamingRequests[filepath]		= pRequest;
+		s_StreamingGUIDs[pRequest->GUID]	= pRequest;
+
+		ResourceStreamer::Submit(pRequest);
+		return pRequest->GUID;
+	}
+
+	void ResourceManager::TickStreaming()
+	{
+		ResourceStreamer::PopCompleted(s_PendingUploads);
+		if (s_PendingUploads.IsEmpty())
+		{
+			return;
+		}
+
+		std::stable_sort(s_PendingUploads.GetData(), s_PendingUploads.GetData() + s_PendingUploads.GetSize(), [](const StreamingRequest* pLHS, const StreamingRequest* pRHS)
+		{
+			return pLHS->Priority > pRHS->Priority;
+		});
+
+		// At least one request is completed every frame, so resources larger than the budget still get through
+		uint64 uploadedBytes	= 0;
+		uint32 completedCount	= 0;
+		for (StreamingRequest* pRequest : s_PendingUploads)
+		{
+			const uint64 uploadSize = pRequest->IsCancelled ? 0 : pRequest->UploadSizeInBytes;
+			if (uploadedBytes > 0 && uploadedBytes + uploadSize > RESOURCE_STREAMING_UPLOAD_BUDGET)
+			{
+				break;
+			}
+
+			uploadedBytes += uploadSize;
+			completedCount++;
+
+			CompleteStreamingRequest(pRequest);
+		}
+
+		s_PendingUploads.Erase(s_PendingUploads.Begin(), s_PendingUploads.Begin() + completedCount);
+	}
+
+	EResourceState ResourceManager::GetResourceState(GUID_Lambda guid)
+	{
+		if (s_StreamingGUIDs.count(guid) > 0)
+		{
+			return EResourceState::RESOURCE_STATE_LOADING;
+		}
+		else if (s_FailedStreamingGUIDs.count(guid) > 0)
+		{
+			return EResourceState::RESOURCE_STATE_FAILED;
+		}
+		else if (s_Textures.count(guid) > 0 || s_Meshes.count(guid) > 0)
+		{
+			return EResourceState::RESOURCE_STATE_READY;
+		}
+
+		return EResourceState::RESOURCE_STATE_UNKNOWN;
+	}
+
 	GUID_Lambda ResourceManager::LoadTextureCubeFromPanormaFile(
 		const String& filename,
 		EFormat format,
 		uint32 size,
 		bool generateMips)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
 		auto loadedTextureGUID = s_TextureNamesToGUIDs.find(filename);
 		if (loadedTextureGUID != s_TextureNamesToGUIDs.end())
 		{
@@ -954,6 +1181,11 @@ namespace LambdaEngine
 		bool generateMips,
 		bool linearFilteringMips)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
 		auto loadedTextureGUID = s_TextureNamesToGUIDs.find(name);
 		if (loadedTextureGUID != s_TextureNamesToGUIDs.end())
 		{
@@ -996,6 +1228,11 @@ namespace LambdaEngine
 
 	GUID_Lambda ResourceManager::LoadShaderFromFile(const String& filename, FShaderStageFlag stage, EShaderLang lang, const char* pEntryPoint)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
 		auto loadedShaderGUID = s_ShaderNamesToGUIDs.find(filename);
 		if (loadedShaderGUID != s_ShaderNamesToGUIDs.end())
 		{
@@ -1052,6 +1289,11 @@ namespace LambdaEngine
 
 	GUID_Lambda ResourceManager::LoadSoundEffect3DFromFile(const String& filename)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
 		auto loadedSoundEffectGUID = s_SoundEffect3DNamesToGUIDs.find(filename);
 		if (loadedSoundEffectGUID != s_SoundEffect3DNamesToGUIDs.end())
 		{
@@ -1075,6 +1317,11 @@ namespace LambdaEngine
 
 	GUID_Lambda ResourceManager::LoadSoundEffect2DFromFile(const String& filename)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
 		auto loadedSoundEffectGUID = s_SoundEffect2DNamesToGUIDs.find(filename);
 		if (loadedSoundEffectGUID != s_SoundEffect2DNamesToGUIDs.end())
 		{
@@ -1098,6 +1345,11 @@ namespace LambdaEngine
 
 	GUID_Lambda ResourceManager::LoadMusicFromFile(const String& filename, float32 defaultVolume, float32 defaultPitch)
 	{
+		if (EngineLoop::IsHeadless())
+		{
+			return GUID_NONE;
+		}
+
 		auto loadedMusicGUID = s_MusicNamesToGUIDs.find(filename);
 		if (loadedMusicGUID != s_MusicNamesToGUIDs.end())
 		{
@@ -1377,6 +1629,9 @@ namespace LambdaEngine
 		if (guid < SMALLEST_UNRESERVED_GUID)
 			return true;
 
+		if (CancelStreaming(guid))
+			return true;
+
 		auto meshIt = s_Meshes.find(guid);
 		if (meshIt != s_Meshes.end())
 		{
@@ -1571,6 +1826,9 @@ namespace LambdaEngine
 		if (guid < SMALLEST_UNRESERVED_GUID)
 			return true;
 
+		if (CancelStreaming(guid))
+			return true;
+
 		bool unload = false;
 		auto textureRefIt = s_TextureRefs.find(guid);
 		if (textureRefIt != s_TextureRefs.end())
@@ -2057,24 +2315,58 @@ namespace LambdaEngine
 	{
 		UNREFERENCED_VARIABLE(event);
 
+		struct ShaderRecompilation
+		{
+			GUID_Lambda				ShaderGUID;
+			const ShaderLoadDesc*	pLoadConfig;
+			TArray<uint32>			SourceSPIRV;
+			bool					Succeeded;
+		};
+
+		TArray<ShaderRecompilation> recompilations;
+		recompilations.Reserve(uint32(s_Shaders.size()));
 		for (auto it = s_Shaders.begin(); it != s_Shaders.end(); it++)
 		{
 			if (it->second != nullptr)
 			{
 				auto loadConfigIt = s_ShaderLoadConfigurations.find(it->first);
-
 				if (loadConfigIt != s_ShaderLoadConfigurations.end())
 				{
-					Shader* pShader = ResourceLoader::LoadShaderFromFile(loadConfigIt->second.Filepath, loadConfigIt->second.Stage, loadConfigIt->second.Lang, loadConfigIt->second.pEntryPoint);
-					if (pShader != nullptr)
-					{
-						SAFERELEASE(it->second);
-						it->second = pShader;
-					}
+					recompilations.PushBack({ it->first, &loadConfigIt->second, {}, false });
 				}
 			}
 		}
 
+		// Compiling is independent per shader and runs on the thread pool, the shaders are then created on this thread
+		JobCounter compileJobs;
+		for (ShaderRecompilation& recompilation : recompilations)
+		{
+			ThreadPool::Execute(compileJobs, [&recompilation]
+			{
+				const ShaderLoadDesc* pLoadConfig = recompilation.pLoadConfig;
+				recompilation.Succeeded = ResourceLoader::CompileShaderFromFile(pLoadConfig->Filepath, pLoadConfig->Stage, pLoadConfig->Lang, recompilation.SourceSPIRV);
+			});
+		}
+
+		ThreadPool::Wait(compileJobs);
+
+		for (ShaderRecompilation& recompilation : recompilations)
+		{
+			if (!recompilation.Succeeded)
+			{
+				continue;
+			}
+
+			const ShaderLoadDesc* pLoadConfig = recompilation.pLoadConfig;
+			Shader* pShader = ResourceLoader::CreateShaderFromSPIRV(pLoadConfig->Filepath, recompilation.SourceSPIRV, pLoadConfig->Stage, pLoadConfig->Lang, pLoadConfig->pEntryPoint);
+			if (pShader != nullptr)
+			{
+				Shader*& pOldShader = s_Shaders[recompilation.ShaderGUID];
+				SAFERELEASE(pOldShader);
+				pOldShader = pShader;
+			}
+		}
+
 		return true;
 	}
 
@@ -2320,6 +2612,153 @@ namespace LambdaEngine
 		return guid;
 	}
 
+	void ResourceManager::FinishStreaming(const String& filepath, bool shouldTessellate)
+	{
+		auto streamingRequestIt = s_StreamingRequests.find(filepath);
+		if (streamingRequestIt == s_StreamingRequests.end())
+		{
+			return;
+		}
+
+		StreamingRequest* pRequest = streamingRequestIt->second;
+		pRequest->ShouldTessellate |= shouldTessellate;
+
+		// A request that has been decoded but not uploaded yet is waiting in the pending uploads
+		for (uint32 i = 0; i < s_PendingUploads.GetSize(); i++)
+		{
+			if (s_PendingUploads[i] == pRequest)
+			{
+				s_PendingUploads.Erase(s_PendingUploads.Begin() + i);
+				CompleteStreamingRequest(pRequest);
+				return;
+			}
+		}
+
+		ResourceStreamer::Wait(pRequest);
+		CompleteStreamingRequest(pRequest);
+	}
+
+	void ResourceManager::CompleteStreamingRequest(StreamingRequest* pRequest)
+	{
+		const GUID_Lambda guid = pRequest->GUID;
+		bool succeeded = pRequest->Succeeded && !pRequest->IsCancelled;
+
+		if (pRequest->Type == EStreamingRequestType::STREAMING_REQUEST_TYPE_TEXTURE)
+		{
+			Texture* pTexture = nullptr;
+			if (succeeded)
+			{
+				pTexture = ResourceLoader::LoadTextureArrayFromMemory(
+					pRequest->Name,
+					&pRequest->pPixels,
+					1,
+					pRequest->Width,
+					pRequest->Height,
+					pRequest->Format,
+					FTextureFlag::TEXTURE_FLAG_SHADER_RESOURCE,
+					pRequest->GenerateMips,
+					pRequest->LinearFilteringMips);
+			}
+
+			if (pRequest->pPixels != nullptr)
+			{
+				ResourceLoader::FreePixels(pRequest->pPixels);
+			}
+
+			if (pTexture != nullptr)
+			{
+				TextureViewDesc textureViewDesc = {};
+				textureViewDesc.DebugName		= pRequest->Name + " Texture View";
+				textureViewDesc.pTexture		= pTexture;
+				textureViewDesc.Flags			= FTextureViewFlag::TEXTURE_VIEW_FLAG_SHADER_RESOURCE;
+				textureViewDesc.Format			= pRequest->Format;
+				textureViewDesc.Type			= ETextureViewType::TEXTURE_VIEW_TYPE_2D;
+				textureViewDesc.MiplevelCount	= pTexture->GetDesc().Miplevels;
+				textureViewDesc.ArrayCount		= 1;
+				textureViewDesc.Miplevel		= 0;
+				textureViewDesc.ArrayIndex		= 0;
+
+				s_Textures[guid]				= pTexture;
+				s_TextureViews[guid]			= RenderAPI::GetDevice()->CreateTextureView(&textureViewDesc);
+				s_TextureGUIDsToNames[guid]		= pRequest->Name;
+				s_TextureNamesToGUIDs.insert(std::make_pair(pRequest->Name, guid));
+				s_TextureRefs[guid]++;
+			}
+			else
+			{
+				succeeded = false;
+			}
+		}
+		else if (pRequest->Type == EStreamingRequestType::STREAMING_REQUEST_TYPE_MESH)
+		{
+			if (succeeded)
+			{
+				// The mesh was decoded untessellated, so it is optimized again once tessellation has added vertices
+				Mesh* pMesh = pRequest->pMesh;
+				if (pRequest->ShouldTessellate && pMesh->pSkeleton == nullptr && !EngineLoop::IsHeadless())
+				{
+					MeshTessellator::GetInstance().Tessellate(pMesh);
+					MeshTessellator::GetInstance().ReleaseTessellationBuffers();
+
+					MeshFactory::OptimizeMesh(pMesh);
+					MeshFactory::GenerateMeshlets(pMesh, MAX_VERTS, MAX_PRIMS);
+				}
+
+				s_Meshes[guid]				= pRequest->pMesh;
+				s_MeshGUIDsToNames[guid]	= pRequest->Name;
+				s_MeshNamesToGUIDs.insert(std::make_pair(pRequest->Name, guid));
+
+				TArray<GUID_Lambda> animations;
+				animations.Reserve(pRequest->Animations.GetSize());
+				for (Animation* pAnimation : pRequest->Animations)
+				{
+					animations.EmplaceBack(RegisterAnimation(pAnimation->Name, pAnimation));
+				}
+
+				s_FileNamesToAnimationGUIDs.insert(std::make_pair(pRequest->Name, animations));
+			}
+			else
+			{
+				SAFEDELETE(pRequest->pMesh);
+				for (Animation* pAnimation : pRequest->Animations)
+				{
+					SAFEDELETE(pAnimation);
+				}
+			}
+		}
+
+		if (!succeeded && !pRequest->IsCancelled)
+		{
+			s_FailedStreamingGUIDs.insert(guid);
+		}
+
+		// A cancelled request may have been replaced by a new request for the same file
+		auto streamingRequestIt = s_StreamingRequests.find(pRequest->Filepath);
+		if (streamingRequestIt != s_StreamingRequests.end() && streamingRequestIt->second == pRequest)
+		{
+			s_StreamingRequests.erase(streamingRequestIt);
+		}
+
+		s_StreamingGUIDs.erase(guid);
+		SAFEDELETE(pRequest);
+	}
+
+	bool ResourceManager::CancelStreaming(GUID_Lambda guid)
+	{
+		auto streamingGUIDIt = s_StreamingGUIDs.find(guid);
+		if (streamingGUIDIt == s_StreamingGUIDs.end())
+		{
+			return false;
+		}
+
+		// The request stays with the worker or in the pending uploads and is freed once it gets there. It no longer
+		// serves new loads of the file though
+		StreamingRequest* pRequest = streamingGUIDIt->second;
+		pRequest->IsCancelled = true;
+		s_StreamingRequests.erase(pRequest->Filepath);
+		return true;
+	}
+
 	GUID_Lambda ResourceManager::GetGUID(const std::unordered_map<String, GUID_Lambda>& namesToGUIDs, const String& name)
 	{
 		auto guidIt = namesToGUIDs.find(name);
@@ -2463,6 +2902,9 @@ namespace LambdaEngine
 			s_Meshes[GUID_MESH_QUAD]			= MeshFactory::CreateQuad();
 		}
 
+		// The default material is still registered without textures so level objects have a valid material GUID
+		const bool headless = EngineLoop::IsHeadless();
+		if (!headless)
 		{
 			byte defaultColor[4]				= { 255, 255, 255, 255 };
 			byte defaultNormal[4]				= { 127, 127, 255,   0 };
@@ -2539,6 +2981,7 @@ namespace LambdaEngine
 		}
 		
 		//Blue Noise
+		if (!headless)
 		{
 			String blueNoiseResourceName = "Blue Noise Array";
 			String pBlueNoiseLUTFileNames[NUM_BLUE_NOISE_LUTS];
@@ -0,0 +1,178 @@
+#include "Resources/ResourceStreamer.h"
+#include "Resources/ResourceLoader.h"
+
+#include "Rendering/Core/API/GraphicsHelpers.h"
+
+#include "Threading/API/Thread.h"
+
+#include "Log/Log.h"
+
+namespace LambdaEngine
+{
+	TArray<StreamingRequest*>	ResourceStreamer::s_Queue;
+	TArray<StreamingRequest*>	ResourceStreamer::s_Completed;
+	std::mutex					ResourceStreamer::s_Mutex;
+	std::condition_variable		ResourceStreamer::s_QueueCondition;
+	std::condition_variable		ResourceStreamer::s_CompletedCondition;
+	uint64						ResourceStreamer::s_NextSequence		= 0;
+	uint32						ResourceStreamer::s_RunningWorkerCount	= 0;
+	bool						ResourceStreamer::s_IsRunning			= false;
+
+	bool ResourceStreamer::Init()
+	{
+		std::scoped_lock<std::mutex> lock(s_Mutex);
+		s_IsRunning = true;
+
+		for (uint32 i = 0; i < RESOURCE_STREAMING_WORKER_COUNT; i++)
+		{
+			s_RunningWorkerCount++;
+			Thread::Create("ResourceStreamer", &ResourceStreamer::RunWorker, nullptr);
+		}
+
+		return true;
+	}
+
+	bool ResourceStreamer::Release()
+	{
+		std::unique_lock<std::mutex> lock(s_Mutex);
+		s_IsRunning = false;
+		s_QueueCondition.notify_all();
+
+		// Requests are owned by ResourceManager, so no worker may touch one once this returns
+		s_CompletedCondition.wait(lock, [] { return s_RunningWorkerCount == 0; });
+
+		s_Queue.Clear();
+		s_Completed.Clear();
+		return true;
+	}
+
+	void ResourceStreamer::Submit(StreamingRequest* pRequest)
+	{
+		{
+			std::scoped_lock<std::mutex> lock(s_Mutex);
+			pRequest->Sequence = s_NextSequence++;
+			s_Queue.PushBack(pRequest);
+		}
+
+		s_QueueCondition.notify_one();
+	}
+
+	void ResourceStreamer::PopCompleted(TArray<StreamingRequest*>& completed)
+	{
+		std::scoped_lock<std::mutex> lock(s_Mutex);
+		for (StreamingRequest* pRequest : s_Completed)
+		{
+			completed.PushBack(pRequest);
+		}
+
+		s_Completed.Clear();
+	}
+
+	void ResourceStreamer::Wait(StreamingRequest* pRequest)
+	{
+		std::unique_lock<std::mutex> lock(s_Mutex);
+
+		// Still queued, nobody else will touch it once it is taken out of the queue
+		for (uint32 i = 0; i < s_Queue.GetSize(); i++)
+		{
+			if (s_Queue[i] == pRequest)
+			{
+				s_Queue.Erase(s_Queue.Begin() + i);
+				lock.unlock();
+
+				Decode(pRequest);
+				return;
+			}
+		}
+
+		// Being decoded or already done, either way it ends up in the completed requests
+		StreamingRequest** ppCompleted = nullptr;
+		s_CompletedCondition.wait(lock, [&]
+		{
+			for (StreamingRequest*& pCompleted : s_Completed)
+			{
+				if (pCompleted == pRequest)
+				{
+					ppCompleted = &pCompleted;
+					return true;
+				}
+			}
+
+			return false;
+		});
+
+		s_Completed.Erase(s_Completed.Begin() + uint32(ppCompleted - s_Completed.GetData()));
+	}
+
+	void ResourceStreamer::RunWorker()
+	{
+		while (true)
+		{
+			StreamingRequest* pRequest = nullptr;
+			{
+				std::unique_lock<std::mutex> lock(s_Mutex);
+				s_QueueCondition.wait(lock, [] { return !s_IsRunning || !s_Queue.IsEmpty(); });
+
+				if (!s_IsRunning)
+				{
+					s_RunningWorkerCount--;
+					s_CompletedCondition.notify_all();
+					return;
+				}
+
+				// The queue is short, so a scan for the highest priority and oldest request is cheaper than keeping it sorted
+				uint32 bestIndex = 0;
+				for (uint32 i = 1; i < s_Queue.GetSize(); i++)
+				{
+					const StreamingRequest* pCandidate	= s_Queue[i];
+					const StreamingRequest* pBest		= s_Queue[bestIndex];
+					if (pCandidate->Priority > pBest->Priority || (pCandidate->Priority == pBest->Priority && pCandidate->Sequence < pBest->Sequence))
+					{
+						bestIndex = i;
+					}
+				}
+
+				pRequest = s_Queue[bestIndex];
+				s_Queue.Erase(s_Queue.Begin() + bestIndex);
+			}
+
+			Decode(pRequest);
+
+			{
+				std::scoped_lock<std::mutex> lock(s_Mutex);
+				s_Completed.PushBack(pRequest);
+			}
+
+			s_CompletedCondition.notify_all();
+		}
+	}
+
+	void ResourceStreamer::Decode(StreamingRequest* pRequest)
+	{
+		if (pRequest->Type == EStreamingRequestType::STREAMING_REQUEST_TYPE_TEXTURE)
+		{
+			pRequest->pPixels = ResourceLoader::LoadPixelsFromFile(pRequest->Filepath, pRequest->Width, pRequest->Height);
+			if (pRequest->pPixels != nullptr)
+			{
+				pRequest->UploadSizeInBytes	= uint64(pRequest->Width) * pRequest->Height * TextureFormatStride(pRequest->Format);
+				pRequest->Succeeded			= true;
+			}
+		}
+		else if (pRequest->Type == EStreamingRequestType::STREAMING_REQUEST_TYPE_MESH)
+		{
+			// Tessellation records GPU work and is therefore never done while streaming
+			pRequest->pMesh = ResourceLoader::LoadMeshFromFile(pRequest->Filepath, nullptr, nullptr, &pRequest->Animations, pRequest->AssimpFlags, false);
+			if (pRequest->pMesh != nullptr)
+			{
+				const Mesh* pMesh = pRequest->pMesh;
+				pRequest->UploadSizeInBytes	= uint64(pMesh->Vertices.GetSize()) * sizeof(Vertex) + uint64(pMesh->Indices.GetSize()) * sizeof(MeshIndexType);
+				pRequest->Succeeded			= true;
+			}
+		}
+
+		if (!pRequest->Succeeded)
+		{
+			LOG_ERROR("[ResourceStreamer]: Failed to stream \"%s\"", pRequest->Filepath.c_str());
+		}
+	}
+}
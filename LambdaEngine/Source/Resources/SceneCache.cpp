@@ -0,0 +1,865 @@
+#include "Resources/SceneCache.h"
+#include "Resources/ResourceLoader.h"
+#include "Resources/ResourcePaths.h"
+#include "Resources/TextureCooker.h"
+
+#include "Memory/API/PlatformMemory.h"
+
+#include "Engine/EngineLoop.h"
+
+#include "Utilities/FileUtilities.h"
+#include "Utilities/HashUtilities.h"
+#include "Utilities/SHA256.h"
+
+#include "Log/Log.h"
+
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+namespace LambdaEngine
+{
+	struct CookedSceneHeader
+	{
+		uint32		Magic;
+		uint32		Version;
+		uint64		SourceSize;
+		int64		SourceWriteTime;
+		SHA256Hash	SourceHash;
+	};
+
+	/*
+	* CookedSceneWriter - Writes through an AtomicFileWriter, so a reader never maps half a cooked scene and a failed
+	* store leaves the previous one intact
+	*/
+
+	class CookedSceneWriter
+	{
+	public:
+		CookedSceneWriter(const String& filepath)
+			: m_Writer(filepath)
+		{
+		}
+
+		template<typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			m_Writer.Write(&value, sizeof(T));
+		}
+
+		template<typename T>
+		void WriteArray(const TArray<T>& array)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			Write<uint32>(array.GetSize());
+			WriteBytes(array.GetData(), sizeof(T) * array.GetSize());
+		}
+
+		void WriteString(const String& string)
+		{
+			Write<uint32>(uint32(string.length()));
+			WriteBytes(string.data(), string.length());
+		}
+
+		void WriteBytes(const void* pData, uint64 sizeInBytes)
+		{
+			m_Writer.Write(pData, sizeInBytes);
+		}
+
+		bool Commit()
+		{
+			return m_Writer.Commit();
+		}
+
+	private:
+		AtomicFileWriter m_Writer;
+	};
+
+	/*
+	* CookedSceneReader - Reads from the mapped file, every read is bounds checked so a truncated file fails instead of crashing
+	*/
+
+	class CookedSceneReader
+	{
+	public:
+		CookedSceneReader(const void* pData, uint64 sizeInBytes)
+			: m_pData(reinterpret_cast<const byte*>(pData))
+			, m_Size(sizeInBytes)
+		{
+		}
+
+		const byte* ReadView(uint64 sizeInBytes)
+		{
+			if (sizeInBytes > m_Size - m_Offset)
+			{
+				m_Offset = m_Size;
+				return nullptr;
+			}
+
+			const byte* pView = m_pData + m_Offset;
+			m_Offset += sizeInBytes;
+			return pView;
+		}
+
+		template<typename T>
+		bool Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			const byte* pView = ReadView(sizeof(T));
+			if (!pView)
+			{
+				return false;
+			}
+
+			memcpy(&value, pView, sizeof(T));
+			return true;
+		}
+
+		template<typename T>
+		bool ReadArray(TArray<T>& array)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			uint32 count;
+			if (!Read(count))
+			{
+				return false;
+			}
+
+			const byte* pView = ReadView(uint64(count) * sizeof(T));
+			if (!pView)
+			{
+				return false;
+			}
+
+			array.Resize(count);
+			memcpy(array.GetData(), pView, sizeof(T) * count);
+			return true;
+		}
+
+		bool ReadString(String& string)
+		{
+			uint32 length;
+			if (!Read(length))
+			{
+				return false;
+			}
+
+			const byte* pView = ReadView(length);
+			if (!pView)
+			{
+				return false;
+			}
+
+			string.assign(reinterpret_cast<const char*>(pView), length);
+			return true;
+		}
+
+		bool ReadPrehashedString(PrehashedString& string)
+		{
+			String value;
+			if (!ReadString(value))
+			{
+				return false;
+			}
+
+			string = PrehashedString(value);
+			return true;
+		}
+
+	private:
+		const byte*	m_pData;
+		uint64		m_Size;
+		uint64		m_Offset = 0;
+	};
+
+	/*
+	* Helpers
+	*/
+
+	static bool HashSourceFile(const String& filepath, SHA256Hash& hash)
+	{
+		std::ifstream file(filepath, std::ifstream::in | std::ifstream::binary);
+		if (!file)
+		{
+			return false;
+		}
+
+		SHA256 sha = SHA256();
+		sha.Init();
+
+		constexpr uint32 CHUNK_SIZE = 64 * 1024;
+		TArray<byte> chunk(CHUNK_SIZE);
+		while (file)
+		{
+			file.read(reinterpret_cast<char*>(chunk.GetData()), CHUNK_SIZE);
+			const std::streamsize bytesRead = file.gcount();
+			if (bytesRead > 0)
+			{
+				sha.Update(chunk.GetData(), uint32(bytesRead));
+			}
+		}
+
+		memset(hash.Data, 0, DIGEST_SIZE);
+		sha.Final(hash.Data);
+		return true;
+	}
+
+	static bool GetSourceFileInfo(const String& filepath, uint64& size, int64& writeTime)
+	{
+		std::error_code error;
+		size = uint64(std::filesystem::file_size(filepath, error));
+		if (error)
+		{
+			return false;
+		}
+
+		writeTime = int64(std::filesystem::last_write_time(filepath, error).time_since_epoch().count());
+		return !error;
+	}
+
+	/*
+	* File textures are cooked once no matter how many scenes use them, embedded textures once per cooked scene. A texture
+	* is only cooked again if its DDS is older than the file its pixels come from
+	*/
+	static bool CookSceneTexture(const LoadedTextureSource& source, const String& directoryPath, const String& cookedScenePath, int64 sceneWriteTime, String& cookedTexturePath)
+	{
+		const bool isNormalMap	= (source.pTexture->Flags & LOADED_TEXTURE_FLAG_NORMAL) != 0;
+		const bool isEmbedded	= source.Width > 0;
+		const String filepath	= directoryPath + source.Name;
+
+		CookedTextureDesc desc = {};
+		size_t key = 0;
+		if (isEmbedded)
+		{
+			key = std::hash<String>()(cookedScenePath);
+			HashCombine<String>(key, source.Name);
+		}
+		else
+		{
+			key = std::hash<String>()(filepath);
+			if (!GetSourceFileInfo(filepath, desc.SourceSize, desc.SourceWriteTime))
+			{
+				return false;
+			}
+		}
+
+		HashCombine<bool>(key, isNormalMap);
+
+		cookedTexturePath = COOKED_TEXTURE_DIR + ToHexString(&key, sizeof(key)) + ".dds";
+
+		// Embedded pixels can only have changed along with the scene file
+		const int64 writeTime = isEmbedded ? sceneWriteTime : desc.SourceWriteTime;
+		if (TextureCooker::IsUpToDate(cookedTexturePath, desc.SourceSize, desc.SourceWriteTime, writeTime))
+		{
+			return true;
+		}
+
+		TArray<byte> data;
+		if (isEmbedded)
+		{
+			TextureCooker::Cook(source.EmbeddedPixels.GetData(), source.Width, source.Height, isNormalMap, desc, data);
+		}
+		else
+		{
+			uint32 width	= 0;
+			uint32 height	= 0;
+			void* pPixels = ResourceLoader::LoadPixelsFromFile(filepath, width, height);
+			if (pPixels == nullptr)
+			{
+				return false;
+			}
+
+			TextureCooker::Cook(reinterpret_cast<const byte*>(pPixels), width, height, isNormalMap, desc, data);
+			ResourceLoader::FreePixels(pPixels);
+		}
+
+		return TextureCooker::Write(cookedTexturePath, desc, data);
+	}
+
+	static void WriteVec3Track(CookedSceneWriter& writer, const Animation::Vec3Track& track)
+	{
+		writer.Write(track.Min);
+		writer.Write(track.Extent);
+		writer.WriteArray(track.Values);
+	}
+
+	static bool ReadVec3Track(CookedSceneReader& reader, Animation::Vec3Track& track)
+	{
+		return reader.Read(track.Min) && reader.Read(track.Extent) && reader.ReadArray(track.Values);
+	}
+
+	static void WriteMesh(CookedSceneWriter& writer, const Mesh* pMesh)
+	{
+		writer.Write(pMesh->DefaultPosition);
+		writer.Write(pMesh->DefaultRotation);
+		writer.Write(pMesh->DefaultScale);
+		writer.Write(pMesh->BoundingBox);
+		writer.WriteArray(pMesh->Vertices);
+		writer.WriteArray(pMesh->PackedVertices);
+		writer.Write(pMesh->PackedPositionMin);
+		writer.Write(pMesh->PackedPositionExtent);
+		writer.WriteArray(pMesh->VertexJointData);
+		writer.WriteArray(pMesh->Indices);
+		writer.WriteArray(pMesh->UniqueIndices);
+		writer.WriteArray(pMesh->PrimitiveIndices);
+		writer.WriteArray(pMesh->Meshlets);
+		writer.WriteArray(pMesh->MeshletBounds);
+
+		const Skeleton* pSkeleton = pMesh->pSkeleton;
+		writer.Write<uint8>(pSkeleton ? 1 : 0);
+		if (pSkeleton)
+		{
+			writer.Write(pSkeleton->InverseGlobalTransform);
+			writer.Write(pSkeleton->SkinTransform);
+			writer.Write(pSkeleton->RootNodeTransform);
+			writer.Write(pSkeleton->RootJoint);
+
+			writer.Write<uint32>(pSkeleton->Joints.GetSize());
+			for (const Joint& joint : pSkeleton->Joints)
+			{
+				writer.Write(joint.InvBindTransform);
+				writer.WriteString(joint.Name.GetString());
+				writer.Write(joint.ParentBoneIndex);
+			}
+
+			writer.WriteArray(pSkeleton->RelativeTransforms);
+			writer.WriteArray(pSkeleton->EvaluationOrder);
+			writer.WriteArray(pSkeleton->JointDepths);
+		}
+	}
+
+	static Mesh* ReadMesh(CookedSceneReader& reader)
+	{
+		Mesh* pMesh = DBG_NEW Mesh();
+		bool result =
+			reader.Read(pMesh->DefaultPosition) &&
+			reader.Read(pMesh->DefaultRotation) &&
+			reader.Read(pMesh->DefaultScale) &&
+			reader.Read(pMesh->BoundingBox) &&
+			reader.ReadArray(pMesh->Vertices) &&
+			reader.ReadArray(pMesh->PackedVertices) &&
+			reader.Read(pMesh->PackedPositionMin) &&
+			reader.Read(pMesh->PackedPositionExtent) &&
+			reader.ReadArray(pMesh->VertexJointData) &&
+			reader.ReadArray(pMesh->Indices) &&
+			reader.ReadArray(pMesh->UniqueIndices) &&
+			reader.ReadArray(pMesh->PrimitiveIndices) &&
+			reader.ReadArray(pMesh->Meshlets) &&
+			reader.ReadArray(pMesh->MeshletBounds);
+
+		uint8 hasSkeleton = 0;
+		result = result && reader.Read(hasSkeleton);
+		if (result && hasSkeleton)
+		{
+			Skeleton* pSkeleton = DBG_NEW Skeleton();
+			pMesh->pSkeleton = pSkeleton;
+
+			uint32 jointCount = 0;
+			result =
+				reader.Read(pSkeleton->InverseGlobalTransform) &&
+				reader.Read(pSkeleton->SkinTransform) &&
+				reader.Read(pSkeleton->RootNodeTransform) &&
+				reader.Read(pSkeleton->RootJoint) &&
+				reader.Read(jointCount);
+
+			if (result)
+			{
+				pSkeleton->Joints.Resize(jointCount);
+				for (uint32 jointIndex = 0; jointIndex < jointCount && result; jointIndex++)
+				{
+					Joint& joint = pSkeleton->Joints[jointIndex];
+					result =
+						reader.Read(joint.InvBindTransform) &&
+						reader.ReadPrehashedString(joint.Name) &&
+						reader.Read(joint.ParentBoneIndex);
+
+					pSkeleton->JointMap[joint.Name] = JointIndexType(jointIndex);
+				}
+			}
+
+			result = result &&
+				reader.ReadArray(pSkeleton->RelativeTransforms) &&
+				reader.ReadArray(pSkeleton->EvaluationOrder) &&
+				reader.ReadArray(pSkeleton->JointDepths);
+		}
+
+		if (!result)
+		{
+			SAFEDELETE(pMesh);
+		}
+
+		return pMesh;
+	}
+
+	static void WriteAnimation(CookedSceneWriter& writer, const Animation* pAnimation)
+	{
+		writer.WriteString(pAnimation->Name.GetString());
+		writer.Write(pAnimation->DurationInTicks);
+		writer.Write(pAnimation->TicksPerSecond);
+		writer.Write(pAnimation->FrameCount);
+
+		writer.Write<uint32>(pAnimation->Channels.GetSize());
+		for (const Animation::Channel& channel : pAnimation->Channels)
+		{
+			writer.WriteString(channel.Name.GetString());
+			WriteVec3Track(writer, channel.Positions);
+			WriteVec3Track(writer, channel.Scales);
+			writer.WriteArray(channel.Rotations.Values);
+		}
+	}
+
+	static Animation* ReadAnimation(CookedSceneReader& reader)
+	{
+		Animation* pAnimation = DBG_NEW Animation();
+
+		uint32 channelCount = 0;
+		bool result =
+			reader.ReadPrehashedString(pAnimation->Name) &&
+			reader.Read(pAnimation->DurationInTicks) &&
+			reader.Read(pAnimation->TicksPerSecond) &&
+			reader.Read(pAnimation->FrameCount) &&
+			reader.Read(channelCount);
+
+		if (result)
+		{
+			pAnimation->Channels.Resize(channelCount);
+			for (Animation::Channel& channel : pAnimation->Channels)
+			{
+				result =
+					reader.ReadPrehashedString(channel.Name) &&
+					ReadVec3Track(reader, channel.Positions) &&
+					ReadVec3Track(reader, channel.Scales) &&
+					reader.ReadArray(channel.Rotations.Values);
+
+				if (!result)
+				{
+					break;
+				}
+			}
+		}
+
+		if (!result)
+		{
+			SAFEDELETE(pAnimation);
+		}
+
+		return pAnimation;
+	}
+
+	/*
+	* SceneCache
+	*/
+
+	bool SceneCache::Load(const SceneLoadRequest& request, SceneLoadingContext& context)
+	{
+		if (!CanCache(context))
+		{
+			return false;
+		}
+
+		const String cookedPath = GetCookedScenePath(request, context);
+
+		uint64 sizeInBytes = 0;
+		const void* pMapping = PlatformMemory::MapFile(cookedPath.c_str(), sizeInBytes);
+		if (!pMapping)
+		{
+			return false;
+		}
+
+		CookedSceneReader reader(pMapping, sizeInBytes);
+
+		// The hash of the source is only computed when its size or write time differ from when it was cooked
+		CookedSceneHeader header;
+		uint64	sourceSize		= 0;
+		int64	sourceWriteTime	= 0;
+		bool result =
+			reader.Read(header) &&
+			header.Magic == COOKED_SCENE_MAGIC &&
+			header.Version == COOKED_SCENE_VERSION &&
+			GetSourceFileInfo(request.Filepath, sourceSize, sourceWriteTime);
+
+		if (result && (header.SourceSize != sourceSize || header.SourceWriteTime != sourceWriteTime))
+		{
+			SHA256Hash sourceHash;
+			result = HashSourceFile(request.Filepath, sourceHash) && sourceHash == header.SourceHash;
+		}
+
+		if (!result)
+		{
+			PlatformMemory::UnmapFile(pMapping, sizeInBytes);
+			return false;
+		}
+
+		// Everything is read into local arrays first, so a corrupt file does not leave a partially loaded scene behind
+		struct CookedTexture
+		{
+			String	Name;
+			String	CookedPath;
+			uint32	Flags			= 0;
+			bool	IsFromFile		= false;
+		};
+
+		struct CookedMaterial
+		{
+			MaterialProperties	Properties;
+			int32				TextureIndices[6];
+		};
+
+		TArray<LoadedDirectionalLight>	directionalLights;
+		TArray<LoadedPointLight>		pointLights;
+		TArray<CookedTexture>			textures;
+		TArray<CookedMaterial>			materials;
+		TArray<Mesh*>					meshes;
+		TArray<MeshComponent>			meshComponents;
+		TArray<LevelObjectOnLoad>		levelObjects;
+		TArray<Animation*>				animations;
+
+		uint32 count = 0;
+		result = reader.Read(count);
+		for (uint32 i = 0; i < count && result; i++)
+		{
+			LoadedDirectionalLight& light = directionalLights.PushBack({});
+			result = reader.ReadString(light.Name) && reader.Read(light.ColorIntensity) && reader.Read(light.Direction);
+		}
+
+		result = result && reader.Read(count);
+		for (uint32 i = 0; i < count && result; i++)
+		{
+			LoadedPointLight& light = pointLights.PushBack({});
+			result =
+				reader.ReadString(light.Name) &&
+				reader.Read(light.ColorIntensity) &&
+				reader.Read(light.Position) &&
+				reader.Read(light.Attenuation);
+		}
+
+		result = result && reader.Read(count);
+		for (uint32 i = 0; i < count && result; i++)
+		{
+			// Every texture lives in a cooked texture of its own, the cooked scene only refers to it
+			CookedTexture& texture = textures.PushBack({});
+			result =
+				reader.ReadString(texture.Name) &&
+				reader.ReadString(texture.CookedPath) &&
+				reader.Read(texture.Flags) &&
+				reader.Read(texture.IsFromFile);
+		}
+
+		result = result && reader.Read(count);
+		for (uint32 i = 0; i < count && result; i++)
+		{
+			CookedMaterial& material = materials.PushBack({});
+			result = reader.Read(material.Properties) && reader.Read(material.TextureIndices);
+			for (int32 textureIndex : material.TextureIndices)
+			{
+				result = result && textureIndex < int32(textures.GetSize());
+			}
+		}
+
+		result = result && reader.Read(count);
+		for (uint32 i = 0; i < count && result; i++)
+		{
+			Mesh* pMesh = ReadMesh(reader);
+			result = pMesh != nullptr;
+			if (result)
+			{
+				meshes.PushBack(pMesh);
+			}
+		}
+
+		result = result && reader.ReadArray(meshComponents);
+
+		result = result && reader.Read(count);
+		for (uint32 i = 0; i < count && result; i++)
+		{
+			LevelObjectOnLoad& levelObject = levelObjects.PushBack({});
+			result =
+				reader.ReadString(levelObject.Prefix) &&
+				reader.ReadString(levelObject.Name) &&
+				reader.ReadArray(levelObject.BoundingBoxes) &&
+				reader.ReadArray(levelObject.MeshComponents) &&
+				reader.Read(levelObject.DefaultPosition) &&
+				reader.Read(levelObject.DefaultRotation) &&
+				reader.Read(levelObject.DefaultScale);
+		}
+
+		result = result && reader.Read(count);
+		for (uint32 i = 0; i < count && result; i++)
+		{
+			Animation* pAnimation = ReadAnimation(reader);
+			result = pAnimation != nullptr;
+			if (result)
+			{
+				animations.PushBack(pAnimation);
+			}
+		}
+
+		if (!result)
+		{
+			LOG_WARNING("Cooked scene '%s' is corrupt, loading '%s' with Assimp", cookedPath.c_str(), request.Filepath.c_str());
+
+			for (Mesh* pMesh : meshes)
+			{
+				SAFEDELETE(pMesh);
+			}
+
+			for (Animation* pAnimation : animations)
+			{
+				SAFEDELETE(pAnimation);
+			}
+
+			PlatformMemory::UnmapFile(pMapping, sizeInBytes);
+			return false;
+		}
+
+		// The request decides what is handed out, the cooked scene was written for exactly this request
+		if (context.pTextures && context.pMaterials)
+		{
+			// A texture whose source has changed or whose cooked file is gone fails the whole scene, which is then cooked again
+			TArray<Texture*> loadedTextures;
+			for (uint32 i = 0; i < textures.GetSize() && result; i++)
+			{
+				const CookedTexture& texture = textures[i];
+
+				uint64	sourceSize		= 0;
+				int64	sourceWriteTime	= 0;
+				if (texture.IsFromFile)
+				{
+					result = GetSourceFileInfo(context.DirectoryPath + texture.Name, sourceSize, sourceWriteTime);
+				}
+
+				Texture* pTexture = result ? TextureCooker::Load(texture.CookedPath, texture.Name, sourceSize, sourceWriteTime) : nullptr;
+				result = pTexture != nullptr;
+				if (result)
+				{
+					loadedTextures.PushBack(pTexture);
+				}
+			}
+
+			if (!result)
+			{
+				LOG_WARNING("Cooked textures of '%s' are out of date, loading '%s' with Assimp", cookedPath.c_str(), request.Filepath.c_str());
+
+				for (Texture* pTexture : loadedTextures)
+				{
+					SAFERELEASE(pTexture);
+				}
+
+				for (Mesh* pMesh : meshes)
+				{
+					SAFEDELETE(pMesh);
+				}
+
+				for (Animation* pAnimation : animations)
+				{
+					SAFEDELETE(pAnimation);
+				}
+
+				PlatformMemory::UnmapFile(pMapping, sizeInBytes);
+				return false;
+			}
+
+			for (uint32 i = 0; i < textures.GetSize(); i++)
+			{
+				LoadedTexture* pLoadedTexture = DBG_NEW LoadedTexture();
+				pLoadedTexture->pTexture	= loadedTextures[i];
+				pLoadedTexture->Flags		= textures[i].Flags;
+				context.pTextures->PushBack(pLoadedTexture);
+			}
+
+			for (const CookedMaterial& material : materials)
+			{
+				const auto getTexture = [&](uint32 slot) { return material.TextureIndices[slot] >= 0 ? (*context.pTextures)[material.TextureIndices[slot]] : nullptr; };
+
+				LoadedMaterial* pMaterial = DBG_NEW LoadedMaterial();
+				pMaterial->Properties				= material.Properties;
+				pMaterial->pAlbedoMap				= getTexture(0);
+				pMaterial->pNormalMap				= getTexture(1);
+				pMaterial->pAmbientOcclusionMap		= getTexture(2);
+				pMaterial->pMetallicMap				= getTexture(3);
+				pMaterial->pRoughnessMap			= getTexture(4);
+				pMaterial->pMetallicRoughnessMap	= getTexture(5);
+				context.pMaterials->PushBack(pMaterial);
+			}
+		}
+
+		PlatformMemory::UnmapFile(pMapping, sizeInBytes);
+
+		context.DirectionalLights	= std::move(directionalLights);
+		context.PointLights			= std::move(pointLights);
+		context.Meshes				= std::move(meshes);
+		context.MeshComponents		= std::move(meshComponents);
+		context.LevelObjects		= std::move(levelObjects);
+
+		if (context.pAnimations)
+		{
+			*context.pAnimations = std::move(animations);
+		}
+		else
+		{
+			for (Animation* pAnimation : animations)
+			{
+				SAFEDELETE(pAnimation);
+			}
+		}
+
+		return true;
+	}
+
+	void SceneCache::Store(const SceneLoadRequest& request, const SceneLoadingContext& context)
+	{
+		if (!CanCache(context))
+		{
+			return;
+		}
+
+		CookedSceneHeader header = {};
+		header.Magic	= COOKED_SCENE_MAGIC;
+		header.Version	= COOKED_SCENE_VERSION;
+		if (!GetSourceFileInfo(request.Filepath, header.SourceSize, header.SourceWriteTime) || !HashSourceFile(request.Filepath, header.SourceHash))
+		{
+			return;
+		}
+
+		const String cookedPath = GetCookedScenePath(request, context);
+
+		// Textures are cooked first, a scene is only stored if all of its textures could be cooked
+		TArray<String> cookedTexturePaths;
+		for (const LoadedTextureSource& source : context.TextureSources)
+		{
+			String& cookedTexturePath = cookedTexturePaths.PushBack({});
+			if (!CookSceneTexture(source, context.DirectoryPath, cookedPath, header.SourceWriteTime, cookedTexturePath))
+			{
+				LOG_WARNING("Failed to cook texture '%s' of '%s'", source.Name.c_str(), request.Filepath.c_str());
+				return;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::create_directories(COOKED_SCENE_DIR, error);
+
+		CookedSceneWriter writer(cookedPath);
+		writer.Write(header);
+
+		writer.Write<uint32>(context.DirectionalLights.GetSize());
+		for (const LoadedDirectionalLight& light : context.DirectionalLights)
+		{
+			writer.WriteString(light.Name);
+			writer.Write(light.ColorIntensity);
+			writer.Write(light.Direction);
+		}
+
+		writer.Write<uint32>(context.PointLights.GetSize());
+		for (const LoadedPointLight& light : context.PointLights)
+		{
+			writer.WriteString(light.Name);
+			writer.Write(light.ColorIntensity);
+			writer.Write(light.Position);
+			writer.Write(light.Attenuation);
+		}
+
+		// Sources are recorded in the same order as the loaded textures
+		THashTable<const LoadedTexture*, int32> textureIndices;
+		writer.Write<uint32>(context.TextureSources.GetSize());
+		for (uint32 textureIndex = 0; textureIndex < context.TextureSources.GetSize(); textureIndex++)
+		{
+			const LoadedTextureSource& source = context.TextureSources[textureIndex];
+			textureIndices[source.pTexture] = int32(textureIndex);
+
+			writer.WriteString(source.Name);
+			writer.WriteString(cookedTexturePaths[textureIndex]);
+			writer.Write<uint32>(source.pTexture->Flags);
+			writer.Write<bool>(source.Width == 0);
+		}
+
+		const uint32 materialCount = context.pMaterials ? context.pMaterials->GetSize() : 0;
+		writer.Write<uint32>(materialCount);
+		for (uint32 materialIndex = 0; materialIndex < materialCount; materialIndex++)
+		{
+			const LoadedMaterial* pMaterial = (*context.pMaterials)[materialIndex];
+			const LoadedTexture* pTextures[6] =
+			{
+				pMaterial->pAlbedoMap,
+				pMaterial->pNormalMap,
+				pMaterial->pAmbientOcclusionMap,
+				pMaterial->pMetallicMap,
+				pMaterial->pRoughnessMap,
+				pMaterial->pMetallicRoughnessMap
+			};
+
+			int32 indices[6];
+			for (uint32 slot = 0; slot < 6; slot++)
+			{
+				auto it = textureIndices.find(pTextures[slot]);
+				indices[slot] = it != textureIndices.end() ? it->second : -1;
+			}
+
+			writer.Write(pMaterial->Properties);
+			writer.Write(indices);
+		}
+
+		writer.Write<uint32>(context.Meshes.GetSize());
+		for (const Mesh* pMesh : context.Meshes)
+		{
+			WriteMesh(writer, pMesh);
+		}
+
+		writer.WriteArray(context.MeshComponents);
+
+		writer.Write<uint32>(context.LevelObjects.GetSize());
+		for (const LevelObjectOnLoad& levelObject : context.LevelObjects)
+		{
+			writer.WriteString(levelObject.Prefix);
+			writer.WriteString(levelObject.Name);
+			writer.WriteArray(levelObject.BoundingBoxes);
+			writer.WriteArray(levelObject.MeshComponents);
+			writer.Write(levelObject.DefaultPosition);
+			writer.Write(levelObject.DefaultRotation);
+			writer.Write(levelObject.DefaultScale);
+		}
+
+		const uint32 animationCount = context.pAnimations ? context.pAnimations->GetSize() : 0;
+		writer.Write<uint32>(animationCount);
+		for (uint32 animationIndex = 0; animationIndex < animationCount; animationIndex++)
+		{
+			WriteAnimation(writer, (*context.pAnimations)[animationIndex]);
+		}
+
+		if (!writer.Commit())
+		{
+			LOG_WARNING("Failed to write cooked scene '%s'", cookedPath.c_str());
+		}
+	}
+
+	bool SceneCache::CanCache(const SceneLoadingContext& context)
+	{
+		// Mesh and material GUIDs are indices into the outputs, so they only match the cooked scene if the outputs start out empty
+		return
+			context.Meshes.IsEmpty() &&
+			context.MeshComponents.IsEmpty() &&
+			context.LevelObjects.IsEmpty() &&
+			context.DirectionalLights.IsEmpty() &&
+			context.PointLights.IsEmpty() &&
+			(!context.pAnimations || context.pAnimations->IsEmpty()) &&
+			(!context.pMaterials || context.pMaterials->IsEmpty()) &&
+			(!context.pTextures || context.pTextures->IsEmpty());
+	}
+
+	String SceneCache::GetCookedScenePath(const SceneLoadRequest& request, const SceneLoadingContext& context)
+	{
+		size_t key = std::hash<String>()(request.Filepath);
+		HashCombine<int32>(key, request.AssimpFlags);
+		HashCombine<bool>(key, request.AnimationsOnly);
+		HashCombine<bool>(key, context.ShouldTessellate);
+		HashCombine<bool>(key, context.pMaterials != nullptr);
+		HashCombine<bool>(key, context.pAnimations != nullptr);
+		HashCombine<bool>(key, EngineLoop::IsHeadless());
+		for (const LevelObjectOnLoadDesc& levelObjectDesc : request.LevelObjectDescriptions)
+		{
+			HashCombine<String>(key, levelObjectDesc.Prefix);
+		}
+
+		return COOKED_SCENE_DIR + context.Filename + "." + ToHexString(&key, sizeof(key)) + ".cooked";
+	}
+}
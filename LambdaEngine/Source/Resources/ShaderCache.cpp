@@ -0,0 +1,204 @@
+#include "Resources/ShaderCache.h"
+#include "Resources/ResourcePaths.h"
+
+#include "Rendering/Core/API/Shader.h"
+
+#include "Utilities/FileUtilities.h"
+
+#include "Log/Log.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+// Deeper include chains than this are assumed to be recursive
+#define SHADER_CACHE_MAX_INCLUDE_DEPTH 32
+
+namespace LambdaEngine
+{
+	struct ShaderCacheHeader
+	{
+		uint32				Magic;
+		uint32				Version;
+		uint32				HasReflection;
+		uint32				WordCount;
+		ShaderReflection	Reflection;
+	};
+
+	static bool ReadTextFile(const String& filepath, String& text)
+	{
+		std::ifstream file(filepath, std::ifstream::in | std::ifstream::binary);
+		if (!file)
+		{
+			return false;
+		}
+
+		std::stringstream stream;
+		stream << file.rdbuf();
+		text = stream.str();
+		return true;
+	}
+
+	bool ShaderCache::ComputeKey(const String& source, const String& directory, FShaderStageFlags stage, const String& defines, SHA256Hash& key)
+	{
+		String expanded;
+		if (!ExpandIncludes(source, directory, directory, 0, expanded))
+		{
+			return false;
+		}
+
+		const uint32 version = SHADER_CACHE_VERSION;
+
+		SHA256 sha = SHA256();
+		sha.Init();
+		sha.Update(reinterpret_cast<const byte*>(&version), sizeof(version));
+		sha.Update(reinterpret_cast<const byte*>(&stage), sizeof(stage));
+		sha.Update(reinterpret_cast<const byte*>(defines.c_str()), uint32(defines.length() + 1));
+		sha.Update(reinterpret_cast<const byte*>(expanded.c_str()), uint32(expanded.length()));
+
+		memset(key.Data, 0, DIGEST_SIZE);
+		sha.Final(key.Data);
+		return true;
+	}
+
+	bool ShaderCache::Load(const SHA256Hash& key, TArray<uint32>* pSourceSPIRV, ShaderReflection* pReflection)
+	{
+		// An entry with reflection data serves requests that only want SPIR-V as well
+		if (pReflection == nullptr && LoadEntry(GetEntryPath(key, false), pSourceSPIRV, nullptr))
+		{
+			return true;
+		}
+
+		return LoadEntry(GetEntryPath(key, true), pSourceSPIRV, pReflection);
+	}
+
+	bool ShaderCache::LoadEntry(const String& entryPath, TArray<uint32>* pSourceSPIRV, ShaderReflection* pReflection)
+	{
+		std::ifstream file(entryPath, std::ifstream::in | std::ifstream::binary);
+		if (!file)
+		{
+			return false;
+		}
+
+		ShaderCacheHeader header;
+		file.read(reinterpret_cast<char*>(&header), sizeof(ShaderCacheHeader));
+		if (!file || header.Magic != SHADER_CACHE_MAGIC || header.Version != SHADER_CACHE_VERSION || header.WordCount == 0)
+		{
+			return false;
+		}
+
+		if (pReflection)
+		{
+			if (!header.HasReflection)
+			{
+				return false;
+			}
+
+			*pReflection = header.Reflection;
+		}
+
+		if (pSourceSPIRV)
+		{
+			pSourceSPIRV->Resize(header.WordCount);
+			file.read(reinterpret_cast<char*>(pSourceSPIRV->GetData()), std::streamsize(sizeof(uint32) * header.WordCount));
+			if (!file)
+			{
+				pSourceSPIRV->Clear();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void ShaderCache::Store(const SHA256Hash& key, const TArray<uint32>& sourceSPIRV, const ShaderReflection* pReflection)
+	{
+		std::error_code error;
+		std::filesystem::create_directories(SHADER_CACHE_DIR, error);
+
+		ShaderCacheHeader header = {};
+		header.Magic			= SHADER_CACHE_MAGIC;
+		header.Version			= SHADER_CACHE_VERSION;
+		header.HasReflection	= pReflection ? 1 : 0;
+		header.WordCount		= sourceSPIRV.GetSize();
+		if (pReflection)
+		{
+			header.Reflection = *pReflection;
+		}
+
+		// Threads compiling the same shader never see half an entry
+		const String entryPath = GetEntryPath(key, pReflection != nullptr);
+		AtomicFileWriter writer(entryPath);
+		writer.Write(&header, sizeof(ShaderCacheHeader));
+		writer.Write(sourceSPIRV.GetData(), sizeof(uint32) * sourceSPIRV.GetSize());
+		if (!writer.Commit())
+		{
+			LOG_WARNING("[ShaderCache]: Failed to write \"%s\"", entryPath.c_str());
+		}
+	}
+
+	bool ShaderCache::ExpandIncludes(const String& source, const String& directory, const String& rootDirectory, uint32 depth, String& expanded)
+	{
+		if (depth > SHADER_CACHE_MAX_INCLUDE_DEPTH)
+		{
+			return false;
+		}
+
+		expanded.reserve(expanded.size() + source.size());
+
+		size_t lineStart = 0;
+		while (lineStart < source.size())
+		{
+			size_t lineEnd = source.find('\n', lineStart);
+			if (lineEnd == String::npos)
+			{
+				lineEnd = source.size();
+			}
+
+			const size_t directive = source.find_first_not_of(" \t", lineStart);
+			if (directive < lineEnd && source.compare(directive, 8, "#include") == 0)
+			{
+				const size_t nameStart	= source.find_first_of("\"<", directive + 8);
+				const size_t nameEnd	= nameStart < lineEnd ? source.find_first_of("\">", nameStart + 1) : String::npos;
+				if (nameEnd >= lineEnd)
+				{
+					return false;
+				}
+
+				// Includes are looked up next to the including file first and then next to the shader, like the compiler does
+				const String name = source.substr(nameStart + 1, nameEnd - nameStart - 1);
+				String includePath = directory + "/" + name;
+				String includeSource;
+				if (!ReadTextFile(includePath, includeSource))
+				{
+					includePath = rootDirectory + "/" + name;
+					if (!ReadTextFile(includePath, includeSource))
+					{
+						return false;
+					}
+				}
+
+				const size_t includeDirectoryEnd = includePath.find_last_of("/\\");
+				if (!ExpandIncludes(includeSource, includePath.substr(0, includeDirectoryEnd), rootDirectory, depth + 1, expanded))
+				{
+					return false;
+				}
+
+				expanded += '\n';
+			}
+			else
+			{
+				expanded.append(source, lineStart, lineEnd - lineStart + 1);
+			}
+
+			lineStart = lineEnd + 1;
+		}
+
+		return true;
+	}
+
+	String ShaderCache::GetEntryPath(const SHA256Hash& key, bool hasReflection)
+	{
+		return SHADER_CACHE_DIR + ToHexString(key.Data, DIGEST_SIZE) + (hasReflection ? ".spvr" : ".spvc");
+	}
+}
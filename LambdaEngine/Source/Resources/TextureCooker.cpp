@@ -0,0 +1,533 @@
+#include "Resources/TextureCooker.h"
+#include "Resources/ResourceLoader.h"
+
+#include "Rendering/Core/API/GraphicsHelpers.h"
+
+#include "Memory/API/PlatformMemory.h"
+
+#include "Threading/API/ThreadPool.h"
+
+#include "Math/Math.h"
+
+#include "Utilities/FileUtilities.h"
+
+#include "Log/Log.h"
+
+#include <cfloat>
+#include <filesystem>
+#include <fstream>
+
+// Rows of blocks compressed by each job
+#define TEXTURE_COOKER_ROWS_PER_JOB 8
+
+#define DDS_MAGIC					0x20534444 // "DDS "
+#define DDS_FOURCC_DX10				0x30315844 // "DX10"
+#define DDS_FLAGS					(0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000)
+#define DDS_PIXEL_FORMAT_FOURCC		0x4
+#define DDS_CAPS					(0x8 | 0x1000 | 0x400000)
+#define DDS_DIMENSION_TEXTURE2D		3
+
+#define DXGI_FORMAT_R8G8B8A8_UNORM	28
+#define DXGI_FORMAT_BC1_UNORM		71
+#define DXGI_FORMAT_BC3_UNORM		77
+
+namespace LambdaEngine
+{
+	struct DDSPixelFormat
+	{
+		uint32 Size;
+		uint32 Flags;
+		uint32 FourCC;
+		uint32 RGBBitCount;
+		uint32 RBitMask;
+		uint32 GBitMask;
+		uint32 BBitMask;
+		uint32 ABitMask;
+	};
+
+	// The reserved words of the header carry what the engine needs to tell whether the texture is up to date
+#pragma pack(push, 1)
+	struct DDSHeader
+	{
+		uint32			Magic;
+		uint32			Size;
+		uint32			Flags;
+		uint32			Height;
+		uint32			Width;
+		uint32			PitchOrLinearSize;
+		uint32			Depth;
+		uint32			MipMapCount;
+		uint32			CookedMagic;
+		uint32			CookedVersion;
+		uint64			SourceSize;
+		int64			SourceWriteTime;
+		uint32			Reserved1[5];
+		DDSPixelFormat	PixelFormat;
+		uint32			Caps;
+		uint32			Caps2;
+		uint32			Caps3;
+		uint32			Caps4;
+		uint32			Reserved2;
+		uint32			DXGIFormat;
+		uint32			ResourceDimension;
+		uint32			MiscFlag;
+		uint32			ArraySize;
+		uint32			MiscFlags2;
+	};
+#pragma pack(pop)
+
+	static_assert(sizeof(DDSHeader) == 4 + 124 + 20);
+
+	static uint32 ConvertFormatToDXGI(EFormat format)
+	{
+		switch (format)
+		{
+		case EFormat::FORMAT_R8G8B8A8_UNORM:	return DXGI_FORMAT_R8G8B8A8_UNORM;
+		case EFormat::FORMAT_BC1_RGBA_UNORM:	return DXGI_FORMAT_BC1_UNORM;
+		case EFormat::FORMAT_BC3_UNORM:			return DXGI_FORMAT_BC3_UNORM;
+		default:								return 0;
+		}
+	}
+
+	static EFormat ConvertDXGIToFormat(uint32 dxgiFormat)
+	{
+		switch (dxgiFormat)
+		{
+		case DXGI_FORMAT_R8G8B8A8_UNORM:	return EFormat::FORMAT_R8G8B8A8_UNORM;
+		case DXGI_FORMAT_BC1_UNORM:			return EFormat::FORMAT_BC1_RGBA_UNORM;
+		case DXGI_FORMAT_BC3_UNORM:			return EFormat::FORMAT_BC3_UNORM;
+		default:							return EFormat::FORMAT_NONE;
+		}
+	}
+
+	static uint16 PackColor565(const glm::vec3& color)
+	{
+		const glm::vec3 clamped = glm::clamp(color, glm::vec3(0.0f), glm::vec3(255.0f));
+		const uint32 r = uint32(clamped.r * (31.0f / 255.0f) + 0.5f);
+		const uint32 g = uint32(clamped.g * (63.0f / 255.0f) + 0.5f);
+		const uint32 b = uint32(clamped.b * (31.0f / 255.0f) + 0.5f);
+		return uint16((r << 11) | (g << 5) | b);
+	}
+
+	static glm::vec3 UnpackColor565(uint16 color)
+	{
+		const uint32 r = (color >> 11) & 0x1f;
+		const uint32 g = (color >> 5) & 0x3f;
+		const uint32 b = color & 0x1f;
+		return glm::vec3(float32((r << 3) | (r >> 2)), float32((g << 2) | (g >> 4)), float32((b << 3) | (b >> 2)));
+	}
+
+	/*
+	* TextureCooker
+	*/
+
+	void TextureCooker::Cook(const byte* pPixels, uint32 width, uint32 height, bool isNormalMap, CookedTextureDesc& desc, TArray<byte>& data)
+	{
+		bool isOpaque = true;
+		const uint64 pixelCount = uint64(width) * height;
+		for (uint64 pixel = 0; pixel < pixelCount && isOpaque; pixel++)
+		{
+			isOpaque = pPixels[4 * pixel + 3] == 255;
+		}
+
+		if (isNormalMap)
+		{
+			desc.Format = EFormat::FORMAT_R8G8B8A8_UNORM;
+		}
+		else
+		{
+			desc.Format = isOpaque ? EFormat::FORMAT_BC1_RGBA_UNORM : EFormat::FORMAT_BC3_UNORM;
+		}
+
+		desc.Width		= width;
+		desc.Height		= height;
+		desc.Miplevels	= uint32(std::floor(std::log2(std::max(width, height)))) + 1u;
+
+		uint64 dataSize = 0;
+		for (uint32 miplevel = 0; miplevel < desc.Miplevels; miplevel++)
+		{
+			dataSize += TextureMiplevelSize(desc.Format, width, height, miplevel);
+		}
+
+		data.Resize(dataSize);
+
+		// Every miplevel is filtered from the uncompressed one above it
+		TArray<byte> miplevelPixels;
+		TArray<byte> nextMiplevelPixels;
+		miplevelPixels.Assign(pPixels, pPixels + 4 * pixelCount);
+
+		uint64 offset = 0;
+		for (uint32 miplevel = 0; miplevel < desc.Miplevels; miplevel++)
+		{
+			const uint32 mipWidth	= std::max(width >> miplevel, 1u);
+			const uint32 mipHeight	= std::max(height >> miplevel, 1u);
+			if (miplevel > 0)
+			{
+				const uint32 srcWidth	= std::max(width >> (miplevel - 1), 1u);
+				const uint32 srcHeight	= std::max(height >> (miplevel - 1), 1u);
+				nextMiplevelPixels.Resize(4u * mipWidth * mipHeight);
+				GenerateMiplevel(miplevelPixels.GetData(), srcWidth, srcHeight, isNormalMap, nextMiplevelPixels.GetData());
+				std::swap(miplevelPixels, nextMiplevelPixels);
+			}
+
+			if (IsBlockCompressedFormat(desc.Format))
+			{
+				CompressMiplevel(miplevelPixels.GetData(), mipWidth, mipHeight, desc.Format, data.GetData() + offset);
+			}
+			else
+			{
+				memcpy(data.GetData() + offset, miplevelPixels.GetData(), 4u * mipWidth * mipHeight);
+			}
+
+			offset += TextureMiplevelSize(desc.Format, width, height, miplevel);
+		}
+	}
+
+	bool TextureCooker::Write(const String& filepath, const CookedTextureDesc& desc, const TArray<byte>& data)
+	{
+		const std::filesystem::path directory = std::filesystem::path(filepath).parent_path();
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+
+		DDSHeader header = {};
+		header.Magic				= DDS_MAGIC;
+		header.Size					= 124;
+		header.Flags				= DDS_FLAGS;
+		header.Height				= desc.Height;
+		header.Width				= desc.Width;
+		header.PitchOrLinearSize	= uint32(TextureMiplevelSize(desc.Format, desc.Width, desc.Height, 0));
+		header.Depth				= 1;
+		header.MipMapCount			= desc.Miplevels;
+		header.CookedMagic			= COOKED_TEXTURE_MAGIC;
+		header.CookedVersion		= COOKED_TEXTURE_VERSION;
+		header.SourceSize			= desc.SourceSize;
+		header.SourceWriteTime		= desc.SourceWriteTime;
+		header.PixelFormat.Size		= sizeof(DDSPixelFormat);
+		header.PixelFormat.Flags	= DDS_PIXEL_FORMAT_FOURCC;
+		header.PixelFormat.FourCC	= DDS_FOURCC_DX10;
+		header.Caps					= DDS_CAPS;
+		header.DXGIFormat			= ConvertFormatToDXGI(desc.Format);
+		header.ResourceDimension	= DDS_DIMENSION_TEXTURE2D;
+		header.ArraySize			= 1;
+
+		// Several scenes can cook the same texture at once
+		AtomicFileWriter writer(filepath);
+		writer.Write(&header, sizeof(DDSHeader));
+		writer.Write(data.GetData(), data.GetSize());
+		if (!writer.Commit())
+		{
+			LOG_WARNING("[TextureCooker]: Failed to write \"%s\"", filepath.c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool TextureCooker::IsUpToDate(const String& filepath, uint64 sourceSize, int64 sourceWriteTime, int64 writeTime)
+	{
+		std::error_code error;
+		const int64 fileWriteTime = int64(std::filesystem::last_write_time(filepath, error).time_since_epoch().count());
+		if (error || fileWriteTime < writeTime)
+		{
+			return false;
+		}
+
+		DDSHeader header = {};
+		std::ifstream file(filepath, std::ifstream::in | std::ifstream::binary);
+		file.read(reinterpret_cast<char*>(&header), sizeof(DDSHeader));
+		return
+			file &&
+			header.Magic == DDS_MAGIC &&
+			header.CookedMagic == COOKED_TEXTURE_MAGIC &&
+			header.CookedVersion == COOKED_TEXTURE_VERSION &&
+			header.SourceSize == sourceSize &&
+			header.SourceWriteTime == sourceWriteTime;
+	}
+
+	Texture* TextureCooker::Load(const String& filepath, const String& name, uint64 sourceSize, int64 sourceWriteTime)
+	{
+		uint64 sizeInBytes = 0;
+		const void* pMapping = PlatformMemory::MapFile(filepath.c_str(), sizeInBytes);
+		if (pMapping == nullptr)
+		{
+			return nullptr;
+		}
+
+		DDSHeader header = {};
+		bool result = sizeInBytes >= sizeof(DDSHeader);
+		if (result)
+		{
+			memcpy(&header, pMapping, sizeof(DDSHeader));
+			result =
+				header.Magic == DDS_MAGIC &&
+				header.CookedMagic == COOKED_TEXTURE_MAGIC &&
+				header.CookedVersion == COOKED_TEXTURE_VERSION &&
+				header.SourceSize == sourceSize &&
+				header.SourceWriteTime == sourceWriteTime &&
+				header.PixelFormat.FourCC == DDS_FOURCC_DX10 &&
+				header.Width > 0 &&
+				header.Height > 0 &&
+				header.MipMapCount > 0 &&
+				header.MipMapCount <= uint32(std::floor(std::log2(std::max(header.Width, header.Height)))) + 1u;
+		}
+
+		const EFormat format = result ? ConvertDXGIToFormat(header.DXGIFormat) : EFormat::FORMAT_NONE;
+		if (format != EFormat::FORMAT_NONE)
+		{
+			uint64 dataSize = 0;
+			for (uint32 miplevel = 0; miplevel < header.MipMapCount; miplevel++)
+			{
+				dataSize += TextureMiplevelSize(format, header.Width, header.Height, miplevel);
+			}
+
+			result = sizeInBytes - sizeof(DDSHeader) >= dataSize;
+		}
+		else
+		{
+			result = false;
+		}
+
+		Texture* pTexture = nullptr;
+		if (result)
+		{
+			const byte* pData = reinterpret_cast<const byte*>(pMapping) + sizeof(DDSHeader);
+			pTexture = ResourceLoader::LoadTextureMiplevelsFromMemory(name, pData, header.Width, header.Height, header.MipMapCount, format);
+		}
+
+		PlatformMemory::UnmapFile(pMapping, sizeInBytes);
+		return pTexture;
+	}
+
+	void TextureCooker::GenerateMiplevel(const byte* pSrc, uint32 srcWidth, uint32 srcHeight, bool isNormalMap, byte* pDst)
+	{
+		const uint32 dstWidth	= std::max(srcWidth >> 1, 1u);
+		const uint32 dstHeight	= std::max(srcHeight >> 1, 1u);
+
+		for (uint32 y = 0; y < dstHeight; y++)
+		{
+			const uint32 y0 = std::min(2 * y, srcHeight - 1);
+			const uint32 y1 = std::min(2 * y + 1, srcHeight - 1);
+			for (uint32 x = 0; x < dstWidth; x++)
+			{
+				const uint32 x0 = std::min(2 * x, srcWidth - 1);
+				const uint32 x1 = std::min(2 * x + 1, srcWidth - 1);
+
+				const byte* pTexels[4] =
+				{
+					pSrc + 4 * (y0 * srcWidth + x0),
+					pSrc + 4 * (y0 * srcWidth + x1),
+					pSrc + 4 * (y1 * srcWidth + x0),
+					pSrc + 4 * (y1 * srcWidth + x1),
+				};
+
+				byte* pTexel = pDst + 4 * (y * dstWidth + x);
+				if (isNormalMap)
+				{
+					// Averaged normals are shorter than one, which would make the lower miplevels look flat
+					glm::vec3 normal(0.0f);
+					for (const byte* pSrcTexel : pTexels)
+					{
+						normal += glm::vec3(pSrcTexel[0], pSrcTexel[1], pSrcTexel[2]) / 127.5f - 1.0f;
+					}
+
+					const float32 length = glm::length(normal);
+					normal = length > 0.0f ? normal / length : glm::vec3(0.0f, 0.0f, 1.0f);
+					normal = (normal + 1.0f) * 127.5f + 0.5f;
+
+					pTexel[0] = byte(glm::clamp(normal.x, 0.0f, 255.0f));
+					pTexel[1] = byte(glm::clamp(normal.y, 0.0f, 255.0f));
+					pTexel[2] = byte(glm::clamp(normal.z, 0.0f, 255.0f));
+					pTexel[3] = byte((uint32(pTexels[0][3]) + pTexels[1][3] + pTexels[2][3] + pTexels[3][3] + 2) / 4);
+				}
+				else
+				{
+					for (uint32 c = 0; c < 4; c++)
+					{
+						pTexel[c] = byte((uint32(pTexels[0][c]) + pTexels[1][c] + pTexels[2][c] + pTexels[3][c] + 2) / 4);
+					}
+				}
+			}
+		}
+	}
+
+	void TextureCooker::CompressMiplevel(const byte* pPixels, uint32 width, uint32 height, EFormat format, byte* pDst)
+	{
+		const uint32 blockCountX	= (width + 3) / 4;
+		const uint32 blockCountY	= (height + 3) / 4;
+		const uint32 blockSize		= TextureFormatBlockSize(format);
+
+		// Blocks are independent, so rows of blocks are compressed on the thread pool
+		JobCounter compressJobs;
+		for (uint32 rowStart = 0; rowStart < blockCountY; rowStart += TEXTURE_COOKER_ROWS_PER_JOB)
+		{
+			const uint32 rowEnd = std::min(rowStart + TEXTURE_COOKER_ROWS_PER_JOB, blockCountY);
+			ThreadPool::Execute(compressJobs, [pPixels, width, height, format, pDst, blockCountX, blockSize, rowStart, rowEnd]
+			{
+				byte block[64];
+				for (uint32 blockY = rowStart; blockY < rowEnd; blockY++)
+				{
+					for (uint32 blockX = 0; blockX < blockCountX; blockX++)
+					{
+						// Blocks that hang over the edge repeat the last row and column
+						for (uint32 y = 0; y < 4; y++)
+						{
+							const uint32 srcY = std::min(blockY * 4 + y, height - 1);
+							for (uint32 x = 0; x < 4; x++)
+							{
+								const uint32 srcX = std::min(blockX * 4 + x, width - 1);
+								memcpy(block + 4 * (y * 4 + x), pPixels + 4 * (srcY * width + srcX), 4);
+							}
+						}
+
+						byte* pBlockDst = pDst + uint64(blockY * blockCountX + blockX) * blockSize;
+						if (format == EFormat::FORMAT_BC3_UNORM)
+						{
+							CompressAlphaBlock(block, pBlockDst);
+							pBlockDst += 8;
+						}
+
+						CompressColorBlock(block, pBlockDst);
+					}
+				}
+			});
+		}
+
+		ThreadPool::Wait(compressJobs);
+	}
+
+	void TextureCooker::CompressColorBlock(const byte* pBlock, byte* pDst)
+	{
+		glm::vec3 colors[16];
+		glm::vec3 mean(0.0f);
+		for (uint32 i = 0; i < 16; i++)
+		{
+			colors[i] = glm::vec3(pBlock[4 * i + 0], pBlock[4 * i + 1], pBlock[4 * i + 2]);
+			mean += colors[i];
+		}
+
+		mean /= 16.0f;
+
+		// The endpoints are placed along the principal axis of the colors, found by power iteration on the covariance
+		glm::mat3 covariance(0.0f);
+		for (const glm::vec3& color : colors)
+		{
+			const glm::vec3 delta = color - mean;
+			covariance += glm::outerProduct(delta, delta);
+		}
+
+		glm::vec3 axis(1.0f, 1.0f, 1.0f);
+		for (uint32 iteration = 0; iteration < 8; iteration++)
+		{
+			axis = covariance * axis;
+			const float32 length = glm::length(axis);
+			if (length < 1e-6f)
+			{
+				axis = glm::vec3(0.0f);
+				break;
+			}
+
+			axis /= length;
+		}
+
+		float32 minT = 0.0f;
+		float32 maxT = 0.0f;
+		for (const glm::vec3& color : colors)
+		{
+			const float32 t = glm::dot(color - mean, axis);
+			minT = std::min(minT, t);
+			maxT = std::max(maxT, t);
+		}
+
+		// Pulling the endpoints in slightly lowers the error for the colors between them
+		const float32 inset = (maxT - minT) / 16.0f;
+		uint16 color0 = PackColor565(mean + axis * (maxT - inset));
+		uint16 color1 = PackColor565(mean + axis * (minT + inset));
+		if (color0 < color1)
+		{
+			std::swap(color0, color1);
+		}
+
+		// Equal endpoints would select the three color mode, every texel then uses the first endpoint
+		uint32 indices = 0;
+		if (color0 != color1)
+		{
+			const glm::vec3 palette[4] =
+			{
+				UnpackColor565(color0),
+				UnpackColor565(color1),
+				(UnpackColor565(color0) * 2.0f + UnpackColor565(color1)) / 3.0f,
+				(UnpackColor565(color0) + UnpackColor565(color1) * 2.0f) / 3.0f,
+			};
+
+			for (uint32 i = 0; i < 16; i++)
+			{
+				uint32 bestIndex = 0;
+				float32 bestDistance = FLT_MAX;
+				for (uint32 index = 0; index < 4; index++)
+				{
+					const glm::vec3 delta = colors[i] - palette[index];
+					const float32 distance = glm::dot(delta, delta);
+					if (distance < bestDistance)
+					{
+						bestDistance	= distance;
+						bestIndex		= index;
+					}
+				}
+
+				indices |= bestIndex << (2 * i);
+			}
+		}
+
+		memcpy(pDst + 0, &color0, sizeof(uint16));
+		memcpy(pDst + 2, &color1, sizeof(uint16));
+		memcpy(pDst + 4, &indices, sizeof(uint32));
+	}
+
+	void TextureCooker::CompressAlphaBlock(const byte* pBlock, byte* pDst)
+	{
+		uint32 alpha0 = 0;
+		uint32 alpha1 = 255;
+		for (uint32 i = 0; i < 16; i++)
+		{
+			alpha0 = std::max<uint32>(alpha0, pBlock[4 * i + 3]);
+			alpha1 = std::min<uint32>(alpha1, pBlock[4 * i + 3]);
+		}
+
+		// With the first endpoint larger the block uses eight interpolated alphas instead of six
+		uint64 indices = 0;
+		if (alpha0 != alpha1)
+		{
+			uint32 palette[8] = { alpha0, alpha1 };
+			for (uint32 index = 1; index < 7; index++)
+			{
+				palette[index + 1] = ((7 - index) * alpha0 + index * alpha1 + 3) / 7;
+			}
+
+			for (uint32 i = 0; i < 16; i++)
+			{
+				const int32 alpha = pBlock[4 * i + 3];
+
+				uint64 bestIndex = 0;
+				int32 bestDistance = INT32_MAX;
+				for (uint32 index = 0; index < 8; index++)
+				{
+					const int32 distance = std::abs(alpha - int32(palette[index]));
+					if (distance < bestDistance)
+					{
+						bestDistance	= distance;
+						bestIndex		= index;
+					}
+				}
+
+				indices |= bestIndex << (3 * i);
+			}
+		}
+
+		pDst[0] = byte(alpha0);
+		pDst[1] = byte(alpha1);
+		for (uint32 i = 0; i < 6; i++)
+		{
+			pDst[2 + i] = byte(indices >> (8 * i));
+		}
+	}
+}
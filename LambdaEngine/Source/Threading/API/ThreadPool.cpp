@@ -1,23 +1,56 @@
 #include "Threading/API/ThreadPool.h"
+#include "Threading/API/MPMCQueue.h"
 #include "Threading/API/PlatformThread.h"
+#include "Threading/API/WorkStealingQueue.h"
 
 #include "Log/Log.h"
 
+#include <algorithm>
+
 // In case hardware_concurrency() returns 0, this is the default amount of threads the thread pool will start
 #define MIN_THREADS 4u
 
+// Amount of jobs each scheduling thread can have in flight before its ring of jobs wraps around
+#define JOB_POOL_SIZE 2048u
+
+// Amount of join counters available through Execute(function)
+#define MAX_JOIN_COUNTERS 4096u
+
+// Amount of failed attempts to find a job before a worker goes to sleep
+#define IDLE_SPIN_COUNT 64u
+
 namespace LambdaEngine
 {
+	struct ThreadJobPool
+	{
+		ThreadJob Jobs[JOB_POOL_SIZE];
+		uint32 NextJob = 0;
+	};
+
 	TArray<std::thread> ThreadPool::s_Threads;
-	std::queue<ThreadJob> ThreadPool::s_Jobs;
-	std::condition_variable ThreadPool::s_JobsExist;
+	TArray<TWorkStealingQueue<ThreadJob, 4096>*> ThreadPool::s_WorkerQueues;
+	TMPMCQueue<ThreadJob*, 4096>* ThreadPool::s_pSharedQueue = nullptr;
+
+	TArray<ThreadJobPool*> ThreadPool::s_JobPools;
+	SpinLock ThreadPool::s_JobPoolLock;
+	std::atomic_uint32_t ThreadPool::s_JobPoolGeneration = 0;
+	thread_local ThreadJobPool* ThreadPool::s_pThreadJobPool = nullptr;
+	thread_local uint32 ThreadPool::s_ThreadJobPoolGeneration = 0;
+	thread_local uint32 ThreadPool::s_WorkerIndex = UINT32_MAX;
+
+	JobCounter* ThreadPool::s_pJoinCounters = nullptr;
+	TArray<uint32> ThreadPool::s_FreeJoinCounterIndices;
+	SpinLock ThreadPool::s_JoinCounterLock;
 
-	// Pool of join resources to each thread job. Expanded upon need.
-	TArray<JoinResources*> ThreadPool::s_JoinResources;
-	TArray<uint32> ThreadPool::s_FreeJoinResourcesIndices;
-	std::mutex ThreadPool::s_ScheduleLock;
+	std::atomic_uint32_t ThreadPool::s_QueuedJobCount = 0;
+	std::atomic_uint32_t ThreadPool::s_PendingJobCount = 0;
+	std::atomic_uint32_t ThreadPool::s_ActiveThreadCount = 0;
 
-	bool ThreadPool::s_TimeToTerminate = false;
+	std::atomic_uint32_t ThreadPool::s_SleepingThreadCount = 0;
+	std::mutex ThreadPool::s_SleepLock;
+	std::condition_variable ThreadPool::s_WakeCondition;
+
+	std::atomic_bool ThreadPool::s_TimeToTerminate = false;
 
 	bool ThreadPool::Init()
 	{
@@ -25,21 +58,30 @@ namespace LambdaEngine
 		unsigned int hwConc = std::thread::hardware_concurrency();
 		unsigned int threadCount = hwConc ? hwConc : MIN_THREADS;
 
-		s_Threads.Reserve(threadCount);
-		for (uint32 threadIdx = 0u; threadIdx < threadCount; threadIdx++)
+		s_TimeToTerminate = false;
+		s_ActiveThreadCount = threadCount;
+		s_pSharedQueue = DBG_NEW TMPMCQueue<ThreadJob*, 4096>();
+
+		s_pJoinCounters = DBG_NEW JobCounter[MAX_JOIN_COUNTERS];
+		s_FreeJoinCounterIndices.Resize(MAX_JOIN_COUNTERS);
+		for (uint32 counterIdx = 0u; counterIdx < MAX_JOIN_COUNTERS; counterIdx++)
 		{
-			std::thread& thread = s_Threads.EmplaceBack(std::thread(&ThreadPool::WaitForJob));
-			PlatformThread::SetThreadName(PlatformThread::GetThreadHandle(thread), "ThreadPool" + std::to_string(threadIdx));
+			// Hand out low indices first
+			s_FreeJoinCounterIndices[counterIdx] = MAX_JOIN_COUNTERS - counterIdx - 1u;
 		}
 
-		s_JoinResources.Resize(s_Threads.GetSize() * 2u);
-		s_FreeJoinResourcesIndices.Resize(s_JoinResources.GetSize());
+		// All queues have to exist before any worker starts stealing
+		s_WorkerQueues.Reserve(threadCount);
+		for (uint32 threadIdx = 0u; threadIdx < threadCount; threadIdx++)
+		{
+			s_WorkerQueues.PushBack(DBG_NEW TWorkStealingQueue<ThreadJob, 4096>());
+		}
 
-		for (uint32 threadHandleIdx = 0u; threadHandleIdx < s_JoinResources.GetSize(); threadHandleIdx++)
+		s_Threads.Reserve(threadCount);
+		for (uint32 threadIdx = 0u; threadIdx < threadCount; threadIdx++)
 		{
-			s_JoinResources[threadHandleIdx] = DBG_NEW JoinResources();
-			s_JoinResources[threadHandleIdx]->FinishSignal = false;
-			s_FreeJoinResourcesIndices[threadHandleIdx] = threadHandleIdx;
+			std::thread& thread = s_Threads.EmplaceBack(std::thread(&ThreadPool::WorkerLoop, threadIdx));
+			PlatformThread::SetThreadName(PlatformThread::GetThreadHandle(thread), "ThreadPool" + std::to_string(threadIdx));
 		}
 
 		LOG_INFO("Started thread pool with %ld threads", threadCount);
@@ -50,106 +92,275 @@ namespace LambdaEngine
 	{
 		JoinAll();
 
-		s_ScheduleLock.lock();
-		s_TimeToTerminate = true;
-		s_JobsExist.notify_all();
-		s_ScheduleLock.unlock();
+		{
+			std::scoped_lock<std::mutex> lock(s_SleepLock);
+			s_TimeToTerminate = true;
+		}
+
+		s_WakeCondition.notify_all();
 
 		for (std::thread& thread : s_Threads)
 		{
 			thread.join();
 		}
 
-		for (JoinResources* pJoinResources : s_JoinResources)
+		s_Threads.Clear();
+
+		for (TWorkStealingQueue<ThreadJob, 4096>* pQueue : s_WorkerQueues)
 		{
-			delete pJoinResources;
+			SAFEDELETE(pQueue);
 		}
 
+		s_WorkerQueues.Clear();
+		SAFEDELETE(s_pSharedQueue);
+
+		for (ThreadJobPool* pJobPool : s_JobPools)
+		{
+			SAFEDELETE(pJobPool);
+		}
+
+		s_JobPools.Clear();
+		s_pThreadJobPool = nullptr;
+		s_JobPoolGeneration.fetch_add(1, std::memory_order_relaxed);
+
+		SAFEDELETE_ARRAY(s_pJoinCounters);
+		s_FreeJoinCounterIndices.Clear();
+
 		return true;
 	}
 
-	uint32 ThreadPool::Execute(std::function<void()> job)
+	void ThreadPool::Wait(const JobCounter& counter)
 	{
-		s_ScheduleLock.lock();
-		uint32 joinResourceIdx = 0u;
-		if (s_FreeJoinResourcesIndices.IsEmpty())
+		while (counter.Value.load(std::memory_order_acquire) > 0)
 		{
-			// Create new join resources
-			joinResourceIdx = s_JoinResources.GetSize();
-			s_JoinResources.EmplaceBack(DBG_NEW JoinResources());
-		} else
+			if (!ExecuteNextJob())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void ThreadPool::Join(uint32 joinCounterIndex)
+	{
+		Wait(s_pJoinCounters[joinCounterIndex]);
+
+		std::scoped_lock<SpinLock> lock(s_JoinCounterLock);
+		s_FreeJoinCounterIndices.PushBack(joinCounterIndex);
+	}
+
+	void ThreadPool::JoinAll()
+	{
+		while (s_PendingJobCount.load(std::memory_order_acquire) > 0)
 		{
-			joinResourceIdx = s_FreeJoinResourcesIndices.GetBack();
-			s_FreeJoinResourcesIndices.PopBack();
+			if (!ExecuteNextJob())
+			{
+				std::this_thread::yield();
+			}
 		}
+	}
 
-		s_JoinResources[joinResourceIdx]->FinishSignal = false;
-		s_Jobs.push({ job, joinResourceIdx });
-		s_JobsExist.notify_one();
-		s_ScheduleLock.unlock();
+	void ThreadPool::SetActiveThreadCount(uint32 threadCount)
+	{
+		threadCount = std::clamp(threadCount, 1u, s_Threads.GetSize());
 
-		return joinResourceIdx;
+		{
+			std::scoped_lock<std::mutex> lock(s_SleepLock);
+			s_ActiveThreadCount = threadCount;
+		}
+
+		s_WakeCondition.notify_all();
 	}
 
-	void ThreadPool::ExecuteDetached(std::function<void()> job)
+	ThreadJob* ThreadPool::AllocateJob()
 	{
-		s_ScheduleLock.lock();
-		s_Jobs.push({ job, UINT32_MAX });
-		s_JobsExist.notify_one();
-		s_ScheduleLock.unlock();
+		// The pool of a thread that scheduled jobs before the thread pool was released has been deleted
+		const uint32 generation = s_JobPoolGeneration.load(std::memory_order_relaxed);
+		ThreadJobPool* pJobPool = s_ThreadJobPoolGeneration == generation ? s_pThreadJobPool : nullptr;
+		if (!pJobPool)
+		{
+			pJobPool = DBG_NEW ThreadJobPool();
+			for (ThreadJob& job : pJobPool->Jobs)
+			{
+				job.IsInFlight.store(0, std::memory_order_relaxed);
+			}
+
+			std::scoped_lock<SpinLock> lock(s_JobPoolLock);
+			s_JobPools.PushBack(pJobPool);
+			s_pThreadJobPool = pJobPool;
+			s_ThreadJobPoolGeneration = generation;
+		}
+
+		// Skip jobs that are still in flight, they might be waiting further down on this thread's stack
+		while (true)
+		{
+			for (uint32 attempt = 0u; attempt < JOB_POOL_SIZE; attempt++)
+			{
+				ThreadJob* pJob = &pJobPool->Jobs[pJobPool->NextJob % JOB_POOL_SIZE];
+				pJobPool->NextJob++;
+
+				if (!pJob->IsInFlight.load(std::memory_order_acquire))
+				{
+					pJob->IsInFlight.store(1, std::memory_order_relaxed);
+					return pJob;
+				}
+			}
+
+			// Every job in the ring is in flight, help out until one has finished
+			if (!ExecuteNextJob())
+			{
+				std::this_thread::yield();
+			}
+		}
 	}
 
-	void ThreadPool::Join(uint32 joinResourcesIndex)
+	uint32 ThreadPool::AllocateJoinCounter()
 	{
-		JoinResources* pJoinResources = s_JoinResources[joinResourcesIndex];
-		std::unique_lock<std::mutex> uLock(pJoinResources->Mutex);
-		pJoinResources->CondVar.wait(uLock, [pJoinResources]{ return pJoinResources->FinishSignal; });
-
-		// Free the join resources
-		s_ScheduleLock.lock();
-		s_FreeJoinResourcesIndices.PushBack(joinResourcesIndex);
-		s_ScheduleLock.unlock();
+		s_JoinCounterLock.lock();
+		while (s_FreeJoinCounterIndices.IsEmpty())
+		{
+			// Every counter has an unjoined job, help out until one is returned
+			s_JoinCounterLock.unlock();
+			if (!ExecuteNextJob())
+			{
+				std::this_thread::yield();
+			}
+
+			s_JoinCounterLock.lock();
+		}
+
+		const uint32 joinCounterIdx = s_FreeJoinCounterIndices.GetBack();
+		s_FreeJoinCounterIndices.PopBack();
+		s_JoinCounterLock.unlock();
+
+		return joinCounterIdx;
 	}
 
-	void ThreadPool::JoinAll()
+	void ThreadPool::Submit(ThreadJob* pJob)
 	{
-		// Wait for all jobs to finish
-		std::unique_lock<std::mutex> uLock(s_ScheduleLock);
-		s_JobsExist.wait(uLock, []{ return s_Jobs.empty() && s_FreeJoinResourcesIndices.GetSize() == s_JoinResources.GetSize(); });
+		s_PendingJobCount.fetch_add(1, std::memory_order_acq_rel);
+		s_QueuedJobCount.fetch_add(1, std::memory_order_seq_cst);
+
+		const uint32 workerIndex = s_WorkerIndex;
+		const bool pushedLocally = workerIndex != UINT32_MAX && s_WorkerQueues[workerIndex]->Push(pJob);
+		if (!pushedLocally && !s_pSharedQueue->Enqueue(pJob))
+		{
+			// Every queue is full, run the job right away rather than blocking
+			s_QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+			ExecuteJob(pJob);
+			return;
+		}
+
+		if (s_SleepingThreadCount.load(std::memory_order_seq_cst) > 0)
+		{
+			std::scoped_lock<std::mutex> lock(s_SleepLock);
+			if (s_ActiveThreadCount.load(std::memory_order_relaxed) < s_Threads.GetSize())
+			{
+				// Parked workers share the condition variable, make sure an active worker is woken up
+				s_WakeCondition.notify_all();
+			}
+			else
+			{
+				s_WakeCondition.notify_one();
+			}
+		}
 	}
 
-	void ThreadPool::WaitForJob()
+	bool ThreadPool::ExecuteNextJob()
 	{
-		std::unique_lock<std::mutex> uLock(s_ScheduleLock);
-		while (true)
+		ThreadJob* pJob = FindJob();
+		if (pJob)
 		{
-			s_JobsExist.wait(uLock, []{ return !s_Jobs.empty() || s_TimeToTerminate; });
+			s_QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+			ExecuteJob(pJob);
+			return true;
+		}
 
-			if (!s_Jobs.empty())
+		return false;
+	}
+
+	ThreadJob* ThreadPool::FindJob()
+	{
+		const uint32 workerIndex = s_WorkerIndex;
+		ThreadJob* pJob = nullptr;
+		if (workerIndex != UINT32_MAX)
+		{
+			pJob = s_WorkerQueues[workerIndex]->Pop();
+			if (pJob)
 			{
-				ThreadJob threadJob = s_Jobs.front();
-				s_Jobs.pop();
+				return pJob;
+			}
+		}
 
-				s_ScheduleLock.unlock();
-				threadJob.Function();
-				s_ScheduleLock.lock();
+		if (s_pSharedQueue->Dequeue(pJob))
+		{
+			return pJob;
+		}
 
-				// Notify joining threads that the job is finished
-				if (threadJob.JoinResourcesIndex != UINT32_MAX)
+		// Steal from the other workers, starting next to ourselves to spread out the contention
+		const uint32 queueCount = s_WorkerQueues.GetSize();
+		const uint32 startIndex = workerIndex != UINT32_MAX ? workerIndex + 1u : 0u;
+		for (uint32 offset = 0u; offset < queueCount; offset++)
+		{
+			const uint32 victimIndex = (startIndex + offset) % queueCount;
+			if (victimIndex != workerIndex)
+			{
+				pJob = s_WorkerQueues[victimIndex]->Steal();
+				if (pJob)
 				{
-					JoinResources* pJoinResources = s_JoinResources[threadJob.JoinResourcesIndex];
-
-					pJoinResources->Mutex.lock();
-					pJoinResources->FinishSignal = true;
-					pJoinResources->CondVar.notify_all();
-					pJoinResources->Mutex.unlock();
+					return pJob;
 				}
 			}
+		}
+
+		return nullptr;
+	}
+
+	void ThreadPool::ExecuteJob(ThreadJob* pJob)
+	{
+		pJob->pInvoke(pJob->Storage);
+		pJob->pDestroy(pJob->Storage);
+
+		JobCounter* pCounter = pJob->pCounter;
+		pJob->IsInFlight.store(0, std::memory_order_release);
+
+		if (pCounter)
+		{
+			pCounter->Value.fetch_sub(1, std::memory_order_acq_rel);
+		}
+
+		s_PendingJobCount.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	void ThreadPool::WorkerLoop(uint32 workerIndex)
+	{
+		s_WorkerIndex = workerIndex;
+
+		uint32 idleSpins = 0u;
+		while (!s_TimeToTerminate.load(std::memory_order_acquire))
+		{
+			const bool isActive = workerIndex < s_ActiveThreadCount.load(std::memory_order_relaxed);
+			if (isActive && ExecuteNextJob())
+			{
+				idleSpins = 0u;
+				continue;
+			}
 
-			if (s_TimeToTerminate)
+			if (isActive && ++idleSpins < IDLE_SPIN_COUNT)
 			{
-				break;
+				std::this_thread::yield();
+				continue;
 			}
+
+			std::unique_lock<std::mutex> uLock(s_SleepLock);
+			s_SleepingThreadCount.fetch_add(1, std::memory_order_seq_cst);
+			s_WakeCondition.wait(uLock, [workerIndex]
+			{
+				const bool canWork = workerIndex < s_ActiveThreadCount.load(std::memory_order_relaxed);
+				return s_TimeToTerminate.load(std::memory_order_relaxed) || (canWork && s_QueuedJobCount.load(std::memory_order_seq_cst) > 0);
+			});
+
+			s_SleepingThreadCount.fetch_sub(1, std::memory_order_relaxed);
+			idleSpins = 0u;
 		}
 	}
 }
@@ -0,0 +1,53 @@
+#ifdef LAMBDA_PLATFORM_LINUX
+#include "Threading/Linux/LinuxThread.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <thread>
+
+namespace LambdaEngine
+{
+	/*
+	* LinuxThread
+	*/
+
+	ThreadHandle LinuxThread::GetCurrentThreadHandle()
+	{
+		return reinterpret_cast<void*>(pthread_self());
+	}
+
+	ThreadHandle LinuxThread::GetThreadHandle(std::thread& thread)
+	{
+		std::thread::native_handle_type threadID = thread.native_handle();
+		return reinterpret_cast<void*>(threadID);
+	}
+
+	bool LinuxThread::SetThreadName(ThreadHandle threadID, const String& name)
+	{
+		constexpr size_t MAX_NAME_LENGTH = 15;
+
+		pthread_t	thread			= reinterpret_cast<pthread_t>(threadID);
+		String		truncatedName	= name.substr(0, MAX_NAME_LENGTH);
+		return pthread_setname_np(thread, truncatedName.c_str()) == 0;
+	}
+
+	bool LinuxThread::SetThreadAffinity(ThreadHandle threadID, uint64 affinityMask)
+	{
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		for (uint32 core = 0; core < 64; core++)
+		{
+			if (affinityMask & (1ull << core))
+			{
+				CPU_SET(core, &cpuSet);
+			}
+		}
+
+		pthread_t thread = reinterpret_cast<pthread_t>(threadID);
+		return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet) == 0;
+	}
+}
+
+#endif
@@ -0,0 +1,81 @@
+#include "Utilities/FileUtilities.h"
+
+#include <filesystem>
+#include <random>
+
+namespace LambdaEngine
+{
+	/*
+	* AtomicFileWriter
+	*/
+
+	static String CreateTempFilepath(const String& filepath)
+	{
+		// Seeded per thread, the random suffix keeps writers in other processes apart as well
+		thread_local std::mt19937_64 s_Generator(std::random_device{}());
+		const uint64 suffix = s_Generator();
+		return filepath + "." + ToHexString(&suffix, sizeof(suffix)) + ".tmp";
+	}
+
+	AtomicFileWriter::AtomicFileWriter(const String& filepath)
+		: m_Filepath(filepath)
+		, m_TempFilepath(CreateTempFilepath(filepath))
+		, m_File(m_TempFilepath, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc)
+	{
+	}
+
+	AtomicFileWriter::~AtomicFileWriter()
+	{
+		if (!m_IsCommitted)
+		{
+			m_File.close();
+
+			std::error_code error;
+			std::filesystem::remove(m_TempFilepath, error);
+		}
+	}
+
+	void AtomicFileWriter::Write(const void* pData, uint64 sizeInBytes)
+	{
+		m_File.write(reinterpret_cast<const char*>(pData), std::streamsize(sizeInBytes));
+	}
+
+	bool AtomicFileWriter::Commit()
+	{
+		m_File.close();
+		if (!m_File)
+		{
+			return false;
+		}
+
+		std::error_code error;
+		std::filesystem::rename(m_TempFilepath, m_Filepath, error);
+		if (error)
+		{
+			return false;
+		}
+
+		m_IsCommitted = true;
+		return true;
+	}
+
+	/*
+	* Helpers
+	*/
+
+	String ToHexString(const void* pData, uint64 sizeInBytes)
+	{
+		constexpr const char* HEX_DIGITS = "0123456789abcdef";
+
+		const byte* pBytes = reinterpret_cast<const byte*>(pData);
+		String result;
+		result.reserve(sizeInBytes * 2);
+		for (uint64 i = 0; i < sizeInBytes; i++)
+		{
+			result += HEX_DIGITS[pBytes[i] >> 4];
+			result += HEX_DIGITS[pBytes[i] & 0xf];
+		}
+
+		return result;
+	}
+}
@@ -169,6 +169,12 @@ workspace "LambdaEngine"
 			"LAMBDA_PLATFORM_WINDOWS",
 		}
 
+	filter "system:linux"
+		defines
+		{
+			"LAMBDA_PLATFORM_LINUX",
+		}
+
 	filter "system:macosx or windows"
 		defines
 		{
@@ -278,11 +284,23 @@ workspace "LambdaEngine"
 				"%{prj.name}/Include/Networking/Mac/**",
 				"%{prj.name}/Source/Networking/Mac/**",
 
+				"%{prj.name}/Include/Networking/Linux/**",
+				"%{prj.name}/Source/Networking/Linux/**",
+
 				"%{prj.name}/Include/Threading/Mac/**",
 				"%{prj.name}/Source/Threading/Mac/**",
 
 				"%{prj.name}/Include/Memory/Mac/**",
 				"%{prj.name}/Source/Memory/Mac/**",
+
+				"%{prj.name}/Include/Application/Linux/**",
+				"%{prj.name}/Source/Application/Linux/**",
+
+				"%{prj.name}/Include/Threading/Linux/**",
+				"%{prj.name}/Source/Threading/Linux/**",
+
+				"%{prj.name}/Include/Memory/Linux/**",
+				"%{prj.name}/Source/Memory/Linux/**",
 			}
 		-- Remove files not available for macos builds
 		filter "system:macosx"
@@ -307,6 +325,52 @@ workspace "LambdaEngine"
 
 				"%{prj.name}/Include/Memory/Win32/**",
 				"%{prj.name}/Source/Memory/Win32/**",
+
+				"%{prj.name}/Include/Networking/Linux/**",
+				"%{prj.name}/Source/Networking/Linux/**",
+
+				"%{prj.name}/Include/Application/Linux/**",
+				"%{prj.name}/Source/Application/Linux/**",
+
+				"%{prj.name}/Include/Threading/Linux/**",
+				"%{prj.name}/Source/Threading/Linux/**",
+
+				"%{prj.name}/Include/Memory/Linux/**",
+				"%{prj.name}/Source/Memory/Linux/**",
+			}
+		-- Remove files not available for linux builds, linux only builds the headless dedicated server
+		filter "system:linux"
+			removefiles
+			{
+				"%{prj.name}/Include/Application/Win32/**",
+				"%{prj.name}/Source/Application/Win32/**",
+
+				"%{prj.name}/Include/Application/Mac/**",
+				"%{prj.name}/Source/Application/Mac/**",
+
+				"%{prj.name}/Include/Input/Win32/**",
+				"%{prj.name}/Source/Input/Win32/**",
+
+				"%{prj.name}/Include/Input/Mac/**",
+				"%{prj.name}/Source/Input/Mac/**",
+
+				"%{prj.name}/Include/Networking/Win32/**",
+				"%{prj.name}/Source/Networking/Win32/**",
+
+				"%{prj.name}/Include/Networking/Mac/**",
+				"%{prj.name}/Source/Networking/Mac/**",
+
+				"%{prj.name}/Include/Threading/Win32/**",
+				"%{prj.name}/Source/Threading/Win32/**",
+
+				"%{prj.name}/Include/Threading/Mac/**",
+				"%{prj.name}/Source/Threading/Mac/**",
+
+				"%{prj.name}/Include/Memory/Win32/**",
+				"%{prj.name}/Source/Memory/Win32/**",
+
+				"%{prj.name}/Include/Memory/Mac/**",
+				"%{prj.name}/Source/Memory/Mac/**",
 			}
 		filter {}
 
@@ -484,6 +548,41 @@ workspace "LambdaEngine"
 				"Cocoa.framework",
 				"MetalKit.framework",
 			}
+		-- Linux
+		filter { "system:linux" }
+			libdirs
+			{
+				"/usr/local/lib",
+				"../FMODProgrammersAPI/api/core/lib/x86_64",
+			}
+
+			sysincludedirs
+			{
+				"/usr/local/include",
+				"../FMODProgrammersAPI/api/core/inc",
+			}
+
+			links
+			{
+				-- Vulkan
+				"vulkan",
+
+				-- Audio
+				"fmod",
+
+				-- Shader Compilation
+				"glslang",
+				"SPIRV",
+				"SPIRV-Tools",
+				"SPIRV-Tools-opt",
+				"OSDependent",
+				"OGLCompiler",
+				"HLSL",
+
+				-- Native
+				"pthread",
+				"dl",
+			}
 		filter {}
 
 		-- FMOD
@@ -619,6 +718,10 @@ workspace "LambdaEngine"
 	-- Server Project
 	project "Server"
 		kind "WindowedApp"
+		-- The linux server runs headless from a terminal
+		filter "system:linux"
+			kind "ConsoleApp"
+		filter {}
 		language "C++"
 		cppdialect "C++latest"
 		systemversion "latest"